@@ -0,0 +1,384 @@
+/*
+-------------------------------------------------------------------------------
+Name:
+	FMATH | Benchmark
+
+Description:
+	Console micro-benchmark comparing the scalar and the SIMD code paths of "final_math.h".
+	The SIMD backend is selected at compile time (SSE2/AVX/NEON), use FMATH_NO_SIMD to disable it.
+
+Requirements:
+	- C++/11 Compiler
+	- Final Platform Layer
+	- Final Math
+
+Author:
+	Torsten Spaete
+
+Changelog:
+	## 2026-10-18
+	- Added structure-of-arrays batch benchmarks
+	- Initial version
+
+License:
+	Copyright (c) 2017-2020 Torsten Spaete
+	MIT License (See LICENSE file)
+-------------------------------------------------------------------------------
+*/
+
+#define FPL_IMPLEMENTATION
+#define FPL_NO_WINDOW
+#define FPL_NO_VIDEO
+#define FPL_NO_AUDIO
+#include <final_platform_layer.h>
+
+#include <final_math.h>
+
+#define BENCH_ITEM_COUNT 4096
+#define BENCH_ITERATION_COUNT 256
+// Not a multiple of the SIMD width, so the remainder code path is covered as well
+#define BENCH_BATCH_COUNT (BENCH_ITEM_COUNT * 4 + 3)
+
+static float RandomFloat(uint32_t *state) {
+	*state = *state * 1664525u + 1013904223u;
+	float result = ((*state >> 8) / (float)(1 << 24)) * 2.0f - 1.0f;
+	return(result);
+}
+
+static float MaxDifference(const float *a, const float *b, const size_t count) {
+	float result = 0.0f;
+	for (size_t i = 0; i < count; ++i) {
+		result = Max(result, Abs(a[i] - b[i]));
+	}
+	return(result);
+}
+
+// Difference relative to the magnitude of the reference value a
+static float MaxRelativeDifference(const float *a, const float *b, const size_t count) {
+	float result = 0.0f;
+	for (size_t i = 0; i < count; ++i) {
+		float magnitude = Abs(a[i]);
+		if (magnitude > 0.0f) {
+			result = Max(result, Abs(a[i] - b[i]) / magnitude);
+		}
+	}
+	return(result);
+}
+
+static void PrintResult(const char *name, const double scalarMs, const double simdMs, const float maxDiff, const bool isRelative = false) {
+	double speedup = simdMs > 0.0 ? scalarMs / simdMs : 0.0;
+	const char *diffName = isRelative ? "max rel diff" : "max diff";
+	fplConsoleFormatOut("%-24s scalar: %8.3f ms, %-6s: %8.3f ms, speedup: %5.2fx, %s: %g\n", name, scalarMs, FMATH_SIMD_NAME, simdMs, speedup, diffName, maxDiff);
+}
+
+struct BenchData {
+	Mat4f *matsA;
+	Mat4f *matsB;
+	Vec4f *vecs;
+	Mat4f *matResultsScalar;
+	Mat4f *matResultsSIMD;
+	Vec4f *vecResultsScalar;
+	Vec4f *vecResultsSIMD;
+	float *floats;
+	float *floatResultsScalar;
+	float *floatResultsSIMD;
+
+	// Structure-of-arrays
+	float *xs;
+	float *ys;
+	float *zs;
+	float *outXsScalar;
+	float *outYsScalar;
+	float *outZsScalar;
+	float *outXsSIMD;
+	float *outYsSIMD;
+	float *outZsSIMD;
+	uint8_t *hitsScalar;
+	uint8_t *hitsSIMD;
+};
+
+static void BenchMat4Mult(BenchData &data) {
+	double start = fplGetTimeInMillisecondsHP();
+	for (int iteration = 0; iteration < BENCH_ITERATION_COUNT; ++iteration) {
+		for (int i = 0; i < BENCH_ITEM_COUNT; ++i) {
+			data.matResultsScalar[i] = Mat4MultScalar(data.matsA[i], data.matsB[i]);
+		}
+	}
+	double scalarMs = fplGetTimeInMillisecondsHP() - start;
+
+	start = fplGetTimeInMillisecondsHP();
+	for (int iteration = 0; iteration < BENCH_ITERATION_COUNT; ++iteration) {
+		for (int i = 0; i < BENCH_ITEM_COUNT; ++i) {
+			data.matResultsSIMD[i] = Mat4Mult(data.matsA[i], data.matsB[i]);
+		}
+	}
+	double simdMs = fplGetTimeInMillisecondsHP() - start;
+
+	float maxDiff = MaxDifference(data.matResultsScalar[0].m, data.matResultsSIMD[0].m, BENCH_ITEM_COUNT * 16);
+	PrintResult("Mat4f x Mat4f", scalarMs, simdMs, maxDiff);
+}
+
+// The SIMD version is expected to be on par with scalar, see the note on Mat4MultVec4SIMD
+static void BenchMat4MultVec4(BenchData &data) {
+	double start = fplGetTimeInMillisecondsHP();
+	for (int iteration = 0; iteration < BENCH_ITERATION_COUNT; ++iteration) {
+		for (int i = 0; i < BENCH_ITEM_COUNT; ++i) {
+			data.vecResultsScalar[i] = Mat4MultVec4Scalar(data.matsA[i], data.vecs[i]);
+		}
+	}
+	double scalarMs = fplGetTimeInMillisecondsHP() - start;
+
+	start = fplGetTimeInMillisecondsHP();
+	for (int iteration = 0; iteration < BENCH_ITERATION_COUNT; ++iteration) {
+		for (int i = 0; i < BENCH_ITEM_COUNT; ++i) {
+			data.vecResultsSIMD[i] = Mat4MultVec4(data.matsA[i], data.vecs[i]);
+		}
+	}
+	double simdMs = fplGetTimeInMillisecondsHP() - start;
+
+	float maxDiff = MaxDifference(data.vecResultsScalar[0].m, data.vecResultsSIMD[0].m, BENCH_ITEM_COUNT * 4);
+	PrintResult("Mat4f x Vec4f", scalarMs, simdMs, maxDiff);
+}
+
+static void BenchVec4MultMat4(BenchData &data) {
+	double start = fplGetTimeInMillisecondsHP();
+	for (int iteration = 0; iteration < BENCH_ITERATION_COUNT; ++iteration) {
+		for (int i = 0; i < BENCH_ITEM_COUNT; ++i) {
+			data.vecResultsScalar[i] = Vec4MultMat4Scalar(data.matsA[i], data.vecs[i]);
+		}
+	}
+	double scalarMs = fplGetTimeInMillisecondsHP() - start;
+
+	start = fplGetTimeInMillisecondsHP();
+	for (int iteration = 0; iteration < BENCH_ITERATION_COUNT; ++iteration) {
+		for (int i = 0; i < BENCH_ITEM_COUNT; ++i) {
+			data.vecResultsSIMD[i] = Vec4MultMat4(data.matsA[i], data.vecs[i]);
+		}
+	}
+	double simdMs = fplGetTimeInMillisecondsHP() - start;
+
+	float maxDiff = MaxDifference(data.vecResultsScalar[0].m, data.vecResultsSIMD[0].m, BENCH_ITEM_COUNT * 4);
+	PrintResult("Vec4f x Mat4f", scalarMs, simdMs, maxDiff);
+}
+
+static void BenchInvSquareRoot(BenchData &data) {
+	double start = fplGetTimeInMillisecondsHP();
+	for (int iteration = 0; iteration < BENCH_ITERATION_COUNT; ++iteration) {
+		for (int i = 0; i < BENCH_ITEM_COUNT; ++i) {
+			data.floatResultsScalar[i] = 1.0f / SquareRoot(data.floats[i]);
+		}
+	}
+	double scalarMs = fplGetTimeInMillisecondsHP() - start;
+
+	start = fplGetTimeInMillisecondsHP();
+	for (int iteration = 0; iteration < BENCH_ITERATION_COUNT; ++iteration) {
+		for (int i = 0; i < BENCH_ITEM_COUNT; ++i) {
+			data.floatResultsSIMD[i] = ApproxInvSquareRoot(data.floats[i]);
+		}
+	}
+	double simdMs = fplGetTimeInMillisecondsHP() - start;
+
+	// The approximation has a bounded relative error, so compare relative to the exact result
+	float maxDiff = MaxRelativeDifference(data.floatResultsScalar, data.floatResultsSIMD, BENCH_ITEM_COUNT);
+	PrintResult("1/sqrt(x)", scalarMs, simdMs, maxDiff, true);
+}
+
+static void BenchBatchTransformPoints(BenchData &data) {
+	const Mat4f &mat = data.matsA[0];
+	double start = fplGetTimeInMillisecondsHP();
+	for (int iteration = 0; iteration < BENCH_ITERATION_COUNT; ++iteration) {
+		for (int i = 0; i < BENCH_BATCH_COUNT; ++i) {
+			Vec4f p = Mat4MultVec4Scalar(mat, V4fInit(data.xs[i], data.ys[i], data.zs[i], 1.0f));
+			data.outXsScalar[i] = p.x;
+			data.outYsScalar[i] = p.y;
+			data.outZsScalar[i] = p.z;
+		}
+	}
+	double scalarMs = fplGetTimeInMillisecondsHP() - start;
+
+	start = fplGetTimeInMillisecondsHP();
+	for (int iteration = 0; iteration < BENCH_ITERATION_COUNT; ++iteration) {
+		BatchTransformPoints3(&mat, data.xs, data.ys, data.zs, data.outXsSIMD, data.outYsSIMD, data.outZsSIMD, BENCH_BATCH_COUNT);
+	}
+	double simdMs = fplGetTimeInMillisecondsHP() - start;
+
+	float maxDiff = MaxDifference(data.outXsScalar, data.outXsSIMD, BENCH_BATCH_COUNT);
+	maxDiff = Max(maxDiff, MaxDifference(data.outYsScalar, data.outYsSIMD, BENCH_BATCH_COUNT));
+	maxDiff = Max(maxDiff, MaxDifference(data.outZsScalar, data.outZsSIMD, BENCH_BATCH_COUNT));
+	PrintResult("Batch transform points", scalarMs, simdMs, maxDiff);
+}
+
+static void BenchBatchNormalize(BenchData &data) {
+	double start = fplGetTimeInMillisecondsHP();
+	for (int iteration = 0; iteration < BENCH_ITERATION_COUNT; ++iteration) {
+		for (int i = 0; i < BENCH_BATCH_COUNT; ++i) {
+			Vec3f n = V3fNormalize(V3fInit(data.xs[i], data.ys[i], data.zs[i]));
+			data.outXsScalar[i] = n.x;
+			data.outYsScalar[i] = n.y;
+			data.outZsScalar[i] = n.z;
+		}
+	}
+	double scalarMs = fplGetTimeInMillisecondsHP() - start;
+
+	start = fplGetTimeInMillisecondsHP();
+	for (int iteration = 0; iteration < BENCH_ITERATION_COUNT; ++iteration) {
+		BatchNormalize3(data.xs, data.ys, data.zs, data.outXsSIMD, data.outYsSIMD, data.outZsSIMD, BENCH_BATCH_COUNT);
+	}
+	double simdMs = fplGetTimeInMillisecondsHP() - start;
+
+	float maxDiff = MaxDifference(data.outXsScalar, data.outXsSIMD, BENCH_BATCH_COUNT);
+	maxDiff = Max(maxDiff, MaxDifference(data.outYsScalar, data.outYsSIMD, BENCH_BATCH_COUNT));
+	maxDiff = Max(maxDiff, MaxDifference(data.outZsScalar, data.outZsSIMD, BENCH_BATCH_COUNT));
+	PrintResult("Batch normalize", scalarMs, simdMs, maxDiff);
+}
+
+static void BenchBatchLerp(BenchData &data) {
+	const float t = 0.35f;
+	double start = fplGetTimeInMillisecondsHP();
+	for (int iteration = 0; iteration < BENCH_ITERATION_COUNT; ++iteration) {
+		for (int i = 0; i < BENCH_BATCH_COUNT; ++i) {
+			data.outXsScalar[i] = ScalarLerp(data.xs[i], t, data.ys[i]);
+		}
+	}
+	double scalarMs = fplGetTimeInMillisecondsHP() - start;
+
+	start = fplGetTimeInMillisecondsHP();
+	for (int iteration = 0; iteration < BENCH_ITERATION_COUNT; ++iteration) {
+		BatchLerp(data.xs, t, data.ys, data.outXsSIMD, BENCH_BATCH_COUNT);
+	}
+	double simdMs = fplGetTimeInMillisecondsHP() - start;
+
+	float maxDiff = MaxDifference(data.outXsScalar, data.outXsSIMD, BENCH_BATCH_COUNT);
+	PrintResult("Batch lerp", scalarMs, simdMs, maxDiff);
+}
+
+static void BenchBatchDistanceSquared(BenchData &data) {
+	const Vec3f p = V3fInit(0.25f, -0.5f, 0.1f);
+	double start = fplGetTimeInMillisecondsHP();
+	for (int iteration = 0; iteration < BENCH_ITERATION_COUNT; ++iteration) {
+		for (int i = 0; i < BENCH_BATCH_COUNT; ++i) {
+			data.outXsScalar[i] = V3fDistanceSquared(V3fInit(data.xs[i], data.ys[i], data.zs[i]), p);
+		}
+	}
+	double scalarMs = fplGetTimeInMillisecondsHP() - start;
+
+	start = fplGetTimeInMillisecondsHP();
+	for (int iteration = 0; iteration < BENCH_ITERATION_COUNT; ++iteration) {
+		BatchDistanceSquared3(data.xs, data.ys, data.zs, p, data.outXsSIMD, BENCH_BATCH_COUNT);
+	}
+	double simdMs = fplGetTimeInMillisecondsHP() - start;
+
+	float maxDiff = MaxDifference(data.outXsScalar, data.outXsSIMD, BENCH_BATCH_COUNT);
+	PrintResult("Batch distance squared", scalarMs, simdMs, maxDiff);
+}
+
+static void BenchBatchAABBOverlap(BenchData &data) {
+	// Boxes are (x, y) - (x + |z|, y + |z|)
+	for (int i = 0; i < BENCH_BATCH_COUNT; ++i) {
+		data.outXsScalar[i] = data.xs[i] + Abs(data.zs[i]);
+		data.outYsScalar[i] = data.ys[i] + Abs(data.zs[i]);
+	}
+	const Vec2f queryMin = V2fInit(-0.25f, -0.25f);
+	const Vec2f queryMax = V2fInit(0.25f, 0.25f);
+
+	size_t scalarHitCount = 0;
+	double start = fplGetTimeInMillisecondsHP();
+	for (int iteration = 0; iteration < BENCH_ITERATION_COUNT; ++iteration) {
+		scalarHitCount = 0;
+		for (int i = 0; i < BENCH_BATCH_COUNT; ++i) {
+			bool hit = (data.xs[i] <= queryMax.x) && (queryMin.x <= data.outXsScalar[i]) && (data.ys[i] <= queryMax.y) && (queryMin.y <= data.outYsScalar[i]);
+			data.hitsScalar[i] = hit ? 1 : 0;
+			scalarHitCount += hit ? 1 : 0;
+		}
+	}
+	double scalarMs = fplGetTimeInMillisecondsHP() - start;
+
+	size_t simdHitCount = 0;
+	start = fplGetTimeInMillisecondsHP();
+	for (int iteration = 0; iteration < BENCH_ITERATION_COUNT; ++iteration) {
+		simdHitCount = BatchAABBOverlap2(data.xs, data.ys, data.outXsScalar, data.outYsScalar, queryMin, queryMax, data.hitsSIMD, BENCH_BATCH_COUNT);
+	}
+	double simdMs = fplGetTimeInMillisecondsHP() - start;
+
+	size_t mismatchCount = 0;
+	for (int i = 0; i < BENCH_BATCH_COUNT; ++i) {
+		if (data.hitsScalar[i] != data.hitsSIMD[i]) {
+			++mismatchCount;
+		}
+	}
+	if (scalarHitCount != simdHitCount) {
+		++mismatchCount;
+	}
+	PrintResult("Batch AABB overlap", scalarMs, simdMs, (float)mismatchCount);
+}
+
+int main() {
+	if (!fplPlatformInit(fplInitFlags_None, fpl_null)) {
+		return -1;
+	}
+
+	BenchData data = {};
+	data.matsA = (Mat4f *)fplMemoryAlignedAllocate(sizeof(Mat4f) * BENCH_ITEM_COUNT, 16);
+	data.matsB = (Mat4f *)fplMemoryAlignedAllocate(sizeof(Mat4f) * BENCH_ITEM_COUNT, 16);
+	data.matResultsScalar = (Mat4f *)fplMemoryAlignedAllocate(sizeof(Mat4f) * BENCH_ITEM_COUNT, 16);
+	data.matResultsSIMD = (Mat4f *)fplMemoryAlignedAllocate(sizeof(Mat4f) * BENCH_ITEM_COUNT, 16);
+	data.vecs = (Vec4f *)fplMemoryAlignedAllocate(sizeof(Vec4f) * BENCH_ITEM_COUNT, 16);
+	data.vecResultsScalar = (Vec4f *)fplMemoryAlignedAllocate(sizeof(Vec4f) * BENCH_ITEM_COUNT, 16);
+	data.vecResultsSIMD = (Vec4f *)fplMemoryAlignedAllocate(sizeof(Vec4f) * BENCH_ITEM_COUNT, 16);
+	data.floats = (float *)fplMemoryAlignedAllocate(sizeof(float) * BENCH_ITEM_COUNT, 16);
+	data.floatResultsScalar = (float *)fplMemoryAlignedAllocate(sizeof(float) * BENCH_ITEM_COUNT, 16);
+	data.floatResultsSIMD = (float *)fplMemoryAlignedAllocate(sizeof(float) * BENCH_ITEM_COUNT, 16);
+	float **soaArrays[] = { &data.xs, &data.ys, &data.zs, &data.outXsScalar, &data.outYsScalar, &data.outZsScalar, &data.outXsSIMD, &data.outYsSIMD, &data.outZsSIMD };
+	for (size_t i = 0; i < fplArrayCount(soaArrays); ++i) {
+		*soaArrays[i] = (float *)fplMemoryAlignedAllocate(sizeof(float) * BENCH_BATCH_COUNT, 32);
+	}
+	data.hitsScalar = (uint8_t *)fplMemoryAllocate(BENCH_BATCH_COUNT);
+	data.hitsSIMD = (uint8_t *)fplMemoryAllocate(BENCH_BATCH_COUNT);
+
+	uint32_t rndState = 1337;
+	for (int i = 0; i < BENCH_ITEM_COUNT; ++i) {
+		for (int j = 0; j < 16; ++j) {
+			data.matsA[i].m[j] = RandomFloat(&rndState);
+			data.matsB[i].m[j] = RandomFloat(&rndState);
+		}
+		data.vecs[i] = V4fInit(RandomFloat(&rndState), RandomFloat(&rndState), RandomFloat(&rndState), 1.0f);
+		data.floats[i] = 2.0f + RandomFloat(&rndState);
+	}
+	for (int i = 0; i < BENCH_BATCH_COUNT; ++i) {
+		data.xs[i] = RandomFloat(&rndState);
+		data.ys[i] = RandomFloat(&rndState);
+		data.zs[i] = (i % 64) == 0 ? 0.0f : RandomFloat(&rndState);
+	}
+	// Zero vector for the normalize special case
+	data.xs[BENCH_BATCH_COUNT - 1] = data.ys[BENCH_BATCH_COUNT - 1] = data.zs[BENCH_BATCH_COUNT - 1] = 0.0f;
+
+	fplConsoleFormatOut("Final Math benchmark, backend: %s, items: %d, iterations: %d\n", FMATH_SIMD_NAME, BENCH_ITEM_COUNT, BENCH_ITERATION_COUNT);
+	BenchMat4Mult(data);
+	BenchMat4MultVec4(data);
+	BenchVec4MultMat4(data);
+	BenchInvSquareRoot(data);
+	BenchBatchTransformPoints(data);
+	BenchBatchNormalize(data);
+	BenchBatchLerp(data);
+	BenchBatchDistanceSquared(data);
+	BenchBatchAABBOverlap(data);
+
+	fplMemoryFree(data.hitsSIMD);
+	fplMemoryFree(data.hitsScalar);
+	for (size_t i = 0; i < fplArrayCount(soaArrays); ++i) {
+		fplMemoryAlignedFree(*soaArrays[i]);
+	}
+	fplMemoryAlignedFree(data.floatResultsSIMD);
+	fplMemoryAlignedFree(data.floatResultsScalar);
+	fplMemoryAlignedFree(data.floats);
+	fplMemoryAlignedFree(data.vecResultsSIMD);
+	fplMemoryAlignedFree(data.vecResultsScalar);
+	fplMemoryAlignedFree(data.vecs);
+	fplMemoryAlignedFree(data.matResultsSIMD);
+	fplMemoryAlignedFree(data.matResultsScalar);
+	fplMemoryAlignedFree(data.matsB);
+	fplMemoryAlignedFree(data.matsA);
+
+	fplPlatformRelease();
+	return 0;
+}
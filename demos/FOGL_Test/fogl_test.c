@@ -15,6 +15,9 @@ Author:
 	Torsten Spaete
 
 Changelog:
+	## 2026-10-18
+	- Load only the functions up to the context version and print the load statistics
+
 	## 2018-10-22
 	- Reflect api changes in FPL 0.9.3
 
@@ -216,7 +219,10 @@ int main(int argc, char **args) {
 	if(fplPlatformInit(initFlags, &settings)) {
 
 #if USE_FPL_OPENGL_CONTEXT_CREATION
-		if(fglLoadOpenGL(true)) {
+		if(fglLoadOpenGL(false)) {
+			fglLoadOpenGLFunctionsForVersion(0, 0);
+			const fglOpenGLLoadStats *loadStats = fglGetOpenGLLoadStats();
+			fplConsoleFormatOut("Loaded %u of %u OpenGL functions up to version %u.%u in %.3f ms\n", loadStats->resolvedProcCount, loadStats->requestedProcCount, loadStats->loadedVersion / 10, loadStats->loadedVersion % 10, loadStats->loadTimeMs);
 			RunModern(fgl_null);
 			fglUnloadOpenGL();
 		}
@@ -12,10 +12,35 @@ Requirements:
 	- Final Memory
 	- Final Framework
 
+Usage:
+	FPL_Crackout [-headless] [-levels <count>] [-balls <count>] [-substeps <count>]
+	             [-velocityiterations <count>] [-positioniterations <count>] [-nocontinuous]
+	             [-fps <rate>] [-novsync] [-framestats] [-record <file>] [-replay <file>] [-unlimited]
+
+	-headless: Plays the levels with a scripted paddle at a fixed rate of 60 Hz without a window,
+	then prints physics step time percentiles, contact counts and a state hash.
+	A level without a broken brick for one minute of game time is reported as jammed, its steps since the last broken brick are not part of the stats.
+	-levels: Number of levels played in headless mode (Default: 10).
+	-balls: Number of balls launched from the paddle at once (Default: 1).
+	-substeps, -velocityiterations, -positioniterations, -nocontinuous: Physics settings (Default: 1, 10, 10, continuous).
+	-fps: Limits the frame rate with the frame pacer (Default: 0, VSync only).
+	-novsync: Disables VSync.
+	-framestats: Shows the frame time graph with p50/p95/p99 lines and prints the frame time percentiles every second.
+	-record: Records the input of the played session into the given file.
+	-replay: Replays the session recorded in the given file, then prints frame time percentiles and verifies the state checksums.
+	-unlimited: Replays as fast as possible.
+
 Author:
 	Torsten Spaete
 
 Changelog:
+	## 2026-10-18
+	- Headless benchmark mode (-headless)
+	- Multiball: Launch more than one ball at once (-balls), extra balls are lost without costing a life
+	- Physics iterations, sub-steps and continuous collision are configurable from the command line
+	- Frame pacing and frame time statistics (-fps, -novsync, -framestats)
+	- Input recording and replay (-record, -replay, -unlimited)
+
 	## 2019-06-23
 	- Modify the bounce normal for ball vs paddle, based on projection
 	- Made the brick assets 50 % smaller to fit the pixel style
@@ -140,6 +165,14 @@ const Vec2f BrickRadius = V2fInit(SpaceForBricksX / (float)MaxBrickCols, SpaceFo
 
 const Vec2f Gravity = V2fInit(0, -10);
 
+// Balls are launched together with the main ball, when more than one ball is launched (Multiball)
+constexpr size_t MaxExtraBallCount = 63;
+// Balls never collide with each other
+constexpr uint16 BallCategoryBits = 0x0002;
+
+constexpr int DefaultVelocityIterations = 10;
+constexpr int DefaultPositionIterations = 10;
+
 fplStaticAssert(MaxBrickCols % 2 != 0);
 
 // Brick UVs
@@ -337,6 +370,33 @@ struct MenuState {
 	bool itemActivated;
 };
 
+struct PhysicsSettings {
+	int velocityIterations;
+	int positionIterations;
+	// Number of world steps per update, each with an equal part of the delta time
+	int subStepCount;
+	bool isContinuous;
+};
+
+struct GameSettings {
+	PhysicsSettings physics;
+	// Number of balls launched from the paddle, including the main ball
+	int launchBallCount;
+};
+
+inline GameSettings MakeDefaultSettings() {
+	GameSettings result = {};
+	result.physics.velocityIterations = DefaultVelocityIterations;
+	result.physics.positionIterations = DefaultPositionIterations;
+	result.physics.subStepCount = 1;
+	result.physics.isContinuous = true;
+	result.launchBallCount = 1;
+	return(result);
+}
+
+// @NOTE(final): Set from the command line before the game is initialized
+static GameSettings globalStartupSettings = MakeDefaultSettings();
+
 struct GameState {
 	char dataPath[1024];
 	Assets assets;
@@ -349,6 +409,8 @@ struct GameState {
 
 	Entity frame;
 	Entity ball;
+	Entity extraBalls[MaxExtraBallCount];
+	size_t extraBallCount;
 	Entity paddle;
 	Entity killArea;
 	BrickType bricksMap[1024];
@@ -358,6 +420,11 @@ struct GameState {
 
 	GameContactListener* contactListener;
 
+	GameSettings settings;
+	// Duration of the last physics update in milliseconds and the number of contacts which began touching
+	double lastPhysicsTime;
+	uint64_t beginContactCount;
+
 	int levelSeed;
 	int levelsCompleted;
 
@@ -366,6 +433,7 @@ struct GameState {
 	int score;
 	MenuState menu;
 
+	bool isHeadless;
 	bool isExiting;
 };
 
@@ -393,6 +461,41 @@ static void ClearWorld(b2World* world) {
 	}
 }
 
+static void CreateBall(b2World* world, Entity* ballEntity, const b2Vec2& position) {
+	b2Body* body;
+	b2BodyDef ballDef = b2BodyDef();
+
+	*ballEntity = {};
+	ballEntity->type = EntityType::Ball;
+
+	Ball& ball = ballEntity->ball;
+	ball.speed = BallSpeed;
+
+	ballDef.type = b2BodyType::b2_dynamicBody;
+	ballDef.allowSleep = false;
+	ballDef.bullet = true;
+	ballDef.position = position;
+	ballDef.angle = 0;
+	ballDef.fixedRotation = true;
+	ballDef.linearDamping = 0;
+	ballDef.angularDamping = 0;
+	ballDef.gravityScale = 0;
+	ball.body = body = world->CreateBody(&ballDef);
+	body->SetUserData(ballEntity);
+
+	b2CircleShape ballShape = b2CircleShape();
+	ballShape.m_radius = BallRadius;
+
+	b2FixtureDef ballFixtureDef = b2FixtureDef();
+	ballFixtureDef.shape = &ballShape;
+	ballFixtureDef.restitution = 1.0f;
+	ballFixtureDef.friction = 0.0f;
+	ballFixtureDef.density = 1.0f;
+	ballFixtureDef.filter.categoryBits = BallCategoryBits;
+	ballFixtureDef.filter.maskBits = 0xFFFF & ~BallCategoryBits;
+	body->CreateFixture(&ballFixtureDef);
+}
+
 static void LoadLevel(GameState& state, int levelSeed) {
 	SetRandomLevel(state, levelSeed);
 
@@ -404,6 +507,7 @@ static void LoadLevel(GameState& state, int levelSeed) {
 	// Clear world
 	//
 	ClearWorld(world);
+	state.extraBallCount = 0;
 
 	//
 	// Field
@@ -620,40 +724,7 @@ static void LoadLevel(GameState& state, int levelSeed) {
 	//
 	// Ball
 	//
-	{
-		b2Body* body;
-		b2BodyDef ballDef = b2BodyDef();
-
-		Entity* ballEntity = &state.ball;
-		*ballEntity = {};
-		ballEntity->type = EntityType::Ball;
-
-		Ball& ball = ballEntity->ball;
-		ball.speed = BallSpeed;
-
-		ballDef.type = b2BodyType::b2_dynamicBody;
-		ballDef.allowSleep = false;
-		ballDef.bullet = true;
-		ballDef.position = b2Vec2(0, 0);
-		ballDef.angle = 0;
-		ballDef.fixedRotation = true;
-		ballDef.linearDamping = 0;
-		ballDef.angularDamping = 0;
-		ballDef.gravityScale = 0;
-		ball.body = body = world->CreateBody(&ballDef);
-		body->SetUserData(ballEntity);
-
-		b2CircleShape ballShape = b2CircleShape();
-		ballShape.m_radius = BallRadius;
-
-		b2FixtureDef ballFixtureDef = b2FixtureDef();
-		ballFixtureDef.shape = &ballShape;
-		ballFixtureDef.restitution = 1.0f;
-		ballFixtureDef.friction = 0.0f;
-		ballFixtureDef.density = 1.0f;
-		ballFixtureDef.filter.maskBits = 0xFFFF;
-		body->CreateFixture(&ballFixtureDef);
-	}
+	CreateBall(world, &state.ball, b2Vec2(0, 0));
 
 	GlueBallOnPaddle(state, &state.ball.ball);
 
@@ -729,6 +800,27 @@ static void StartGame(GameState& state) {
 	LoadLevel(state, InitialLevelSeed);
 }
 
+static void InitWorld(GameState& state) {
+	b2World* world;
+	state.world = world = new b2World(b2Vec2(Gravity.x, Gravity.y));
+	world->SetContinuousPhysics(state.settings.physics.isContinuous);
+	world->SetAutoClearForces(false);
+	state.contactListener = new GameContactListener(&state);
+	world->SetContactListener(state.contactListener);
+}
+
+static void ReleaseWorld(GameState& state) {
+	if (state.world != nullptr) {
+		ClearWorld(state.world);
+		delete state.world;
+		state.world = nullptr;
+	}
+	if (state.contactListener != nullptr) {
+		delete state.contactListener;
+		state.contactListener = nullptr;
+	}
+}
+
 static bool InitGame(GameState& state) {
 	if (!fglLoadOpenGL(true)) {
 		return false;
@@ -738,8 +830,6 @@ static bool InitGame(GameState& state) {
 	fplExtractFilePath(state.dataPath, state.dataPath, fplArrayCount(state.dataPath));
 	fplPathCombine(state.dataPath, fplArrayCount(state.dataPath), 2, state.dataPath, "data");
 
-	srand((int)fplGetTimeInMillisecondsLP());
-
 	glEnable(GL_DEPTH_TEST);
 	glDepthFunc(GL_LEQUAL);
 
@@ -759,13 +849,7 @@ static bool InitGame(GameState& state) {
 
 	LoadAssets(state);
 
-	b2World* world;
-
-	state.world = world = new b2World(b2Vec2(Gravity.x, Gravity.y));
-	world->SetContinuousPhysics(true);
-
-	state.contactListener = new GameContactListener(&state);
-	world->SetContactListener(state.contactListener);
+	InitWorld(state);
 
 #if 1
 	state.mode = GameMode::Title;
@@ -778,11 +862,7 @@ static bool InitGame(GameState& state) {
 }
 
 static void ReleaseGame(GameState& state) {
-	ClearWorld(state.world);
-	if (state.world != nullptr) {
-		delete state.world;
-		state.world = nullptr;
-	}
+	ReleaseWorld(state);
 	fglUnloadOpenGL();
 }
 
@@ -798,6 +878,8 @@ extern bool GameInit(GameMemory& gameMemory) {
 	GameState* state = (GameState*)fmemPush(gameMemory.memory, sizeof(GameState), fmemPushFlags_Clear);
 	gameMemory.game = state;
 	state->audioSys = gameMemory.audio;
+	state->settings = globalStartupSettings;
+	srand(gameMemory.randomSeed);
 	if (!InitGame(*state)) {
 		GameRelease(gameMemory);
 		return(false);
@@ -814,11 +896,9 @@ static void GlueBallOnPaddle(GameState& state, Ball* ball) {
 	ball->body->SetType(b2BodyType::b2_staticBody);
 }
 
-static void LaunchBall(GameState& state) {
-	Paddle& paddle = state.paddle.paddle;
+static void LaunchBallInRandomDirection(Ball* ball) {
 	const float spreadAngle = 30.0f;
 	const float startAngle = 90;
-	Ball* ball = paddle.gluedBall;
 	ball->isMoving = true;
 	ball->isDead = false;
 	ball->body->SetType(b2BodyType::b2_dynamicBody);
@@ -826,7 +906,22 @@ static void LaunchBall(GameState& state) {
 	float a = DegreesToRadians(newAngle);
 	b2Vec2 direction = b2Vec2(Cosine(a), Sine(a));
 	ball->body->ApplyLinearImpulse(ball->speed * direction, ball->body->GetPosition(), true);
+}
+
+static void LaunchBall(GameState& state) {
+	Paddle& paddle = state.paddle.paddle;
+	Ball* ball = paddle.gluedBall;
+	LaunchBallInRandomDirection(ball);
 	paddle.gluedBall = nullptr;
+
+	// Multiball
+	b2Vec2 launchPos = ball->body->GetPosition();
+	int extraBallCount = state.settings.launchBallCount - 1;
+	for (int i = 0; i < extraBallCount && state.extraBallCount < MaxExtraBallCount; ++i) {
+		Entity* extraBallEntity = &state.extraBalls[state.extraBallCount++];
+		CreateBall(state.world, extraBallEntity, launchPos);
+		LaunchBallInRandomDirection(&extraBallEntity->ball);
+	}
 }
 
 static void SetRandomLevel(GameState& state, int seed) {
@@ -865,11 +960,16 @@ static void SetRandomLevel(GameState& state, int seed) {
 static void EntersKillArea(GameState& state, Entity& other) {
 	if (other.type == EntityType::Ball) {
 		Ball* ball = &other.ball;
-		Paddle& paddle = state.paddle.paddle;
+		if (ball->isDead) {
+			return;
+		}
 		ball->isDead = true;
-		state.lifes--;
-		if (state.lifes <= 0) {
-			state.lifes = 0;
+		// Extra balls are just removed
+		if (&other == &state.ball) {
+			state.lifes--;
+			if (state.lifes <= 0) {
+				state.lifes = 0;
+			}
 		}
 	} else if (other.type == EntityType::Brick) {
 		Brick& brick = other.brick;
@@ -945,6 +1045,18 @@ static void HandleContactCollision(GameState& state, b2Contact* contact) {
 	}
 }
 
+static Vec2f GetPaddleBounceDirection(const float t) {
+	// Where the ball hits the paddle (-1 = left, 0 = center, 1 = right) decides the bounce direction
+	Vec2f result;
+	if (t < 0.0f) {
+		result = V2fLerp(V2fInit(0, 1), Abs(t), V2fInit(-1, 0.25f));
+	} else {
+		result = V2fLerp(V2fInit(0, 1), t, V2fInit(1, 0.25f));
+	}
+	result = V2fNormalize(result);
+	return(result);
+}
+
 static void HandlePreCollision(GameState& state, b2Contact* contact) {
 	CollisionPair pair = GetCollisionPair(contact);
 	if (pair.entityA->type == EntityType::KillArea) {
@@ -964,18 +1076,13 @@ static void HandlePreCollision(GameState& state, b2Contact* contact) {
 			b2Vec2 distanceToPaddle = ballPos - paddlePos;
 			float t = b2Clamp(b2Dot(distanceToPaddle, unitRightVec) / PaddleRadius.x, -1.0f, 1.0f);
 
-			Vec2f bounce = V2fInit(0, 1);
-			if (t < 0.0f) {
-				t = Abs(t);
-				bounce = V2fLerp(V2fInit(0, 1), t, V2fInit(-1, 0.25f));
-			} else {
-				bounce = V2fLerp(V2fInit(0, 1), t, V2fInit(1, 0.25f));
-			}
-			bounce = V2fNormalize(bounce);
+			Vec2f bounce = GetPaddleBounceDirection(t);
 
 			b2Vec2 n = b2Vec2(bounce.x, bounce.y);
 
-			fplDebugFormatOut("Out direction: %f %f, t: %f\n", n.x, n.y, t);
+			if (!state.isHeadless) {
+				fplDebugFormatOut("Out direction: %f %f, t: %f\n", n.x, n.y, t);
+			}
 
 			manifold->localNormal = n;
 		}
@@ -984,6 +1091,7 @@ static void HandlePreCollision(GameState& state, b2Contact* contact) {
 
 // @NOTE(final): These are bad design decision from Box2D!
 void GameContactListener::BeginContact(b2Contact* contact) {
+	++gameState->beginContactCount;
 	HandleContactCollision(*gameState, contact);
 }
 void GameContactListener::EndContact(b2Contact* contact) {
@@ -1074,6 +1182,42 @@ extern void GameInput(GameMemory& gameMemory, const Input& input) {
 	}
 }
 
+static void ForceBallSpeed(Ball& ball) {
+	const float angleTolerance = 3.0f;
+	const float angleCorrection = 6.0f;
+	float squaredAngles[] = { 0, 90, 180, 270, 360 };
+	if (ball.isMoving) {
+		b2Vec2 vel = ball.body->GetLinearVelocity();
+		b2Vec2 dir = vel;
+		dir.Normalize();
+
+		float a = ArcTan2(dir.y, dir.x);
+		float deg = RadiansToDegrees(a);
+		for (int i = 0; i < fplArrayCount(squaredAngles); ++i) {
+			if (Abs(deg) > (squaredAngles[i] - angleTolerance) && Abs(deg) < (squaredAngles[i] + angleTolerance)) {
+				deg += (Abs(deg) - squaredAngles[i] > 0 ? 1 : -1) * angleCorrection;
+				a = DegreesToRadians(deg);
+			}
+		}
+		dir = b2Vec2(Cosine(a), Sine(a));
+
+		dir *= ball.speed;
+		ball.body->SetLinearVelocity(dir);
+	}
+}
+
+static void StepPhysics(GameState& state, const float deltaTime) {
+	const PhysicsSettings& physics = state.settings.physics;
+	double startTime = fplGetTimeInMillisecondsHP();
+	// @NOTE(final): Forces are cleared once after all sub-steps, see InitWorld()
+	float subDeltaTime = deltaTime / (float)physics.subStepCount;
+	for (int subStep = 0; subStep < physics.subStepCount; ++subStep) {
+		state.world->Step(subDeltaTime, physics.velocityIterations, physics.positionIterations);
+	}
+	state.world->ClearForces();
+	state.lastPhysicsTime = fplGetTimeInMillisecondsHP() - startTime;
+}
+
 static void UpdatePlayMode(GameState& state, const Input& input) {
 	// Game over?
 	if (state.lifes == 0) {
@@ -1093,32 +1237,26 @@ static void UpdatePlayMode(GameState& state, const Input& input) {
 	} else {
 	}
 
-	// Force ball speed and correct ball angle when needed
-	{
-		const float angleTolerance = 3.0f;
-		const float angleCorrection = 6.0f;
-		float squaredAngles[] = { 0, 90, 180, 270, 360 };
-		Ball& ball = state.ball.ball;
-		if (ball.isMoving) {
-			b2Vec2 vel = ball.body->GetLinearVelocity();
-			b2Vec2 dir = vel;
-			dir.Normalize();
-
-			float a = ArcTan2(dir.y, dir.x);
-			float deg = RadiansToDegrees(a);
-			for (int i = 0; i < fplArrayCount(squaredAngles); ++i) {
-				if (Abs(deg) > (squaredAngles[i] - angleTolerance) && Abs(deg) < (squaredAngles[i] + angleTolerance)) {
-					deg += (Abs(deg) - squaredAngles[i] > 0 ? 1 : -1) * angleCorrection;
-					a = DegreesToRadians(deg);
-				}
+	// Remove lost extra balls
+	for (size_t i = 0; i < state.extraBallCount;) {
+		if (state.extraBalls[i].ball.isDead) {
+			state.world->DestroyBody(state.extraBalls[i].ball.body);
+			if (i < state.extraBallCount - 1) {
+				state.extraBalls[i] = state.extraBalls[state.extraBallCount - 1];
+				state.extraBalls[i].ball.body->SetUserData(&state.extraBalls[i]);
 			}
-			dir = b2Vec2(Cosine(a), Sine(a));
-
-			dir *= ball.speed;
-			ball.body->SetLinearVelocity(dir);
+			--state.extraBallCount;
+		} else {
+			++i;
 		}
 	}
 
+	// Force ball speed and correct ball angle when needed
+	ForceBallSpeed(state.ball.ball);
+	for (size_t i = 0; i < state.extraBallCount; ++i) {
+		ForceBallSpeed(state.extraBalls[i].ball);
+	}
+
 	// Make all bricks dynamic when hit
 	const float hitStrength = 1.5f;
 	for (size_t i = 0; i < state.remainingBricks; ++i) {
@@ -1158,8 +1296,7 @@ static void UpdatePlayMode(GameState& state, const Input& input) {
 	}
 
 	// Run physics simulation
-	state.world->Step(input.deltaTime, 10, 10);
-	state.world->ClearForces();
+	StepPhysics(state, input.deltaTime);
 }
 
 extern void GameUpdate(GameMemory& gameMemory, const Input& input) {
@@ -1224,9 +1361,9 @@ static void DrawPlayMode(GameState& state) {
 	// Field
 	DrawField(state);
 
-	// Ball
-	{
-		const Ball& ball = state.ball.ball;
+	// Balls
+	for (size_t i = 0; i <= state.extraBallCount; ++i) {
+		const Ball& ball = i == 0 ? state.ball.ball : state.extraBalls[i - 1].ball;
 		b2Vec2 ballPos = ball.body->GetPosition();
 		float ballRot = ball.body->GetAngle();
 		GLuint texId = PointerToValue<GLuint>(state.assets.ballTexture.texture);
@@ -1485,16 +1622,375 @@ extern void GameRender(GameMemory& gameMemory, const float alpha) {
 extern void GameUpdateAndRender(GameMemory& gameMemory, const Input& input, const float alpha) {
 }
 
+//
+// Headless benchmark
+//
+constexpr float HeadlessDeltaTime = 1.0f / 60.0f;
+constexpr size_t HeadlessMaxStepsPerLevel = 60 * 60 * 5; // 5 minutes of game time
+constexpr size_t HeadlessMaxStepsWithoutProgress = 60 * 60; // 1 minute of game time without a broken brick
+constexpr uint64_t FNV64Offset = 0xcbf29ce484222325ULL;
+constexpr uint64_t FNV64Prime = 0x100000001b3ULL;
+
+struct HeadlessConfig {
+	int levelCount;
+};
+
+inline void HashBytes(uint64_t& hash, const void* data, const size_t size) {
+	const uint8_t* p = (const uint8_t*)data;
+	for (size_t i = 0; i < size; ++i) {
+		hash = (hash ^ p[i]) * FNV64Prime;
+	}
+}
+
+template<typename T>
+inline void HashValue(uint64_t& hash, const T& value) {
+	HashBytes(hash, &value, sizeof(value));
+}
+
+static void HashBody(uint64_t& hash, const b2Body* body) {
+	HashValue(hash, body->GetPosition());
+	HashValue(hash, body->GetAngle());
+	HashValue(hash, body->GetLinearVelocity());
+}
+
+static uint64_t HashGameState(const GameState& state) {
+	// @NOTE(final): Only simulation state, no pointers - so the hash is the same across runs
+	uint64_t hash = FNV64Offset;
+	HashValue(hash, state.levelSeed);
+	HashValue(hash, state.levelsCompleted);
+	HashValue(hash, state.score);
+	HashValue(hash, state.lifes);
+	HashBody(hash, state.ball.ball.body);
+	HashValue(hash, state.extraBallCount);
+	for (size_t i = 0; i < state.extraBallCount; ++i) {
+		HashBody(hash, state.extraBalls[i].ball.body);
+	}
+	HashBody(hash, state.paddle.paddle.body);
+	HashValue(hash, state.remainingBricks);
+	for (size_t i = 0; i < state.remainingBricks; ++i) {
+		HashBody(hash, state.activeBricks[i].brick.body);
+	}
+	return(hash);
+}
+
+static uint64_t ComputeGameChecksum(GameMemory& gameMemory) {
+	uint64_t result = HashGameState(*gameMemory.game);
+	return(result);
+}
+
+static float PredictBallX(const Ball& ball) {
+	// Where the ball crosses the paddle line, reflected by the side walls
+	b2Vec2 pos = ball.body->GetPosition();
+	b2Vec2 vel = ball.body->GetLinearVelocity();
+	float t = (pos.y - PaddleLineY) / -vel.y;
+	float minX = -AreaHalfWidth + BallRadius;
+	float width = (AreaHalfWidth - BallRadius) - minX;
+	float d = fmodf(pos.x + vel.x * t - minX, width * 2.0f);
+	if (d < 0) {
+		d += width * 2.0f;
+	}
+	if (d > width) {
+		d = width * 2.0f - d;
+	}
+	float result = minX + d;
+	return(result);
+}
+
+static float GetPaddleAimOffset(const GameState& state, const float impactX) {
+	// Aim for the first brick which was not hit yet, by choosing where the ball hits the paddle
+	const Brick* targetBrick = nullptr;
+	for (size_t i = 0; i < state.remainingBricks; ++i) {
+		const Brick& brick = state.activeBricks[i].brick;
+		if (!brick.isHit && !brick.isDead) {
+			targetBrick = &brick;
+			break;
+		}
+	}
+	if (targetBrick == nullptr) {
+		return(0.0f);
+	}
+	b2Vec2 brickPos = targetBrick->body->GetPosition();
+	Vec2f toBrick = V2fNormalize(V2fInit(brickPos.x - impactX, brickPos.y - PaddleLineY));
+	float bestT = 0.0f;
+	float bestDot = -1.0f;
+	const int stepCount = 10;
+	for (int i = -stepCount; i <= stepCount; ++i) {
+		// Stay away from the paddle edges
+		float t = (i / (float)stepCount) * 0.9f;
+		float d = V2fDot(GetPaddleBounceDirection(t), toBrick);
+		if (d > bestDot) {
+			bestDot = d;
+			bestT = t;
+		}
+	}
+	float result = bestT * PaddleRadius.x;
+	return(result);
+}
+
+static void UpdatePaddleAI(const GameState& state, Controller& controller) {
+	// Follow the ball which reaches the paddle line first and launch as soon as a ball is glued
+	const Paddle& paddle = state.paddle.paddle;
+	float paddleX = paddle.body->GetPosition().x;
+	float targetX = paddleX;
+	float minTime = 0;
+	bool hasTarget = false;
+	for (size_t i = 0; i <= state.extraBallCount; ++i) {
+		const Ball& ball = i == 0 ? state.ball.ball : state.extraBalls[i - 1].ball;
+		if (!ball.isMoving || ball.isDead) {
+			continue;
+		}
+		b2Vec2 pos = ball.body->GetPosition();
+		b2Vec2 vel = ball.body->GetLinearVelocity();
+		if (vel.y < 0 && pos.y > PaddleLineY) {
+			float t = (pos.y - PaddleLineY) / -vel.y;
+			if (!hasTarget || t < minTime) {
+				float impactX = PredictBallX(ball);
+				minTime = t;
+				targetX = impactX - GetPaddleAimOffset(state, impactX);
+				hasTarget = true;
+			}
+		}
+	}
+	controller.isAnalog = true;
+	controller.analogMovement.x = b2Clamp((targetX - paddleX) / PaddleRadius.x, -1.0f, 1.0f);
+	controller.actionDown.endedDown = paddle.gluedBall != nullptr;
+}
+
+static int CompareStepTimes(const void* a, const void* b) {
+	float timeA = *(const float*)a;
+	float timeB = *(const float*)b;
+	int result = (timeA > timeB) - (timeA < timeB);
+	return(result);
+}
+
+inline float GetPercentile(const float* sortedTimes, const size_t count, const float percentile) {
+	if (count == 0) {
+		return(0.0f);
+	}
+	size_t index = (size_t)(percentile * (float)(count - 1) + 0.5f);
+	return sortedTimes[index];
+}
+
+static void PrintStepTimes(float* times, const size_t count) {
+	// Sorts the times in place
+	qsort(times, count, sizeof(*times), CompareStepTimes);
+	double sum = 0.0;
+	for (size_t i = 0; i < count; ++i) {
+		sum += times[i];
+	}
+	fplConsoleFormatOut("avg %.4f, p50 %.4f, p95 %.4f, p99 %.4f, max %.4f ms",
+		count > 0 ? sum / count : 0.0,
+		GetPercentile(times, count, 0.5f),
+		GetPercentile(times, count, 0.95f),
+		GetPercentile(times, count, 0.99f),
+		count > 0 ? times[count - 1] : 0.0f);
+}
+
+static int RunHeadless(const HeadlessConfig& config) {
+	if (!fplPlatformInit(fplInitFlags_None, nullptr)) {
+		return -1;
+	}
+
+	fmemMemoryBlock memory = {};
+	if (!fmemInit(&memory, fmemType_Growable, FMEM_MEGABYTES(16))) {
+		fplPlatformRelease();
+		return -1;
+	}
+
+	size_t maxStepCount = (size_t)config.levelCount * HeadlessMaxStepsPerLevel;
+	float* stepTimes = (float*)fmemPush(&memory, sizeof(float) * maxStepCount, fmemPushFlags_None);
+	int* jammedLevelSeeds = (int*)fmemPush(&memory, sizeof(int) * config.levelCount, fmemPushFlags_None);
+
+	// No assets, audio or OpenGL - just the world
+	GameState* state = (GameState*)fmemPush(&memory, sizeof(GameState), fmemPushFlags_Clear);
+	state->isHeadless = true;
+	state->settings = globalStartupSettings;
+	InitWorld(*state);
+	StartGame(*state);
+
+	// @NOTE(final): No game over, so every level runs to the end
+	const int startLifes = INT32_MAX / 2;
+	state->lifes = startLifes;
+
+	GameMemory gameMem = {};
+	gameMem.game = state;
+
+	Input input = {};
+	input.isActive = true;
+	input.deltaTime = HeadlessDeltaTime;
+	input.framesPerSeconds = 1.0f / HeadlessDeltaTime;
+	input.defaultControllerIndex = 0;
+	Controller& controller = input.controllers[0];
+	controller.isConnected = true;
+
+	const PhysicsSettings& physics = state->settings.physics;
+	fplConsoleFormatOut("Headless benchmark (%d levels, %d balls, %d velocity / %d position iterations, %d sub-steps, continuous %s)\n",
+		config.levelCount,
+		state->settings.launchBallCount,
+		physics.velocityIterations,
+		physics.positionIterations,
+		physics.subStepCount,
+		physics.isContinuous ? "on" : "off");
+
+	size_t stepCount = 0;
+	size_t levelStartStep = 0;
+	uint64_t contactSum = 0;
+	int32 maxContactCount = 0;
+	int timedOutLevelCount = 0;
+	int jammedLevelCount = 0;
+	size_t jammedStepCount = 0;
+	int levelSeed = state->levelSeed;
+	int levelStartScore = state->score;
+
+	// Stats at the last broken brick, a jammed level is rolled back to this point
+	size_t progressStep = 0;
+	uint64_t progressContactSum = 0;
+	int32 progressMaxContactCount = 0;
+	int progressScore = state->score;
+
+	for (int levelIndex = 0; levelIndex < config.levelCount;) {
+		UpdatePaddleAI(*state, controller);
+		GameInput(gameMem, input);
+		UpdatePlayMode(*state, input);
+
+		stepTimes[stepCount++] = (float)state->lastPhysicsTime;
+		int32 contactCount = state->world->GetContactCount();
+		contactSum += contactCount;
+		maxContactCount = b2Max(maxContactCount, contactCount);
+
+		if (state->score != progressScore) {
+			progressScore = state->score;
+			progressStep = stepCount;
+			progressContactSum = contactSum;
+			progressMaxContactCount = maxContactCount;
+		}
+
+		// @NOTE(final): The ball can get trapped between wedged bricks, those steps do not describe normal play.
+		// So a level without a broken brick for too long ends early and the steps since the last broken brick are excluded from all stats.
+		bool isJammed = (stepCount - progressStep) >= HeadlessMaxStepsWithoutProgress;
+		bool isTimedOut = !isJammed && (stepCount - levelStartStep) >= HeadlessMaxStepsPerLevel;
+		if (state->levelSeed != levelSeed || isJammed || isTimedOut) {
+			size_t levelJammedStepCount = 0;
+			if (isJammed) {
+				levelJammedStepCount = stepCount - progressStep;
+				stepCount = progressStep;
+				contactSum = progressContactSum;
+				maxContactCount = progressMaxContactCount;
+				jammedStepCount += levelJammedStepCount;
+				jammedLevelSeeds[jammedLevelCount++] = levelSeed;
+			}
+			size_t levelStepCount = stepCount - levelStartStep;
+			fplConsoleFormatOut("Level %d (seed %d): %zu steps, %d bricks",
+				levelIndex + 1,
+				levelSeed,
+				levelStepCount,
+				state->score - levelStartScore);
+			if (isJammed) {
+				fplConsoleFormatOut(" (jammed, %zu steps excluded)", levelJammedStepCount);
+			} else if (isTimedOut) {
+				fplConsoleOut(" (timed out)");
+			}
+			if (levelStepCount > 0) {
+				fplConsoleOut(", physics ");
+				PrintStepTimes(stepTimes + levelStartStep, levelStepCount);
+			}
+			fplConsoleOut("\n");
+			if (isJammed || isTimedOut) {
+				if (isTimedOut) {
+					++timedOutLevelCount;
+				}
+				LoadLevel(*state, levelSeed + 1);
+			}
+			++levelIndex;
+			levelSeed = state->levelSeed;
+			levelStartScore = state->score;
+			levelStartStep = stepCount;
+			progressStep = stepCount;
+			progressContactSum = contactSum;
+			progressMaxContactCount = maxContactCount;
+		}
+	}
+
+	fplConsoleFormatOut("Total: %zu steps, physics ", stepCount);
+	PrintStepTimes(stepTimes, stepCount);
+	fplConsoleOut("\n");
+	fplConsoleFormatOut("Contacts: avg %.1f, max %d, begin %llu\n",
+		stepCount > 0 ? contactSum / (double)stepCount : 0.0,
+		maxContactCount,
+		(unsigned long long)state->beginContactCount);
+	fplConsoleFormatOut("Bricks: %d, lost balls: %d, timed out levels: %d\n", state->score, startLifes - state->lifes, timedOutLevelCount);
+	fplConsoleFormatOut("Jammed levels: %d", jammedLevelCount);
+	if (jammedLevelCount > 0) {
+		fplConsoleOut(" (seeds");
+		for (int i = 0; i < jammedLevelCount; ++i) {
+			fplConsoleFormatOut("%s %d", i > 0 ? "," : "", jammedLevelSeeds[i]);
+		}
+		fplConsoleFormatOut("), %zu steps excluded from the physics and contact stats", jammedStepCount);
+	}
+	fplConsoleOut("\n");
+	fplConsoleFormatOut("State hash: %016llx\n", (unsigned long long)HashGameState(*state));
+
+	ReleaseWorld(*state);
+	state->~GameState();
+	fmemFree(&memory);
+	fplPlatformRelease();
+	return(0);
+}
+
 #define FINAL_GAMEPLATFORM_IMPLEMENTATION
 #include <final_gameplatform.h>
 
 int main(int argc, char* argv[]) {
+	bool isHeadless = false;
+	GameConfiguration config = {};
+	HeadlessConfig headlessConfig = {};
+	headlessConfig.levelCount = 10;
+	for (int i = 1; i < argc; ++i) {
+		if (fplIsStringEqual(argv[i], "-headless")) {
+			isHeadless = true;
+		} else if (fplIsStringEqual(argv[i], "-levels") && (i + 1) < argc) {
+			int levelCount = atoi(argv[++i]);
+			headlessConfig.levelCount = fplMax(1, levelCount);
+		} else if (fplIsStringEqual(argv[i], "-balls") && (i + 1) < argc) {
+			int ballCount = atoi(argv[++i]);
+			globalStartupSettings.launchBallCount = fplMax(1, fplMin(ballCount, (int)MaxExtraBallCount + 1));
+		} else if (fplIsStringEqual(argv[i], "-substeps") && (i + 1) < argc) {
+			int subStepCount = atoi(argv[++i]);
+			globalStartupSettings.physics.subStepCount = fplMax(1, subStepCount);
+		} else if (fplIsStringEqual(argv[i], "-velocityiterations") && (i + 1) < argc) {
+			int velocityIterations = atoi(argv[++i]);
+			globalStartupSettings.physics.velocityIterations = fplMax(1, velocityIterations);
+		} else if (fplIsStringEqual(argv[i], "-positioniterations") && (i + 1) < argc) {
+			int positionIterations = atoi(argv[++i]);
+			globalStartupSettings.physics.positionIterations = fplMax(1, positionIterations);
+		} else if (fplIsStringEqual(argv[i], "-nocontinuous")) {
+			globalStartupSettings.physics.isContinuous = false;
+		} else if (fplIsStringEqual(argv[i], "-fps") && (i + 1) < argc) {
+			int frameRate = atoi(argv[++i]);
+			config.targetFrameRate = (uint32_t)fplMax(0, frameRate);
+		} else if (fplIsStringEqual(argv[i], "-novsync")) {
+			config.noVSync = true;
+		} else if (fplIsStringEqual(argv[i], "-framestats")) {
+			config.showFrameStats = true;
+		} else if (fplIsStringEqual(argv[i], "-record") && (i + 1) < argc) {
+			config.recordFilePath = argv[++i];
+		} else if (fplIsStringEqual(argv[i], "-replay") && (i + 1) < argc) {
+			config.replayFilePath = argv[++i];
+		} else if (fplIsStringEqual(argv[i], "-unlimited")) {
+			config.isUnlimited = true;
+		}
+	}
+	if (isHeadless) {
+		int result = RunHeadless(headlessConfig);
+		return(result);
+	}
+
 	fplSetMaxLogLevel(fplLogLevel_All);
 
-	GameConfiguration config = {};
 	config.title = L"FPL Demo | Crackout";
 	config.hideMouseCursor = true;
 	config.noUpdateRenderSeparation = false;
+	config.checksum = ComputeGameChecksum;
 	config.audioSampleRate = 44100;
 	int result = GameMain(config);
 	return(result);
@@ -13,10 +13,28 @@ Requirements:
 	- FFmpeg-4.2.2-win64-shared (http://ffmpeg.zeranoe.com/builds/)
 	- FFmpeg-4.2.2-win64-dev (http://ffmpeg.zeranoe.com/builds/)
 
+Usage:
+	fpl_ffmpeg [media file] [-headless]
+
+	-headless: Decodes and converts the entire media as fast as possible without a window or audio device,
+	then prints decoded frames/s, sws_scale vs. SIMD conversion times, queue occupancy histograms and the A/V sync error.
+
 Author:
 	Torsten Spaete
 
 Changelog:
+	## 2026-10-18
+	- Headless benchmark mode (-headless)
+	- Preallocated packet pool with a lock-free free list, no more allocations per demuxed packet
+	- Packet queues are bounded single-producer/single-consumer rings
+	- Frame queues use an atomic count instead of a mutex
+	- Queues only signal when they were empty or full, decoder threads wait only when no progress can be made
+	- Fixed packets from a previous serial were never given back to the reader
+	- SSE2 YUV420P to RGBA conversion for software rendering, compared against sws_scale in headless mode
+	- YUV420P planes are copied row by row into orphaned PBOs when the decoder pads the lines
+	- Fixed swapped Cb/Cr coefficients in the GLSL and CPU YUV to RGB conversion
+	- Print upload time per frame (PRINT_FRAME_UPLOAD_INFOS)
+
 	## 2020-04-22
 	- Relative Seeking Support
 	- OSD for displaying media/stream informations
@@ -63,6 +81,7 @@ Features/Planned:
 	[x] Decodes video and audio packets and queues them up as well
 	[x] FFmpeg functions are loaded dynamically
 	[x] Linked list for packet queue
+	[x] Packet pool and lock-free packet/frame queues
 	[x] Handle PTS/DTS to schedule video frame
 	[x] Syncronize video to audio
 	[x] Fix memory leak (There was no leak at all)
@@ -88,7 +107,7 @@ Features/Planned:
 	[x] Image format conversion (YUY2, YUV > RGB24 etc.)
 		[x] GLSL (YUV420P for now)
 		[x] Slow CPU implementation (YUV420P for now)
-		[ ] SIMD YUV420P implementation
+		[x] SIMD YUV420P implementation (SSE2)
 	[ ] Audio format conversion (Downsampling, Upsampling, S16 > F32 etc.)
 		[ ] Slow CPU implementation
 		[ ] SIMD implementation
@@ -264,6 +283,9 @@ constexpr uint32_t MAX_FRAME_QUEUE_COUNT = fplMax(MAX_AUDIO_FRAME_QUEUE_COUNT, M
 // Total size of data from all packet queues
 constexpr uint64_t MAX_PACKET_QUEUE_SIZE = fplMegaBytes(16);
 
+// Number of preallocated packets shared by all packet queues, must be a power of two
+constexpr uint32_t MAX_PACKET_POOL_COUNT = 4096;
+
 // Min number of packet frames in a single queue
 constexpr uint32_t MIN_PACKET_FRAMES = 25;
 
@@ -292,26 +314,25 @@ constexpr int AV_AUDIO_DIFF_AVG_NB = 20;
 constexpr int AV_SAMPLE_CORRECTION_PERCENT_MAX = 10;
 
 //
-// Packet Queue
+// Packet Pool
 //
 static AVPacket globalFlushPacket = {};
 
 struct PacketList {
 	AVPacket packet;
-	PacketList *next;
+	// Index + 1 of the next free packet in the pool, zero terminates the free list
+	volatile uint32_t nextFree;
 	int32_t serial;
 };
 
-struct PacketQueue {
-	fplMutexHandle lock;
-	fplSignalHandle addedSignal;
+// Fixed set of packets, preallocated once, so the reader never hits the allocator while playing.
+// Free packets are kept in a lock-free stack, the head stores an ABA tag in the upper 32-bits and index + 1 in the lower 32-bits.
+struct PacketPool {
+	PacketList *packets;
 	fplSignalHandle freeSignal;
-	PacketList *first;
-	PacketList *last;
-	uint64_t size;
-	uint64_t duration;
-	int32_t packetCount;
-	int32_t serial;
+	volatile uint64_t freeHead;
+	volatile int32_t freeCount;
+	uint32_t capacity;
 };
 
 static bool IsFlushPacket(PacketList *packet) {
@@ -320,130 +341,164 @@ static bool IsFlushPacket(PacketList *packet) {
 	return(result);
 }
 
-static PacketList *AllocatePacket(PacketQueue &queue) {
-	PacketList *packet = (PacketList *)ffmpeg.av_mallocz(sizeof(PacketList));
-	if (packet == nullptr) {
-		return nullptr;
-	}
-	fplAtomicFetchAndAddS32(&globalMemStats.allocatedPackets, 1);
-	return(packet);
-}
-
-static void DestroyPacket(PacketQueue &queue, PacketList *packet) {
-	ffmpeg.av_freep(packet);
-	fplAtomicFetchAndAddS32(&globalMemStats.allocatedPackets, -1);
-}
-
 static void ReleasePacketData(PacketList *packet) {
 	if (!IsFlushPacket(packet)) {
 		ffmpeg.av_packet_unref(&packet->packet);
 	}
 }
 
-static void ReleasePacket(PacketQueue &queue, PacketList *packet) {
+static void ReleasePacket(PacketPool &pool, PacketList *packet) {
+	assert(packet >= pool.packets && packet < (pool.packets + pool.capacity));
 	ReleasePacketData(packet);
-	DestroyPacket(queue, packet);
-	fplSignalSet(&queue.freeSignal);
-}
-
-static bool AquirePacket(PacketQueue &queue, PacketList *&packet) {
-	bool result = false;
-	packet = AllocatePacket(queue);
-	if (packet != nullptr) {
-		result = true;
+	fplClearStruct(&packet->packet);
+	uint32_t index = (uint32_t)(packet - pool.packets) + 1;
+	uint64_t head = fplAtomicLoadU64(&pool.freeHead);
+	for (;;) {
+		fplAtomicStoreU32(&packet->nextFree, (uint32_t)(head & 0xFFFFFFFF));
+		uint64_t newHead = ((((head >> 32) + 1) & 0xFFFFFFFF) << 32) | index;
+		if (fplIsAtomicCompareAndSwapU64(&pool.freeHead, head, newHead)) {
+			break;
+		}
+		head = fplAtomicLoadU64(&pool.freeHead);
+	}
+	// Only wake up the reader when the pool was exhausted
+	if (fplAtomicFetchAndAddS32(&pool.freeCount, 1) == 0) {
+		fplSignalSet(&pool.freeSignal);
 	}
-	return(result);
 }
 
-static void FlushPacketQueue(PacketQueue &queue) {
-	fplMutexLock(&queue.lock);
-	PacketList *p = queue.first;
-	while (p != nullptr) {
-		PacketList *n = p->next;
-		ReleasePacketData(p);
-		DestroyPacket(queue, p);
-		p = n;
+static bool AquirePacket(PacketPool &pool, PacketList *&packet) {
+	uint64_t head = fplAtomicLoadU64(&pool.freeHead);
+	for (;;) {
+		uint32_t index = (uint32_t)(head & 0xFFFFFFFF);
+		if (index == 0) {
+			return false;
+		}
+		PacketList *p = pool.packets + (index - 1);
+		uint32_t nextFree = fplAtomicLoadU32(&p->nextFree);
+		uint64_t newHead = ((((head >> 32) + 1) & 0xFFFFFFFF) << 32) | nextFree;
+		if (fplIsAtomicCompareAndSwapU64(&pool.freeHead, head, newHead)) {
+			fplAtomicFetchAndAddS32(&pool.freeCount, -1);
+			packet = p;
+			packet->nextFree = 0;
+			packet->serial = 0;
+			return true;
+		}
+		head = fplAtomicLoadU64(&pool.freeHead);
 	}
-	queue.first = queue.last = nullptr;
-	queue.packetCount = 0;
-	queue.size = 0;
-	queue.duration = 0;
-	fplMutexUnlock(&queue.lock);
 }
 
-static void DestroyPacketQueue(PacketQueue &queue) {
-	FlushPacketQueue(queue);
-	fplSignalDestroy(&queue.freeSignal);
-	fplSignalDestroy(&queue.addedSignal);
-	fplMutexDestroy(&queue.lock);
+static void DestroyPacketPool(PacketPool &pool) {
+	fplSignalDestroy(&pool.freeSignal);
+	if (pool.packets != nullptr) {
+		fplAtomicFetchAndAddS32(&globalMemStats.allocatedPackets, -(int32_t)pool.capacity);
+		fplMemoryFree(pool.packets);
+		pool.packets = nullptr;
+	}
 }
 
-static bool InitPacketQueue(PacketQueue &queue) {
-	if (!fplMutexInit(&queue.lock)) {
+static bool InitPacketPool(PacketPool &pool, const uint32_t capacity) {
+	if (!fplSignalInit(&pool.freeSignal, fplSignalValue_Unset)) {
 		return false;
 	}
-	if (!fplSignalInit(&queue.addedSignal, fplSignalValue_Unset)) {
+	pool.packets = (PacketList *)fplMemoryAllocate(sizeof(*pool.packets) * capacity);
+	if (pool.packets == nullptr) {
 		return false;
 	}
-	if (!fplSignalInit(&queue.freeSignal, fplSignalValue_Unset)) {
-		return false;
+	pool.capacity = capacity;
+	for (uint32_t i = 0; i < capacity; ++i) {
+		pool.packets[i].nextFree = (i + 1) < capacity ? (i + 2) : 0;
 	}
+	pool.freeHead = 1;
+	pool.freeCount = (int32_t)capacity;
+	fplAtomicFetchAndAddS32(&globalMemStats.allocatedPackets, (int32_t)capacity);
 	return true;
 }
 
+//
+// Packet Queue
+//
+
+// Bounded single-producer/single-consumer ring, the reader thread pushes and exactly one decoder thread pops.
+// Its capacity matches the packet pool, so pushing can never fail.
+struct PacketQueue {
+	PacketList **packets;
+	fplSignalHandle addedSignal;
+	volatile uint64_t size;
+	volatile uint64_t duration;
+	volatile uint32_t readIndex;
+	volatile uint32_t writeIndex;
+	volatile int32_t packetCount;
+	int32_t serial;
+	uint32_t capacity;
+};
+
 static void PushPacket(PacketQueue &queue, PacketList *packet) {
-	fplMutexLock(&queue.lock);
-	{
-		packet->next = nullptr;
-		if (IsFlushPacket(packet)) {
-			queue.serial++;
-		}
-		packet->serial = queue.serial;
-		if (queue.first == nullptr) {
-			queue.first = packet;
-		}
-		if (queue.last != nullptr) {
-			assert(queue.last->next == nullptr);
-			queue.last->next = packet;
-		}
-		queue.last = packet;
-		queue.size += packet->packet.size + sizeof(*packet);
-		queue.duration += packet->packet.duration;
-		fplAtomicFetchAndAddS32(&queue.packetCount, 1);
-		fplAtomicFetchAndAddS32(&globalMemStats.usedPackets, 1);
+	uint32_t writeIndex = queue.writeIndex;
+	assert((writeIndex - fplAtomicLoadU32(&queue.readIndex)) < queue.capacity);
+	if (IsFlushPacket(packet)) {
+		fplAtomicStoreS32(&queue.serial, queue.serial + 1);
+	}
+	packet->serial = queue.serial;
+	queue.packets[writeIndex & (queue.capacity - 1)] = packet;
+	fplAtomicFetchAndAddU64(&queue.size, packet->packet.size + sizeof(*packet));
+	fplAtomicFetchAndAddU64(&queue.duration, (uint64_t)packet->packet.duration);
+	fplAtomicStoreU32(&queue.writeIndex, writeIndex + 1);
+	fplAtomicFetchAndAddS32(&globalMemStats.usedPackets, 1);
+	// Only wake up the decoder when the queue was empty
+	if (fplAtomicFetchAndAddS32(&queue.packetCount, 1) == 0) {
 		fplSignalSet(&queue.addedSignal);
 	}
-	fplMutexUnlock(&queue.lock);
 }
 
 static bool PopPacket(PacketQueue &queue, PacketList *&packet) {
-	bool result = false;
-	fplMutexLock(&queue.lock);
-	{
-		if (queue.first != nullptr) {
-			PacketList *p = queue.first;
-			PacketList *n = p->next;
-			queue.first = n;
-			p->next = nullptr;
-			packet = p;
-			queue.duration -= packet->packet.duration;
-			queue.size -= packet->packet.size + sizeof(*packet);
-			if (queue.first == nullptr) {
-				queue.last = nullptr;
-			}
-			fplAtomicFetchAndAddS32(&queue.packetCount, -1);
-			fplAtomicFetchAndAddS32(&globalMemStats.usedPackets, -1);
-			result = true;
-		}
+	uint32_t readIndex = queue.readIndex;
+	if (readIndex == fplAtomicLoadU32(&queue.writeIndex)) {
+		return false;
 	}
-	fplMutexUnlock(&queue.lock);
-	return(result);
+	packet = queue.packets[readIndex & (queue.capacity - 1)];
+	fplAtomicFetchAndAddU64(&queue.duration, (uint64_t)-packet->packet.duration);
+	fplAtomicFetchAndAddU64(&queue.size, (uint64_t)0 - (packet->packet.size + sizeof(*packet)));
+	fplAtomicStoreU32(&queue.readIndex, readIndex + 1);
+	fplAtomicFetchAndAddS32(&queue.packetCount, -1);
+	fplAtomicFetchAndAddS32(&globalMemStats.usedPackets, -1);
+	return true;
+}
+
+// Must only be called when the consuming decoder thread is not running
+static void FlushPacketQueue(PacketQueue &queue, PacketPool &pool) {
+	PacketList *p;
+	while (PopPacket(queue, p)) {
+		ReleasePacket(pool, p);
+	}
+}
+
+static void DestroyPacketQueue(PacketQueue &queue) {
+	assert(queue.readIndex == queue.writeIndex);
+	fplSignalDestroy(&queue.addedSignal);
+	if (queue.packets != nullptr) {
+		fplMemoryFree(queue.packets);
+		queue.packets = nullptr;
+	}
+}
+
+static bool InitPacketQueue(PacketQueue &queue, const uint32_t capacity) {
+	assert(fplIsPowerOfTwo(capacity));
+	if (!fplSignalInit(&queue.addedSignal, fplSignalValue_Unset)) {
+		return false;
+	}
+	queue.packets = (PacketList **)fplMemoryAllocate(sizeof(*queue.packets) * capacity);
+	if (queue.packets == nullptr) {
+		return false;
+	}
+	queue.capacity = capacity;
+	return true;
 }
 
-static bool PushNullPacket(PacketQueue &queue, int streamIndex) {
+static bool PushNullPacket(PacketPool &pool, PacketQueue &queue, int streamIndex) {
 	bool result = false;
 	PacketList *packet = nullptr;
-	if (AquirePacket(queue, packet)) {
+	if (AquirePacket(pool, packet)) {
 		ffmpeg.av_init_packet(&packet->packet);
 		packet->packet.data = nullptr;
 		packet->packet.size = 0;
@@ -454,10 +509,10 @@ static bool PushNullPacket(PacketQueue &queue, int streamIndex) {
 	return(result);
 }
 
-static bool PushFlushPacket(PacketQueue &queue) {
+static bool PushFlushPacket(PacketPool &pool, PacketQueue &queue) {
 	bool result = false;
 	PacketList *packet = nullptr;
-	if (AquirePacket(queue, packet)) {
+	if (AquirePacket(pool, packet)) {
 		packet->packet = globalFlushPacket;
 		PushPacket(queue, packet);
 		result = true;
@@ -465,10 +520,10 @@ static bool PushFlushPacket(PacketQueue &queue) {
 	return(result);
 }
 
-static void StartPacketQueue(PacketQueue &queue) {
-	fplMutexLock(&queue.lock);
-	assert(PushFlushPacket(queue));
-	fplMutexUnlock(&queue.lock);
+static void StartPacketQueue(PacketPool &pool, PacketQueue &queue) {
+	if (!PushFlushPacket(pool, queue)) {
+		assert(!"Packet pool exhausted");
+	}
 }
 
 //
@@ -503,13 +558,13 @@ static void FreeFrame(Frame *frame) {
 
 struct FrameQueue {
 	Frame frames[MAX_FRAME_QUEUE_COUNT];
-	fplMutexHandle lock;
+	// Signaled when the queue is no longer full
 	fplSignalHandle signal;
 	PacketList *pendingPacket;
 	volatile uint32_t *stopped;
 	int32_t readIndex;
 	int32_t writeIndex;
-	int32_t count;
+	volatile int32_t count;
 	int32_t capacity;
 	int32_t keepLast;
 	int32_t readIndexShown;
@@ -531,9 +586,6 @@ static bool InitFrameQueue(FrameQueue &queue, int32_t capacity, volatile uint32_
 	queue.keepLast = !!keepLast;
 	queue.stopped = stopped;
 
-	if (!fplMutexInit(&queue.lock)) {
-		return false;
-	}
 	if (!fplSignalInit(&queue.signal, fplSignalValue_Unset)) {
 		return false;
 	}
@@ -544,7 +596,6 @@ static bool InitFrameQueue(FrameQueue &queue, int32_t capacity, volatile uint32_
 
 static void DestroyFrameQueue(FrameQueue &queue) {
 	fplSignalDestroy(&queue.signal);
-	fplMutexDestroy(&queue.lock);
 	for (int64_t i = 0; i < queue.capacity; ++i) {
 		Frame *frame = queue.frames + i;
 		FreeFrame(frame);
@@ -564,14 +615,7 @@ static Frame *PeekFrameQueueLast(FrameQueue &queue) {
 }
 
 static bool PeekWritableFromFrameQueue(FrameQueue &queue, Frame *&frame) {
-	fplMutexLock(&queue.lock);
-	if (queue.count >= queue.capacity || *queue.stopped) {
-		fplMutexUnlock(&queue.lock);
-		return false;
-	}
-	fplMutexUnlock(&queue.lock);
-
-	if (*queue.stopped) {
+	if (fplAtomicLoadS32(&queue.count) >= queue.capacity || *queue.stopped) {
 		return false;
 	}
 
@@ -580,14 +624,7 @@ static bool PeekWritableFromFrameQueue(FrameQueue &queue, Frame *&frame) {
 }
 
 static bool PeekReadableFromFrameQueue(FrameQueue &queue, Frame *&frame) {
-	fplMutexLock(&queue.lock);
-	if ((queue.count - queue.readIndexShown) <= 0 || *queue.stopped) {
-		fplMutexUnlock(&queue.lock);
-		return false;
-	}
-	fplMutexUnlock(&queue.lock);
-
-	if (*queue.stopped) {
+	if ((fplAtomicLoadS32(&queue.count) - queue.readIndexShown) <= 0 || *queue.stopped) {
 		return false;
 	}
 
@@ -597,11 +634,7 @@ static bool PeekReadableFromFrameQueue(FrameQueue &queue, Frame *&frame) {
 
 static void NextWritable(FrameQueue &queue) {
 	queue.writeIndex = (queue.writeIndex + 1) % queue.capacity;
-
-	fplMutexLock(&queue.lock);
-	queue.count++;
-	fplSignalSet(&queue.signal);
-	fplMutexUnlock(&queue.lock);
+	fplAtomicFetchAndAddS32(&queue.count, 1);
 }
 
 static void NextReadable(FrameQueue &queue) {
@@ -613,10 +646,10 @@ static void NextReadable(FrameQueue &queue) {
 	FreeFrameData(&queue.frames[queue.readIndex]);
 	queue.readIndex = (queue.readIndex + 1) % queue.capacity;
 
-	fplMutexLock(&queue.lock);
-	queue.count--;
-	fplSignalSet(&queue.signal);
-	fplMutexUnlock(&queue.lock);
+	// Only wake up the decoder when the queue was full
+	if (fplAtomicFetchAndAddS32(&queue.count, -1) >= queue.capacity) {
+		fplSignalSet(&queue.signal);
+	}
 }
 
 static int32_t GetFrameQueueRemainingCount(const FrameQueue &queue) {
@@ -635,7 +668,7 @@ struct MediaStream {
 };
 
 struct ReaderContext {
-	PacketQueue packetQueue;
+	PacketPool packetPool;
 	fplMutexHandle lock;
 	fplSignalHandle stopSignal;
 	fplSignalHandle resumeSignal;
@@ -656,14 +689,14 @@ static bool InitReader(ReaderContext &outReader) {
 	if (!fplSignalInit(&outReader.resumeSignal, fplSignalValue_Unset)) {
 		return false;
 	}
-	if (!InitPacketQueue(outReader.packetQueue)) {
+	if (!InitPacketPool(outReader.packetPool, MAX_PACKET_POOL_COUNT)) {
 		return false;
 	}
 	return true;
 }
 
 static void DestroyReader(ReaderContext &reader) {
-	DestroyPacketQueue(reader.packetQueue);
+	DestroyPacketPool(reader.packetPool);
 	fplSignalDestroy(&reader.resumeSignal);
 	fplSignalDestroy(&reader.stopSignal);
 	fplMutexDestroy(&reader.lock);
@@ -724,7 +757,7 @@ static bool InitDecoder(Decoder &outDecoder, PlayerState *state, ReaderContext *
 	if (!fplSignalInit(&outDecoder.resumeSignal, fplSignalValue_Unset)) {
 		return false;
 	}
-	if (!InitPacketQueue(outDecoder.packetsQueue)) {
+	if (!InitPacketQueue(outDecoder.packetsQueue, MAX_PACKET_POOL_COUNT)) {
 		return false;
 	}
 	if (!InitFrameQueue(outDecoder.frameQueue, frameCapacity, &outDecoder.stopRequest, keepLast)) {
@@ -743,7 +776,7 @@ static void DestroyDecoder(Decoder &decoder) {
 }
 
 static void StartDecoder(Decoder &decoder, fpl_run_thread_callback *decoderThreadFunc) {
-	StartPacketQueue(decoder.packetsQueue);
+	StartPacketQueue(decoder.reader->packetPool, decoder.packetsQueue);
 	assert(decoder.thread == nullptr);
 	decoder.thread = fplThreadCreate(decoderThreadFunc, &decoder);
 }
@@ -754,7 +787,12 @@ static void StopDecoder(Decoder &decoder) {
 	fplThreadWaitForOne(decoder.thread, FPL_TIMEOUT_INFINITE);
 	fplThreadTerminate(decoder.thread);
 	decoder.thread = nullptr;
-	FlushPacketQueue(decoder.packetsQueue);
+	if (decoder.frameQueue.hasPendingPacket) {
+		ReleasePacket(decoder.reader->packetPool, decoder.frameQueue.pendingPacket);
+		decoder.frameQueue.pendingPacket = nullptr;
+		decoder.frameQueue.hasPendingPacket = false;
+	}
+	FlushPacketQueue(decoder.packetsQueue, decoder.reader->packetPool);
 }
 
 static void AddPacketToDecoder(Decoder &decoder, PacketList *targetPacket, AVPacket *sourcePacket) {
@@ -907,6 +945,8 @@ static uint8_t *LockVideoTexture(VideoTexture &texture) {
 #if USE_HARDWARE_RENDERING
 #	if USE_GL_PBO
 	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, texture.pboId);
+	// Orphan the previous storage, so mapping does not wait for the last upload to finish
+	glBufferData(GL_PIXEL_UNPACK_BUFFER, texture.rowSize * texture.height, nullptr, GL_STREAM_DRAW);
 	result = (uint8_t *)glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
 	CheckGLError();
 #	else
@@ -973,6 +1013,11 @@ struct VideoContext {
 #endif
 
 	SwsContext *softwareScaleCtx;
+	// @NOTE(final): Headless mode only, sws_scale() converts into this buffer instead of the textures
+	uint8_t *conversionVideoBuffer;
+	// @NOTE(final): Headless mode only, our SIMD conversion writes into this buffer, so it can be compared against sws_scale()
+	uint8_t *comparisonVideoBuffer;
+	int32_t conversionVideoRowSize;
 	uint32_t targetTextureCount;
 };
 
@@ -1006,8 +1051,16 @@ static void UploadTexture(VideoContext &video, const AVFrame *sourceNativeFrame)
 				VideoTexture &targetTexture = video.targetTextures[textureIndex];
 				uint8_t *data = LockVideoTexture(targetTexture);
 				assert(data != nullptr);
-				uint32_t h = (textureIndex == 0) ? sourceNativeFrame->height : sourceNativeFrame->height / 2;
-				fplMemoryCopy(sourceNativeFrame->data[textureIndex], sourceNativeFrame->linesize[textureIndex] * h, data);
+				const uint8_t *sourcePlane = sourceNativeFrame->data[textureIndex];
+				int32_t sourceLineSize = sourceNativeFrame->linesize[textureIndex];
+				if (sourceLineSize == targetTexture.rowSize) {
+					fplMemoryCopy(sourcePlane, targetTexture.rowSize * targetTexture.height, data);
+				} else {
+					// Decoders pad the lines, so the plane must be copied row by row
+					for (int32_t y = 0; y < targetTexture.height; ++y) {
+						fplMemoryCopy(sourcePlane + y * sourceLineSize, targetTexture.rowSize, data + y * targetTexture.rowSize);
+					}
+				}
 				UnlockVideoTexture(targetTexture);
 			}
 			break;
@@ -1041,7 +1094,7 @@ static void UploadTexture(VideoContext &video, const AVFrame *sourceNativeFrame)
 #	endif
 	switch (sourceNativeFrame->format) {
 		case AVPixelFormat::AV_PIX_FMT_YUV420P:
-			ConvertYUV420PToRGB32(dstData, dstLineSize, targetTexture.width, targetTexture.height, srcData, srcLineSize, flags);
+			ConvertYUV420PToRGB32SSE2(dstData, dstLineSize, targetTexture.width, targetTexture.height, srcData, srcLineSize, flags);
 			break;
 		default:
 			ffmpeg.sws_scale(video.softwareScaleCtx, (uint8_t const *const *)srcData, srcLineSize, 0, videoCodecCtx->height, dstData, dstLineSize);
@@ -1052,6 +1105,35 @@ static void UploadTexture(VideoContext &video, const AVFrame *sourceNativeFrame)
 #endif
 }
 
+static void ConvertVideoFrame(VideoContext &video, const AVFrame *sourceNativeFrame) {
+	assert(video.conversionVideoBuffer != nullptr);
+	AVCodecContext *videoCodecCtx = video.stream.codecContext;
+	int32_t dstLineSize[8] = { video.conversionVideoRowSize, 0 };
+	uint8_t *dstData[8] = { video.conversionVideoBuffer, nullptr };
+	ffmpeg.sws_scale(video.softwareScaleCtx, (uint8_t const *const *)sourceNativeFrame->data, sourceNativeFrame->linesize, 0, videoCodecCtx->height, dstData, dstLineSize);
+}
+
+static bool ConvertVideoFrameSIMD(VideoContext &video, const AVFrame *sourceNativeFrame) {
+	assert(video.comparisonVideoBuffer != nullptr);
+	if (sourceNativeFrame->format != AVPixelFormat::AV_PIX_FMT_YUV420P) {
+		return false;
+	}
+	int32_t dstLineSize[8] = { video.conversionVideoRowSize, 0 };
+	uint8_t *dstData[8] = { video.comparisonVideoBuffer, nullptr };
+	uint8_t *srcData[8];
+	int32_t srcLineSize[8];
+	for (int i = 0; i < 8; ++i) {
+		srcData[i] = sourceNativeFrame->data[i];
+		srcLineSize[i] = sourceNativeFrame->linesize[i];
+	}
+	ConversionFlags flags = ConversionFlags::None;
+#if USE_HARDWARE_RENDERING
+	flags |= ConversionFlags::DstBGRA;
+#endif
+	ConvertYUV420PToRGB32SSE2(dstData, dstLineSize, sourceNativeFrame->width, sourceNativeFrame->height, srcData, srcLineSize, flags);
+	return true;
+}
+
 //
 // Audio
 //
@@ -1707,6 +1789,7 @@ struct PlayerState {
 	bool32 lastPaused;
 	bool32 isFullscreen;
 	bool32 seekByBytes;
+	bool32 isHeadless;
 };
 
 static void ReleasePlayer(PlayerState &state) {
@@ -1715,35 +1798,37 @@ static void ReleasePlayer(PlayerState &state) {
 }
 
 static bool InitPlayer(PlayerState &state) {
-	//
-	// OpenGL
-	//
+	// Headless mode has no window, so there is nothing to render into
+	if (!state.isHeadless) {
+		//
+		// OpenGL
+		//
 #if USE_HARDWARE_RENDERING
 #if USE_GL_BLENDING
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		glEnable(GL_BLEND);
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 #else
-	glDisable(GL_BLEND);
+		glDisable(GL_BLEND);
 #endif
 
-	glCullFace(GL_BACK);
-	glFrontFace(GL_CCW);
-	glEnable(GL_CULL_FACE);
+		glCullFace(GL_BACK);
+		glFrontFace(GL_CCW);
+		glEnable(GL_CULL_FACE);
 #endif
 
-//
-// Font Info
-//
-	uint32_t firstChar = ' ';
-	uint32_t charCount = '~' - firstChar;
-	if (!LoadFontInfo(sulphurPointRegularData, sulphurPointRegularDataSize, 1024, 1024, firstChar, charCount, 40.0f, &state.fontInfo)) {
-		ReleasePlayer(state);
-		return(false);
-	}
-
-	// Font Buffer
-	state.fontBuffer = AllocFontBuffer(state.fontInfo.atlasWidth, state.fontInfo.atlasHeight, state.fontInfo.atlasBitmap);
+		//
+		// Font Info
+		//
+		uint32_t firstChar = ' ';
+		uint32_t charCount = '~' - firstChar;
+		if (!LoadFontInfo(sulphurPointRegularData, sulphurPointRegularDataSize, 1024, 1024, firstChar, charCount, 40.0f, &state.fontInfo)) {
+			ReleasePlayer(state);
+			return(false);
+		}
 
+		// Font Buffer
+		state.fontBuffer = AllocFontBuffer(state.fontInfo.atlasWidth, state.fontInfo.atlasHeight, state.fontInfo.atlasBitmap);
+	}
 
 	//
 	// Settings
@@ -1759,7 +1844,7 @@ static bool InitPlayer(PlayerState &state) {
 // Utils
 //
 static void PutPacketBackToReader(ReaderContext &reader, PacketList *packet) {
-	ReleasePacket(reader.packetQueue, packet);
+	ReleasePacket(reader.packetPool, packet);
 }
 
 static bool StreamHasEnoughPackets(const AVStream *stream, const int streamIndex, const PacketQueue &queue) {
@@ -1859,7 +1944,7 @@ static DecodeResult DecodeFrame(ReaderContext &reader, Decoder &decoder, AVFrame
 	int ret = AVERROR(EAGAIN);
 	PacketList *pkt;
 	for (;;) {
-		if (decoder.packetsQueue.serial == decoder.pktSerial) {
+		if (fplAtomicLoadS32(&decoder.packetsQueue.serial) == decoder.pktSerial) {
 			do {
 				if (decoder.isEOF) {
 					return DecodeResult::Skipped;
@@ -1913,13 +1998,18 @@ static DecodeResult DecodeFrame(ReaderContext &reader, Decoder &decoder, AVFrame
 			} while (ret != AVERROR(EAGAIN));
 		}
 
+		pkt = nullptr;
 		do {
+			// Packets from a previous serial (before seeking) are not decoded, just given back
+			if (pkt != nullptr) {
+				PutPacketBackToReader(reader, pkt);
+				pkt = nullptr;
+			}
 			if (decoder.frameQueue.hasPendingPacket) {
 				assert(decoder.frameQueue.pendingPacket != nullptr);
 				pkt = decoder.frameQueue.pendingPacket;
 				decoder.frameQueue.hasPendingPacket = false;
 			} else {
-				pkt = nullptr;
 				if (PopPacket(decoder.packetsQueue, pkt)) {
 					decoder.pktSerial = pkt->serial;
 				} else {
@@ -1927,7 +2017,7 @@ static DecodeResult DecodeFrame(ReaderContext &reader, Decoder &decoder, AVFrame
 					return DecodeResult::RequireMorePackets;
 				}
 			}
-		} while (decoder.packetsQueue.serial != decoder.pktSerial);
+		} while (fplAtomicLoadS32(&decoder.packetsQueue.serial) != decoder.pktSerial);
 
 		if (pkt != nullptr) {
 			if (IsFlushPacket(pkt)) {
@@ -2003,9 +2093,15 @@ static void VideoDecodingThreadProc(const fplThreadHandle *thread, void *userDat
 
 	AVFrame *sourceFrame = ffmpeg.av_frame_alloc();
 	bool hasDecodedFrame = false;
+	bool skipWait = true;
 	for (;;) {
-		// Wait for any signal (Available packet, Free frame, Stopped, Wake up)
-		fplSignalWaitForAny(waitSignals, fplArrayCount(waitSignals), sizeof(fplSignalHandle *), FPL_TIMEOUT_INFINITE);
+		// Wait for any signal (Available packet, Free frame, Stopped, Wake up) or skip wait.
+		// The queues only signal when they were empty or full, so we wait only when we cannot make any progress.
+		if (!skipWait) {
+			fplSignalWaitForAny(waitSignals, fplArrayCount(waitSignals), sizeof(fplSignalHandle *), FPL_TIMEOUT_INFINITE);
+		} else {
+			skipWait = false;
+		}
 
 		// Stop decoder
 		if (decoder->stopRequest) {
@@ -2057,6 +2153,7 @@ static void VideoDecodingThreadProc(const fplThreadHandle *thread, void *userDat
 							state->frame_drops_early++;
 							ffmpeg.av_frame_unref(sourceFrame);
 							hasDecodedFrame = false;
+							skipWait = true;
 #if PRINT_FRAME_DROPS
 							FPL_LOG_INFO("App", "Frame drops: %d/%d\n", state->frame_drops_early, state->frame_drops_late);
 #endif
@@ -2072,6 +2169,7 @@ static void VideoDecodingThreadProc(const fplThreadHandle *thread, void *userDat
 				QueuePicture(*decoder, sourceFrame, targetFrame, decoder->pktSerial);
 				ffmpeg.av_frame_unref(sourceFrame);
 				hasDecodedFrame = false;
+				skipWait = true;
 			}
 		}
 
@@ -2155,9 +2253,15 @@ static void AudioDecodingThreadProc(const fplThreadHandle *thread, void *userDat
 
 	AVFrame *sourceFrame = ffmpeg.av_frame_alloc();
 	bool hasDecodedFrame = false;
+	bool skipWait = true;
 	for (;;) {
-		// Wait for any signal (Available packet, Free frame, Stopped, Wake up)
-		fplSignalWaitForAny(waitSignals, fplArrayCount(waitSignals), sizeof(fplSignalHandle *), FPL_TIMEOUT_INFINITE);
+		// Wait for any signal (Available packet, Free frame, Stopped, Wake up) or skip wait.
+		// The queues only signal when they were empty or full, so we wait only when we cannot make any progress.
+		if (!skipWait) {
+			fplSignalWaitForAny(waitSignals, fplArrayCount(waitSignals), sizeof(fplSignalHandle *), FPL_TIMEOUT_INFINITE);
+		} else {
+			skipWait = false;
+		}
 
 		// Stop decoder
 		if (decoder->stopRequest) {
@@ -2202,6 +2306,7 @@ static void AudioDecodingThreadProc(const fplThreadHandle *thread, void *userDat
 				QueueSamples(*decoder, sourceFrame, targetFrame, decoder->pktSerial);
 				ffmpeg.av_frame_unref(sourceFrame);
 				hasDecodedFrame = false;
+				skipWait = true;
 			}
 		}
 	}
@@ -2416,6 +2521,22 @@ static void StepToNextFrame(PlayerState *state) {
 	state->step = 1;
 }
 
+// A seek relies on the flush packet to bump the queue serial, so it must never be dropped.
+// When the pool is exhausted, this waits until a decoder gives a packet back. Returns false when the reader was stopped meanwhile.
+static bool PushSeekFlushPacket(ReaderContext &reader, PacketQueue &queue) {
+	fplSignalHandle *waitSignals[] = {
+		&reader.packetPool.freeSignal,
+		&reader.stopSignal,
+	};
+	while (!PushFlushPacket(reader.packetPool, queue)) {
+		if (reader.stopRequest) {
+			return false;
+		}
+		fplSignalWaitForAny(waitSignals, fplArrayCount(waitSignals), sizeof(fplSignalHandle *), 10);
+	}
+	return true;
+}
+
 static void PacketReadThreadProc(const fplThreadHandle *thread, void *userData) {
 	PlayerState *state = (PlayerState *)userData;
 	assert(state != nullptr);
@@ -2430,7 +2551,7 @@ static void PacketReadThreadProc(const fplThreadHandle *thread, void *userData)
 
 	fplSignalHandle *waitSignals[] = {
 		// We got a free packet for use to read into
-		&reader.packetQueue.freeSignal,
+		&reader.packetPool.freeSignal,
 		// Reader should terminate
 		&reader.stopSignal,
 		// Reader can continue
@@ -2480,17 +2601,20 @@ static void PacketReadThreadProc(const fplThreadHandle *thread, void *userData)
 			if (seekResult < 0) {
 				// @TODO(final): Log seek error
 			} else {
+				// The decoders drop all packets from the previous serial by themselves
 				if (state->audio.stream.isValid) {
-					FlushPacketQueue(state->audio.decoder.packetsQueue);
-					PushFlushPacket(state->audio.decoder.packetsQueue);
+					if (!PushSeekFlushPacket(reader, state->audio.decoder.packetsQueue)) {
+						break;
+					}
 
 					state->audio.decoder.isEOF = false;
 					fplSignalSet(&state->audio.decoder.resumeSignal);
 				}
 
 				if (state->video.stream.isValid) {
-					FlushPacketQueue(state->video.decoder.packetsQueue);
-					PushFlushPacket(state->video.decoder.packetsQueue);
+					if (!PushSeekFlushPacket(reader, state->video.decoder.packetsQueue)) {
+						break;
+					}
 
 					state->video.decoder.isEOF = false;
 					fplSignalSet(&state->video.decoder.resumeSignal);
@@ -2549,10 +2673,10 @@ static void PacketReadThreadProc(const fplThreadHandle *thread, void *userData)
 			if (res < 0) {
 				if ((res == AVERROR_EOF || ffmpeg.avio_feof(formatCtx->pb)) && !reader.isEOF) {
 					if (video.stream.isValid) {
-						PushNullPacket(video.decoder.packetsQueue, video.stream.streamIndex);
+						PushNullPacket(reader.packetPool, video.decoder.packetsQueue, video.stream.streamIndex);
 					}
 					if (audio.stream.isValid) {
-						PushNullPacket(audio.decoder.packetsQueue, audio.stream.streamIndex);
+						PushNullPacket(reader.packetPool, audio.decoder.packetsQueue, audio.stream.streamIndex);
 					}
 					reader.isEOF = true;
 				}
@@ -2574,7 +2698,7 @@ static void PacketReadThreadProc(const fplThreadHandle *thread, void *userData)
 		if (hasPendingPacket) {
 			// Try to get new packet from the freelist
 			PacketList *targetPacket = nullptr;
-			if (AquirePacket(reader.packetQueue, targetPacket)) {
+			if (AquirePacket(reader.packetPool, targetPacket)) {
 				assert(targetPacket != nullptr);
 
 #if PRINT_QUEUE_INFOS
@@ -2604,10 +2728,12 @@ static void PacketReadThreadProc(const fplThreadHandle *thread, void *userData)
 					ConsoleFormatOut("Dropped packet %lu\n", packetIndex);
 #endif
 					ffmpeg.av_packet_unref(&srcPacket);
+					ReleasePacket(reader.packetPool, targetPacket);
 				}
 				hasPendingPacket = false;
+				skipWait = true;
 			}
-			skipWait = true;
+			// Otherwise the pool is exhausted, so we wait until any decoder gives a packet back
 		}
 	}
 
@@ -2811,8 +2937,11 @@ static void RenderVideoFrame(PlayerState *state) {
 	Frame *vp = PeekFrameQueueLast(state->video.decoder.frameQueue);
 	VideoContext &video = state->video;
 	bool wasUploaded = false;
+	double uploadTime = 0.0;
 	if (!vp->isUploaded) {
+		double uploadStart = fplGetTimeInMillisecondsHP();
 		UploadTexture(video, vp->frame);
+		uploadTime = fplGetTimeInMillisecondsHP() - uploadStart;
 		vp->isUploaded = true;
 		wasUploaded = true;
 	}
@@ -2927,7 +3056,11 @@ static void RenderVideoFrame(PlayerState *state) {
 	fplVideoFlip();
 
 #if PRINT_FRAME_UPLOAD_INFOS
-	ConsoleFormatOut("Displayed frame: %d(%s)\n", readIndex, (wasUploaded ? " (New)" : ""));
+	if (wasUploaded) {
+		ConsoleFormatOut("Displayed frame: %d (New, uploaded in %.3f ms)\n", readIndex, uploadTime);
+	} else {
+		ConsoleFormatOut("Displayed frame: %d\n", readIndex);
+	}
 #endif
 }
 
@@ -3023,12 +3156,9 @@ static void VideoRefresh(PlayerState *state, double &remainingTime, int &display
 				state->frameTimer = time;
 			}
 
-			// @TODO(final): Why do we need to lock the frame queue here?
-			fplMutexLock(&state->video.decoder.frameQueue.lock);
 			if (!isnan(vp->pts)) {
 				UpdateVideoClock(state, vp->pts, vp->serial);
 			}
-			fplMutexUnlock(&state->video.decoder.frameQueue.lock);
 
 			// When we got more than one frame we may drop this frame entirely
 			if (GetFrameQueueRemainingCount(state->video.decoder.frameQueue) > 1) {
@@ -3058,11 +3188,6 @@ static void VideoRefresh(PlayerState *state, double &remainingTime, int &display
 		if (!state->settings.isVideoDisabled && state->forceRefresh && state->video.decoder.frameQueue.readIndexShown) {
 			RenderVideoFrame(state);
 			displayCount++;
-		} else {
-			if (state->video.decoder.frameQueue.count < state->video.decoder.frameQueue.capacity) {
-				// @TODO(final): This is not great, but a fix to not wait forever in the video decoding thread
-				fplSignalSet(&state->video.decoder.frameQueue.signal);
-			}
 		}
 	}
 	state->forceRefresh = 0;
@@ -3084,14 +3209,29 @@ static int DecodeInterruptCallback(void *opaque) {
 
 static void ReleaseVideoContext(VideoContext &video) {
 #if USE_HARDWARE_RENDERING
-	glDeleteProgram(video.basicShader.programId);
-	video.basicShader.programId = 0;
-	glDeleteBuffers(1, &video.indexBufferId);
-	video.indexBufferId = 0;
-	glDeleteBuffers(1, &video.vertexBufferId);
-	video.vertexBufferId = 0;
+	if (video.basicShader.programId) {
+		glDeleteProgram(video.basicShader.programId);
+		video.basicShader.programId = 0;
+	}
+	if (video.indexBufferId) {
+		glDeleteBuffers(1, &video.indexBufferId);
+		video.indexBufferId = 0;
+	}
+	if (video.vertexBufferId) {
+		glDeleteBuffers(1, &video.vertexBufferId);
+		video.vertexBufferId = 0;
+	}
 #endif
 
+	if (video.conversionVideoBuffer != nullptr) {
+		fplMemoryAlignedFree(video.conversionVideoBuffer);
+		video.conversionVideoBuffer = nullptr;
+	}
+	if (video.comparisonVideoBuffer != nullptr) {
+		fplMemoryAlignedFree(video.comparisonVideoBuffer);
+		video.comparisonVideoBuffer = nullptr;
+	}
+
 	for (uint32_t textureIndex = 0; textureIndex < video.targetTextureCount; ++textureIndex) {
 		if (video.targetTextures[textureIndex].id) {
 			DestroyVideoTexture(video.targetTextures[textureIndex]);
@@ -3124,6 +3264,10 @@ static bool InitializeVideo(PlayerState &state, const char *mediaFilePath) {
 	targetPixelFormat = AVPixelFormat::AV_PIX_FMT_BGRA;
 #endif
 
+	state.frameTimer = 0.0;
+	state.frameLastPTS = 0.0;
+	state.frameLastDelay = 40e-3;
+
 	// Get software context
 	video.softwareScaleCtx = ffmpeg.sws_getContext(
 		videoCodexCtx->width,
@@ -3142,6 +3286,18 @@ static bool InitializeVideo(PlayerState &state, const char *mediaFilePath) {
 		return false;
 	}
 
+	// Headless mode always converts with sws_scale() into memory, no textures or shaders are required
+	if (state.isHeadless) {
+		video.conversionVideoRowSize = videoCodexCtx->width * 4;
+		video.conversionVideoBuffer = (uint8_t *)fplMemoryAlignedAllocate(video.conversionVideoRowSize * videoCodexCtx->height, 16);
+		video.comparisonVideoBuffer = (uint8_t *)fplMemoryAlignedAllocate(video.conversionVideoRowSize * videoCodexCtx->height, 16);
+		if ((video.conversionVideoBuffer == nullptr) || (video.comparisonVideoBuffer == nullptr)) {
+			FPL_LOG_ERROR("App", "Failed allocating video conversion buffer with size (%d x %d) for file '%s'!\n", videoCodexCtx->width, videoCodexCtx->height, mediaFilePath);
+			return false;
+		}
+		return true;
+	}
+
 #if USE_HARDWARE_RENDERING && USE_GLSL_IMAGE_FORMAT_DECODING
 	switch (videoCodexCtx->pix_fmt) {
 		case AVPixelFormat::AV_PIX_FMT_YUV420P:
@@ -3217,10 +3373,6 @@ static bool InitializeVideo(PlayerState &state, const char *mediaFilePath) {
 	CheckGLError();
 #endif
 
-	state.frameTimer = 0.0;
-	state.frameLastPTS = 0.0;
-	state.frameLastDelay = 40e-3;
-
 	return true;
 }
 
@@ -3432,6 +3584,264 @@ static void SeekRelative(PlayerState *state, double incr) {
 	}
 }
 
+//
+// Headless benchmark
+//
+constexpr uint32_t MAX_HISTOGRAM_BUCKET_COUNT = 14;
+
+// Number of audio frames pulled through the audio callback at once in headless mode
+constexpr uint32_t HEADLESS_AUDIO_CHUNK_FRAME_COUNT = 512;
+
+struct QueueHistogram {
+	uint64_t buckets[MAX_HISTOGRAM_BUCKET_COUNT];
+	uint64_t sampleCount;
+	const char *name;
+	bool32 isPowerOfTwo;
+};
+
+static void AddHistogramSample(QueueHistogram &histogram, const int32_t value) {
+	uint32_t bucket = 0;
+	if (histogram.isPowerOfTwo) {
+		// 0, 1, 2-3, 4-7, 8-15, ...
+		uint32_t v = (uint32_t)fplMax(value, 0);
+		while (v > 0 && bucket < (MAX_HISTOGRAM_BUCKET_COUNT - 1)) {
+			v >>= 1;
+			++bucket;
+		}
+	} else {
+		bucket = (uint32_t)fplMin(fplMax(value, 0), (int32_t)MAX_HISTOGRAM_BUCKET_COUNT - 1);
+	}
+	histogram.buckets[bucket]++;
+	histogram.sampleCount++;
+}
+
+static void PrintHistogram(const QueueHistogram &histogram) {
+	fplConsoleFormatOut("  %-14s", histogram.name);
+	if (histogram.sampleCount == 0) {
+		fplConsoleFormatOut(" no samples\n");
+		return;
+	}
+	uint32_t lastBucket = 0;
+	for (uint32_t bucket = 0; bucket < MAX_HISTOGRAM_BUCKET_COUNT; ++bucket) {
+		if (histogram.buckets[bucket] > 0) {
+			lastBucket = bucket;
+		}
+	}
+	for (uint32_t bucket = 0; bucket <= lastBucket; ++bucket) {
+		double percentage = histogram.buckets[bucket] / (double)histogram.sampleCount * 100.0;
+		if (histogram.isPowerOfTwo && bucket > 1) {
+			uint32_t minValue = 1 << (bucket - 1);
+			if (bucket == (MAX_HISTOGRAM_BUCKET_COUNT - 1)) {
+				fplConsoleFormatOut(" %u+: %.1f%%", minValue, percentage);
+			} else {
+				fplConsoleFormatOut(" %u-%u: %.1f%%", minValue, (minValue << 1) - 1, percentage);
+			}
+		} else {
+			fplConsoleFormatOut(" %u: %.1f%%", bucket, percentage);
+		}
+	}
+	fplConsoleFormatOut("\n");
+}
+
+struct HeadlessStats {
+	QueueHistogram videoPackets;
+	QueueHistogram audioPackets;
+	QueueHistogram videoFrames;
+	QueueHistogram audioFrames;
+	double videoConversionTime;
+	double simdConversionTime;
+	double audioConversionTime;
+	double syncErrorSum;
+	double syncErrorMax;
+	uint64_t syncErrorCount;
+	uint64_t videoFrameCount;
+	uint64_t simdFrameCount;
+	uint64_t audioSampleCount;
+	uint64_t audioCallbackCount;
+	uint64_t idleCount;
+	int32_t simdMaxDifference;
+};
+
+static int32_t GetMaxChannelDifference(const uint8_t *a, const uint8_t *b, const size_t size) {
+	int32_t result = 0;
+	for (size_t i = 0; i < size; ++i) {
+		int32_t d = abs((int32_t)a[i] - (int32_t)b[i]);
+		if (d > result) {
+			result = d;
+		}
+	}
+	return(result);
+}
+
+static bool IsDecoderFinished(const MediaStream &stream, const Decoder &decoder) {
+	bool result = !stream.isValid ||
+		((decoder.finishedSerial == decoder.packetsQueue.serial) && (GetFrameQueueRemainingCount(decoder.frameQueue) == 0));
+	return(result);
+}
+
+static void SampleQueues(PlayerState &state, HeadlessStats &stats) {
+	if (state.video.stream.isValid) {
+		AddHistogramSample(stats.videoPackets, state.video.decoder.packetsQueue.packetCount);
+		AddHistogramSample(stats.videoFrames, GetFrameQueueRemainingCount(state.video.decoder.frameQueue));
+	}
+	if (state.audio.stream.isValid) {
+		AddHistogramSample(stats.audioPackets, state.audio.decoder.packetsQueue.packetCount);
+		AddHistogramSample(stats.audioFrames, GetFrameQueueRemainingCount(state.audio.decoder.frameQueue));
+	}
+}
+
+// Pulls all frames through the same reader, decoder and conversion paths as the windowed player, but without presenting anything.
+// Video frames are released when the audio has been played up to their PTS, so both streams advance in media time as fast as the pipeline allows.
+static int RunHeadlessBenchmark(PlayerState &state, const fplAudioDeviceFormat &audioFormat) {
+	VideoContext &video = state.video;
+	AudioContext &audio = state.audio;
+
+	HeadlessStats stats = {};
+	stats.videoPackets.name = "Video packets";
+	stats.videoPackets.isPowerOfTwo = true;
+	stats.audioPackets.name = "Audio packets";
+	stats.audioPackets.isPowerOfTwo = true;
+	stats.videoFrames.name = "Video frames";
+	stats.audioFrames.name = "Audio frames";
+
+	uint32_t audioFrameSize = fplGetAudioFrameSizeInBytes(audioFormat.type, audioFormat.channels);
+	uint8_t *audioOutput = (uint8_t *)fplMemoryAlignedAllocate(HEADLESS_AUDIO_CHUNK_FRAME_COUNT * audioFrameSize, 16);
+	if (audioOutput == nullptr) {
+		return -1;
+	}
+
+	fplConsoleFormatOut("Headless benchmark of '%s' (%s%s%s)\n", state.filePathOrUrl,
+		video.stream.isValid ? "video" : "",
+		(video.stream.isValid && audio.stream.isValid) ? " + " : "",
+		audio.stream.isValid ? "audio" : "");
+
+	double startTime = fplGetTimeInMillisecondsHP();
+	for (;;) {
+		bool isVideoFinished = IsDecoderFinished(video.stream, video.decoder);
+		bool isAudioFinished = IsDecoderFinished(audio.stream, audio.decoder) && (audio.conversionAudioFramesRemaining == 0);
+		if (isVideoFinished && isAudioFinished) {
+			break;
+		}
+
+		double audioPosition = NAN;
+		if (audio.stream.isValid && !isnan(audio.audioClock)) {
+			audioPosition = audio.audioClock - audio.conversionAudioFramesRemaining / (double)audioFormat.sampleRate;
+		}
+
+		bool madeProgress = false;
+
+		// Video: Convert the next frame when the audio has caught up with it
+		double nextVideoPTS = NAN;
+		Frame *vp = nullptr;
+		if (video.stream.isValid && PeekReadableFromFrameQueue(video.decoder.frameQueue, vp)) {
+			if (vp->serial != video.decoder.packetsQueue.serial) {
+				NextReadable(video.decoder.frameQueue);
+				continue;
+			}
+			nextVideoPTS = vp->pts;
+			if (isAudioFinished || isnan(vp->pts) || isnan(audioPosition) || (vp->pts <= audioPosition)) {
+				double convertStart = fplGetTimeInMillisecondsHP();
+				ConvertVideoFrame(video, vp->frame);
+				stats.videoConversionTime += fplGetTimeInMillisecondsHP() - convertStart;
+
+				// Same frame again through our own SIMD conversion, only the first one is compared to sws_scale()
+				convertStart = fplGetTimeInMillisecondsHP();
+				if (ConvertVideoFrameSIMD(video, vp->frame)) {
+					stats.simdConversionTime += fplGetTimeInMillisecondsHP() - convertStart;
+					if (stats.simdFrameCount == 0) {
+						stats.simdMaxDifference = GetMaxChannelDifference(video.conversionVideoBuffer, video.comparisonVideoBuffer, video.conversionVideoRowSize * vp->frame->height);
+					}
+					stats.simdFrameCount++;
+				}
+				if (!isAudioFinished && !isnan(vp->pts) && !isnan(audioPosition)) {
+					double syncError = fabs(vp->pts - audioPosition);
+					stats.syncErrorSum += syncError;
+					stats.syncErrorMax = fplMax(stats.syncErrorMax, syncError);
+					stats.syncErrorCount++;
+				}
+				SampleQueues(state, stats);
+				NextReadable(video.decoder.frameQueue);
+				stats.videoFrameCount++;
+				madeProgress = true;
+			}
+		}
+
+		// Audio: Resample the next chunk until we are ahead of the next video frame
+		if (audio.stream.isValid && !isAudioFinished) {
+			bool hasAudio = (audio.conversionAudioFramesRemaining > 0) || (GetFrameQueueRemainingCount(audio.decoder.frameQueue) > 0);
+			bool isAudioDue = isVideoFinished || isnan(audioPosition) || (!isnan(nextVideoPTS) && (audioPosition < nextVideoPTS));
+			if (hasAudio && isAudioDue) {
+				// Never request more than is converted, otherwise the callback fills up with silence
+				uint32_t frameCount = audio.conversionAudioFramesRemaining > 0 ? fplMin(audio.conversionAudioFramesRemaining, HEADLESS_AUDIO_CHUNK_FRAME_COUNT) : 1;
+				double convertStart = fplGetTimeInMillisecondsHP();
+				uint32_t writtenFrames = AudioReadCallback(&audioFormat, frameCount, audioOutput, &audio);
+				stats.audioConversionTime += fplGetTimeInMillisecondsHP() - convertStart;
+				stats.audioSampleCount += writtenFrames;
+				stats.audioCallbackCount++;
+				if (!video.stream.isValid) {
+					SampleQueues(state, stats);
+				}
+				madeProgress = true;
+			}
+		}
+
+		if (!madeProgress) {
+			// Decoders are behind, give them time
+			stats.idleCount++;
+			fplThreadYield();
+		}
+	}
+	double totalTime = fplGetTimeInMillisecondsHP() - startTime;
+
+	fplMemoryAlignedFree(audioOutput);
+
+	double mediaLength = 0.0;
+	if (audio.stream.isValid) {
+		mediaLength = stats.audioSampleCount / (double)audioFormat.sampleRate;
+	} else {
+		double frameRate = GetMasterFrameRate(&state);
+		mediaLength = frameRate > 0 ? stats.videoFrameCount / frameRate : 0.0;
+	}
+
+	fplConsoleFormatOut("Total time: %.2f ms, media time: %.2f s (%.1fx realtime)\n", totalTime, mediaLength, totalTime > 0 ? mediaLength / (totalTime / 1000.0) : 0.0);
+	if (video.stream.isValid) {
+		fplConsoleFormatOut("Video: %llu frames, %.1f frames/s, sws_scale %.3f ms/frame\n",
+			(unsigned long long)stats.videoFrameCount,
+			totalTime > 0 ? stats.videoFrameCount / (totalTime / 1000.0) : 0.0,
+			stats.videoFrameCount > 0 ? stats.videoConversionTime / stats.videoFrameCount : 0.0);
+		if (stats.simdFrameCount > 0) {
+			double simdFrameTime = stats.simdConversionTime / stats.simdFrameCount;
+			double swsFrameTime = stats.videoConversionTime / stats.videoFrameCount;
+			fplConsoleFormatOut("Video: SIMD YUV420P %.3f ms/frame (%.2fx sws_scale), max channel difference %d\n",
+				simdFrameTime,
+				simdFrameTime > 0 ? swsFrameTime / simdFrameTime : 0.0,
+				stats.simdMaxDifference);
+		}
+	}
+	if (audio.stream.isValid) {
+		fplConsoleFormatOut("Audio: %llu samples, %.1f ksamples/s, resampling %.3f ms total (%llu callbacks)\n",
+			(unsigned long long)stats.audioSampleCount,
+			totalTime > 0 ? stats.audioSampleCount / totalTime : 0.0,
+			stats.audioConversionTime,
+			(unsigned long long)stats.audioCallbackCount);
+	}
+	if (stats.syncErrorCount > 0) {
+		fplConsoleFormatOut("A/V sync error: avg %.2f ms, max %.2f ms\n", stats.syncErrorSum / stats.syncErrorCount * 1000.0, stats.syncErrorMax * 1000.0);
+	}
+	fplConsoleFormatOut("Idle iterations: %llu\n", (unsigned long long)stats.idleCount);
+	fplConsoleFormatOut("Queue occupancy:\n");
+	if (video.stream.isValid) {
+		PrintHistogram(stats.videoPackets);
+		PrintHistogram(stats.videoFrames);
+	}
+	if (audio.stream.isValid) {
+		PrintHistogram(stats.audioPackets);
+		PrintHistogram(stats.audioFrames);
+	}
+
+	return(0);
+}
+
 int main(int argc, char **argv) {
 	int result = 0;
 
@@ -3448,6 +3858,13 @@ int main(int argc, char **argv) {
 
 	const char *mediaFilePath = argv[1];
 
+	bool isHeadless = false;
+	for (int i = 2; i < argc; ++i) {
+		if (fplIsStringEqual(argv[i], "-headless")) {
+			isHeadless = true;
+		}
+	}
+
 	fplSettings settings = fplMakeDefaultSettings();
 
 	fplCopyString("FPL FFmpeg Demo", settings.window.title, fplArrayCount(settings.window.title));
@@ -3462,27 +3879,42 @@ int main(int argc, char **argv) {
 	settings.video.isAutoSize = false;
 	settings.video.isVSync = false;
 
-	if (!fplPlatformInit(fplInitFlags_All, &settings)) {
+	// Headless mode runs without a window and without an audio device
+	fplInitFlags initFlags = isHeadless ? fplInitFlags_None : fplInitFlags_All;
+	if (!fplPlatformInit(initFlags, &settings)) {
 		return -1;
 	}
 
 #if USE_HARDWARE_RENDERING
-	if (!fglLoadOpenGL(true)) {
+	if (!isHeadless && !fglLoadOpenGL(true)) {
 		fplPlatformRelease();
 		return -1;
 	}
 #endif
 
 	PlayerState state = {};
+	state.isHeadless = isHeadless;
 
 	// Init
 	if (!InitPlayer(state)) {
 		goto release;
 	}
 
-	// Get native audio format
+	// Get native audio format, headless mode uses a fixed stereo S16 format instead
 	fplAudioDeviceFormat nativeAudioFormat;
-	if (!fplGetAudioHardwareFormat(&nativeAudioFormat)) {
+	if (isHeadless) {
+		nativeAudioFormat = {};
+		nativeAudioFormat.type = fplAudioFormatType_S16;
+		nativeAudioFormat.channels = 2;
+		nativeAudioFormat.sampleRate = 48000;
+		nativeAudioFormat.periods = 3;
+		nativeAudioFormat.bufferSizeInFrames = fplGetAudioBufferSizeInFrames(nativeAudioFormat.sampleRate, 20);
+		nativeAudioFormat.bufferSizeInBytes = fplGetAudioBufferSizeInBytes(nativeAudioFormat.type, nativeAudioFormat.channels, nativeAudioFormat.bufferSizeInFrames);
+
+		// Never loop and never drop frames, every frame needs to go through the pipeline
+		state.settings.frameDrop = 0;
+		state.loop = 0;
+	} else if (!fplGetAudioHardwareFormat(&nativeAudioFormat)) {
 		goto release;
 	}
 
@@ -3509,6 +3941,11 @@ int main(int argc, char **argv) {
 	}
 	StartReader(state.reader, PacketReadThreadProc, &state);
 
+	if (isHeadless) {
+		result = RunHeadlessBenchmark(state, nativeAudioFormat);
+		goto release;
+	}
+
 	// Start playing audio
 	if (state.audio.stream.isValid) {
 		fplSetAudioClientReadCallback(AudioReadCallback, &state.audio);
@@ -3608,7 +4045,7 @@ int main(int argc, char **argv) {
 
 release:
 	// Stop audio
-	if (state.audio.stream.isValid) {
+	if (state.audio.stream.isValid && !isHeadless) {
 		fplStopAudio();
 	}
 
@@ -3627,9 +4064,11 @@ release:
 
 	// Release platform
 #if USE_HARDWARE_RENDERING
-	fglUnloadOpenGL();
+	if (!isHeadless) {
+		fglUnloadOpenGL();
+	}
 #endif
 	fplPlatformRelease();
 
-	return(0);
+	return(result);
 }
\ No newline at end of file
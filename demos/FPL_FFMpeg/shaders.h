@@ -47,9 +47,9 @@ namespace BasicShaderSource {
 	"const float vu_const = 0.5;\n" \
 	"vec4 YUVToRGBA(float y, float u, float v) {\n" \
 	"  vec4 result;\n" \
-	"  result.r = (1.164 * (y - y_const)) + (2.018 * (v - vu_const));\n" \
-	"  result.g = (1.164 * (y - y_const)) - (0.813 * (u - vu_const)) - (0.391 * (v - vu_const));\n" \
-	"  result.b = (1.164 * (y - y_const)) + (1.596 * (u - vu_const));\n" \
+	"  result.r = (1.164 * (y - y_const)) + (1.596 * (v - vu_const));\n" \
+	"  result.g = (1.164 * (y - y_const)) - (0.391 * (u - vu_const)) - (0.813 * (v - vu_const));\n" \
+	"  result.b = (1.164 * (y - y_const)) + (2.018 * (u - vu_const));\n" \
 	"  result.a = 0.0;\n" \
 	"  return result;\n" \
 	"}\n"
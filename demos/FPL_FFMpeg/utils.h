@@ -85,9 +85,10 @@ inline uint8_t ClipByte(float v) {
 }
 
 inline uint32_t YUVToRGB32(const uint8_t y, const uint8_t u, const uint8_t v, const bool isBGRA) {
-	float r = (1.164f * (float)(y - 16)) + (2.018f * (float)(v - 128));
-	float g = (1.164f * (float)(y - 16)) - (0.813f * (float)(u - 128)) - (0.391f * (float)(v - 128));
-	float b = (1.164f * (float)(y - 16)) + (1.596f * (float)(u - 128));
+	// BT.601, limited range (U = Cb, V = Cr)
+	float r = (1.164f * (float)(y - 16)) + (1.596f * (float)(v - 128));
+	float g = (1.164f * (float)(y - 16)) - (0.391f * (float)(u - 128)) - (0.813f * (float)(v - 128));
+	float b = (1.164f * (float)(y - 16)) + (2.018f * (float)(u - 128));
 	uint32_t result;
 	if (isBGRA) {
 		result = ((uint8_t)255 << 24) | (ClipByte(b) << 16) | (ClipByte(g) << 8) | ClipByte(r);
@@ -123,6 +124,93 @@ static void ConvertYUV420PToRGB32(uint8_t *destData[8], int32_t destLineSize[8],
 	}
 }
 
+#if defined(FPL_ARCH_X64) || defined(FPL_ARCH_X86)
+#include <emmintrin.h>
+
+// Converts 8 pixels in 16-bit lanes to clamped 8-bit R, G and B values (BT.601, limited range).
+// All coefficients are fixed point multiplies with _mm_mulhi_epi16, the sums are 5-bit fractional.
+static inline void YUVToRGB8x16SSE2(const __m128i y16, const __m128i u16, const __m128i v16, __m128i &r16, __m128i &g16, __m128i &b16) {
+	const __m128i yOffset = _mm_set1_epi16(16);
+	const __m128i uvOffset = _mm_set1_epi16(128);
+	const __m128i yCoeff = _mm_set1_epi16(19071); // 1.164 * 2^14
+	const __m128i vrCoeff = _mm_set1_epi16(26149); // 1.596 * 2^14
+	const __m128i ugCoeff = _mm_set1_epi16(6406); // 0.391 * 2^14
+	const __m128i vgCoeff = _mm_set1_epi16(13320); // 0.813 * 2^14
+	const __m128i ubCoeff = _mm_set1_epi16(16679); // (2.018 - 1.0) * 2^14
+	const __m128i rounding = _mm_set1_epi16(16);
+
+	__m128i y = _mm_slli_epi16(_mm_sub_epi16(y16, yOffset), 7);
+	__m128i u = _mm_sub_epi16(u16, uvOffset);
+	__m128i v = _mm_slli_epi16(_mm_sub_epi16(v16, uvOffset), 7);
+	__m128i yc = _mm_add_epi16(_mm_mulhi_epi16(y, yCoeff), rounding);
+
+	// 2.018 does not fit into a signed 16-bit coefficient, so the whole part is added separately
+	__m128i ub = _mm_add_epi16(_mm_slli_epi16(u, 5), _mm_mulhi_epi16(_mm_slli_epi16(u, 7), ubCoeff));
+	__m128i ug = _mm_mulhi_epi16(_mm_slli_epi16(u, 7), ugCoeff);
+	__m128i vr = _mm_mulhi_epi16(v, vrCoeff);
+	__m128i vg = _mm_mulhi_epi16(v, vgCoeff);
+
+	r16 = _mm_srai_epi16(_mm_add_epi16(yc, vr), 5);
+	g16 = _mm_srai_epi16(_mm_sub_epi16(_mm_sub_epi16(yc, ug), vg), 5);
+	b16 = _mm_srai_epi16(_mm_add_epi16(yc, ub), 5);
+}
+
+// Same as ConvertYUV420PToRGB32, but converts 16 pixels at once using SSE2
+static void ConvertYUV420PToRGB32SSE2(uint8_t *destData[8], int32_t destLineSize[8], int32_t width, int32_t height, uint8_t *sourceData[8], int32_t sourceLineSize[8], const ConversionFlags flags) {
+	constexpr uint32_t YPLANE = 0;
+	constexpr uint32_t UPLANE = 1;
+	constexpr uint32_t VPLANE = 2;
+	const bool dstBGRA = (flags & ConversionFlags::DstBGRA) == ConversionFlags::DstBGRA;
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i alpha = _mm_set1_epi8((char)0xFF);
+	const int32_t simdWidth = width & ~15;
+	for (int32_t y = 0; y < height; ++y) {
+		uint8_t *dst = destData[0] + y * destLineSize[0];
+		const uint8_t *srcY = sourceData[YPLANE] + y * sourceLineSize[YPLANE];
+		const uint8_t *srcU = sourceData[UPLANE] + (y / 2) * sourceLineSize[UPLANE];
+		const uint8_t *srcV = sourceData[VPLANE] + (y / 2) * sourceLineSize[VPLANE];
+		int32_t x = 0;
+		for (; x < simdWidth; x += 16) {
+			__m128i yBytes = _mm_loadu_si128((const __m128i *)(srcY + x));
+			__m128i uBytes = _mm_loadl_epi64((const __m128i *)(srcU + x / 2));
+			__m128i vBytes = _mm_loadl_epi64((const __m128i *)(srcV + x / 2));
+
+			// Each chroma sample covers two horizontal pixels
+			uBytes = _mm_unpacklo_epi8(uBytes, uBytes);
+			vBytes = _mm_unpacklo_epi8(vBytes, vBytes);
+
+			__m128i rLo, gLo, bLo, rHi, gHi, bHi;
+			YUVToRGB8x16SSE2(_mm_unpacklo_epi8(yBytes, zero), _mm_unpacklo_epi8(uBytes, zero), _mm_unpacklo_epi8(vBytes, zero), rLo, gLo, bLo);
+			YUVToRGB8x16SSE2(_mm_unpackhi_epi8(yBytes, zero), _mm_unpackhi_epi8(uBytes, zero), _mm_unpackhi_epi8(vBytes, zero), rHi, gHi, bHi);
+			__m128i r = _mm_packus_epi16(rLo, rHi);
+			__m128i g = _mm_packus_epi16(gLo, gHi);
+			__m128i b = _mm_packus_epi16(bLo, bHi);
+
+			// Same byte order as YUVToRGB32: DstBGRA writes R,G,B,A - otherwise B,G,R,A
+			__m128i first = dstBGRA ? r : b;
+			__m128i third = dstBGRA ? b : r;
+			__m128i fgLo = _mm_unpacklo_epi8(first, g);
+			__m128i fgHi = _mm_unpackhi_epi8(first, g);
+			__m128i taLo = _mm_unpacklo_epi8(third, alpha);
+			__m128i taHi = _mm_unpackhi_epi8(third, alpha);
+			_mm_storeu_si128((__m128i *)(dst + x * 4 + 0), _mm_unpacklo_epi16(fgLo, taLo));
+			_mm_storeu_si128((__m128i *)(dst + x * 4 + 16), _mm_unpackhi_epi16(fgLo, taLo));
+			_mm_storeu_si128((__m128i *)(dst + x * 4 + 32), _mm_unpacklo_epi16(fgHi, taHi));
+			_mm_storeu_si128((__m128i *)(dst + x * 4 + 48), _mm_unpackhi_epi16(fgHi, taHi));
+		}
+		uint32_t *dst32 = (uint32_t *)dst;
+		for (; x < width; ++x) {
+			dst32[x] = YUVToRGB32(srcY[x], srcU[x / 2], srcV[x / 2], dstBGRA);
+		}
+	}
+}
+#else
+// No SSE2 on this architecture, so the callers get the scalar BT.601 conversion
+static void ConvertYUV420PToRGB32SSE2(uint8_t *destData[8], int32_t destLineSize[8], int32_t width, int32_t height, uint8_t *sourceData[8], int32_t sourceLineSize[8], const ConversionFlags flags) {
+	ConvertYUV420PToRGB32(destData, destLineSize, width, height, sourceData, sourceLineSize, flags);
+}
+#endif // FPL_ARCH_X64 || FPL_ARCH_X86
+
 static void ConvertRGB24ToRGB32(uint8_t *destData, int32_t destScanline, int32_t width, int32_t height, int32_t sourceScanLine, uint8_t *sourceData) {
 	for (int32_t y = 0; y < height; ++y) {
 		uint8_t *src = sourceData + y * sourceScanLine;
@@ -10,6 +10,13 @@ Requirements:
 	- C++ Compiler
 	- Final Framework
 
+Usage:
+	FPL_GameTemplate [-nowindow] [-frames <count>] [-unlimited]
+
+	-nowindow: Runs without a window, rendering and audio output, then prints a summary.
+	-frames: Exits after the given number of frames, when running without a window (Default: 600).
+	-unlimited: Runs without a window as fast as possible.
+
 Author:
 	Torsten Spaete
 
@@ -343,6 +350,16 @@ extern void GameUpdateAndRender(GameMemory &gameMemory, const Input &input, cons
 
 int main(int argc, char *argv[]) {
 	GameConfiguration config = {};
+	for (int i = 1; i < argc; ++i) {
+		if (fplIsStringEqual(argv[i], "-nowindow")) {
+			config.isHeadless = true;
+		} else if (fplIsStringEqual(argv[i], "-frames") && (i + 1) < argc) {
+			int frameCount = atoi(argv[++i]);
+			config.headlessFrameCount = (uint32_t)fplMax(0, frameCount);
+		} else if (fplIsStringEqual(argv[i], "-unlimited")) {
+			config.isUnlimited = true;
+		}
+	}
 	config.title = L"FPL Demo | GameTemplate";
 	config.disableInactiveDetection = true;
 	config.noUpdateRenderSeparation = true;
@@ -4,11 +4,14 @@ Name:
 	FPL-Demo | ImageViewer
 
 Version:
-	v0.5.5 (version.h)
+	v0.8.0 (version.h)
 
 Description:
 	Very simple opengl based image viewer.
 	Loads up pictures in multiple threads using a lock-free MPMC queue.
+	Pictures around the current one are prefetched in browse direction and kept in a LRU cache bounded by a memory budget.
+	Downscaled previews are cached on disk, keyed by path, size and modification time, and shown while a picture is decoded.
+	Load threads build a mipmap chain, huge pictures are split into tiles and uploaded across several frames.
 	Texture Allocate/Release is done in the main thread.
 	It supports several image filters, such as Bilinear, Bicubic, Lanczos etc.
 
@@ -17,11 +20,40 @@ Requirements:
 	- Final Platform Layer
 	- Final Dynamic OpenGL
 	- STB_image
+	- Optional: libjpeg-turbo (USE_TURBOJPEG=1)
 
 Author:
 	Torsten Spaete
 
 Changelog:
+	## v0.8.0
+	- Pictures are memory mapped and decoded in one go, the stream callbacks are only used when mapping fails
+	- Decoder interface, decoders are tried in order with stb_image as the fallback
+	- Optional libjpeg-turbo decoder for JPEG pictures (USE_TURBOJPEG=1)
+	- Log the decoder and the decode time for each picture
+
+	## v0.7.0
+	- Power-of-two mipmap chain built in the load threads with a 2x2 box filter (SSE2 when available)
+	- Pictures are split into tiles of at most 2048 pixels or the max texture size
+	- Tiles are uploaded incrementally across frames (16 MB per frame), smallest mipmap and nearest picture first
+	- Only the mipmaps needed for the current view size are uploaded, the others stay in system memory
+	- Thumbnails are built from the smallest mipmap
+	- Fixed: Mipmap selection always picked the smallest mipmap
+
+	## v0.6.1
+	- Persistent thumbnail cache in the home directory (disable with -n), previews show up while the full picture is decoded
+	- Preview bar uses the thumbnails instead of the full pictures
+	- Fixed: Canceled pictures were never loaded again after a reload
+	- Fixed: Decoded but discarded pictures kept their data until the slot was reused
+
+	## v0.6.0
+	- Load threads sleep on a semaphore, which is released once per enqueued picture (no more polling every 50 ms)
+	- Replaced the fixed picture window with a LRU picture cache, looked up by file index
+	- Prefetch window around the current picture, three quarters of it in browse direction
+	- Cache memory budget (-m=<megabytes>, default 512), queued pictures reserve their estimated size and least recently used pictures outside the prefetch window are evicted first
+	- Fixed: Preload count parameter (-p=<count>) was never parsed
+	- Fixed: Pictures with a failed upload leaked their textures
+
 	## v0.5.5
 	- Reflect api changes in FPL 0.9.4
 	- Fixed broken legacy opengl rendering
@@ -104,6 +136,11 @@ License:
 // Enable this to prevent the usage of modern OpenGL
 #define FORCE_LEGACY_OPENGL 0
 
+// Enable this to decode JPEG pictures with libjpeg-turbo (requires turbojpeg.h and linking against the turbojpeg library)
+#if !defined(USE_TURBOJPEG)
+#	define USE_TURBOJPEG 0
+#endif
+
 #define FPL_IMPLEMENTATION
 #define FPL_LOGGING
 #include <final_platform_layer.h>
@@ -119,6 +156,19 @@ License:
 
 #include <string.h>
 
+#if defined(FPL_SUBPLATFORM_POSIX)
+#	include <sys/mman.h>
+#endif
+
+#if USE_TURBOJPEG
+#	include <turbojpeg.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#	define DOWNSAMPLE_SSE2
+#	include <emmintrin.h>
+#endif
+
 #include "shadersources.h"
 #include "imageresources.h"
 #include "version.h"
@@ -290,6 +340,7 @@ typedef struct PictureFile {
 typedef enum LoadedPictureStateType {
 	LoadedPictureState_Error = -1,
 	LoadedPictureState_Unloaded = 0,
+	LoadedPictureState_Queued,
 	LoadedPictureState_LoadingData,
 	LoadedPictureState_ToUpload,
 	LoadedPictureState_Discard,
@@ -304,27 +355,83 @@ typedef struct StreamingFileBuffer {
 	size_t size;
 } StreamingFileBuffer;
 
+// Part of an image which is uploaded into its own texture
+typedef struct ImageTile {
+	uint32_t x;
+	uint32_t y;
+	uint32_t width;
+	uint32_t height;
+	GLuint textureId;
+} ImageTile;
+
 typedef struct ImageData {
 	uint8_t* data;
+	// Tiles are created and uploaded in the main thread, the data is released once all tiles are uploaded
+	ImageTile* tiles;
 	uint32_t width;
 	uint32_t height;
 	uint32_t components;
-	GLuint textureId;
+	uint32_t tileCount;
+	uint32_t uploadedTileCount;
 } ImageData;
 
-#define MAX_PICTURE_MIPMAPS (1)
-#define MIN_PICTURE_MIPMAP_SIZE 512
+// Each mipmap is half the size of the previous one, the smallest one is below the min size
+#define MAX_PICTURE_MIPMAPS (12)
+#define MIN_PICTURE_MIPMAP_SIZE 256
+#define MAX_PICTURE_TILE_SIZE 2048
+// Huge pictures are uploaded across multiple frames, at least one tile is uploaded per frame
+#define MAX_UPLOAD_BYTES_PER_FRAME (16 * 1024 * 1024)
 
 typedef struct ViewPicture {
 	StreamingFileBuffer fileStream;
 	char filePath[FPL_MAX_PATH_LENGTH];
 	ImageData imageData[MAX_PICTURE_MIPMAPS];
+	// Downscaled preview from the thumbnail cache, shown while the full picture is decoded
+	ImageData previewImage;
+	uint32_t previewSourceWidth;
+	uint32_t previewSourceHeight;
+	uint64_t lastUsed;
+	size_t memorySize;
+	// Estimated size reserved in the cache while the picture is queued or loading, part of memorySize
+	size_t reservedSize;
 	float progress;
 	size_t fileIndex;
+	// Incremented for every load request, so queue entries of an earlier request can be detected
+	volatile uint32_t loadGeneration;
 	volatile LoadedPictureState state;
+	volatile LoadedPictureState previewState;
 	uint8_t mipmapCount;
 } ViewPicture;
 
+// Thumbnail cache file: A fixed 64 byte header followed by the raw pixels, so the file can be read in one block or mapped directly
+#define THUMBNAIL_MAGIC 0x48545646 // FVTH
+#define THUMBNAIL_VERSION 1
+#define THUMBNAIL_MAX_SIZE 256
+#define THUMBNAIL_CACHE_DIRECTORY "thumbs"
+
+typedef struct ThumbnailHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t pathHash;
+	uint64_t fileSize;
+	uint64_t modifyTime;
+	uint32_t width;
+	uint32_t height;
+	uint32_t components;
+	uint32_t sourceWidth;
+	uint32_t sourceHeight;
+	uint32_t dataSize;
+	uint8_t reserved[8];
+} ThumbnailHeader;
+fplStaticAssert(sizeof(ThumbnailHeader) == 64);
+
+typedef struct ThumbnailKey {
+	uint64_t pathHash;
+	uint64_t fileSize;
+	uint64_t modifyTime;
+	char cacheFilePath[FPL_MAX_PATH_LENGTH];
+} ThumbnailKey;
+
 typedef struct LoadPictureContext {
 	ViewPicture* viewPic;
 	volatile bool canceled;
@@ -332,8 +439,6 @@ typedef struct LoadPictureContext {
 
 typedef struct PictureLoadThread {
 	LoadPictureContext context;
-	fplMutexHandle mutex;
-	fplConditionVariable condition;
 	struct ViewerState* state;
 	fplThreadHandle* thread;
 	volatile bool shutdown;
@@ -343,10 +448,15 @@ typedef struct PictureLoadThread {
 #define MAX_VIEW_PICTURE_COUNT MAX_LOAD_THREAD_COUNT * 4
 #define MAX_LOAD_QUEUE_COUNT MAX_VIEW_PICTURE_COUNT * 2
 #define PAGE_INCREMENT_COUNT 10
+#define DEFAULT_PRELOAD_COUNT 16
+#define DEFAULT_MEMORY_BUDGET_MB 512
+// Reserved for a queued picture until the first picture is decoded, a Full-HD RGBA picture with its mipmaps
+#define DEFAULT_PICTURE_SIZE_ESTIMATE (1920 * 1080 * 4 * 4 / 3)
 
 typedef struct LoadQueueValue {
 	int fileIndex;
 	int pictureIndex;
+	uint32_t generation;
 } LoadQueueValue;
 
 typedef struct LoadQueueEntry {
@@ -379,9 +489,11 @@ typedef struct ViewerParameters {
 	const char* path;
 	uint32_t threadCount;
 	uint32_t preloadCount;
+	uint32_t memoryBudgetMB;
 	bool recursive;
 	bool preview;
 	bool border;
+	bool noThumbnailCache;
 } ViewerParameters;
 
 typedef struct Vertex {
@@ -420,6 +532,7 @@ FPL_ENUM_AS_FLAGS_OPERATORS(PictureViewFlags);
 
 typedef struct SupportedFeatures {
 	int openGLMajor;
+	int maxTextureSize;
 	bool rectangleTextures;
 	bool srgbFrameBuffer;
 } SupportedFeatures;
@@ -445,17 +558,32 @@ typedef struct ViewerState {
 	size_t folderCount;
 	int activeFileIndex;
 
+	// Cache of loaded pictures, looked up by file index and evicted in least-recently-used order
 	ViewPicture viewPictures[MAX_VIEW_PICTURE_COUNT];
 	size_t viewPicturesCapacity;
-	int viewPictureIndex;
+	uint64_t viewPictureUseCounter;
+	size_t cacheMemoryUsage;
+	size_t cacheMemoryBudget;
+	// Sum and count of all decoded picture sizes, for estimating the size of pictures which are not decoded yet
+	size_t decodedPictureBytes;
+	size_t decodedPictureCount;
 	bool doPictureReload;
 
+	// Directory of the persistent thumbnail cache, empty when disabled
+	char thumbnailCachePath[FPL_MAX_PATH_LENGTH];
+
+	// Prefetch window around the active file, biased towards the browse direction
+	int prefetchCount;
+	int browseDirection;
+
 	PictureLoadThread loadThreads[MAX_LOAD_THREAD_COUNT];
 	size_t loadThreadCount;
 
 	ViewerParameters params;
 	PictureViewFlags viewFlags;
 
+	// Released once per enqueued item, so exactly one sleeping load thread wakes up for it
+	fplSemaphoreHandle loadSemaphore;
 	LoadQueue loadQueue;
 	size_t loadQueueCapacity;
 
@@ -624,7 +752,7 @@ static GLuint AllocateTexture(const uint32_t width, const uint32_t height, const
 	glTexImage2D(textureTarget, 0, sizedInternalFormat, width, height, 0, baseInternalFormat, GL_UNSIGNED_BYTE, data);
 
 	glTexParameteri(textureTarget, GL_TEXTURE_BASE_LEVEL, 0);
-	glTexParameteri(textureTarget, GL_TEXTURE_MAX_LEVEL, (MAX_PICTURE_MIPMAPS - 1));
+	glTexParameteri(textureTarget, GL_TEXTURE_MAX_LEVEL, 0);
 
 	glTexParameteri(textureTarget, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 	glTexParameteri(textureTarget, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
@@ -638,29 +766,124 @@ static GLuint AllocateTexture(const uint32_t width, const uint32_t height, const
 	return(handle);
 }
 
-static void ClearPictureData(ViewPicture* viewPicture, bool noTextures) {
-	for (size_t p = 0; p < fplArrayCount(viewPicture->imageData); ++p) {
-		if (viewPicture->imageData[p].data != fpl_null) {
-			stbi_image_free(viewPicture->imageData[p].data);
-		}
+static void ClearImageData(ImageData* imageData, bool noTextures) {
+	if (imageData->data != fpl_null) {
+		stbi_image_free(imageData->data);
+	}
+	if (imageData->tiles != fpl_null) {
 		if (!noTextures) {
-			if (viewPicture->imageData[p].textureId > 0) {
-				ReleaseTexture(&viewPicture->imageData[p].textureId);
+			for (uint32_t t = 0; t < imageData->tileCount; ++t) {
+				if (imageData->tiles[t].textureId > 0) {
+					ReleaseTexture(&imageData->tiles[t].textureId);
+				}
 			}
 		}
-		fplClearStruct(&viewPicture->imageData[p]);
-		viewPicture->mipmapCount = 0;
+		free(imageData->tiles);
+	}
+	fplClearStruct(imageData);
+}
+
+static void ClearPictureData(ViewPicture* viewPicture, bool noTextures) {
+	for (size_t p = 0; p < fplArrayCount(viewPicture->imageData); ++p) {
+		ClearImageData(&viewPicture->imageData[p], noTextures);
+	}
+	viewPicture->mipmapCount = 0;
+}
+
+static void ClearPreviewData(ViewPicture* viewPicture, bool noTextures) {
+	ClearImageData(&viewPicture->previewImage, noTextures);
+	viewPicture->previewSourceWidth = viewPicture->previewSourceHeight = 0;
+	fplAtomicStoreS32(&viewPicture->previewState, LoadedPictureState_Unloaded);
+}
+
+// Splits the image into tiles, which fits into the max texture size (Main thread only)
+static void SetupImageTiles(ImageData* imageData, const uint32_t maxTileSize) {
+	fplAssert(imageData->tiles == fpl_null);
+	fplAssert(imageData->width > 0 && imageData->height > 0);
+	uint32_t tileCountX = (imageData->width + maxTileSize - 1) / maxTileSize;
+	uint32_t tileCountY = (imageData->height + maxTileSize - 1) / maxTileSize;
+	imageData->tileCount = tileCountX * tileCountY;
+	imageData->uploadedTileCount = 0;
+	imageData->tiles = (ImageTile*)malloc(sizeof(ImageTile) * imageData->tileCount);
+	for (uint32_t tileY = 0; tileY < tileCountY; ++tileY) {
+		for (uint32_t tileX = 0; tileX < tileCountX; ++tileX) {
+			ImageTile* tile = &imageData->tiles[tileY * tileCountX + tileX];
+			tile->x = tileX * maxTileSize;
+			tile->y = tileY * maxTileSize;
+			tile->width = fplMin(maxTileSize, imageData->width - tile->x);
+			tile->height = fplMin(maxTileSize, imageData->height - tile->y);
+			tile->textureId = 0;
+		}
 	}
 }
 
-static void ClearViewPictures(ViewerState* state) {
+// Uploads the next pending tile and releases the image data, once all tiles are uploaded (Main thread only)
+static bool UploadNextImageTile(const ViewerState* state, ImageData* imageData, size_t* uploadedBytes) {
+	fplAssert(imageData->uploadedTileCount < imageData->tileCount);
+	fplAssert(imageData->data != fpl_null);
+	ImageTile* tile = &imageData->tiles[imageData->uploadedTileCount];
+	const uint8_t* tileData = imageData->data + ((size_t)tile->y * imageData->width + tile->x) * imageData->components;
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, (GLint)imageData->width);
+	tile->textureId = AllocateTexture(tile->width, tile->height, (uint8_t)imageData->components, tileData, false, state->textureTarget, state->features.srgbFrameBuffer);
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+	if (tile->textureId == 0) {
+		return(false);
+	}
+	*uploadedBytes += (size_t)tile->width * tile->height * imageData->components;
+	++imageData->uploadedTileCount;
+	if (imageData->uploadedTileCount == imageData->tileCount) {
+		stbi_image_free(imageData->data);
+		imageData->data = fpl_null;
+	}
+	return(true);
+}
+
+static void ClearViewPictures(ViewerState* state, bool noTextures) {
 	for (size_t i = 0; i < state->viewPicturesCapacity; ++i) {
+		// Pictures which are still loading are canceled and their data is released by the load thread
+		if (fplAtomicLoadS32(&state->viewPictures[i].state) == LoadedPictureState_LoadingData) {
+			continue;
+		}
+		fplAssert(state->cacheMemoryUsage >= state->viewPictures[i].memorySize);
+		state->cacheMemoryUsage -= state->viewPictures[i].memorySize;
 		state->viewPictures[i].state = LoadedPictureState_Unloaded;
 		state->viewPictures[i].progress = 0.0f;
-		ClearPictureData(&state->viewPictures[i], true);
+		state->viewPictures[i].memorySize = 0;
+		state->viewPictures[i].reservedSize = 0;
+		ClearPictureData(&state->viewPictures[i], noTextures);
+		ClearPreviewData(&state->viewPictures[i], noTextures);
 	}
 }
 
+static ViewPicture* FindViewPicture(ViewerState* state, const int fileIndex) {
+	if (fileIndex < 0 || fileIndex >= (int)state->pictureFileCount) {
+		return fpl_null;
+	}
+	for (size_t i = 0; i < state->viewPicturesCapacity; ++i) {
+		ViewPicture* viewPic = &state->viewPictures[i];
+		LoadedPictureState loadState = fplAtomicLoadS32(&viewPic->state);
+		if (loadState != LoadedPictureState_Unloaded && loadState != LoadedPictureState_Discard && viewPic->fileIndex == (size_t)fileIndex) {
+			return viewPic;
+		}
+	}
+	return fpl_null;
+}
+
+// Releases the textures of a ready, discarded or failed picture and makes its slot available again (Main thread only)
+static void ReleaseViewPicture(ViewerState* state, ViewPicture* viewPic) {
+	LoadedPictureState loadState = fplAtomicLoadS32(&viewPic->state);
+	fplAssert(loadState == LoadedPictureState_Ready || loadState == LoadedPictureState_Discard || loadState == LoadedPictureState_Error);
+	fplDebugFormatOut("Release textures '%s'[%d]\n", viewPic->filePath, viewPic->fileIndex);
+	// Mipmaps which are not needed for the current zoom are never uploaded and still hold their data
+	ClearPictureData(viewPic, false);
+	ClearPreviewData(viewPic, false);
+	fplAssert(state->cacheMemoryUsage >= viewPic->memorySize);
+	state->cacheMemoryUsage -= viewPic->memorySize;
+	viewPic->memorySize = 0;
+	viewPic->reservedSize = 0;
+	fplAtomicStoreS32(&viewPic->state, LoadedPictureState_Unloaded);
+}
+
 static void UpdateStreamProgress(ViewPicture* pic) {
 	size_t pos = fplGetFilePosition32(&pic->fileStream.handle);
 	if (pic->fileStream.size > 0) {
@@ -705,75 +928,378 @@ int EofPictureStreamCallback(void* user) {
 	return(res);
 }
 
+// Read-only view of a whole file mapped into memory, so a decoder can access it without any copies or read calls
+typedef struct MappedFile {
+	const uint8_t* data;
+	size_t size;
+#if defined(FPL_PLATFORM_WINDOWS)
+	HANDLE mappingHandle;
+#endif
+} MappedFile;
+
+static bool MapFile(const fplFileHandle* fileHandle, MappedFile* outFile) {
+	fplClearStruct(outFile);
+	uint64_t fileSize = fplGetFileSizeFromHandle64(fileHandle);
+	if (fileSize == 0 || fileSize > (uint64_t)SIZE_MAX) {
+		return(false);
+	}
+#if defined(FPL_PLATFORM_WINDOWS)
+	HANDLE mappingHandle = CreateFileMappingW(fileHandle->internalHandle.win32FileHandle, fpl_null, PAGE_READONLY, 0, 0, fpl_null);
+	if (mappingHandle == fpl_null) {
+		return(false);
+	}
+	void* data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+	if (data == fpl_null) {
+		CloseHandle(mappingHandle);
+		return(false);
+	}
+	outFile->mappingHandle = mappingHandle;
+#elif defined(FPL_SUBPLATFORM_POSIX)
+	void* data = mmap(fpl_null, (size_t)fileSize, PROT_READ, MAP_PRIVATE, fileHandle->internalHandle.posixFileHandle, 0);
+	if (data == MAP_FAILED) {
+		return(false);
+	}
+	// The file is decoded from front to back
+	madvise(data, (size_t)fileSize, MADV_SEQUENTIAL);
+#endif
+	outFile->data = (const uint8_t*)data;
+	outFile->size = (size_t)fileSize;
+	return(true);
+}
+
+static void UnmapFile(MappedFile* file) {
+	if (file->data != fpl_null) {
+#if defined(FPL_PLATFORM_WINDOWS)
+		UnmapViewOfFile(file->data);
+		CloseHandle(file->mappingHandle);
+#elif defined(FPL_SUBPLATFORM_POSIX)
+		munmap((void*)file->data, file->size);
+#endif
+	}
+	fplClearStruct(file);
+}
+
+// Decodes a whole file in memory into tightly packed RGBA pixels
+// The pixels must be allocated with stbi__malloc(), because they are released with stbi_image_free()
+typedef uint8_t* (DecodePictureFunc)(const uint8_t* data, const size_t size, int* outWidth, int* outHeight);
+// Returns true when the decoder supports the format of the file
+typedef bool (ProbePictureFunc)(const uint8_t* data, const size_t size);
+
+typedef struct PictureDecoder {
+	const char* name;
+	ProbePictureFunc* probe;
+	DecodePictureFunc* decode;
+} PictureDecoder;
+
+#if USE_TURBOJPEG
+static bool ProbeJPEG(const uint8_t* data, const size_t size) {
+	bool result = size > 3 && data[0] == 0xFF && data[1] == 0xD8 && data[2] == 0xFF;
+	return(result);
+}
+
+static uint8_t* DecodeTurboJPEG(const uint8_t* data, const size_t size, int* outWidth, int* outHeight) {
+	tjhandle decompressor = tjInitDecompress();
+	if (decompressor == fpl_null) {
+		return fpl_null;
+	}
+	uint8_t* result = fpl_null;
+	int width, height, subsampling, colorspace;
+	if (tjDecompressHeader3(decompressor, (unsigned char*)data, (unsigned long)size, &width, &height, &subsampling, &colorspace) == 0) {
+		result = (uint8_t*)stbi__malloc((size_t)width * height * 4);
+		if (tjDecompress2(decompressor, (unsigned char*)data, (unsigned long)size, result, width, 0, height, TJPF_RGBA, 0) == 0) {
+			*outWidth = width;
+			*outHeight = height;
+		} else {
+			stbi_image_free(result);
+			result = fpl_null;
+		}
+	}
+	tjDestroy(decompressor);
+	return(result);
+}
+#endif
+
+static bool ProbeAnyPicture(const uint8_t* data, const size_t size) {
+	return(true);
+}
+
+static uint8_t* DecodeSTBImage(const uint8_t* data, const size_t size, int* outWidth, int* outHeight) {
+	if (size > (size_t)INT32_MAX) {
+		return fpl_null;
+	}
+	int comp = 0;
+	uint8_t* result = stbi_load_from_memory(data, (int)size, outWidth, outHeight, &comp, 4);
+	return(result);
+}
+
+// Decoders are tried in order, the first one which succeeds wins
+static const PictureDecoder PictureDecoders[] = {
+#if USE_TURBOJPEG
+	fplStructInit(PictureDecoder, "libjpeg-turbo", ProbeJPEG, DecodeTurboJPEG),
+#endif
+	fplStructInit(PictureDecoder, "stb_image", ProbeAnyPicture, DecodeSTBImage),
+};
+
+// Halves the source image with a 2x2 box filter, odd rows/columns at the border are clamped
 static void DownsampleImage(const ImageData* sourceData, ImageData* destData) {
-	int targetStride = destData->components * sizeof(char);
-	uint8_t* targetData = (uint8_t*)stbi__malloc(targetStride * destData->width * destData->height);
-	stbir_resize_uint8(sourceData->data, sourceData->width, sourceData->height, 0, targetData, destData->width, destData->height, 0, destData->components);
+	fplAssert(destData->width == fplMax(sourceData->width / 2, 1));
+	fplAssert(destData->height == fplMax(sourceData->height / 2, 1));
+	fplAssert(destData->components == sourceData->components);
+	const uint32_t comps = sourceData->components;
+	const size_t sourceStride = (size_t)sourceData->width * comps;
+	const size_t targetStride = (size_t)destData->width * comps;
+	uint8_t* targetData = (uint8_t*)stbi__malloc(targetStride * destData->height);
+	for (uint32_t y = 0; y < destData->height; ++y) {
+		const uint8_t* row0 = sourceData->data + (size_t)fplMin(y * 2, sourceData->height - 1) * sourceStride;
+		const uint8_t* row1 = sourceData->data + (size_t)fplMin(y * 2 + 1, sourceData->height - 1) * sourceStride;
+		uint8_t* dst = targetData + (size_t)y * targetStride;
+		uint32_t x = 0;
+#if defined(DOWNSAMPLE_SSE2)
+		if (comps == 4 && sourceData->width >= 2) {
+			// Two target pixels from four source pixels per row
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i round = _mm_set1_epi16(2);
+			for (; x + 2 <= destData->width && (x * 2 + 4) <= sourceData->width; x += 2) {
+				__m128i a = _mm_loadu_si128((const __m128i*)(row0 + x * 8));
+				__m128i b = _mm_loadu_si128((const __m128i*)(row1 + x * 8));
+				__m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+				__m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+				lo = _mm_add_epi16(lo, _mm_srli_si128(lo, 8));
+				hi = _mm_add_epi16(hi, _mm_srli_si128(hi, 8));
+				__m128i sum = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(lo, hi), round), 2);
+				_mm_storel_epi64((__m128i*)(dst + x * 4), _mm_packus_epi16(sum, zero));
+			}
+		}
+#endif
+		for (; x < destData->width; ++x) {
+			uint32_t x0 = fplMin(x * 2, sourceData->width - 1) * comps;
+			uint32_t x1 = fplMin(x * 2 + 1, sourceData->width - 1) * comps;
+			for (uint32_t c = 0; c < comps; ++c) {
+				uint32_t sum = (uint32_t)row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c];
+				dst[x * comps + c] = (uint8_t)((sum + 2) >> 2);
+			}
+		}
+	}
 	destData->data = targetData;
 }
 
+#define FNV1A64_OFFSET_BASIS 0xcbf29ce484222325ULL
+#define FNV1A64_PRIME 0x100000001b3ULL
+
+static uint64_t HashFNV1a64(uint64_t hash, const void* data, const size_t size) {
+	const uint8_t* p = (const uint8_t*)data;
+	for (size_t i = 0; i < size; ++i) {
+		hash ^= p[i];
+		hash *= FNV1A64_PRIME;
+	}
+	return(hash);
+}
+
+// Builds the cache key from the path, the size and the last modification time, so any change to the source file invalidates its thumbnail
+static bool GetThumbnailKey(const ViewerState* state, const char* filePath, ThumbnailKey* outKey) {
+	if (fplGetStringLength(state->thumbnailCachePath) == 0) {
+		return(false);
+	}
+	fplFileTimeStamps timeStamps;
+	if (!fplGetFileTimestampsFromPath(filePath, &timeStamps)) {
+		return(false);
+	}
+	outKey->pathHash = HashFNV1a64(FNV1A64_OFFSET_BASIS, filePath, fplGetStringLength(filePath));
+	outKey->fileSize = fplGetFileSizeFromPath64(filePath);
+	outKey->modifyTime = timeStamps.lastModifyTime;
+	uint64_t keyHash = HashFNV1a64(outKey->pathHash, &outKey->fileSize, sizeof(outKey->fileSize));
+	keyHash = HashFNV1a64(keyHash, &outKey->modifyTime, sizeof(outKey->modifyTime));
+	char fileName[32];
+	fplFormatString(fileName, fplArrayCount(fileName), "%08x%08x.thumb", (uint32_t)(keyHash >> 32), (uint32_t)(keyHash & 0xFFFFFFFF));
+	fplPathCombine(outKey->cacheFilePath, fplArrayCount(outKey->cacheFilePath), 2, state->thumbnailCachePath, fileName);
+	return(true);
+}
+
+static bool ReadThumbnail(const ThumbnailKey* key, ImageData* outImage, uint32_t* outSourceWidth, uint32_t* outSourceHeight) {
+	fplFileHandle file;
+	if (!fplOpenBinaryFile(key->cacheFilePath, &file)) {
+		return(false);
+	}
+	bool result = false;
+	ThumbnailHeader header;
+	if (fplReadFileBlock32(&file, sizeof(header), &header, sizeof(header)) == sizeof(header)) {
+		// A stale or foreign file is simply ignored and gets overwritten, once the picture was decoded again
+		bool isValid =
+			header.magic == THUMBNAIL_MAGIC &&
+			header.version == THUMBNAIL_VERSION &&
+			header.pathHash == key->pathHash &&
+			header.fileSize == key->fileSize &&
+			header.modifyTime == key->modifyTime &&
+			header.width > 0 && header.width <= THUMBNAIL_MAX_SIZE &&
+			header.height > 0 && header.height <= THUMBNAIL_MAX_SIZE &&
+			header.components == 4 &&
+			header.dataSize == header.width * header.height * header.components;
+		if (isValid) {
+			uint8_t* data = (uint8_t*)stbi__malloc(header.dataSize);
+			if (fplReadFileBlock32(&file, header.dataSize, data, header.dataSize) == header.dataSize) {
+				outImage->data = data;
+				outImage->width = header.width;
+				outImage->height = header.height;
+				outImage->components = header.components;
+				*outSourceWidth = header.sourceWidth;
+				*outSourceHeight = header.sourceHeight;
+				result = true;
+			} else {
+				stbi_image_free(data);
+			}
+		}
+	}
+	fplCloseFile(&file);
+	return(result);
+}
+
+static bool WriteThumbnail(const ThumbnailKey* key, const ImageData* sourceImage, const uint32_t pictureWidth, const uint32_t pictureHeight) {
+	fplAssert(sourceImage->data != fpl_null);
+	uint32_t thumbW = sourceImage->width;
+	uint32_t thumbH = sourceImage->height;
+	if (thumbW > THUMBNAIL_MAX_SIZE || thumbH > THUMBNAIL_MAX_SIZE) {
+		if (thumbW >= thumbH) {
+			thumbH = fplMax((uint32_t)(((uint64_t)thumbH * THUMBNAIL_MAX_SIZE) / thumbW), 1);
+			thumbW = THUMBNAIL_MAX_SIZE;
+		} else {
+			thumbW = fplMax((uint32_t)(((uint64_t)thumbW * THUMBNAIL_MAX_SIZE) / thumbH), 1);
+			thumbH = THUMBNAIL_MAX_SIZE;
+		}
+	}
+
+	ThumbnailHeader header = fplZeroInit;
+	header.magic = THUMBNAIL_MAGIC;
+	header.version = THUMBNAIL_VERSION;
+	header.pathHash = key->pathHash;
+	header.fileSize = key->fileSize;
+	header.modifyTime = key->modifyTime;
+	header.width = thumbW;
+	header.height = thumbH;
+	header.components = sourceImage->components;
+	header.sourceWidth = pictureWidth;
+	header.sourceHeight = pictureHeight;
+	header.dataSize = thumbW * thumbH * sourceImage->components;
+
+	uint8_t* thumbData = (uint8_t*)malloc(header.dataSize);
+	stbir_resize_uint8(sourceImage->data, sourceImage->width, sourceImage->height, 0, thumbData, thumbW, thumbH, 0, sourceImage->components);
+
+	// Write to a temporary file first and rename it afterwards, so other load threads never read a partially written thumbnail
+	char tempFilePath[FPL_MAX_PATH_LENGTH];
+	fplFormatString(tempFilePath, fplArrayCount(tempFilePath), "%s.%u.tmp", key->cacheFilePath, fplGetCurrentThreadId());
+	bool result = false;
+	fplFileHandle file;
+	if (fplCreateBinaryFile(tempFilePath, &file)) {
+		result =
+			fplWriteFileBlock32(&file, &header, sizeof(header)) == sizeof(header) &&
+			fplWriteFileBlock32(&file, thumbData, header.dataSize) == header.dataSize;
+		fplCloseFile(&file);
+		if (!result || !fplFileMove(tempFilePath, key->cacheFilePath)) {
+			fplFileDelete(tempFilePath);
+			result = false;
+		}
+	}
+	free(thumbData);
+	return(result);
+}
+
 static void LoadPictureThreadProc(const fplThreadHandle* thread, void* data) {
 	PictureLoadThread* loadThread = (PictureLoadThread*)data;
 	ViewerState* state = loadThread->state;
 	volatile LoadQueueValue valueToLoad = fplZeroInit;
-	volatile bool hasValue = false;
 	while (!loadThread->shutdown) {
-		fplConditionWait(&loadThread->condition, &loadThread->mutex, 50);
+		// Sleep until a picture was enqueued, each enqueued item wakes up exactly one thread
+		fplSemaphoreWait(&state->loadSemaphore, FPL_TIMEOUT_INFINITE);
 		if (loadThread->shutdown) {
 			break;
 		}
 
-		if (!hasValue) {
-			if (TryQueueDequeue(&state->loadQueue, &valueToLoad)) {
-				hasValue = true;
-			}
-		}
-
-		if (hasValue) {
+		if (TryQueueDequeue(&state->loadQueue, &valueToLoad)) {
 			fplAssert(valueToLoad.fileIndex >= 0 && valueToLoad.fileIndex < (int)state->pictureFileCount);
 			fplAssert(valueToLoad.pictureIndex >= 0 && valueToLoad.pictureIndex < (int)state->viewPicturesCapacity);
 			ViewPicture* loadedPic = &state->viewPictures[valueToLoad.pictureIndex];
-			const PictureFile* picFile = &state->pictureFiles[valueToLoad.fileIndex];
 
-			LoadedPictureState loadState = fplAtomicLoadS32(&loadedPic->state);
-			if (loadState == LoadedPictureState_Discard || loadThread->context.canceled || loadedPic->fileStream.handle.isValid) {
+			if (loadThread->context.canceled || loadedPic->fileStream.handle.isValid) {
 				continue;
 			}
-			if (loadState == LoadedPictureState_Unloaded || loadState == LoadedPictureState_Error) {
-				fplAtomicStoreS32(&loadedPic->state, LoadedPictureState_LoadingData);
+
+			// The main thread may have discarded the picture and queued the slot again for another file, this entry is stale then
+			if (fplAtomicLoadU32(&loadedPic->loadGeneration) != valueToLoad.generation) {
+				continue;
+			}
+
+			// The main thread may have discarded the queued picture in the meantime, when it has left the prefetch window
+			if (fplIsAtomicCompareAndSwapS32(&loadedPic->state, LoadedPictureState_Queued, LoadedPictureState_LoadingData)) {
+				// The slot may still have been queued again right before the exchange, so the request of the slot is loaded.
+				// It cannot change while loading, slots are only queued when they are unloaded.
+				const size_t fileIndex = loadedPic->fileIndex;
+				fplAssert(fileIndex < state->pictureFileCount);
+				const PictureFile* picFile = &state->pictureFiles[fileIndex];
 
 				// TODO(final): This should not be neccesary, but in case there are left-overs...
 				ClearPictureData(loadedPic, true);
+				fplAssert(fplAtomicLoadS32(&loadedPic->previewState) == LoadedPictureState_Unloaded);
 
 				ImageData* firstImage = &loadedPic->imageData[0];
 
 				fplAssert(!loadedPic->fileStream.handle.isValid);
 				fplAssert(firstImage->data == fpl_null);
-				fplAssert(firstImage->textureId == 0);
+				fplAssert(firstImage->tiles == fpl_null);
 				fplAssert(picFile->filePath != fpl_null);
 
 				loadedPic->progress = 0.0f;
 				loadedPic->fileStream.size = 0;
-				loadedPic->fileIndex = (size_t)valueToLoad.fileIndex;
 				fplCopyString(picFile->filePath, loadedPic->filePath, fplArrayCount(loadedPic->filePath));
 				firstImage->width = firstImage->height = 0;
 				firstImage->components = 0;
 				loadThread->context.viewPic = loadedPic;
 
+				// Show the cached thumbnail, while the full picture is decoded
+				ThumbnailKey thumbnailKey;
+				bool hasThumbnailKey = GetThumbnailKey(state, loadedPic->filePath, &thumbnailKey);
+				bool hasThumbnail = false;
+				if (hasThumbnailKey && ReadThumbnail(&thumbnailKey, &loadedPic->previewImage, &loadedPic->previewSourceWidth, &loadedPic->previewSourceHeight)) {
+					fplAtomicStoreS32(&loadedPic->previewState, LoadedPictureState_ToUpload);
+					hasThumbnail = true;
+				}
+
 				int w = 0, h = 0, comp = 0;
 				uint8_t* decodedData = fpl_null;
 
-				flogWrite("Load picture stream '%s' [%d]", loadedPic->filePath, loadedPic->fileIndex);
+				flogWrite("Load picture '%s' [%d]", loadedPic->filePath, loadedPic->fileIndex);
+				double decodeStartTime = fplGetTimeInMillisecondsHP();
+				const char* decoderName = "none";
 				if (fplOpenBinaryFile(loadedPic->filePath, &loadedPic->fileStream.handle)) {
-					loadedPic->fileStream.size = fplGetFileSizeFromHandle32(&loadedPic->fileStream.handle);
-					stbi_io_callbacks callbacks;
-					callbacks.read = ReadPictureStreamCallback;
-					callbacks.skip = SkipPictureStreamCallback;
-					callbacks.eof = EofPictureStreamCallback;
 					stbi_set_flip_vertically_on_load(0);
-					decodedData = stbi_load_from_callbacks(&callbacks, &loadThread->context, &w, &h, &comp, 4);
+
+					// Decode the whole mapped file at once, instead of many small reads through the stream callbacks
+					MappedFile mappedFile;
+					if (MapFile(&loadedPic->fileStream.handle, &mappedFile)) {
+						loadedPic->progress = 0.25f;
+						for (size_t decoderIndex = 0; decoderIndex < fplArrayCount(PictureDecoders); ++decoderIndex) {
+							const PictureDecoder* decoder = &PictureDecoders[decoderIndex];
+							if (loadThread->context.canceled || !decoder->probe(mappedFile.data, mappedFile.size)) {
+								continue;
+							}
+							decodedData = decoder->decode(mappedFile.data, mappedFile.size, &w, &h);
+							if (decodedData != fpl_null) {
+								decoderName = decoder->name;
+								break;
+							}
+						}
+						UnmapFile(&mappedFile);
+					} else {
+						// Fallback when the file cannot be mapped
+						loadedPic->fileStream.size = fplGetFileSizeFromHandle32(&loadedPic->fileStream.handle);
+						stbi_io_callbacks callbacks;
+						callbacks.read = ReadPictureStreamCallback;
+						callbacks.skip = SkipPictureStreamCallback;
+						callbacks.eof = EofPictureStreamCallback;
+						decodedData = stbi_load_from_callbacks(&callbacks, &loadThread->context, &w, &h, &comp, 4);
+						decoderName = "stb_image (stream)";
+					}
 					fplCloseFile(&loadedPic->fileStream.handle);
 				}
+				double decodeTime = fplGetTimeInMillisecondsHP() - decodeStartTime;
 
 				if (loadThread->shutdown || loadThread->context.canceled) {
 					// Loading is canceled
@@ -784,7 +1310,7 @@ static void LoadPictureThreadProc(const fplThreadHandle* thread, void* data) {
 				}
 				if (decodedData != fpl_null) {
 					// Loading was successful, mark it as ToUpload
-					flogWrite("Successfully loaded picture stream '%s' [%d], Size (%d x %d)", loadedPic->filePath, loadedPic->fileIndex, w, h);
+					flogWrite("Successfully loaded picture '%s' [%d], Size (%d x %d), Decoded by %s in %.2f ms", loadedPic->filePath, loadedPic->fileIndex, w, h, decoderName, decodeTime);
 
 					firstImage->width = (uint32_t)w;
 					firstImage->height = (uint32_t)h;
@@ -792,21 +1318,28 @@ static void LoadPictureThreadProc(const fplThreadHandle* thread, void* data) {
 					firstImage->data = decodedData;
 					loadedPic->progress = 0.75f;
 
+					// Build the mipmap chain, until the smallest mipmap fits into the min size
 					const ImageData* bigImage = firstImage;
 					for (uint32_t mipmapIndex = 1; mipmapIndex < MAX_PICTURE_MIPMAPS; ++mipmapIndex) {
-						int32_t mipSizeW = w / (2 * mipmapIndex);
-						int32_t mipSizeH = h / (2 * mipmapIndex);
-						if (mipSizeW < MIN_PICTURE_MIPMAP_SIZE &&
-							mipSizeH < MIN_PICTURE_MIPMAP_SIZE)
+						if (bigImage->width <= MIN_PICTURE_MIPMAP_SIZE && bigImage->height <= MIN_PICTURE_MIPMAP_SIZE) {
 							break;
+						}
 
 						ImageData* smallImage = &loadedPic->imageData[mipmapIndex];
-						smallImage->width = mipSizeW;
-						smallImage->height = mipSizeH;
+						smallImage->width = fplMax(bigImage->width / 2, 1);
+						smallImage->height = fplMax(bigImage->height / 2, 1);
 						smallImage->components = bigImage->components;
 						DownsampleImage(bigImage, smallImage);
 
 						++loadedPic->mipmapCount;
+						bigImage = smallImage;
+					}
+
+					// The thumbnail is built from the smallest mipmap, which is much faster than resizing the full picture
+					if (hasThumbnailKey && !hasThumbnail) {
+						if (!WriteThumbnail(&thumbnailKey, &loadedPic->imageData[loadedPic->mipmapCount], firstImage->width, firstImage->height)) {
+							flogWrite("Failed writing thumbnail '%s' for picture '%s' [%d]", thumbnailKey.cacheFilePath, loadedPic->filePath, loadedPic->fileIndex);
+						}
 					}
 
 
@@ -814,21 +1347,19 @@ static void LoadPictureThreadProc(const fplThreadHandle* thread, void* data) {
 				} else {
 					// Failed or canceled loading
 					bool isFailed = !(loadThread->shutdown || loadThread->context.canceled);
-					flogWrite("%s loaded picture stream '%s' [%d], Size (%d x %d)", (isFailed ? "Failed" : "Canceled"), loadedPic->filePath, loadedPic->fileIndex, w, h);
+					flogWrite("%s loaded picture '%s' [%d], Size (%d x %d) after %.2f ms", (isFailed ? "Failed" : "Canceled"), loadedPic->filePath, loadedPic->fileIndex, w, h, decodeTime);
 					loadedPic->progress = 1.0f;
 					fplAtomicStoreS32(&loadedPic->state, LoadedPictureState_Error);
 				}
 			}
-			hasValue = false;
 		}
 	}
 }
 
 static void InitLoadThreads(ViewerState* state, const size_t threadCount) {
 	state->loadThreadCount = threadCount;
+	fplSemaphoreInit(&state->loadSemaphore, 0);
 	for (size_t i = 0; i < state->loadThreadCount; ++i) {
-		fplMutexInit(&state->loadThreads[i].mutex);
-		fplConditionInit(&state->loadThreads[i].condition);
 		state->loadThreads[i].state = state;
 		state->loadThreads[i].shutdown = false;
 		state->loadThreads[i].context.canceled = false;
@@ -840,7 +1371,6 @@ static void InitLoadThreads(ViewerState* state, const size_t threadCount) {
 static void StopLoadingInThreads(ViewerState* state) {
 	for (size_t i = 0; i < state->loadThreadCount; ++i) {
 		state->loadThreads[i].context.canceled = true;
-		fplConditionSignal(&state->loadThreads[i].condition);
 	}
 }
 
@@ -848,7 +1378,9 @@ static void ShutdownLoadThreads(ViewerState* state) {
 	for (size_t i = 0; i < state->loadThreadCount; ++i) {
 		state->loadThreads[i].shutdown = true;
 		state->loadThreads[i].context.canceled = true;
-		fplConditionSignal(&state->loadThreads[i].condition);
+	}
+	for (size_t i = 0; i < state->loadThreadCount; ++i) {
+		fplSemaphoreRelease(&state->loadSemaphore);
 	}
 
 	// @FIXME(final): Passing an invalid stride should return a false, instead of hardly crashing or do we?
@@ -856,60 +1388,156 @@ static void ShutdownLoadThreads(ViewerState* state) {
 
 	fplThreadWaitForAll(&state->loadThreads[0].thread, state->loadThreadCount, sizeof(PictureLoadThread), FPL_TIMEOUT_INFINITE);
 
-	for (size_t i = 0; i < state->loadThreadCount; ++i) {
-		fplConditionDestroy(&state->loadThreads[i].condition);
-		fplMutexDestroy(&state->loadThreads[i].mutex);
+	fplSemaphoreDestroy(&state->loadSemaphore);
+}
+
+static bool IsInPrefetchWindow(const ViewerState* state, const int fileIndex) {
+	int aheadCount = (state->prefetchCount * 3) / 4;
+	int behindCount = state->prefetchCount - aheadCount;
+	int offset = (fileIndex - state->activeFileIndex) * state->browseDirection;
+	bool result = offset >= -behindCount && offset <= aheadCount;
+	return(result);
+}
+
+// Returns the least recently used ready picture outside of the prefetch window.
+// With includeWindow, the farthest ready picture inside of the prefetch window is returned when there is none outside, but never the active one.
+static ViewPicture* FindEvictableViewPicture(ViewerState* state, const bool includeWindow) {
+	ViewPicture* result = fpl_null;
+	ViewPicture* windowPic = fpl_null;
+	for (size_t i = 0; i < state->viewPicturesCapacity; ++i) {
+		ViewPicture* viewPic = &state->viewPictures[i];
+		if (fplAtomicLoadS32(&viewPic->state) != LoadedPictureState_Ready) {
+			continue;
+		}
+		if (!IsInPrefetchWindow(state, (int)viewPic->fileIndex)) {
+			if (result == fpl_null || viewPic->lastUsed < result->lastUsed) {
+				result = viewPic;
+			}
+		} else if (includeWindow && viewPic->fileIndex != (size_t)state->activeFileIndex) {
+			// Nearer pictures are used more recently, so the least recently used one is the farthest
+			if (windowPic == fpl_null || viewPic->lastUsed < windowPic->lastUsed) {
+				windowPic = viewPic;
+			}
+		}
+	}
+	if (result == fpl_null) {
+		result = windowPic;
 	}
+	return(result);
 }
 
-static void QueueUpPictures(ViewerState* state) {
-	// Compute how many pictures we need to preload on the left/right side
-	int capacity = (int)state->viewPicturesCapacity;
-	int maxSidePreloadCount = capacity / 2;
-	state->viewPictureIndex = maxSidePreloadCount;
-	fplAssert(state->activeFileIndex >= 0 && state->activeFileIndex < (int)state->pictureFileCount);
-	int preloadCountLeft;
-	int preloadCountRight;
-	if (state->activeFileIndex > 0) {
-		preloadCountLeft = fplMin(state->activeFileIndex, maxSidePreloadCount);
-	} else {
-		preloadCountLeft = 0;
+// Returns a free picture slot for a picture of the given size, after evicting pictures outside of the prefetch window to stay within the memory budget.
+// Returns null when the budget or all slots are used up. The active picture is always loaded:
+// It may exceed the budget and evicts the farthest picture inside of the prefetch window, when all slots are used.
+static ViewPicture* AcquireViewPicture(ViewerState* state, const size_t pictureSize, const bool isActive) {
+	while ((state->cacheMemoryUsage + pictureSize) > state->cacheMemoryBudget) {
+		ViewPicture* evictPic = FindEvictableViewPicture(state, false);
+		if (evictPic == fpl_null) {
+			if (!isActive) {
+				return fpl_null;
+			}
+			break;
+		}
+		ReleaseViewPicture(state, evictPic);
 	}
-	if (state->activeFileIndex < ((int)state->pictureFileCount - 1)) {
-		int diff = (int)state->pictureFileCount - state->activeFileIndex;
-		preloadCountRight = fplMax(fplMin(diff, maxSidePreloadCount), 0);
-	} else {
-		preloadCountRight = 0;
+	for (size_t i = 0; i < state->viewPicturesCapacity; ++i) {
+		ViewPicture* viewPic = &state->viewPictures[i];
+		LoadedPictureState loadState = fplAtomicLoadS32(&viewPic->state);
+		if (loadState == LoadedPictureState_Unloaded || loadState == LoadedPictureState_Error) {
+			// Failed or canceled pictures may still hold a preview
+			if (loadState == LoadedPictureState_Error) {
+				ReleaseViewPicture(state, viewPic);
+			}
+			return viewPic;
+		}
+	}
+	ViewPicture* evictPic = FindEvictableViewPicture(state, isActive);
+	if (evictPic != fpl_null) {
+		ReleaseViewPicture(state, evictPic);
 	}
+	return evictPic;
+}
 
-	// First picture
-	LoadQueueValue newValue;
-	newValue.fileIndex = state->activeFileIndex;
-	newValue.pictureIndex = state->viewPictureIndex;
-	TryQueueEnqueue(&state->loadQueue, newValue);
-
-	// Enqueu pictures from the left side
-	for (int i = 1; i <= preloadCountLeft; ++i) {
-		if ((state->activeFileIndex - i) >= 0) {
-			newValue.fileIndex = state->activeFileIndex - i;
-			newValue.pictureIndex = state->viewPictureIndex - i;
-			TryQueueEnqueue(&state->loadQueue, newValue);
+// Evicts least recently used pictures outside of the prefetch window, then the farthest pictures inside of it, until the memory usage is below the budget.
+// Pictures can be larger than their reserved estimate, so the ready pictures in the prefetch window alone may exceed the budget.
+static void EnforceMemoryBudget(ViewerState* state) {
+	while (state->cacheMemoryUsage > state->cacheMemoryBudget) {
+		ViewPicture* evictPic = FindEvictableViewPicture(state, true);
+		if (evictPic == fpl_null) {
+			break;
 		}
+		ReleaseViewPicture(state, evictPic);
 	}
+}
 
-	// Enqueu pictures from the right side
-	for (int i = 1; i <= preloadCountRight; ++i) {
-		if ((state->activeFileIndex + i) < (int)state->pictureFileCount) {
-			newValue.fileIndex = state->activeFileIndex + i;
-			newValue.pictureIndex = state->viewPictureIndex + i;
-			TryQueueEnqueue(&state->loadQueue, newValue);
+static bool PushLoadRequest(ViewerState* state, const int fileIndex, ViewPicture* viewPic, const size_t reserveSize) {
+	LoadQueueValue newValue;
+	newValue.fileIndex = fileIndex;
+	newValue.pictureIndex = (int)(viewPic - state->viewPictures);
+	newValue.generation = fplAtomicLoadU32(&viewPic->loadGeneration) + 1;
+	viewPic->fileIndex = (size_t)fileIndex;
+	viewPic->progress = 0.0f;
+	// The picture counts towards the memory budget right away, so the prefetch window cannot queue up more than fits into the cache
+	fplAssert(viewPic->memorySize == 0 && viewPic->reservedSize == 0);
+	viewPic->reservedSize = reserveSize;
+	viewPic->memorySize = reserveSize;
+	state->cacheMemoryUsage += reserveSize;
+	// The generation is published before the state, so a loader which sees the queued state also sees the new generation
+	fplAtomicStoreU32(&viewPic->loadGeneration, newValue.generation);
+	fplAtomicStoreS32(&viewPic->state, LoadedPictureState_Queued);
+	if (!TryQueueEnqueue(&state->loadQueue, newValue)) {
+		state->cacheMemoryUsage -= reserveSize;
+		viewPic->memorySize = 0;
+		viewPic->reservedSize = 0;
+		fplAtomicStoreS32(&viewPic->state, LoadedPictureState_Unloaded);
+		return(false);
+	}
+	fplSemaphoreRelease(&state->loadSemaphore);
+	return(true);
+}
+
+static void UpdatePrefetch(ViewerState* state) {
+	if (state->activeFileIndex < 0) {
+		return;
+	}
+
+	// Pictures which are still queued, but have left the prefetch window are discarded
+	for (size_t i = 0; i < state->viewPicturesCapacity; ++i) {
+		ViewPicture* viewPic = &state->viewPictures[i];
+		if (fplAtomicLoadS32(&viewPic->state) == LoadedPictureState_Queued && !IsInPrefetchWindow(state, (int)viewPic->fileIndex)) {
+			fplAtomicCompareAndSwapS32(&viewPic->state, LoadedPictureState_Queued, LoadedPictureState_Discard);
 		}
 	}
 
-	// Wakeup load threads
-	for (size_t i = 0; i < state->loadThreadCount; ++i) {
-		state->loadThreads[i].context.canceled = false;
-		fplConditionSignal(&state->loadThreads[i].condition);
+	// Walk the prefetch window from the active picture outwards, the browse direction gets three quarters of the window
+	int aheadCount = (state->prefetchCount * 3) / 4;
+	int behindCount = state->prefetchCount - aheadCount;
+	int maxDistance = fplMax(aheadCount, behindCount);
+	size_t pictureSizeEstimate = state->decodedPictureCount > 0 ? state->decodedPictureBytes / state->decodedPictureCount : DEFAULT_PICTURE_SIZE_ESTIMATE;
+	uint64_t useStamp = state->viewPictureUseCounter + (uint64_t)maxDistance * 2 + 1;
+	state->viewPictureUseCounter = useStamp;
+	for (int distance = 0; distance <= maxDistance; ++distance) {
+		for (int side = 0; side < 2; ++side) {
+			if ((side == 0 && distance > aheadCount) || (side == 1 && (distance == 0 || distance > behindCount))) {
+				continue;
+			}
+			int fileIndex = state->activeFileIndex + (side == 0 ? distance : -distance) * state->browseDirection;
+			if (fileIndex < 0 || fileIndex >= (int)state->pictureFileCount) {
+				continue;
+			}
+
+			// Nearer pictures are used more recently
+			--useStamp;
+
+			ViewPicture* viewPic = FindViewPicture(state, fileIndex);
+			if (viewPic == fpl_null) {
+				viewPic = AcquireViewPicture(state, pictureSizeEstimate, distance == 0);
+				if (viewPic == fpl_null || !PushLoadRequest(state, fileIndex, viewPic, pictureSizeEstimate)) {
+					return;
+				}
+			}
+			viewPic->lastUsed = useStamp;
+		}
 	}
 }
 
@@ -927,29 +1555,17 @@ static void UpdateWindowTitle(ViewerState* state) {
 
 static void ChangeViewPicture(ViewerState* state, const int offset, const bool forceReload) {
 	if (state->pictureFileCount == 0) {
-		fplAssert(state->viewPictureIndex == -1);
 		fplAssert(state->activeFileIndex == -1);
 		return;
 	}
-	int capacity = (int)state->viewPicturesCapacity;
-	bool loadPictures = false;
-	int viewIndex;
-	if (state->viewPictureIndex == -1 || forceReload) {
-		viewIndex = capacity / 2;
-		loadPictures = true;
-	} else {
-		viewIndex = state->viewPictureIndex + offset;
-		if (viewIndex < 0 || viewIndex >= capacity) {
-			viewIndex = capacity / 2;
-			loadPictures = true;
-		}
+	if (offset != 0) {
+		state->browseDirection = offset < 0 ? -1 : 1;
 	}
-	state->viewPictureIndex = viewIndex;
 	state->activeFileIndex = fplMax(fplMin(state->activeFileIndex + offset, (int)state->pictureFileCount - 1), 0);
 
 	UpdateWindowTitle(state);
 
-	if (loadPictures) {
+	if (forceReload) {
 		state->doPictureReload = true;
 		ShutdownQueue(&state->loadQueue);
 		StopLoadingInThreads(state);
@@ -983,6 +1599,15 @@ static void ParseParameters(ViewerParameters* params, const int argc, char** arg
 				case 't':
 					params->threadCount = 0;
 					break;
+				case 'p':
+					params->preloadCount = 0;
+					break;
+				case 'm':
+					params->memoryBudgetMB = 0;
+					break;
+				case 'n':
+					params->noThumbnailCache = true;
+					break;
 				default:
 					continue;
 			}
@@ -1002,6 +1627,14 @@ static void ParseParameters(ViewerParameters* params, const int argc, char** arg
 				} else {
 					continue;
 				}
+			} else if (param == 'm') {
+				++p;
+				if (p[0] == '=') {
+					++p;
+					params->memoryBudgetMB = ParseNumber(&p);
+				} else {
+					continue;
+				}
 			}
 		} else {
 			params->path = p;
@@ -1102,14 +1735,14 @@ static void Kill(ViewerState* state) {
 	ShutdownQueue(&state->loadQueue);
 	ShutdownLoadThreads(state);
 	ClearPictureFiles(state);
-	ClearViewPictures(state);
+	ClearViewPictures(state, false);
 }
 
 static void Clear(ViewerState* state) {
 	ShutdownQueue(&state->loadQueue);
 	StopLoadingInThreads(state);
 	ClearPictureFiles(state);
-	ClearViewPictures(state);
+	ClearViewPictures(state, false);
 }
 
 static bool FindPictureIndexByPath(ViewerState* state, const char* path, size_t* outIndex) {
@@ -1211,6 +1844,12 @@ static bool Init(ViewerState* state) {
 		state->textureTarget = GL_TEXTURE_2D;
 	}
 
+	// Pictures bigger than this are split into multiple tiles
+	GLint maxTextureSize = 0;
+	glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+	state->features.maxTextureSize = maxTextureSize > 0 ? maxTextureSize : 1024;
+	flogWrite("Max texture size: %d", state->features.maxTextureSize);
+
 	glClearColor(0, 0, 0, 1);
 	glEnable(GL_BLEND);
 	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
@@ -1258,10 +1897,23 @@ static bool Init(ViewerState* state) {
 		CheckGL(0);
 	}
 
-	state->viewPictureIndex = -1;
 	state->activeFileIndex = -1;
+	state->browseDirection = 1;
 	state->doPictureReload = false;
 
+	// Thumbnails are cached persistently next to the log file
+	state->thumbnailCachePath[0] = 0;
+	if (!state->params.noThumbnailCache) {
+		char thumbnailCachePath[FPL_MAX_PATH_LENGTH];
+		fplGetHomePath(thumbnailCachePath, fplArrayCount(thumbnailCachePath));
+		fplPathCombine(thumbnailCachePath, fplArrayCount(thumbnailCachePath), 3, thumbnailCachePath, VER_INTERNALNAME_STR, THUMBNAIL_CACHE_DIRECTORY);
+		fplDirectoriesCreate(thumbnailCachePath);
+		if (fplDirectoryExists(thumbnailCachePath)) {
+			fplCopyString(thumbnailCachePath, state->thumbnailCachePath, fplArrayCount(state->thumbnailCachePath));
+		}
+	}
+	flogWrite("Thumbnail cache path: %s", state->thumbnailCachePath);
+
 	// Allocate and startup load threads
 	size_t threadCount;
 	if (state->params.threadCount > 0) {
@@ -1271,17 +1923,21 @@ static bool Init(ViewerState* state) {
 	}
 	InitLoadThreads(state, threadCount);
 
+	// The prefetch window must leave room in the cache for recently viewed pictures
 	size_t preloadCapacity;
 	if (state->params.preloadCount > 0) {
-		preloadCapacity = state->params.preloadCount;
-		if ((state->params.preloadCount % 2) != 0) {
-			state->params.preloadCount++;
-		}
+		preloadCapacity = fplMin(state->params.preloadCount, MAX_VIEW_PICTURE_COUNT / 2);
 	} else {
-		preloadCapacity = 16;
-	}
-	size_t queueCapacity = RoundToPowerOfTwo((preloadCapacity + 1) * 2);
-	state->viewPicturesCapacity = preloadCapacity + 1;
+		preloadCapacity = DEFAULT_PRELOAD_COUNT;
+	}
+	size_t memoryBudgetMB = state->params.memoryBudgetMB > 0 ? state->params.memoryBudgetMB : DEFAULT_MEMORY_BUDGET_MB;
+	size_t queueCapacity = MAX_LOAD_QUEUE_COUNT;
+	state->prefetchCount = (int)preloadCapacity;
+	state->viewPicturesCapacity = MAX_VIEW_PICTURE_COUNT;
+	state->cacheMemoryBudget = memoryBudgetMB * 1024 * 1024;
+	state->cacheMemoryUsage = 0;
+	state->decodedPictureBytes = 0;
+	state->decodedPictureCount = 0;
 	state->loadQueueCapacity = queueCapacity;
 
 	fplAssert(fplIsPowerOfTwo(queueCapacity));
@@ -1490,118 +2146,264 @@ static void DrawTexturedRectangle(ViewerState* state, const GLuint textureId, co
 	fplAssert(glGetError() == GL_NO_ERROR);
 }
 
-static void UpdateAndRender(ViewerState* state, const float deltaTime) {
-	// Discard textures on the left/right side when the fileIndex is out of bounds
-	if (state->viewPictureIndex != -1) {
-		ViewPicture* currentPic = &state->viewPictures[state->viewPictureIndex];
-		if (currentPic->fileIndex == 0) {
-			for (int i = 0; i < state->viewPictureIndex; ++i) {
-				ViewPicture* sidePic = &state->viewPictures[i];
-				if (sidePic->state == LoadedPictureState_Ready) {
-					fplAtomicStoreS32(&sidePic->state, LoadedPictureState_Discard);
-				}
-			}
-		} else if (currentPic->fileIndex == state->pictureFileCount - 1) {
-			for (int i = state->viewPictureIndex + 1; i < (int)state->viewPicturesCapacity; ++i) {
-				ViewPicture* sidePic = &state->viewPictures[i];
-				if (sidePic->state == LoadedPictureState_Ready) {
-					fplAtomicStoreS32(&sidePic->state, LoadedPictureState_Discard);
-				}
+// Fits the picture into the target rectangle, depending on the view flags
+static void ComputePictureViewRect(const ViewerState* state, const float texW, const float texH, const float targetRectX, const float targetRectY, const float targetRectWidth, const float targetRectHeight, float* outViewX, float* outViewY, float* outViewWidth, float* outViewHeight) {
+	float viewWidth;
+	float viewHeight;
+	float viewX;
+	float viewY;
+	if ((state->viewFlags & PictureViewFlags_KeepAspectRatio) == PictureViewFlags_KeepAspectRatio) {
+		float aspect = texH > 0 ? texW / texH : 1;
+		fplAssert(aspect != 0);
+		float targetHeight = targetRectWidth / aspect;
+		if ((texW > targetRectWidth || texH > targetRectHeight) || ((state->viewFlags & PictureViewFlags_Upscale) == PictureViewFlags_Upscale)) {
+			// Upscaling
+			if (targetHeight > targetRectHeight) {
+				viewHeight = targetRectHeight;
+				viewWidth = targetRectHeight * aspect;
+				viewX = targetRectX + (targetRectWidth - viewWidth) * 0.5f;
+				viewY = targetRectY;
+			} else {
+				viewWidth = targetRectWidth;
+				viewHeight = targetRectWidth / aspect;
+				viewX = targetRectX;
+				viewY = targetRectY + (targetRectHeight - viewHeight) * 0.5f;
 			}
+		} else {
+			// Downscaling
+			viewWidth = texW;
+			viewHeight = texH;
+			viewX = targetRectX + (targetRectWidth - viewWidth) * 0.5f;
+			viewY = targetRectY + (targetRectHeight - viewHeight) * 0.5f;
 		}
+	} else {
+		viewWidth = targetRectWidth;
+		viewHeight = targetRectHeight;
+		viewX = targetRectX;
+		viewY = targetRectY;
+	}
+	*outViewX = viewX;
+	*outViewY = viewY;
+	*outViewWidth = viewWidth;
+	*outViewHeight = viewHeight;
+}
+
+// Returns the smallest mipmap which is still at least as big as the view, so a picture is never upscaled from a smaller mipmap
+static uint32_t SelectMipmapLevel(const ViewPicture* pic, const float viewWidth, const float viewHeight) {
+	uint32_t level = 0;
+	while (level < pic->mipmapCount) {
+		const ImageData* nextImage = &pic->imageData[level + 1];
+		if ((float)nextImage->width < viewWidth || (float)nextImage->height < viewHeight) {
+			break;
+		}
+		++level;
 	}
+	return(level);
+}
 
-	// Discard or upload textures
-	for (size_t i = 0; i < state->viewPicturesCapacity; ++i) {
-		ViewPicture* loadedPic = &state->viewPictures[i];
+static uint32_t GetRequiredMipmapLevel(const ViewerState* state, const ViewPicture* pic, const float targetRectWidth, const float targetRectHeight) {
+	float viewX, viewY, viewWidth, viewHeight;
+	ComputePictureViewRect(state, (float)pic->imageData[0].width, (float)pic->imageData[0].height, 0.0f, 0.0f, targetRectWidth, targetRectHeight, &viewX, &viewY, &viewWidth, &viewHeight);
+	uint32_t result = SelectMipmapLevel(pic, viewWidth, viewHeight);
+	return(result);
+}
 
-		if (fplAtomicLoadS32(&loadedPic->state) == LoadedPictureState_Discard) {
+// Returns the requested mipmap when it is fully uploaded, otherwise the nearest smaller one which is
+static const ImageData* GetDrawableMipmap(const ViewPicture* pic, const uint32_t level) {
+	for (uint32_t mipmapIndex = level; mipmapIndex <= pic->mipmapCount; ++mipmapIndex) {
+		const ImageData* imageData = &pic->imageData[mipmapIndex];
+		if (imageData->tileCount > 0 && imageData->uploadedTileCount == imageData->tileCount) {
+			return imageData;
+		}
+	}
+	return fpl_null;
+}
 
-			for (int p = 0; p < fplArrayCount(loadedPic->imageData); ++p) {
-				if (loadedPic->imageData[p].textureId > 0) {
-					fplDebugFormatOut("Release texture '%s'[%d]\n", loadedPic->filePath, loadedPic->fileIndex);
-					ReleaseTexture(&loadedPic->imageData[p].textureId);
-				}
-			}
+static size_t GetPictureDataSize(const ViewPicture* pic) {
+	size_t result = 0;
+	for (uint32_t mipmapIndex = 0; mipmapIndex <= pic->mipmapCount; ++mipmapIndex) {
+		const ImageData* imageData = &pic->imageData[mipmapIndex];
+		result += (size_t)imageData->width * imageData->height * imageData->components;
+	}
+	return(result);
+}
 
-			fplAtomicStoreS32(&loadedPic->state, LoadedPictureState_Unloaded);
-		} else if (fplAtomicLoadS32(&loadedPic->state) == LoadedPictureState_ToUpload) {
-			for (int p = 0; p < fplArrayCount(loadedPic->imageData); ++p) {
-				if (loadedPic->imageData[p].textureId > 0) {
-					fplDebugFormatOut("Release texture '%s'[%d]\n", loadedPic->filePath, loadedPic->fileIndex);
-					ReleaseTexture(&loadedPic->imageData[p].textureId);
+static uint32_t GetMaxTileSize(const ViewerState* state) {
+	uint32_t result = fplMin((uint32_t)MAX_PICTURE_TILE_SIZE, (uint32_t)state->features.maxTextureSize);
+	return(result);
+}
+
+// Uploads the tiles of all ready pictures up to their required mipmap, smallest mipmap and nearest picture first, until the frame budget is used up
+static void UploadPendingTiles(ViewerState* state, const float targetRectWidth, const float targetRectHeight) {
+	size_t uploadedBytes = 0;
+	while (uploadedBytes < MAX_UPLOAD_BYTES_PER_FRAME) {
+		ViewPicture* uploadPic = fpl_null;
+		ImageData* uploadImage = fpl_null;
+		for (size_t i = 0; i < state->viewPicturesCapacity; ++i) {
+			ViewPicture* viewPic = &state->viewPictures[i];
+			if (fplAtomicLoadS32(&viewPic->state) != LoadedPictureState_Ready) {
+				continue;
+			}
+			if (uploadPic != fpl_null && viewPic->lastUsed <= uploadPic->lastUsed) {
+				continue;
+			}
+			uint32_t requiredLevel = GetRequiredMipmapLevel(state, viewPic, targetRectWidth, targetRectHeight);
+			for (int mipmapIndex = (int)viewPic->mipmapCount; mipmapIndex >= (int)requiredLevel; --mipmapIndex) {
+				ImageData* imageData = &viewPic->imageData[mipmapIndex];
+				if (imageData->uploadedTileCount < imageData->tileCount) {
+					uploadPic = viewPic;
+					uploadImage = imageData;
+					break;
 				}
-				fplAssert(loadedPic->imageData[p].textureId == 0);
 			}
+		}
+		if (uploadPic == fpl_null) {
+			break;
+		}
+		if (!UploadNextImageTile(state, uploadImage, &uploadedBytes)) {
+			// The preview is kept, its memory is released when the slot is reused
+			size_t pictureSize = GetPictureDataSize(uploadPic);
+			fplAssert(uploadPic->memorySize >= pictureSize && state->cacheMemoryUsage >= pictureSize);
+			uploadPic->memorySize -= pictureSize;
+			state->cacheMemoryUsage -= pictureSize;
+			ClearPictureData(uploadPic, false);
+			fplAtomicStoreS32(&uploadPic->state, LoadedPictureState_Error);
+		}
+	}
+}
 
-			bool hasError = false;
-			uint32_t mipmapCount = loadedPic->mipmapCount + 1;
-			for (uint32_t mipmapIndex = 0; mipmapIndex < mipmapCount; ++mipmapIndex) {
-				ImageData* currentImageData = &loadedPic->imageData[mipmapIndex];
+static void DrawImageTiles(ViewerState* state, const ImageData* imageData, const Mat4f* vpMat, const float viewLeft, const float viewBottom, const float viewWidth, const float viewHeight, const Vec4f color) {
+	GLuint filterProgramId = state->filters[state->activeFilter].programId;
+	float scaleX = viewWidth / (float)imageData->width;
+	float scaleY = viewHeight / (float)imageData->height;
+	for (uint32_t tileIndex = 0; tileIndex < imageData->uploadedTileCount; ++tileIndex) {
+		const ImageTile* tile = &imageData->tiles[tileIndex];
+		// Picture rows are stored from top to bottom
+		float tileWidth = (float)tile->width * scaleX;
+		float tileHeight = (float)tile->height * scaleY;
+		float tileLeft = viewLeft + (float)tile->x * scaleX;
+		float tileTop = viewBottom + viewHeight - (float)tile->y * scaleY;
 
-				fplAssert(currentImageData->data != fpl_null);
-				fplAssert(currentImageData->width > 0 && currentImageData->height > 0);
-				fplAssert(currentImageData->components > 0);
+		Mat4f modelMat;
+		BuildModelMat(tileLeft + tileWidth * 0.5f, tileTop - tileHeight * 0.5f, tileWidth * 0.5f, tileHeight * 0.5f, &modelMat);
 
-				fplDebugFormatOut("Allocate texture '%s'/%d for level %d\n", loadedPic->filePath, loadedPic->fileIndex, mipmapIndex);
-				currentImageData->textureId = AllocateTexture(currentImageData->width, currentImageData->height, (uint8_t)currentImageData->components, currentImageData->data, false, state->textureTarget, state->features.srgbFrameBuffer);
-				if (currentImageData->textureId == 0) {
-					hasError = true;
-					break;
-				}
+		Vec2f texSize = V2f((float)tile->width, (float)tile->height);
+		Vec2f texScale = state->features.rectangleTextures ? texSize : V2f(1.0f, 1.0f);
+		DrawTexturedRectangle(state, tile->textureId, state->textureTarget, filterProgramId, vpMat, &modelMat, color, texSize, texScale);
+	}
+}
 
-				stbi_image_free(currentImageData->data);
-				currentImageData->data = fpl_null;
-			}
+static void UpdateAndRender(ViewerState* state, const float deltaTime) {
+	int w, h;
+	fplWindowSize winSize;
+	if (fplGetWindowSize(&winSize)) {
+		w = winSize.width;
+		h = winSize.height;
+	} else {
+		w = 0;
+		h = 0;
+	}
+
+	float screenLeft = -(float)w * 0.5f;
+	float screenRight = (float)w * 0.5f;
+	float screenBottom = -(float)h * 0.5f;
+	float screenTop = (float)h * 0.5f;
+	float screenW = (float)w;
+	float screenH = (float)h;
+
+	float pictureScale = 1.0f;
+	float targetRectWidth = screenW * pictureScale;
+	float targetRectHeight = screenH * pictureScale;
+
+	// Discard pictures and prepare the tiles for uploading
+	uint32_t maxTileSize = GetMaxTileSize(state);
+	for (size_t i = 0; i < state->viewPicturesCapacity; ++i) {
+		ViewPicture* loadedPic = &state->viewPictures[i];
 
-			if (!hasError) {
-				fplAtomicStoreS32(&loadedPic->state, LoadedPictureState_Ready);
+		if (fplAtomicLoadS32(&loadedPic->previewState) == LoadedPictureState_ToUpload) {
+			ImageData* previewImage = &loadedPic->previewImage;
+			fplAssert(previewImage->data != fpl_null && previewImage->tiles == fpl_null);
+			SetupImageTiles(previewImage, maxTileSize);
+			size_t previewSize = 0;
+			bool previewUploaded = true;
+			while (previewUploaded && previewImage->uploadedTileCount < previewImage->tileCount) {
+				previewUploaded = UploadNextImageTile(state, previewImage, &previewSize);
+			}
+			if (previewUploaded) {
+				loadedPic->memorySize += previewSize;
+				state->cacheMemoryUsage += previewSize;
+				fplAtomicStoreS32(&loadedPic->previewState, LoadedPictureState_Ready);
 			} else {
-				fplAtomicStoreS32(&loadedPic->state, LoadedPictureState_Error);
+				ClearImageData(previewImage, false);
+				fplAtomicStoreS32(&loadedPic->previewState, LoadedPictureState_Error);
 			}
+		}
 
+		if (fplAtomicLoadS32(&loadedPic->state) == LoadedPictureState_Discard) {
+			ReleaseViewPicture(state, loadedPic);
+		} else if (fplAtomicLoadS32(&loadedPic->state) == LoadedPictureState_Error && loadedPic->reservedSize > 0) {
+			// A failed picture has no decoded data, its slot and preview are kept until the slot is reused
+			fplAssert(loadedPic->memorySize >= loadedPic->reservedSize && state->cacheMemoryUsage >= loadedPic->reservedSize);
+			loadedPic->memorySize -= loadedPic->reservedSize;
+			state->cacheMemoryUsage -= loadedPic->reservedSize;
+			loadedPic->reservedSize = 0;
+		} else if (fplAtomicLoadS32(&loadedPic->state) == LoadedPictureState_ToUpload) {
+			// The decoded data is accounted right away, the tiles are uploaded incrementally in UploadPendingTiles()
+			for (uint32_t mipmapIndex = 0; mipmapIndex <= loadedPic->mipmapCount; ++mipmapIndex) {
+				ImageData* currentImageData = &loadedPic->imageData[mipmapIndex];
+				fplAssert(currentImageData->data != fpl_null);
+				fplAssert(currentImageData->width > 0 && currentImageData->height > 0);
+				fplAssert(currentImageData->components > 0);
+				SetupImageTiles(currentImageData, maxTileSize);
+			}
+			// The reserved estimate is replaced by the actual size
+			size_t memorySize = GetPictureDataSize(loadedPic);
+			fplAssert(loadedPic->memorySize >= loadedPic->reservedSize && state->cacheMemoryUsage >= loadedPic->reservedSize);
+			loadedPic->memorySize = loadedPic->memorySize - loadedPic->reservedSize + memorySize;
+			state->cacheMemoryUsage = state->cacheMemoryUsage - loadedPic->reservedSize + memorySize;
+			loadedPic->reservedSize = 0;
+			state->decodedPictureBytes += memorySize;
+			++state->decodedPictureCount;
 			loadedPic->progress = 1.0f;
+			fplAtomicStoreS32(&loadedPic->state, LoadedPictureState_Ready);
 		}
 	}
+
+	// Huge pictures are uploaded across several frames, only the mipmaps needed for the current view size are uploaded at all
+	UploadPendingTiles(state, targetRectWidth, targetRectHeight);
 	fplAssert(glGetError() == GL_NO_ERROR);
 
-	// Start to queue up pictures to load
 	if (state->doPictureReload) {
+		// Discard all pictures and wait until the canceled load threads are done, before we start to queue up pictures again
 		size_t notUnloadedCount = 0;
 		for (size_t i = 0; i < state->viewPicturesCapacity; ++i) {
 			ViewPicture* viewPic = &state->viewPictures[i];
 			LoadedPictureState loadState = fplAtomicLoadS32(&viewPic->state);
-			if (loadState != LoadedPictureState_Unloaded) {
-				if (loadState != LoadedPictureState_Error) {
-					fplAtomicStoreS32(&viewPic->state, LoadedPictureState_Discard);
-					++notUnloadedCount;
-				}
+			if (loadState == LoadedPictureState_Ready || loadState == LoadedPictureState_ToUpload || loadState == LoadedPictureState_Queued) {
+				fplAtomicStoreS32(&viewPic->state, LoadedPictureState_Discard);
+				++notUnloadedCount;
+			} else if (loadState == LoadedPictureState_LoadingData || loadState == LoadedPictureState_Discard) {
+				++notUnloadedCount;
+			} else if (loadState == LoadedPictureState_Error) {
+				// Canceled pictures must be loaded again
+				ReleaseViewPicture(state, viewPic);
 			}
 		}
 		if (notUnloadedCount == 0) {
 			InitQueue(&state->loadQueue, state->loadQueueCapacity);
-			QueueUpPictures(state);
+			for (size_t i = 0; i < state->loadThreadCount; ++i) {
+				state->loadThreads[i].context.canceled = false;
+			}
 			state->doPictureReload = false;
 		}
 	}
 
-	int w, h;
-	fplWindowSize winSize;
-	if (fplGetWindowSize(&winSize)) {
-		w = winSize.width;
-		h = winSize.height;
-	} else {
-		w = 0;
-		h = 0;
+	// Queue up pictures in the prefetch window and keep the cache within its memory budget
+	if (!state->doPictureReload) {
+		UpdatePrefetch(state);
+		EnforceMemoryBudget(state);
 	}
 
-	float screenLeft = -(float)w * 0.5f;
-	float screenRight = (float)w * 0.5f;
-	float screenBottom = -(float)h * 0.5f;
-	float screenTop = (float)h * 0.5f;
-	float screenW = (float)w;
-	float screenH = (float)h;
-
 	glClear(GL_COLOR_BUFFER_BIT);
 	glViewport(0, 0, w, h);
 
@@ -1612,103 +2414,42 @@ static void UpdateAndRender(ViewerState* state, const float deltaTime) {
 	Mat4f viewProjection;
 	MultMat4f(&proj, &view, &viewProjection);
 
-	float pictureScale = 1.0f;
 	int pictureFrameSideCount = 0;
 
-	float targetRectWidth = screenW * pictureScale;
-	float targetRectHeight = screenH * pictureScale;
 	float targetRectLeft = screenLeft + (screenW - targetRectWidth) * 0.5f;
 	float targetRectBottom = screenBottom + (screenH - targetRectHeight) * 0.5f;
 	float pictureFrameSpacing = 10;
 
-	if (state->pictureFileCount > 0 && state->viewPictureIndex > -1 && state->viewPictureIndex < (int)state->viewPicturesCapacity) {
+	if (state->pictureFileCount > 0 && state->activeFileIndex > -1) {
 		int framePictureStart = fplMin(-pictureFrameSideCount, 0);
 		int framePictureEnd = (framePictureStart + 1 + pictureFrameSideCount);
 		for (int framePictureOffset = framePictureStart; framePictureOffset < (framePictureEnd + 1); ++framePictureOffset) {
-			if ((state->viewPictureIndex + framePictureOffset) < 0 || (state->viewPictureIndex + framePictureOffset) > ((int)state->viewPicturesCapacity - 1)) {
+			ViewPicture* loadedPic = FindViewPicture(state, state->activeFileIndex + framePictureOffset);
+			if (loadedPic == fpl_null) {
 				continue;
 			}
-			ViewPicture* loadedPic = &state->viewPictures[state->viewPictureIndex + framePictureOffset];
 			LoadedPictureState pictureState = fplAtomicLoadS32(&loadedPic->state);
-			if (pictureState == LoadedPictureState_Unloaded) {
-				continue;
-			}
 
 			float targetOpacity = 1.0f;
 			float targetRectX = targetRectLeft + (targetRectWidth * (float)framePictureOffset) + (pictureFrameSpacing * (float)framePictureOffset);
 			float targetRectY = targetRectBottom;
 
+			// Draw the best uploaded mipmap for the view size, until then the preview is stretched to the size of the source picture
+			const ImageData* drawImage = fpl_null;
+			float viewX, viewY, viewWidth, viewHeight;
 			if (pictureState == LoadedPictureState_Ready) {
-				ImageData imageData = loadedPic->imageData[0];
-				float texW = (float)imageData.width;
-				float texH = (float)imageData.height;
-				float viewWidth;
-				float viewHeight;
-				float viewX;
-				float viewY;
-				if ((state->viewFlags & PictureViewFlags_KeepAspectRatio) == PictureViewFlags_KeepAspectRatio) {
-					float aspect = texH > 0 ? texW / texH : 1;
-					fplAssert(aspect != 0);
-					float targetHeight = targetRectWidth / aspect;
-					if ((texW > targetRectWidth || texH > targetRectHeight) || ((state->viewFlags & PictureViewFlags_Upscale) == PictureViewFlags_Upscale)) {
-						// Upscaling
-						if (targetHeight > targetRectHeight) {
-							viewHeight = targetRectHeight;
-							viewWidth = targetRectHeight * aspect;
-							viewX = targetRectX + (targetRectWidth - viewWidth) * 0.5f;
-							viewY = targetRectY;
-						} else {
-							viewWidth = targetRectWidth;
-							viewHeight = targetRectWidth / aspect;
-							viewX = targetRectX;
-							viewY = targetRectY + (targetRectHeight - viewHeight) * 0.5f;
-						}
-					} else {
-						// Downscaling
-						viewWidth = texW;
-						viewHeight = texH;
-						viewX = targetRectX + (targetRectWidth - viewWidth) * 0.5f;
-						viewY = targetRectY + (targetRectHeight - viewHeight) * 0.5f;
-					}
-				} else {
-					viewWidth = targetRectWidth;
-					viewHeight = targetRectHeight;
-					viewX = targetRectX;
-					viewY = targetRectY;
-				}
-				float viewLeft = viewX;
-				float viewRight = viewX + viewWidth;
-				float viewBottom = viewY;
-				float viewTop = viewY + viewHeight;
-
-				float compareFactor = 2.0f;
-				uint32_t compareW = (uint32_t)(viewWidth * compareFactor + 0.5f);
-				uint32_t compareH = (uint32_t)(viewHeight * compareFactor + 0.5f);
-
-				uint32_t mipmapCount = loadedPic->mipmapCount + 1;
-				uint32_t lastIndex = mipmapCount - 1;
-				ImageData* actualImageData = &loadedPic->imageData[lastIndex];
-				for (uint32_t mipmapIndex = lastIndex; mipmapIndex > 0; --mipmapIndex) {
-					ImageData *testImageData = &loadedPic->imageData[mipmapIndex];
-					if (compareW > testImageData->width&& compareH > testImageData->height) {
-						actualImageData = testImageData;
-						break;
-					}
-				}
-				
-				texW = (float)actualImageData->width;
-				texH = (float)actualImageData->height;
-
-				Mat4f modelMat;
-				BuildModelMat(viewLeft + viewWidth * 0.5f, viewBottom + viewHeight * 0.5f, viewWidth * 0.5f, viewHeight * 0.5f, &modelMat);
-
+				ComputePictureViewRect(state, (float)loadedPic->imageData[0].width, (float)loadedPic->imageData[0].height, targetRectX, targetRectY, targetRectWidth, targetRectHeight, &viewX, &viewY, &viewWidth, &viewHeight);
+				drawImage = GetDrawableMipmap(loadedPic, SelectMipmapLevel(loadedPic, viewWidth, viewHeight));
+			}
+			if (drawImage == fpl_null && fplAtomicLoadS32(&loadedPic->previewState) == LoadedPictureState_Ready) {
+				ComputePictureViewRect(state, (float)loadedPic->previewSourceWidth, (float)loadedPic->previewSourceHeight, targetRectX, targetRectY, targetRectWidth, targetRectHeight, &viewX, &viewY, &viewWidth, &viewHeight);
+				drawImage = &loadedPic->previewImage;
+			}
+			if (drawImage != fpl_null) {
 				Vec4f texColor = V4f(1, 1, 1, targetOpacity);
-				Vec2f texSize = V2f(texW, texH);
-				Vec2f texScale = state->features.rectangleTextures ? texSize : V2f(1.0f, 1.0f);
-
-				GLuint filterProgramId = state->filters[state->activeFilter].programId;
-				DrawTexturedRectangle(state, actualImageData->textureId, state->textureTarget, filterProgramId, &viewProjection, &modelMat, texColor, texSize, texScale);
-			} else if (pictureState == LoadedPictureState_LoadingData) {
+				DrawImageTiles(state, drawImage, &viewProjection, viewX, viewY, viewWidth, viewHeight, texColor);
+			}
+			if (pictureState == LoadedPictureState_LoadingData) {
 				float progressPadding = 4;
 				float progressAspect = 400.0f / 10.0f;
 				float progressW = targetRectWidth * 0.5f;
@@ -1738,8 +2479,12 @@ static void UpdateAndRender(ViewerState* state, const float deltaTime) {
 		}
 	}
 
-	if (state->params.preview && state->viewPicturesCapacity > 1 && state->pictureFileCount) {
-		int blockCount = (int)state->viewPicturesCapacity;
+	if (state->params.preview && state->prefetchCount > 0 && state->pictureFileCount && state->activeFileIndex > -1) {
+		// One block for each picture in the prefetch window, ordered by file index
+		int blockCount = state->prefetchCount + 1;
+		int aheadCount = (state->prefetchCount * 3) / 4;
+		int behindCount = state->prefetchCount - aheadCount;
+		int firstFileIndex = state->activeFileIndex - (state->browseDirection > 0 ? behindCount : aheadCount);
 		float maxBlockW = ((fplMin(screenW, screenH)) * 0.75f);
 		float blockPadding = 4;
 		float blockW = ((maxBlockW - ((float)(blockCount - 1) * blockPadding)) / (float)blockCount);
@@ -1748,15 +2493,19 @@ static void UpdateAndRender(ViewerState* state, const float deltaTime) {
 		float blocksBottom = (-screenH * 0.5f + blockPadding);
 		Vec2f blockExt = V2f(blockW * 0.5f, blockH * 0.5f);
 		for (int i = 0; i < blockCount; ++i) {
-			ViewPicture* loadedPic = &state->viewPictures[i];
+			int fileIndex = firstFileIndex + i;
+			ViewPicture* loadedPic = FindViewPicture(state, fileIndex);
 			float bx = blocksLeft + (float)i * blockW + ((float)i * blockPadding);
 			float by = blocksBottom;
 			Vec2f blockPos = V2f(bx + blockW * 0.5f, by + blockH * 0.5f);
 
-			LoadedPictureState loadState = fplAtomicLoadS32(&loadedPic->state);
+			LoadedPictureState loadState = loadedPic != fpl_null ? fplAtomicLoadS32(&loadedPic->state) : LoadedPictureState_Unloaded;
 			if (loadState != LoadedPictureState_Unloaded) {
 				Vec4f color = V4f(0, 0, 0, 0);
 				switch (loadState) {
+					case LoadedPictureState_Queued:
+						color = V4f(0.5f, 0.5f, 0.5f, 0.5f);
+						break;
 					case LoadedPictureState_LoadingData:
 						color = V4f(0, 0, 1, 0.5f);
 						break;
@@ -1777,16 +2526,15 @@ static void UpdateAndRender(ViewerState* state, const float deltaTime) {
 						break;
 				}
 
-				if (loadState == LoadedPictureState_Ready) {
-					ImageData imageData = loadedPic->imageData[0];
-					float texW = (float)imageData.width;
-					float texH = (float)imageData.height;
-					Vec2f texSize = V2f(texW, texH);
-					Vec2f texScale = state->features.rectangleTextures ? texSize : V2f(1.0f, 1.0f);
-					GLuint filterProgramId = state->filters[state->activeFilter].programId;
-					Mat4f blockModelMat;
-					BuildModelMat(blockPos.x, blockPos.y, blockExt.x, blockExt.y, &blockModelMat);
-					DrawTexturedRectangle(state, imageData.textureId, state->textureTarget, filterProgramId, &viewProjection, &blockModelMat, color, texSize, texScale);
+				// The preview or the smallest mipmap is much cheaper to sample than the full picture
+				const ImageData* blockImage = fpl_null;
+				if (fplAtomicLoadS32(&loadedPic->previewState) == LoadedPictureState_Ready) {
+					blockImage = &loadedPic->previewImage;
+				} else if (loadState == LoadedPictureState_Ready) {
+					blockImage = GetDrawableMipmap(loadedPic, loadedPic->mipmapCount);
+				}
+				if (blockImage != fpl_null) {
+					DrawImageTiles(state, blockImage, &viewProjection, bx, by, blockW, blockH, color);
 				} else {
 					Vec2f actualBlockStart = V2f(blockPos.x, blockPos.y);
 					Vec2f actualBlockExt = V2f(blockExt.x * loadedPic->progress, blockExt.y * loadedPic->progress);
@@ -1796,12 +2544,14 @@ static void UpdateAndRender(ViewerState* state, const float deltaTime) {
 
 			Vec4f blockColor;
 			float blockLineWidth;
-			if (i == state->viewPictureIndex) {
+			if (fileIndex == state->activeFileIndex) {
 				blockLineWidth = 2;
 				blockColor = V4f(0, 1, 0, 1);
+			} else if (fileIndex < 0 || fileIndex >= (int)state->pictureFileCount) {
+				continue;
 			} else {
 				blockLineWidth = 1;
-				if (loadedPic->state == LoadedPictureState_Unloaded) {
+				if (loadState == LoadedPictureState_Unloaded) {
 					blockColor = V4f(1, 1, 1, 0.2f);
 				} else {
 					blockColor = V4f(1, 1, 1, 0.5f);
@@ -1847,9 +2597,11 @@ int main(int argc, char** argv) {
 	flogWrite("Initial Parameters:");
 	flogWrite("Path: %s", state->params.path);
 	flogWrite("Preload count: %lu", state->params.preloadCount);
+	flogWrite("Memory budget: %lu MB", state->params.memoryBudgetMB);
 	flogWrite("Thread count: %lu", state->params.threadCount);
 	flogWrite("Preview enabled: %s", (state->params.preview ? "yes" : "no"));
 	flogWrite("Recursive enabled: %s", (state->params.recursive ? "yes" : "no"));
+	flogWrite("Thumbnail cache enabled: %s", (state->params.noThumbnailCache ? "no" : "yes"));
 
 	int returnCode = 0;
 	fplSettings settings;
@@ -1957,10 +2709,10 @@ int main(int argc, char** argv) {
 										}
 									} else if (ev.keyboard.mappedKey == fplKey_Home) {
 										int delta = 0 - (int)state->activeFileIndex;
-										ChangeViewPicture(state, delta, true);
+										ChangeViewPicture(state, delta, false);
 									} else if (ev.keyboard.mappedKey == fplKey_End) {
 										int delta = (int)state->pictureFileCount - state->activeFileIndex;
-										ChangeViewPicture(state, delta, true);
+										ChangeViewPicture(state, delta, false);
 									} else if (ev.keyboard.mappedKey == fplKey_F) {
 										fplSetWindowFullscreenSize(!fplIsWindowFullscreen(), 0, 0, 0);
 									} else if (ev.keyboard.mappedKey == fplKey_P) {
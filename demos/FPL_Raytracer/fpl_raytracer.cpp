@@ -12,6 +12,11 @@ Description:
 	The point of this demo, is to test multithreading and software video output.
 	Also there are defines, which can be toggled to enable/disable false sharing or compiler reordering issues.
 
+	Headless benchmark mode (no window):
+	fpl_raytracer -headless [sphere count] [-w=640] [-h=360] [-spp=32] [-passes=1] [-bounces=4] [-threads=N] [-seed=1337] [-out=raytracer.ppm] [-nobvh] [-nopackets] [-noscaling]
+	Renders with 1, 2, 4 ... N threads, prints rays/s, per-thread utilization and scaling efficiency and writes the image as PPM.
+	Each pass traces -spp new samples per pixel and is accumulated progressively, so the image has passes * spp samples per pixel.
+
 Todo:
 	- Better random
 	- Fix bad random bounce
@@ -20,7 +25,6 @@ Todo:
 	- Lights
 	- Box Shape
 	- Triangle Shape
-	- SIMD?
 
 Requirements:
 	- C++/11 Compiler
@@ -32,6 +36,19 @@ Author:
 	Torsten Spaete
 
 Changelog:
+	## 2026-10-18
+	- Added SAH bounding volume hierarchy for bounded objects (spheres), planes are tested separately
+	- Added random sphere scene generator (Keys 1-5 or first command line argument)
+	- Added B key to toggle the BVH on/off
+	- Print render time and rays per second after each completed frame
+	- Added SIMD packet tracing (4/8 samples per packet) with structure-of-arrays scene objects (P key to toggle)
+	- Random numbers are now seeded per pixel and sample, so images are reproducible and equal between scalar and packet tracing
+	- Replaced the shared tile list with per-worker tile deques and work stealing, tiles are queued in morton order
+	- Tiles are split into quadrants when workers run out of work at the end of a frame
+	- Workers keep their counters in padded per-worker stats and check for cancellation once per tile
+	- Added headless benchmark mode (-headless) with PPM output, image hash and thread scaling report
+	- Added progressive accumulation of render passes (-passes=N in headless mode)
+
 	## 2019-08-09
 	- Fixed false sharing issues for work queue
 
@@ -67,6 +84,7 @@ typedef uint32_t u32;
 typedef uint64_t u64;
 typedef int32_t s32;
 typedef float f32;
+typedef double f64;
 typedef int32_t b32;
 
 #define U8_MAX UCHAR_MAX
@@ -85,6 +103,8 @@ typedef int32_t b32;
 
 #include <vector>
 #include <new>
+#include <string.h>
+#include <ctype.h>
 
 struct Image32 {
 	Pixel *pixels;
@@ -122,6 +142,57 @@ struct Object {
 	u32 materialIndex;
 };
 
+// Flattened BVH node, two nodes fit into one cache line.
+// Inner nodes: firstIndex is the left child, the right child is always stored next to it
+// Leaf nodes: firstIndex is the first entry in BVH::objectIndices
+struct BVHNode {
+	Vec3f boundsMin;
+	u32 firstIndex;
+	Vec3f boundsMax;
+	u32 objectCount;
+};
+fplStaticAssert(sizeof(BVHNode) == 32);
+
+#define BVH_MAX_DEPTH 64
+#define BVH_BIN_COUNT 16
+#define BVH_MAX_LEAF_OBJECTS 4
+
+struct BVH {
+	std::vector<BVHNode> nodes;
+	std::vector<u32> objectIndices;
+	u32 leafCount;
+	u32 maxDepth;
+};
+
+// Structure-of-arrays copy of the objects for the packet tracer.
+// Spheres are stored in BVH leaf order, so every leaf references a contiguous range.
+struct SceneSoA {
+	std::vector<f32> sphereX;
+	std::vector<f32> sphereY;
+	std::vector<f32> sphereZ;
+	std::vector<f32> sphereRadius;
+	std::vector<u32> sphereObjectIndices;
+
+	std::vector<f32> planeNormalX;
+	std::vector<f32> planeNormalY;
+	std::vector<f32> planeNormalZ;
+	std::vector<f32> planeDistance;
+	std::vector<u32> planeObjectIndices;
+
+	void Clear() {
+		sphereX.clear();
+		sphereY.clear();
+		sphereZ.clear();
+		sphereRadius.clear();
+		sphereObjectIndices.clear();
+		planeNormalX.clear();
+		planeNormalY.clear();
+		planeNormalZ.clear();
+		planeDistance.clear();
+		planeObjectIndices.clear();
+	}
+};
+
 struct Camera {
 	Vec3f eye;
 	Vec3f target;
@@ -137,6 +208,21 @@ struct Scene {
 	std::vector<Object> objects;
 	std::vector<Material> materials;
 
+	// Bounded objects are stored in the BVH, unbounded objects (planes) are always tested
+	BVH bvh;
+	std::vector<u32> unboundedObjectIndices;
+
+	SceneSoA soa;
+
+	void Clear() {
+		objects.clear();
+		materials.clear();
+		bvh.nodes.clear();
+		bvh.objectIndices.clear();
+		unboundedObjectIndices.clear();
+		soa.Clear();
+	}
+
 	u32 AddMaterial(const Vec3f &emitColor, const Vec3f &reflectColor, const float scatter = 0.0f) {
 		fplAssert(materials.size() < (U32_MAX - 1));
 		u32 result = (u32)materials.size();
@@ -170,15 +256,21 @@ struct Scene {
 };
 
 struct RaytracerSettings {
+	u64 seed;
 	u32 maxBounceCount;
 	u32 raysPerPixelCount;
+	b32 useBVH;
+	b32 usePackets;
 };
 
 struct Raytracer {
 	Image32 image;
+	// Sum of the linear pass colors per pixel, for progressive rendering
+	Vec3f *accumulation;
 	RaytracerSettings settings;
-	RandomSeries rnd;
 	Vec2f halfPixelSize;
+	// Index of the pass being rendered, pass zero overwrites the accumulation
+	u32 passIndex;
 };
 
 struct App {
@@ -408,6 +500,9 @@ struct TilingInfo {
 	u32 imageH;
 };
 
+// Tiles are only split into quadrants, when both sides are at least twice this size
+#define TILE_MIN_SPLIT_SIZE 16
+
 enum class WorkerState : s32 {
 	Stopped = 0,
 	Running,
@@ -432,94 +527,184 @@ struct WorkOrder {
 fplStaticAssert(sizeof(WorkOrder) % 64 == 0);
 #endif
 
-struct WorkQueue {
+// Ring of work orders owned by one worker.
+// The owner pushes and pops at the tail, other workers steal from the head.
+struct TileDeque {
 	// @NOTE(final): Memory must be be aligned by 64-bit, otherwise we get false sharing issues.
 	WorkOrder *orders;
 	u32 capacity;
-	u32 workOrderCount;
+	u32 head;
+	u32 tail;
+	fplMutexHandle lock;
+#if QUEUE_ADD_CACHELINE_PADDING_TO_VOLATILES == 1
+	u8 cacheline_padding1[64];
+#endif
+};
+
+struct WorkQueue {
+	TileDeque *deques;
+	u32 dequeCount;
+	u32 tileCount;
 
 #if QUEUE_ADD_CACHELINE_PADDING_TO_VOLATILES == 1
 	u8 cacheline_padding1[64];
 #endif
 
-	volatile u32 nextWorkOrderIndex;
+	volatile u32 totalPixelCount;
+	volatile u32 queuedTileCount;
 #if QUEUE_ADD_CACHELINE_PADDING_TO_VOLATILES == 1
 	u8 cacheline_padding2[64];
 #endif
 
-	volatile u32 completionCount;
+	volatile u32 completedPixelCount;
 #if QUEUE_ADD_CACHELINE_PADDING_TO_VOLATILES == 1
 	u8 cacheline_padding3[64];
 #endif
 
 	bool IsEmpty() {
-		bool result = workOrderCount == 0;
+		bool result = fplAtomicLoadU32(&totalPixelCount) == 0;
 		return(result);
 	}
 
 	bool IsFinished() {
 		bool result = false;
-		if (workOrderCount > 0)
-			result = fplAtomicLoadU32(&completionCount) == workOrderCount;
+		u32 pixelCount = fplAtomicLoadU32(&totalPixelCount);
+		if (pixelCount > 0)
+			result = fplAtomicLoadU32(&completedPixelCount) == pixelCount;
+		return(result);
+	}
+
+	bool HasQueuedTiles() {
+		bool result = fplAtomicLoadU32(&queuedTileCount) > 0;
+		return(result);
+	}
+
+	// Split tiles as long as there are fewer queued tiles than workers, so no worker sits idle at the end of a frame
+	bool IsStarving() {
+		bool result = dequeCount > 1 && fplAtomicLoadU32(&queuedTileCount) < dequeCount;
 		return(result);
 	}
 
-	void Init(const u32 capacity) {
+	void Init(const u32 dequeCount, const u32 capacityPerDeque) {
 #if QUEUE_ALIGN_WORK_ORDERS_BY_CACHELINE == 1
-		orders = (WorkOrder *)fplMemoryAlignedAllocate(capacity * sizeof(*orders), 64);
+		deques = (TileDeque *)fplMemoryAlignedAllocate(dequeCount * sizeof(*deques), 64);
 #else
-		orders = (WorkOrder *)fplMemoryAllocate(capacity * sizeof(*orders));
+		deques = (TileDeque *)fplMemoryAllocate(dequeCount * sizeof(*deques));
 #endif
-		this->capacity = capacity;
-		workOrderCount = 0;
-		fplAtomicExchangeU32(&nextWorkOrderIndex, 0);
-		fplAtomicExchangeU32(&completionCount, 0);
+		this->dequeCount = dequeCount;
+		for (u32 dequeIndex = 0; dequeIndex < dequeCount; ++dequeIndex) {
+			TileDeque *deque = deques + dequeIndex;
+			fplClearStruct(deque);
+#if QUEUE_ALIGN_WORK_ORDERS_BY_CACHELINE == 1
+			deque->orders = (WorkOrder *)fplMemoryAlignedAllocate(capacityPerDeque * sizeof(*deque->orders), 64);
+#else
+			deque->orders = (WorkOrder *)fplMemoryAllocate(capacityPerDeque * sizeof(*deque->orders));
+#endif
+			deque->capacity = capacityPerDeque;
+			fplMutexInit(&deque->lock);
+		}
+		tileCount = 0;
+		fplAtomicExchangeU32(&totalPixelCount, 0);
+		fplAtomicExchangeU32(&queuedTileCount, 0);
+		fplAtomicExchangeU32(&completedPixelCount, 0);
 	}
 
 	void Release() {
+		for (u32 dequeIndex = 0; dequeIndex < dequeCount; ++dequeIndex) {
+			TileDeque *deque = deques + dequeIndex;
+			fplMutexDestroy(&deque->lock);
+#if QUEUE_ALIGN_WORK_ORDERS_BY_CACHELINE == 1
+			fplMemoryAlignedFree(deque->orders);
+#else
+			fplMemoryFree(deque->orders);
+#endif
+		}
 #if QUEUE_ALIGN_WORK_ORDERS_BY_CACHELINE == 1
-		fplMemoryAlignedFree(orders);
+		fplMemoryAlignedFree(deques);
 #else
-		fplMemoryFree(orders);
+		fplMemoryFree(deques);
 #endif
 	}
 
 	void Reset() {
-		workOrderCount = 0;
-		fplAtomicExchangeU32(&nextWorkOrderIndex, 0);
-		fplAtomicExchangeU32(&completionCount, 0);
-	}
-
-	void Push(Raytracer *rayTracer, const Scene *scene, const u32 xMin, const u32 yMin, const u32 xMaxPlusOne, const u32 yMaxPlusOne) {
-		const fplThreadHandle *mainThread = fplGetMainThread();
-		u32 threadId = fplGetCurrentThreadId();
-		fplAssert(threadId == mainThread->id);
-		fplAssert(workOrderCount < capacity);
-		u32 index = workOrderCount++;
-		WorkOrder *order = orders + index;
-		*order = {};
-		order->raytracer = rayTracer;
-		order->scene = scene;
-		order->xMin = xMin;
-		order->yMin = yMin;
-		order->xMaxPlusOne = xMaxPlusOne;
-		order->yMaxPlusOne = yMaxPlusOne;
-	}
-
-	bool Pop(u32 &outIndex) {
-		if (IsEmpty() || fplAtomicLoadU32(&nextWorkOrderIndex) >= workOrderCount) {
+		for (u32 dequeIndex = 0; dequeIndex < dequeCount; ++dequeIndex) {
+			TileDeque *deque = deques + dequeIndex;
+			fplAssert(deque->head == deque->tail);
+			deque->head = deque->tail = 0;
+		}
+		tileCount = 0;
+		fplAtomicExchangeU32(&totalPixelCount, 0);
+		fplAtomicExchangeU32(&queuedTileCount, 0);
+		fplAtomicExchangeU32(&completedPixelCount, 0);
+	}
+
+	// Pushes all or none of the given orders to the tail of the deque
+	bool Push(const u32 dequeIndex, const WorkOrder *newOrders, const u32 count) {
+		fplAssert(dequeIndex < dequeCount);
+		TileDeque *deque = deques + dequeIndex;
+		bool result = false;
+		fplMutexLock(&deque->lock);
+		if ((deque->tail - deque->head) + count <= deque->capacity) {
+			for (u32 i = 0; i < count; ++i) {
+				deque->orders[deque->tail % deque->capacity] = newOrders[i];
+				++deque->tail;
+			}
+			result = true;
+		}
+		fplMutexUnlock(&deque->lock);
+		if (result) {
+			fplAtomicFetchAndAddU32(&queuedTileCount, count);
+		}
+		return(result);
+	}
+
+	// Pops from the tail of the own deque first, then steals from the head of the other deques
+	bool Pop(const u32 dequeIndex, WorkOrder &outOrder, bool &outStolen) {
+		if (fplAtomicLoadU32(&queuedTileCount) == 0) {
 			return(false);
 		}
-		u32 index = fplAtomicFetchAndAddU32(&nextWorkOrderIndex, 1);
-		fplAssert(index < workOrderCount);
-		outIndex = index;
-		return(true);
+		for (u32 i = 0; i < dequeCount; ++i) {
+			u32 victimIndex = (dequeIndex + i) % dequeCount;
+			TileDeque *deque = deques + victimIndex;
+			bool found = false;
+			fplMutexLock(&deque->lock);
+			if (deque->head != deque->tail) {
+				if (victimIndex == dequeIndex) {
+					--deque->tail;
+					outOrder = deque->orders[deque->tail % deque->capacity];
+				} else {
+					outOrder = deque->orders[deque->head % deque->capacity];
+					++deque->head;
+				}
+				found = true;
+			}
+			fplMutexUnlock(&deque->lock);
+			if (found) {
+				fplAtomicFetchAndAddU32(&queuedTileCount, (u32)-1);
+				outStolen = victimIndex != dequeIndex;
+				return(true);
+			}
+		}
+		return(false);
 	}
 };
 
+// Counters written only by the owning worker, summed up by the main thread after a frame is finished
+struct WorkerStats {
+	u64 rayCount;
+	f64 busyTime;
+	u32 tileCount;
+	u32 stolenTileCount;
+	u32 splitTileCount;
+};
+
 struct Worker {
 	WorkQueue *queue;
 	fplThreadHandle *thread;
+	// All workers, to wake up the idle ones when tiles are split
+	Worker *workers;
+	u32 workerCount;
+	u32 index;
 
 #if QUEUE_ADD_CACHELINE_PADDING_TO_VOLATILES == 1
 	u8 cacheline_padding1[64];
@@ -529,6 +714,11 @@ struct Worker {
 	u8 cacheline_padding2[64];
 #endif
 
+	WorkerStats stats;
+#if QUEUE_ADD_CACHELINE_PADDING_TO_VOLATILES == 1
+	u8 cacheline_padding3[64];
+#endif
+
 	fplMutexHandle lockMutex;
 	fplConditionVariable nonEmptyCondition;
 
@@ -584,167 +774,914 @@ static bool RaySphereIntersection(const Ray3f &ray, const Sphere3f &sphere, f32
 	return(false);
 }
 
-// @NOTE(final): "Order" must be volatile, otherwise the compile may reorder instructions here
-#if FIX_WRONG_INSTRUCTION_REORDER_IN_RELEASE
-static bool RaytracePart(Worker &worker, volatile WorkOrder &order) {
-#else
-static bool RaytracePart(Worker &worker, WorkOrder &order) {
-#endif
-	const Scene *scene = order.scene;
-	Raytracer *raytracer = order.raytracer;
-	fplAssert(scene != fpl_null);
-	fplAssert(raytracer != fpl_null);
+//
+// Bounding volume hierarchy (Binned SAH)
+//
+struct BVHBuildItem {
+	Vec3f boundsMin;
+	Vec3f boundsMax;
+	Vec3f centroid;
+	u32 objectIndex;
+};
 
-	Image32 &image = raytracer->image;
+struct BVHBin {
+	Vec3f boundsMin;
+	Vec3f boundsMax;
+	u32 count;
+};
 
-	const f32 fov = scene->camera.fov;
-	const f32 halfTan = Tan(fov * 0.5f);
-	const f32 aspectRatio = (f32)image.width / (float)image.height;
-	const Vec3f cameraPosition = scene->camera.eye;
-	const Vec3f cameraUp = scene->camera.up;
-	const Vec3f cameraTarget = scene->camera.target;
+static f32 GetBoundsArea(const Vec3f &boundsMin, const Vec3f &boundsMax) {
+	Vec3f e = boundsMax - boundsMin;
+	f32 result = 2.0f * (e.x * e.y + e.y * e.z + e.z * e.x);
+	return(result);
+}
 
-	// Construct camera axis
-	const Vec3f cameraZ = V3fNormalize(cameraPosition - cameraTarget);
-	const Vec3f cameraX = V3fNormalize(V3fCross(cameraUp, cameraZ));
-	const Vec3f cameraY = V3fNormalize(V3fCross(cameraZ, cameraX));
+static u32 GetBVHBinIndex(const f32 centroid, const f32 centroidMin, const f32 binScale) {
+	s32 binIndex = (s32)((centroid - centroidMin) * binScale);
+	u32 result = (u32)fplMax(0, fplMin(binIndex, BVH_BIN_COUNT - 1));
+	return(result);
+}
+
+static void SubdivideBVHNode(BVH &bvh, BVHBuildItem *items, const u32 nodeIndex, const u32 first, const u32 count, const u32 depth) {
+	bvh.maxDepth = fplMax(bvh.maxDepth, depth);
+
+	Vec3f boundsMin = V3fInitScalar(F32_MAX);
+	Vec3f boundsMax = V3fInitScalar(-F32_MAX);
+	Vec3f centroidMin = V3fInitScalar(F32_MAX);
+	Vec3f centroidMax = V3fInitScalar(-F32_MAX);
+	for (u32 i = first; i < first + count; ++i) {
+		boundsMin = V3fMin(boundsMin, items[i].boundsMin);
+		boundsMax = V3fMax(boundsMax, items[i].boundsMax);
+		centroidMin = V3fMin(centroidMin, items[i].centroid);
+		centroidMax = V3fMax(centroidMax, items[i].centroid);
+	}
+
+	BVHNode *node = &bvh.nodes[nodeIndex];
+	node->boundsMin = boundsMin;
+	node->boundsMax = boundsMax;
+	node->firstIndex = first;
+	node->objectCount = count;
+
+	if (count <= 1 || depth >= BVH_MAX_DEPTH - 1) {
+		++bvh.leafCount;
+		return;
+	}
+
+	// Find the cheapest split plane across all axis, by binning the centroids
+	f32 bestCost = F32_MAX;
+	s32 bestAxis = -1;
+	u32 bestSplit = 0;
+	for (s32 axis = 0; axis < 3; ++axis) {
+		f32 extent = centroidMax.m[axis] - centroidMin.m[axis];
+		if (extent <= 0.0f) {
+			continue;
+		}
+		f32 binScale = (f32)BVH_BIN_COUNT / extent;
+
+		BVHBin bins[BVH_BIN_COUNT];
+		for (u32 binIndex = 0; binIndex < BVH_BIN_COUNT; ++binIndex) {
+			bins[binIndex].boundsMin = V3fInitScalar(F32_MAX);
+			bins[binIndex].boundsMax = V3fInitScalar(-F32_MAX);
+			bins[binIndex].count = 0;
+		}
+		for (u32 i = first; i < first + count; ++i) {
+			BVHBin &bin = bins[GetBVHBinIndex(items[i].centroid.m[axis], centroidMin.m[axis], binScale)];
+			bin.boundsMin = V3fMin(bin.boundsMin, items[i].boundsMin);
+			bin.boundsMax = V3fMax(bin.boundsMax, items[i].boundsMax);
+			++bin.count;
+		}
+
+		// Sweep from left and right to get the area and count for each split plane
+		f32 leftArea[BVH_BIN_COUNT - 1];
+		u32 leftCount[BVH_BIN_COUNT - 1];
+		Vec3f sweepMin = V3fInitScalar(F32_MAX);
+		Vec3f sweepMax = V3fInitScalar(-F32_MAX);
+		u32 sweepCount = 0;
+		for (u32 split = 0; split < BVH_BIN_COUNT - 1; ++split) {
+			if (bins[split].count > 0) {
+				sweepMin = V3fMin(sweepMin, bins[split].boundsMin);
+				sweepMax = V3fMax(sweepMax, bins[split].boundsMax);
+				sweepCount += bins[split].count;
+			}
+			leftCount[split] = sweepCount;
+			leftArea[split] = sweepCount > 0 ? GetBoundsArea(sweepMin, sweepMax) : 0.0f;
+		}
+		sweepMin = V3fInitScalar(F32_MAX);
+		sweepMax = V3fInitScalar(-F32_MAX);
+		sweepCount = 0;
+		for (u32 split = BVH_BIN_COUNT - 1; split > 0; --split) {
+			if (bins[split].count > 0) {
+				sweepMin = V3fMin(sweepMin, bins[split].boundsMin);
+				sweepMax = V3fMax(sweepMax, bins[split].boundsMax);
+				sweepCount += bins[split].count;
+			}
+			u32 splitIndex = split - 1;
+			if (sweepCount == 0 || leftCount[splitIndex] == 0) {
+				continue;
+			}
+			f32 cost = leftArea[splitIndex] * (f32)leftCount[splitIndex] + GetBoundsArea(sweepMin, sweepMax) * (f32)sweepCount;
+			if (cost < bestCost) {
+				bestCost = cost;
+				bestAxis = axis;
+				bestSplit = splitIndex;
+			}
+		}
+	}
+
+	// SAH: Traversal cost of one plus the intersection cost weighted by the child areas, versus intersecting all objects
+	f32 nodeArea = GetBoundsArea(boundsMin, boundsMax);
+	f32 splitCost = 1.0f + (nodeArea > 0.0f ? bestCost / nodeArea : F32_MAX);
+	f32 leafCost = (f32)count;
+	if (bestAxis == -1 || (count <= BVH_MAX_LEAF_OBJECTS && splitCost >= leafCost)) {
+		++bvh.leafCount;
+		return;
+	}
+
+	// Partition in place
+	f32 binScale = (f32)BVH_BIN_COUNT / (centroidMax.m[bestAxis] - centroidMin.m[bestAxis]);
+	u32 left = first;
+	u32 right = first + count;
+	while (left < right) {
+		if (GetBVHBinIndex(items[left].centroid.m[bestAxis], centroidMin.m[bestAxis], binScale) <= bestSplit) {
+			++left;
+		} else {
+			--right;
+			BVHBuildItem temp = items[left];
+			items[left] = items[right];
+			items[right] = temp;
+		}
+	}
+	u32 leftCount = left - first;
+	fplAssert(leftCount > 0 && leftCount < count);
+
+	// Both children are allocated next to each other, so we only need to store the left index
+	u32 leftChildIndex = (u32)bvh.nodes.size();
+	bvh.nodes.push_back({});
+	bvh.nodes.push_back({});
+	node = &bvh.nodes[nodeIndex];
+	node->firstIndex = leftChildIndex;
+	node->objectCount = 0;
+
+	SubdivideBVHNode(bvh, items, leftChildIndex + 0, first, leftCount, depth + 1);
+	SubdivideBVHNode(bvh, items, leftChildIndex + 1, left, count - leftCount, depth + 1);
+}
+
+static void BuildSceneSoA(Scene &scene) {
+	SceneSoA &soa = scene.soa;
+	soa.Clear();
+	for (u32 objectIndex : scene.bvh.objectIndices) {
+		const Object &obj = scene.objects[objectIndex];
+		soa.sphereX.push_back(obj.sphere.origin.x);
+		soa.sphereY.push_back(obj.sphere.origin.y);
+		soa.sphereZ.push_back(obj.sphere.origin.z);
+		soa.sphereRadius.push_back(obj.sphere.radius);
+		soa.sphereObjectIndices.push_back(objectIndex);
+	}
+	for (u32 objectIndex : scene.unboundedObjectIndices) {
+		const Object &obj = scene.objects[objectIndex];
+		soa.planeNormalX.push_back(obj.plane.normal.x);
+		soa.planeNormalY.push_back(obj.plane.normal.y);
+		soa.planeNormalZ.push_back(obj.plane.normal.z);
+		soa.planeDistance.push_back(obj.plane.distance);
+		soa.planeObjectIndices.push_back(objectIndex);
+	}
+}
+
+// Builds the BVH and the structure-of-arrays objects
+static void BuildBVH(Scene &scene) {
+	BVH &bvh = scene.bvh;
+	bvh.nodes.clear();
+	bvh.objectIndices.clear();
+	bvh.leafCount = 0;
+	bvh.maxDepth = 0;
+	scene.unboundedObjectIndices.clear();
+
+	std::vector<BVHBuildItem> items;
+	items.reserve(scene.objects.size());
+	for (u32 objectIndex = 0, objectCount = (u32)scene.objects.size(); objectIndex < objectCount; ++objectIndex) {
+		const Object &obj = scene.objects[objectIndex];
+		if (obj.kind == ObjectKind::Sphere) {
+			BVHBuildItem item;
+			// Slightly enlarged bounds, so rounding in the box test never culls a tangent hit
+			Vec3f radius = V3fInitScalar(obj.sphere.radius * 1.001f + 1e-5f);
+			item.boundsMin = obj.sphere.origin - radius;
+			item.boundsMax = obj.sphere.origin + radius;
+			item.centroid = obj.sphere.origin;
+			item.objectIndex = objectIndex;
+			items.push_back(item);
+		} else {
+			scene.unboundedObjectIndices.push_back(objectIndex);
+		}
+	}
+
+	if (items.size() == 0) {
+		BuildSceneSoA(scene);
+		return;
+	}
+
+	// A binary tree with N leafs has at most 2N-1 nodes
+	bvh.nodes.reserve(items.size() * 2);
+	bvh.nodes.push_back({});
+	SubdivideBVHNode(bvh, &items[0], 0, 0, (u32)items.size(), 0);
+
+	bvh.objectIndices.resize(items.size());
+	for (size_t i = 0; i < items.size(); ++i) {
+		bvh.objectIndices[i] = items[i].objectIndex;
+	}
+
+	BuildSceneSoA(scene);
+}
+
+//
+// Scene intersection
+//
+struct SceneHit {
+	const Object *object;
+	f32 distance;
+};
+
+static void IntersectObject(const Object &obj, const Ray3f &ray, const f32 minHitDistance, const f32 tolerance, SceneHit &hit) {
+	f32 t = -F32_MAX;
+	bool isHit = false;
+	if (obj.kind == ObjectKind::Plane) {
+		isHit = RayPlaneIntersection(ray, obj.plane, t, tolerance);
+	} else if (obj.kind == ObjectKind::Sphere) {
+		isHit = RaySphereIntersection(ray, obj.sphere, t, tolerance);
+	}
+	if (isHit && (t > minHitDistance) && (t < hit.distance)) {
+		hit.distance = t;
+		hit.object = &obj;
+	}
+}
+
+// Returns the entry distance of the ray into the box or F32_MAX when missed or farther away than maxDistance
+static f32 RayBoxEntryDistance(const Vec3f &origin, const Vec3f &invDirection, const Vec3f &boundsMin, const Vec3f &boundsMax, const f32 minDistance, const f32 maxDistance) {
+	f32 tx1 = (boundsMin.x - origin.x) * invDirection.x;
+	f32 tx2 = (boundsMax.x - origin.x) * invDirection.x;
+	f32 tMin = Min(tx1, tx2);
+	f32 tMax = Max(tx1, tx2);
+	f32 ty1 = (boundsMin.y - origin.y) * invDirection.y;
+	f32 ty2 = (boundsMax.y - origin.y) * invDirection.y;
+	tMin = Max(tMin, Min(ty1, ty2));
+	tMax = Min(tMax, Max(ty1, ty2));
+	f32 tz1 = (boundsMin.z - origin.z) * invDirection.z;
+	f32 tz2 = (boundsMax.z - origin.z) * invDirection.z;
+	tMin = Max(tMin, Min(tz1, tz2));
+	tMax = Min(tMax, Max(tz1, tz2));
+	if (tMax >= tMin && tMax > minDistance && tMin < maxDistance) {
+		return(tMin);
+	}
+	return(F32_MAX);
+}
+
+static void IntersectBVH(const Scene &scene, const Ray3f &ray, const f32 minHitDistance, const f32 tolerance, SceneHit &hit) {
+	const BVH &bvh = scene.bvh;
+	if (bvh.nodes.size() == 0) {
+		return;
+	}
+	const BVHNode *nodes = &bvh.nodes[0];
+	const u32 *objectIndices = &bvh.objectIndices[0];
+	const Object *objects = &scene.objects[0];
 
-	const Vec2f halfPixelSize = raytracer->halfPixelSize;
+	Vec3f invDirection = V3fInit(1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z);
+
+	if (RayBoxEntryDistance(ray.origin, invDirection, nodes[0].boundsMin, nodes[0].boundsMax, minHitDistance, hit.distance) == F32_MAX) {
+		return;
+	}
+
+	u32 stack[BVH_MAX_DEPTH];
+	u32 stackCount = 0;
+	u32 nodeIndex = 0;
+	while (true) {
+		const BVHNode &node = nodes[nodeIndex];
+		if (node.objectCount > 0) {
+			for (u32 i = 0; i < node.objectCount; ++i) {
+				IntersectObject(objects[objectIndices[node.firstIndex + i]], ray, minHitDistance, tolerance, hit);
+			}
+		} else {
+			// Visit the nearest child first and push the other one
+			u32 nearIndex = node.firstIndex;
+			u32 farIndex = node.firstIndex + 1;
+			f32 nearDistance = RayBoxEntryDistance(ray.origin, invDirection, nodes[nearIndex].boundsMin, nodes[nearIndex].boundsMax, minHitDistance, hit.distance);
+			f32 farDistance = RayBoxEntryDistance(ray.origin, invDirection, nodes[farIndex].boundsMin, nodes[farIndex].boundsMax, minHitDistance, hit.distance);
+			if (farDistance < nearDistance) {
+				u32 tempIndex = nearIndex;
+				nearIndex = farIndex;
+				farIndex = tempIndex;
+				f32 tempDistance = nearDistance;
+				nearDistance = farDistance;
+				farDistance = tempDistance;
+			}
+			if (nearDistance != F32_MAX) {
+				if (farDistance != F32_MAX) {
+					fplAssert(stackCount < fplArrayCount(stack));
+					stack[stackCount++] = farIndex;
+				}
+				nodeIndex = nearIndex;
+				continue;
+			}
+		}
+		if (stackCount == 0) {
+			break;
+		}
+		nodeIndex = stack[--stackCount];
+	}
+}
+
+static SceneHit IntersectScene(const Scene &scene, const Ray3f &ray, const f32 minHitDistance, const f32 tolerance, const bool useBVH) {
+	SceneHit result = {};
+	result.distance = F32_MAX;
+	if (useBVH) {
+		for (u32 objectIndex : scene.unboundedObjectIndices) {
+			IntersectObject(scene.objects[objectIndex], ray, minHitDistance, tolerance, result);
+		}
+		IntersectBVH(scene, ray, minHitDistance, tolerance, result);
+	} else {
+		for (const Object &obj : scene.objects) {
+			IntersectObject(obj, ray, minHitDistance, tolerance, result);
+		}
+	}
+	return(result);
+}
+
+//
+// Per sample random numbers
+//
+
+// Each sample has its own xorshift32 state, seeded by the pixel and the sample index.
+// So every sample gets the same random numbers, regardless of the thread or the tracing path.
+static u32 SeedSampleRandom(const u64 seed, const u32 pixelIndex, const u32 sampleIndex) {
+	u64 z = seed + ((((u64)pixelIndex << 32) | sampleIndex) * 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	z = z ^ (z >> 31);
+	u32 result = (u32)(z ^ (z >> 32));
+	return(result != 0 ? result : 1);
+}
+
+// -1.0 to +1.0
+static f32 SampleRandomBilateral(u32 &state) {
+	u32 x = state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	state = x;
+	f32 result = -1.0f + (f32)(x >> 8) * (2.0f / 16777216.0f);
+	return(result);
+}
+
+//
+// Scalar tracing
+//
+#define RAY_HIT_TOLERANCE 1e-6f
+
+struct PrimaryRaySetup {
+	Vec3f cameraPosition;
+	Vec3f cameraX;
+	Vec3f cameraY;
+	Vec3f filmCenter;
+	Vec2f halfPixelSize;
+	f32 halfTan;
+	f32 aspectRatio;
+};
+
+static PrimaryRaySetup MakePrimaryRaySetup(const Camera &camera, const Image32 &image, const Vec2f &halfPixelSize) {
+	PrimaryRaySetup result = {};
+
+	const f32 fov = camera.fov;
+	result.halfTan = Tan(fov * 0.5f);
+	result.aspectRatio = (f32)image.width / (float)image.height;
+	result.cameraPosition = camera.eye;
+	result.halfPixelSize = halfPixelSize;
+
+	// Construct camera axis
+	const Vec3f cameraZ = V3fNormalize(camera.eye - camera.target);
+	result.cameraX = V3fNormalize(V3fCross(camera.up, cameraZ));
+	result.cameraY = V3fNormalize(V3fCross(cameraZ, result.cameraX));
 
 	f32 filmDistance = 1.0f;
-	Vec3f filmCenter = cameraPosition - filmDistance * cameraZ;
+	result.filmCenter = camera.eye - filmDistance * cameraZ;
 
-	u32 raysPerPixel = raytracer->settings.raysPerPixelCount;
-	u32 maxBounceCount = raytracer->settings.maxBounceCount;
+	return(result);
+}
 
-	f32 contrib = 1.0f / (f32)raysPerPixel;
+static Ray3f MakePrimaryRay(const PrimaryRaySetup &setup, const f32 filmX, const f32 filmY, u32 &rnd) {
+	f32 offsetX = SampleRandomBilateral(rnd) * setup.halfPixelSize.w;
+	f32 offsetY = SampleRandomBilateral(rnd) * setup.halfPixelSize.h;
 
-	fplAssert(scene->materials.size() > 0);
-	const Material &defaultMaterial = scene->materials[0];
+	f32 perspectiveX = (filmX + offsetX) * setup.halfTan * setup.aspectRatio;
+	f32 perspectiveY = (filmY + offsetY) * setup.halfTan;
 
-	for (u32 y = order.yMin; y < order.yMaxPlusOne; ++y) {
-		u32 inverseY = (image.height - 1 - y);
+	Vec3f filmP = setup.filmCenter + (perspectiveX * setup.cameraX) + (perspectiveY * setup.cameraY);
 
-		Pixel *row = &image.pixels[inverseY * image.width];
+	Vec3f rayOrigin = setup.cameraPosition;
+	Vec3f rayDirection = V3fNormalize(filmP - setup.cameraPosition);
 
-		f32 ratioY = (f32)y / (f32)image.height;
-		f32 filmY = -1.0f + 2.0f * ratioY;
+	Ray3f result = MakeRay(rayOrigin, rayDirection);
+	return(result);
+}
 
-		Pixel *col = row + order.xMin;
-		for (u32 x = order.xMin; x < order.xMaxPlusOne; ++x) {
-			if (worker.IsStopped())
-				return(false);
+static Vec3f TraceSample(const Scene &scene, Ray3f ray, const u32 maxBounceCount, const bool useBVH, u32 &rnd, u64 &rayCount) {
+	const f32 tolerance = RAY_HIT_TOLERANCE;
+	const f32 minHitDistance = 0.0f;
 
-			f32 ratioX = (f32)x / (f32)image.width;
-			f32 filmX = -1.0f + 2.0f * ratioX;
+	const Material &defaultMaterial = scene.materials[0];
 
-			Vec3f finalColor = {};
+	Vec3f sample = {};
+	Vec3f attenuation = V3fInit(1, 1, 1);
 
-			for (u32 rayIndex = 0; rayIndex < raysPerPixel; ++rayIndex) {
-				if (worker.IsStopped())
-					return(false);
+	for (u32 bounceIndex = 0; bounceIndex < maxBounceCount; ++bounceIndex) {
+		++rayCount;
 
-				f32 offsetX = RandomBilateral(&raytracer->rnd) * halfPixelSize.w;
-				f32 offsetY = RandomBilateral(&raytracer->rnd) * halfPixelSize.h;
+		SceneHit hit = IntersectScene(scene, ray, minHitDistance, tolerance, useBVH);
 
-				f32 perspectiveX = (filmX + offsetX) * halfTan * aspectRatio;
-				f32 perspectiveY = (filmY + offsetY) * halfTan;
+		f32 hitDistance = hit.distance;
+		u32 hitMaterialIndex = 0;
+		Vec3f hitNormal = V3fZero();
+		if (hit.object != fpl_null) {
+			const Object *obj = hit.object;
+			hitMaterialIndex = obj->materialIndex;
+			if (obj->kind == ObjectKind::Plane) {
+				hitNormal = obj->plane.normal;
+			} else {
+				Vec3f relativeOrigin = ray.origin - obj->sphere.origin;
+				hitNormal = V3fNormalize(hitDistance * ray.direction + relativeOrigin);
+			}
+		}
 
-				Vec3f filmP = filmCenter + (perspectiveX * cameraX) + (perspectiveY * cameraY);
+		if (hitMaterialIndex) {
+			fplAssert(hitMaterialIndex < scene.materials.size());
+			const Material &hitMaterial = scene.materials[hitMaterialIndex];
 
-				Vec3f rayOrigin = cameraPosition;
-				Vec3f rayDirection = V3fNormalize(filmP - cameraPosition);
+			sample += V3fHadamard(attenuation, hitMaterial.emitColor);
 
-				Ray3f ray = MakeRay(rayOrigin, rayDirection);
+			f32 cosineAttenuation = V3fDot(-ray.direction, hitNormal);
+			if (cosineAttenuation < 0) {
+				cosineAttenuation = 0;
+			}
+			attenuation = V3fHadamard(attenuation, cosineAttenuation * hitMaterial.reflectColor);
 
-				const f32 tolerance = 1e-6f;
-				f32 minHitDistance = 0.0f;
+			Vec3f pureBounce = ray.direction - 2.0f * V3fDot(ray.direction, hitNormal) * hitNormal;
 
-				Vec3f sample = {};
-				Vec3f attenuation = V3fInit(1, 1, 1);
+			// @NOTE(final): This is NOT a proper way to produce a random bounce. Do proper distribution based bounce
+			f32 randomX = SampleRandomBilateral(rnd);
+			f32 randomY = SampleRandomBilateral(rnd);
+			f32 randomZ = SampleRandomBilateral(rnd);
+			Vec3f randomBounce = V3fNormalize(hitNormal + V3fInit(randomX, randomY, randomZ));
 
-				for (u32 bounceIndex = 0; bounceIndex < maxBounceCount; ++bounceIndex) {
-					if (worker.IsStopped())
-						return(false);
+			// Ray for next bounce
+			ray.origin += hitDistance * ray.direction;
+			ray.direction = V3fNormalize(V3fLerp(randomBounce, hitMaterial.scatter, pureBounce));
+		} else {
+			sample += V3fHadamard(attenuation, defaultMaterial.emitColor);
+			break;
+		}
+	}
 
-					f32 hitDistance = F32_MAX;
-					u32 hitMaterialIndex = 0;
-					Vec3f hitNormal = V3fZero();
+	return(sample);
+}
 
-					for (u32 objectIndex = 0, objectCount = (u32)scene->objects.size(); objectIndex < objectCount; ++objectIndex) {
-						if (worker.IsStopped())
-							return(false);
+//
+// Packet tracing (SIMD)
+// Traces FMATH_SIMD_WIDTH samples of one pixel at once, one ray per lane.
+// Lanes which miss the scene are masked out for the following bounces.
+// All computations are done in the same order as in the scalar path, so both produces the same image.
+//
+#if defined(FMATH_SIMD)
+#define RAY_PACKET_WIDTH FMATH_SIMD_WIDTH
+
+struct RayPacket {
+	LaneF32 originX, originY, originZ;
+	LaneF32 dirX, dirY, dirZ;
+};
 
-						const Object *obj = &scene->objects[objectIndex];
+struct PacketHit {
+	LaneF32 distance;
+	// Sphere index, sphere count + plane index or -1 for no hit
+	LaneF32 id;
+};
 
-						f32 t = -F32_MAX;
-						bool isHit = false;
-						if (obj->kind == ObjectKind::Plane) {
-							if (RayPlaneIntersection(ray, obj->plane, t, tolerance)) {
-								if ((t > minHitDistance) && (t < hitDistance)) {
-									hitDistance = t;
-									hitMaterialIndex = obj->materialIndex;
-									hitNormal = obj->plane.normal;
-								}
-							}
-						} else if (obj->kind == ObjectKind::Sphere) {
-							if (RaySphereIntersection(ray, obj->sphere, t, tolerance)) {
-								if ((t > minHitDistance) && (t < hitDistance)) {
-									hitDistance = t;
-									hitMaterialIndex = obj->materialIndex;
-									Vec3f relativeOrigin = ray.origin - obj->sphere.origin;
-									hitNormal = V3fNormalize(t * ray.direction + relativeOrigin);
-								}
-							}
-						}
-					}
+static LaneF32 LaneDot(const LaneF32 ax, const LaneF32 ay, const LaneF32 az, const LaneF32 bx, const LaneF32 by, const LaneF32 bz) {
+	LaneF32 result = LaneAdd(LaneAdd(LaneMul(ax, bx), LaneMul(ay, by)), LaneMul(az, bz));
+	return(result);
+}
+
+static void LaneNormalize(LaneF32 &x, LaneF32 &y, LaneF32 &z) {
+	const LaneF32 one = LaneSet1(1.0f);
+	LaneF32 l = LaneSqrt(LaneDot(x, y, z, x, y, z));
+	l = LaneSelect(LaneCmpEq(l, LaneSet1(0.0f)), one, l);
+	LaneF32 invL = LaneDiv(one, l);
+	x = LaneMul(x, invL);
+	y = LaneMul(y, invL);
+	z = LaneMul(z, invL);
+}
 
-					if (hitMaterialIndex) {
-						fplAssert(hitMaterialIndex < scene->materials.size());
-						const Material &hitMaterial = scene->materials[hitMaterialIndex];
+static void IntersectPacketSpheres(const SceneSoA &soa, const u32 first, const u32 count, const RayPacket &ray, const LaneF32 active, PacketHit &hit) {
+	const LaneF32 zero = LaneSet1(0.0f);
+	const LaneF32 two = LaneSet1(2.0f);
+	const LaneF32 four = LaneSet1(4.0f);
+	const LaneF32 tolerance = LaneSet1(RAY_HIT_TOLERANCE);
+	const LaneF32 minHitDistance = zero;
+
+	const LaneF32 a = LaneDot(ray.dirX, ray.dirY, ray.dirZ, ray.dirX, ray.dirY, ray.dirZ);
+	const LaneF32 denom = LaneMul(two, a);
+	const LaneF32 fourA = LaneMul(four, a);
+
+	for (u32 sphereIndex = first; sphereIndex < first + count; ++sphereIndex) {
+		LaneF32 relX = LaneSub(ray.originX, LaneSet1(soa.sphereX[sphereIndex]));
+		LaneF32 relY = LaneSub(ray.originY, LaneSet1(soa.sphereY[sphereIndex]));
+		LaneF32 relZ = LaneSub(ray.originZ, LaneSet1(soa.sphereZ[sphereIndex]));
+		f32 radius = soa.sphereRadius[sphereIndex];
+
+		LaneF32 b = LaneMul(two, LaneDot(ray.dirX, ray.dirY, ray.dirZ, relX, relY, relZ));
+		LaneF32 c = LaneSub(LaneDot(relX, relY, relZ, relX, relY, relZ), LaneSet1(radius * radius));
+
+		LaneF32 rootTerm = LaneSqrt(LaneSub(LaneMul(b, b), LaneMul(fourA, c)));
+		LaneF32 mask = LaneAnd(active, LaneCmpLt(tolerance, rootTerm));
+		if (!LaneMoveMask(mask)) {
+			continue;
+		}
 
-						sample += V3fHadamard(attenuation, hitMaterial.emitColor);
+		LaneF32 negB = LaneSub(zero, b);
+		LaneF32 tPositive = LaneDiv(LaneAdd(negB, rootTerm), denom);
+		LaneF32 tNegative = LaneDiv(LaneSub(negB, rootTerm), denom);
+		LaneF32 t = LaneSelect(LaneAnd(LaneCmpLt(zero, tNegative), LaneCmpLt(tNegative, tPositive)), tNegative, tPositive);
 
-						f32 cosineAttenuation = V3fDot(-ray.direction, hitNormal);
-						if (cosineAttenuation < 0) {
-							cosineAttenuation = 0;
-						}
-						attenuation = V3fHadamard(attenuation, cosineAttenuation * hitMaterial.reflectColor);
+		mask = LaneAnd(mask, LaneAnd(LaneCmpLt(minHitDistance, t), LaneCmpLt(t, hit.distance)));
+		hit.distance = LaneSelect(mask, t, hit.distance);
+		hit.id = LaneSelect(mask, LaneSet1((f32)sphereIndex), hit.id);
+	}
+}
 
-						Vec3f pureBounce = ray.direction - 2.0f * V3fDot(ray.direction, hitNormal) * hitNormal;
+static void IntersectPacketPlanes(const SceneSoA &soa, const RayPacket &ray, const LaneF32 active, PacketHit &hit) {
+	const LaneF32 tolerance = LaneSet1(RAY_HIT_TOLERANCE);
+	const LaneF32 negTolerance = LaneSet1(-RAY_HIT_TOLERANCE);
+	const LaneF32 minHitDistance = LaneSet1(0.0f);
+	const u32 sphereCount = (u32)soa.sphereX.size();
+	for (u32 planeIndex = 0, planeCount = (u32)soa.planeNormalX.size(); planeIndex < planeCount; ++planeIndex) {
+		LaneF32 nx = LaneSet1(soa.planeNormalX[planeIndex]);
+		LaneF32 ny = LaneSet1(soa.planeNormalY[planeIndex]);
+		LaneF32 nz = LaneSet1(soa.planeNormalZ[planeIndex]);
+		LaneF32 denom = LaneDot(nx, ny, nz, ray.dirX, ray.dirY, ray.dirZ);
+		LaneF32 mask = LaneAnd(active, LaneOr(LaneCmpLt(denom, negTolerance), LaneCmpLt(tolerance, denom)));
+		LaneF32 t = LaneDiv(LaneSub(LaneSet1(-soa.planeDistance[planeIndex]), LaneDot(nx, ny, nz, ray.originX, ray.originY, ray.originZ)), denom);
+		mask = LaneAnd(mask, LaneAnd(LaneCmpLt(minHitDistance, t), LaneCmpLt(t, hit.distance)));
+		hit.distance = LaneSelect(mask, t, hit.distance);
+		hit.id = LaneSelect(mask, LaneSet1((f32)(sphereCount + planeIndex)), hit.id);
+	}
+}
 
-#if 1
-						// @NOTE(final): This is NOT a proper way to produce a random bounce. Do proper distribution based bounce
-						Vec3f randomAddon = V3fInit(RandomBilateral(&raytracer->rnd), RandomBilateral(&raytracer->rnd), RandomBilateral(&raytracer->rnd));
-						Vec3f randomBounce = V3fNormalize(hitNormal + randomAddon);
+// Returns the nearest entry distance of all active lanes into the box or F32_MAX when all lanes missed
+static f32 PacketBoxEntryDistance(const BVHNode &node, const RayPacket &ray, const LaneF32 invX, const LaneF32 invY, const LaneF32 invZ, const LaneF32 active, const LaneF32 maxDistance) {
+	LaneF32 tx1 = LaneMul(LaneSub(LaneSet1(node.boundsMin.x), ray.originX), invX);
+	LaneF32 tx2 = LaneMul(LaneSub(LaneSet1(node.boundsMax.x), ray.originX), invX);
+	LaneF32 tMin = LaneMin(tx1, tx2);
+	LaneF32 tMax = LaneMax(tx1, tx2);
+	LaneF32 ty1 = LaneMul(LaneSub(LaneSet1(node.boundsMin.y), ray.originY), invY);
+	LaneF32 ty2 = LaneMul(LaneSub(LaneSet1(node.boundsMax.y), ray.originY), invY);
+	tMin = LaneMax(tMin, LaneMin(ty1, ty2));
+	tMax = LaneMin(tMax, LaneMax(ty1, ty2));
+	LaneF32 tz1 = LaneMul(LaneSub(LaneSet1(node.boundsMin.z), ray.originZ), invZ);
+	LaneF32 tz2 = LaneMul(LaneSub(LaneSet1(node.boundsMax.z), ray.originZ), invZ);
+	tMin = LaneMax(tMin, LaneMin(tz1, tz2));
+	tMax = LaneMin(tMax, LaneMax(tz1, tz2));
+	LaneF32 mask = LaneAnd(active, LaneCmpLe(tMin, tMax));
+	mask = LaneAnd(mask, LaneAnd(LaneCmpLt(LaneSet1(0.0f), tMax), LaneCmpLt(tMin, maxDistance)));
+	if (!LaneMoveMask(mask)) {
+		return(F32_MAX);
+	}
+	f32 distances[RAY_PACKET_WIDTH];
+	LaneStore(distances, LaneSelect(mask, tMin, LaneSet1(F32_MAX)));
+	f32 result = distances[0];
+	for (u32 lane = 1; lane < RAY_PACKET_WIDTH; ++lane) {
+		result = Min(result, distances[lane]);
+	}
+	return(result);
+}
+
+static void IntersectPacketBVH(const Scene &scene, const RayPacket &ray, const LaneF32 active, PacketHit &hit) {
+	const BVH &bvh = scene.bvh;
+	if (bvh.nodes.size() == 0) {
+		return;
+	}
+	const BVHNode *nodes = &bvh.nodes[0];
+
+	const LaneF32 one = LaneSet1(1.0f);
+	const LaneF32 invX = LaneDiv(one, ray.dirX);
+	const LaneF32 invY = LaneDiv(one, ray.dirY);
+	const LaneF32 invZ = LaneDiv(one, ray.dirZ);
+
+	if (PacketBoxEntryDistance(nodes[0], ray, invX, invY, invZ, active, hit.distance) == F32_MAX) {
+		return;
+	}
+
+	u32 stack[BVH_MAX_DEPTH];
+	u32 stackCount = 0;
+	u32 nodeIndex = 0;
+	while (true) {
+		const BVHNode &node = nodes[nodeIndex];
+		if (node.objectCount > 0) {
+			IntersectPacketSpheres(scene.soa, node.firstIndex, node.objectCount, ray, active, hit);
+		} else {
+			u32 nearIndex = node.firstIndex;
+			u32 farIndex = node.firstIndex + 1;
+			f32 nearDistance = PacketBoxEntryDistance(nodes[nearIndex], ray, invX, invY, invZ, active, hit.distance);
+			f32 farDistance = PacketBoxEntryDistance(nodes[farIndex], ray, invX, invY, invZ, active, hit.distance);
+			if (farDistance < nearDistance) {
+				u32 tempIndex = nearIndex;
+				nearIndex = farIndex;
+				farIndex = tempIndex;
+				f32 tempDistance = nearDistance;
+				nearDistance = farDistance;
+				farDistance = tempDistance;
+			}
+			if (nearDistance != F32_MAX) {
+				if (farDistance != F32_MAX) {
+					fplAssert(stackCount < fplArrayCount(stack));
+					stack[stackCount++] = farIndex;
+				}
+				nodeIndex = nearIndex;
+				continue;
+			}
+		}
+		if (stackCount == 0) {
+			break;
+		}
+		nodeIndex = stack[--stackCount];
+	}
+}
+
+static void TracePacket(const Scene &scene, const PrimaryRaySetup &setup, const f32 filmX, const f32 filmY, const u32 pixelIndex, const u32 firstSample, const u32 sampleCount, const u32 maxBounceCount, const bool useBVH, const u64 seed, Vec3f *outSamples, u64 &rayCount) {
+	fplAssert(sampleCount > 0 && sampleCount <= RAY_PACKET_WIDTH);
+
+	const SceneSoA &soa = scene.soa;
+	const u32 sphereCount = (u32)soa.sphereX.size();
+	const Material &defaultMaterial = scene.materials[0];
+
+	// Primary rays, same as MakePrimaryRay() but for all lanes at once
+	u32 rnd[RAY_PACKET_WIDTH];
+	f32 laneA[RAY_PACKET_WIDTH], laneB[RAY_PACKET_WIDTH], laneC[RAY_PACKET_WIDTH];
+	f32 laneD[RAY_PACKET_WIDTH], laneE[RAY_PACKET_WIDTH], laneF[RAY_PACKET_WIDTH];
+	f32 laneIndices[RAY_PACKET_WIDTH];
+	for (u32 lane = 0; lane < RAY_PACKET_WIDTH; ++lane) {
+		rnd[lane] = SeedSampleRandom(seed, pixelIndex, firstSample + lane);
+		laneA[lane] = SampleRandomBilateral(rnd[lane]);
+		laneB[lane] = SampleRandomBilateral(rnd[lane]);
+		laneIndices[lane] = (f32)lane;
+	}
+
+	LaneF32 perspectiveX = LaneAdd(LaneSet1(filmX), LaneMul(LaneLoad(laneA), LaneSet1(setup.halfPixelSize.w)));
+	LaneF32 perspectiveY = LaneAdd(LaneSet1(filmY), LaneMul(LaneLoad(laneB), LaneSet1(setup.halfPixelSize.h)));
+	perspectiveX = LaneMul(LaneMul(perspectiveX, LaneSet1(setup.halfTan)), LaneSet1(setup.aspectRatio));
+	perspectiveY = LaneMul(perspectiveY, LaneSet1(setup.halfTan));
+
+	RayPacket ray;
+	ray.originX = LaneSet1(setup.cameraPosition.x);
+	ray.originY = LaneSet1(setup.cameraPosition.y);
+	ray.originZ = LaneSet1(setup.cameraPosition.z);
+	LaneF32 filmPX = LaneAdd(LaneAdd(LaneSet1(setup.filmCenter.x), LaneMul(perspectiveX, LaneSet1(setup.cameraX.x))), LaneMul(perspectiveY, LaneSet1(setup.cameraY.x)));
+	LaneF32 filmPY = LaneAdd(LaneAdd(LaneSet1(setup.filmCenter.y), LaneMul(perspectiveX, LaneSet1(setup.cameraX.y))), LaneMul(perspectiveY, LaneSet1(setup.cameraY.y)));
+	LaneF32 filmPZ = LaneAdd(LaneAdd(LaneSet1(setup.filmCenter.z), LaneMul(perspectiveX, LaneSet1(setup.cameraX.z))), LaneMul(perspectiveY, LaneSet1(setup.cameraY.z)));
+	ray.dirX = LaneSub(filmPX, ray.originX);
+	ray.dirY = LaneSub(filmPY, ray.originY);
+	ray.dirZ = LaneSub(filmPZ, ray.originZ);
+	LaneNormalize(ray.dirX, ray.dirY, ray.dirZ);
+
+	const LaneF32 zero = LaneSet1(0.0f);
+	const LaneF32 one = LaneSet1(1.0f);
+	const LaneF32 two = LaneSet1(2.0f);
+	const LaneF32 minusOne = LaneSet1(-1.0f);
+
+	LaneF32 active = LaneCmpLt(LaneLoad(laneIndices), LaneSet1((f32)sampleCount));
+
+	LaneF32 sampleR = zero, sampleG = zero, sampleB = zero;
+	LaneF32 attR = one, attG = one, attB = one;
+
+	for (u32 bounceIndex = 0; bounceIndex < maxBounceCount; ++bounceIndex) {
+		int activeBits = LaneMoveMask(active);
+		if (!activeBits) {
+			break;
+		}
+		for (u32 lane = 0; lane < RAY_PACKET_WIDTH; ++lane) {
+			if (activeBits & (1 << lane)) {
+				++rayCount;
+			}
+		}
+
+		PacketHit hit;
+		hit.distance = LaneSet1(F32_MAX);
+		hit.id = minusOne;
+		IntersectPacketPlanes(soa, ray, active, hit);
+		if (useBVH) {
+			IntersectPacketBVH(scene, ray, active, hit);
+		} else {
+			IntersectPacketSpheres(soa, 0, sphereCount, ray, active, hit);
+		}
+
+		// Gather hit material, sphere center or plane normal and random numbers per lane
+		f32 hitIds[RAY_PACKET_WIDTH];
+		LaneStore(hitIds, hit.id);
+		f32 isHit[RAY_PACKET_WIDTH], isSphere[RAY_PACKET_WIDTH];
+		f32 emitR[RAY_PACKET_WIDTH], emitG[RAY_PACKET_WIDTH], emitB[RAY_PACKET_WIDTH];
+		f32 reflectR[RAY_PACKET_WIDTH], reflectG[RAY_PACKET_WIDTH], reflectB[RAY_PACKET_WIDTH];
+		f32 scatter[RAY_PACKET_WIDTH];
+		for (u32 lane = 0; lane < RAY_PACKET_WIDTH; ++lane) {
+			isHit[lane] = isSphere[lane] = 0.0f;
+			emitR[lane] = emitG[lane] = emitB[lane] = 0.0f;
+			reflectR[lane] = reflectG[lane] = reflectB[lane] = 0.0f;
+			scatter[lane] = 0.0f;
+			laneA[lane] = laneB[lane] = laneC[lane] = 0.0f;
+			laneD[lane] = laneE[lane] = laneF[lane] = 0.0f;
+			if (!(activeBits & (1 << lane)) || hitIds[lane] < 0.0f) {
+				continue;
+			}
+			u32 hitId = (u32)hitIds[lane];
+			const Object *obj;
+			if (hitId < sphereCount) {
+				obj = &scene.objects[soa.sphereObjectIndices[hitId]];
+				isSphere[lane] = 1.0f;
+				laneA[lane] = obj->sphere.origin.x;
+				laneB[lane] = obj->sphere.origin.y;
+				laneC[lane] = obj->sphere.origin.z;
+			} else {
+				obj = &scene.objects[soa.planeObjectIndices[hitId - sphereCount]];
+				laneA[lane] = obj->plane.normal.x;
+				laneB[lane] = obj->plane.normal.y;
+				laneC[lane] = obj->plane.normal.z;
+			}
+			if (obj->materialIndex == 0) {
+				continue;
+			}
+			const Material &hitMaterial = scene.materials[obj->materialIndex];
+			isHit[lane] = 1.0f;
+			emitR[lane] = hitMaterial.emitColor.r;
+			emitG[lane] = hitMaterial.emitColor.g;
+			emitB[lane] = hitMaterial.emitColor.b;
+			reflectR[lane] = hitMaterial.reflectColor.r;
+			reflectG[lane] = hitMaterial.reflectColor.g;
+			reflectB[lane] = hitMaterial.reflectColor.b;
+			scatter[lane] = hitMaterial.scatter;
+			laneD[lane] = SampleRandomBilateral(rnd[lane]);
+			laneE[lane] = SampleRandomBilateral(rnd[lane]);
+			laneF[lane] = SampleRandomBilateral(rnd[lane]);
+		}
+
+		LaneF32 hitMask = LaneCmpLt(zero, LaneLoad(isHit));
+		LaneF32 missMask = LaneSelect(hitMask, zero, active);
+
+		// Missed lanes gets the sky color and are done
+		sampleR = LaneSelect(missMask, LaneAdd(sampleR, LaneMul(attR, LaneSet1(defaultMaterial.emitColor.r))), sampleR);
+		sampleG = LaneSelect(missMask, LaneAdd(sampleG, LaneMul(attG, LaneSet1(defaultMaterial.emitColor.g))), sampleG);
+		sampleB = LaneSelect(missMask, LaneAdd(sampleB, LaneMul(attB, LaneSet1(defaultMaterial.emitColor.b))), sampleB);
+
+		active = hitMask;
+		if (!LaneMoveMask(active)) {
+			break;
+		}
+
+		// Hit normal
+		LaneF32 t = hit.distance;
+		LaneF32 normalX = LaneAdd(LaneMul(t, ray.dirX), LaneSub(ray.originX, LaneLoad(laneA)));
+		LaneF32 normalY = LaneAdd(LaneMul(t, ray.dirY), LaneSub(ray.originY, LaneLoad(laneB)));
+		LaneF32 normalZ = LaneAdd(LaneMul(t, ray.dirZ), LaneSub(ray.originZ, LaneLoad(laneC)));
+		LaneNormalize(normalX, normalY, normalZ);
+		LaneF32 sphereMask = LaneCmpLt(zero, LaneLoad(isSphere));
+		normalX = LaneSelect(sphereMask, normalX, LaneLoad(laneA));
+		normalY = LaneSelect(sphereMask, normalY, LaneLoad(laneB));
+		normalZ = LaneSelect(sphereMask, normalZ, LaneLoad(laneC));
+
+		// Emission and attenuation
+		sampleR = LaneSelect(active, LaneAdd(sampleR, LaneMul(attR, LaneLoad(emitR))), sampleR);
+		sampleG = LaneSelect(active, LaneAdd(sampleG, LaneMul(attG, LaneLoad(emitG))), sampleG);
+		sampleB = LaneSelect(active, LaneAdd(sampleB, LaneMul(attB, LaneLoad(emitB))), sampleB);
+
+		LaneF32 cosineAttenuation = LaneDot(LaneMul(ray.dirX, minusOne), LaneMul(ray.dirY, minusOne), LaneMul(ray.dirZ, minusOne), normalX, normalY, normalZ);
+		cosineAttenuation = LaneSelect(LaneCmpLt(cosineAttenuation, zero), zero, cosineAttenuation);
+		attR = LaneSelect(active, LaneMul(attR, LaneMul(cosineAttenuation, LaneLoad(reflectR))), attR);
+		attG = LaneSelect(active, LaneMul(attG, LaneMul(cosineAttenuation, LaneLoad(reflectG))), attG);
+		attB = LaneSelect(active, LaneMul(attB, LaneMul(cosineAttenuation, LaneLoad(reflectB))), attB);
+
+		// Bounce
+		LaneF32 twoDot = LaneMul(two, LaneDot(ray.dirX, ray.dirY, ray.dirZ, normalX, normalY, normalZ));
+		LaneF32 pureX = LaneSub(ray.dirX, LaneMul(twoDot, normalX));
+		LaneF32 pureY = LaneSub(ray.dirY, LaneMul(twoDot, normalY));
+		LaneF32 pureZ = LaneSub(ray.dirZ, LaneMul(twoDot, normalZ));
+
+		LaneF32 randomX = LaneAdd(normalX, LaneLoad(laneD));
+		LaneF32 randomY = LaneAdd(normalY, LaneLoad(laneE));
+		LaneF32 randomZ = LaneAdd(normalZ, LaneLoad(laneF));
+		LaneNormalize(randomX, randomY, randomZ);
+
+		LaneF32 s = LaneLoad(scatter);
+		LaneF32 invS = LaneSub(one, s);
+		LaneF32 dirX = LaneAdd(LaneMul(invS, randomX), LaneMul(s, pureX));
+		LaneF32 dirY = LaneAdd(LaneMul(invS, randomY), LaneMul(s, pureY));
+		LaneF32 dirZ = LaneAdd(LaneMul(invS, randomZ), LaneMul(s, pureZ));
+		LaneNormalize(dirX, dirY, dirZ);
+
+		ray.originX = LaneSelect(active, LaneAdd(ray.originX, LaneMul(t, ray.dirX)), ray.originX);
+		ray.originY = LaneSelect(active, LaneAdd(ray.originY, LaneMul(t, ray.dirY)), ray.originY);
+		ray.originZ = LaneSelect(active, LaneAdd(ray.originZ, LaneMul(t, ray.dirZ)), ray.originZ);
+		ray.dirX = LaneSelect(active, dirX, ray.dirX);
+		ray.dirY = LaneSelect(active, dirY, ray.dirY);
+		ray.dirZ = LaneSelect(active, dirZ, ray.dirZ);
+	}
+
+	LaneStore(laneA, sampleR);
+	LaneStore(laneB, sampleG);
+	LaneStore(laneC, sampleB);
+	for (u32 lane = 0; lane < sampleCount; ++lane) {
+		outSamples[lane] = V3fInit(laneA[lane], laneB[lane], laneC[lane]);
+	}
+}
+#endif // FMATH_SIMD
+
+// @NOTE(final): "Order" must be volatile, otherwise the compile may reorder instructions here
+#if FIX_WRONG_INSTRUCTION_REORDER_IN_RELEASE
+static void RaytracePart(Worker &worker, volatile WorkOrder &order) {
 #else
-						Vec3f randomBounce = RandomUnitHemisphere(&raytracer.rnd);
+static void RaytracePart(Worker &worker, WorkOrder &order) {
 #endif
+	const Scene *scene = order.scene;
+	Raytracer *raytracer = order.raytracer;
+	fplAssert(scene != fpl_null);
+	fplAssert(raytracer != fpl_null);
+
+	Image32 &image = raytracer->image;
+
+	const PrimaryRaySetup setup = MakePrimaryRaySetup(scene->camera, image, raytracer->halfPixelSize);
+
+	const u32 raysPerPixel = raytracer->settings.raysPerPixelCount;
+	const u32 maxBounceCount = raytracer->settings.maxBounceCount;
+	const u64 seed = raytracer->settings.seed;
+	const bool useBVH = raytracer->settings.useBVH != 0;
+#if defined(FMATH_SIMD)
+	const bool usePackets = raytracer->settings.usePackets != 0;
+#endif
+
+	// Every pass continues the sample sequence of the pixel, so passes add new samples instead of repeating them
+	const u32 passIndex = raytracer->passIndex;
+	const u32 firstPassSample = passIndex * raysPerPixel;
+	const f32 passContrib = 1.0f / (f32)(passIndex + 1);
+
+	f32 contrib = 1.0f / (f32)raysPerPixel;
+
+	u64 rayCount = 0;
+
+	fplAssert(scene->materials.size() > 0);
+
+	for (u32 y = order.yMin; y < order.yMaxPlusOne; ++y) {
+		u32 inverseY = (image.height - 1 - y);
+
+		Pixel *row = &image.pixels[inverseY * image.width];
+
+		f32 ratioY = (f32)y / (f32)image.height;
+		f32 filmY = -1.0f + 2.0f * ratioY;
+
+		Pixel *col = row + order.xMin;
+		for (u32 x = order.xMin; x < order.xMaxPlusOne; ++x) {
+			f32 ratioX = (f32)x / (f32)image.width;
+			f32 filmX = -1.0f + 2.0f * ratioX;
+
+			u32 pixelIndex = y * image.width + x;
+
+			Vec3f finalColor = {};
 
-						// Ray for next bounce
-						ray.origin += hitDistance * ray.direction;
-						ray.direction = V3fNormalize(V3fLerp(randomBounce, hitMaterial.scatter, pureBounce));
-					} else {
-						sample += V3fHadamard(attenuation, defaultMaterial.emitColor);
-						break;
+#if defined(FMATH_SIMD)
+			if (usePackets) {
+				for (u32 firstSample = 0; firstSample < raysPerPixel; firstSample += RAY_PACKET_WIDTH) {
+					u32 sampleCount = fplMin(raysPerPixel - firstSample, (u32)RAY_PACKET_WIDTH);
+					Vec3f samples[RAY_PACKET_WIDTH];
+					TracePacket(*scene, setup, filmX, filmY, pixelIndex, firstPassSample + firstSample, sampleCount, maxBounceCount, useBVH, seed, samples, rayCount);
+					for (u32 sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex) {
+						finalColor += contrib * samples[sampleIndex];
 					}
 				}
-
-				finalColor += contrib * sample;
+			} else
+#endif
+			{
+				for (u32 rayIndex = 0; rayIndex < raysPerPixel; ++rayIndex) {
+					u32 rnd = SeedSampleRandom(seed, pixelIndex, firstPassSample + rayIndex);
+					Ray3f ray = MakePrimaryRay(setup, filmX, filmY, rnd);
+					Vec3f sample = TraceSample(*scene, ray, maxBounceCount, useBVH, rnd, rayCount);
+					finalColor += contrib * sample;
+				}
 			}
 
-			Pixel outputPixel = LinearToPixelSRGB(V4fInitXYZ(finalColor, 1.0f));
+			// The image shows the mean of all passes so far
+			Vec3f &accumulated = raytracer->accumulation[pixelIndex];
+			accumulated = passIndex > 0 ? accumulated + finalColor : finalColor;
+			Vec3f meanColor = passContrib * accumulated;
+
+			Pixel outputPixel = LinearToPixelSRGB(V4fInitXYZ(meanColor, 1.0f));
 			*col = outputPixel;
 			++col;
 		}
 
 		++row;
-
-		if (worker.IsStopped())
-			return(false);
 	}
 
-	return(true);
+	worker.stats.rayCount += rayCount;
 }
 
 
@@ -772,6 +1709,8 @@ static void InitGL() {
 #endif
 
 static void InitScene(Scene &scene) {
+	scene.Clear();
+
 	scene.camera.eye = V3fInit(0, -10, 1);
 	scene.camera.target = V3fInit(0, 0, 0);
 	scene.camera.up = UnitUp;
@@ -790,6 +1729,47 @@ static void InitScene(Scene &scene) {
 	scene.AddSphere(V3fInit(0, 0, 0.25f), 1.0f, whiteMat);
 	scene.AddSphere(V3fInit(1, -2, 0.3f), 0.5f, redMat);
 	scene.AddSphere(V3fInit(-1.0f, -0.75f, 0.9f), 0.3f, blueMat);
+
+	BuildBVH(scene);
+}
+
+// Generates a floor with the given number of random spheres on it
+static void InitRandomSpheresScene(Scene &scene, const u32 sphereCount, const u64 seed) {
+	scene.Clear();
+
+	RandomSeries rnd = RandomSeed(seed);
+
+	const f32 spacing = 0.5f;
+	const f32 halfExtent = SquareRoot((f32)sphereCount) * spacing * 0.5f;
+
+	scene.camera.eye = V3fInit(0, -halfExtent * 2.5f - 2.0f, halfExtent * 0.75f + 1.0f);
+	scene.camera.target = V3fInit(0, 0, 0);
+	scene.camera.up = UnitUp;
+	scene.camera.fov = DegreesToRadians(45.0f);
+	scene.camera.zNear = 0.5f;
+	scene.camera.zFar = 1000.0f;
+
+	scene.AddMaterial(V3fInit(0.152f, 0.22745f, 0.3647f), {});
+
+	u32 floorMat = scene.AddMaterial(V3fInit(0, 0.0f, 0), V3fInit(0.5f, 0.5f, 0.5f), 0.5f);
+
+	const u32 sphereMaterialCount = 16;
+	u32 firstSphereMat = (u32)scene.materials.size();
+	for (u32 i = 0; i < sphereMaterialCount; ++i) {
+		Vec3f reflectColor = V3fInit(RandomUnilateral(&rnd), RandomUnilateral(&rnd), RandomUnilateral(&rnd));
+		Vec3f emitColor = (i % 4 == 0) ? reflectColor * 0.5f : V3fZero();
+		scene.AddMaterial(emitColor, reflectColor, RandomUnilateral(&rnd));
+	}
+
+	scene.AddPlane(V3fInit(0, 0, 1), 0.0f, floorMat);
+	for (u32 i = 0; i < sphereCount; ++i) {
+		f32 radius = 0.05f + RandomUnilateral(&rnd) * 0.2f;
+		Vec3f origin = V3fInit(RandomBilateral(&rnd) * halfExtent, RandomBilateral(&rnd) * halfExtent, radius + RandomUnilateral(&rnd) * 0.5f);
+		u32 matIndex = firstSphereMat + (RandomU32(&rnd) % sphereMaterialCount);
+		scene.AddSphere(origin, radius, matIndex);
+	}
+
+	BuildBVH(scene);
 }
 
 static void InitRaytracer(Raytracer &raytracer, const u32 raytraceWidth, const u32 raytraceHeight) {
@@ -798,76 +1778,175 @@ static void InitRaytracer(Raytracer &raytracer, const u32 raytraceWidth, const u
 	raytraceImage.height = raytraceHeight;
 	raytraceImage.pixels = (Pixel *)fplMemoryAllocate(sizeof(Pixel) * raytraceImage.width * raytraceImage.height);
 	raytraceImage.Fill(MakePixelFromRGBA(0, 0, 0, 255));
+	raytracer.accumulation = (Vec3f *)fplMemoryAllocate(sizeof(Vec3f) * raytraceImage.width * raytraceImage.height);
+	raytracer.passIndex = 0;
 
 	raytracer.halfPixelSize.w = 0.5f / (f32)raytraceImage.width;
 	raytracer.halfPixelSize.h = 0.5f / (f32)raytraceImage.height;
 
-	//raytracer.rnd = RandomSeed(fplGetTimeInMillisecondsLP() % U64_MAX);
-	raytracer.rnd = RandomSeed(1337);
+	raytracer.settings.seed = 1337;
 	raytracer.settings.maxBounceCount = 4;
 	raytracer.settings.raysPerPixelCount = 32;
+	raytracer.settings.useBVH = true;
+#if defined(FMATH_SIMD)
+	raytracer.settings.usePackets = true;
+#endif
 }
 
-static void InitApp(App &app, const u32 raytraceWidth, const u32 raytraceHeight) {
+static void LoadScene(Scene &scene, const u32 sphereCount) {
+	f64 startTime = fplGetTimeInMillisecondsHP();
+	if (sphereCount > 0) {
+		InitRandomSpheresScene(scene, sphereCount, 1337);
+	} else {
+		InitScene(scene);
+	}
+	f64 buildTime = fplGetTimeInMillisecondsHP() - startTime;
+	fplConsoleFormatOut("Scene with %zu objects loaded, BVH: %zu nodes, %u leafs, depth %u in %.2f ms\n", scene.objects.size(), scene.bvh.nodes.size(), scene.bvh.leafCount, scene.bvh.maxDepth, buildTime);
+}
+
+static void InitApp(App &app, const u32 raytraceWidth, const u32 raytraceHeight, const u32 sphereCount) {
 #if USE_OPENGL_NO_RAYTRACE
 	InitGL();
 #endif
 
-	InitScene(app.scene);
+	LoadScene(app.scene, sphereCount);
 	InitRaytracer(app.raytracer, raytraceWidth, raytraceHeight);
 }
 
+// Extracts every second bit of a morton code
+static u32 MortonCompactBits(u32 x) {
+	x &= 0x55555555;
+	x = (x ^ (x >> 1)) & 0x33333333;
+	x = (x ^ (x >> 2)) & 0x0f0f0f0f;
+	x = (x ^ (x >> 4)) & 0x00ff00ff;
+	x = (x ^ (x >> 8)) & 0x0000ffff;
+	return(x);
+}
+
 static void FillQueue(App &app, WorkQueue &queue, const TilingInfo &tilingInfo) {
 	queue.Reset();
 
-	fplAssert(queue.completionCount == 0);
-	fplAssert(queue.workOrderCount == 0);
-	fplAssert(queue.nextWorkOrderIndex == 0);
+	fplAssert(queue.completedPixelCount == 0);
+	fplAssert(queue.queuedTileCount == 0);
+	fplAssert(queue.dequeCount > 0);
 
 	u32 totalTileCount = tilingInfo.tileCountX * tilingInfo.tileCountY;
 
-	for (u32 tileY = 0; tileY < tilingInfo.tileCountY; ++tileY) {
-		for (u32 tileX = 0; tileX < tilingInfo.tileCountX; ++tileX) {
-			u32 minX = tileX * tilingInfo.tileSizeX;
-			u32 minY = tileY * tilingInfo.tileSizeY;
-			u32 maxXPlusOne = fplMin(minX + tilingInfo.tileSizeX, tilingInfo.imageW);
-			u32 maxYPlusOne = fplMin(minY + tilingInfo.tileSizeY, tilingInfo.imageH);
-			queue.Push(&app.raytracer, &app.scene, minX, minY, maxXPlusOne, maxYPlusOne);
+	// Tiles are visited in morton order and each worker gets a contiguous range of it,
+	// so neighbor tiles are rendered by the same worker and stealing takes tiles from the far end
+	u32 mortonSize = 1;
+	while (mortonSize < tilingInfo.tileCountX || mortonSize < tilingInfo.tileCountY) {
+		mortonSize *= 2;
+	}
+	u32 tileIndex = 0;
+	for (u32 code = 0; code < mortonSize * mortonSize; ++code) {
+		u32 tileX = MortonCompactBits(code);
+		u32 tileY = MortonCompactBits(code >> 1);
+		if (tileX >= tilingInfo.tileCountX || tileY >= tilingInfo.tileCountY) {
+			continue;
 		}
+		WorkOrder order = {};
+		order.raytracer = &app.raytracer;
+		order.scene = &app.scene;
+		order.xMin = tileX * tilingInfo.tileSizeX;
+		order.yMin = tileY * tilingInfo.tileSizeY;
+		order.xMaxPlusOne = fplMin(order.xMin + tilingInfo.tileSizeX, tilingInfo.imageW);
+		order.yMaxPlusOne = fplMin(order.yMin + tilingInfo.tileSizeY, tilingInfo.imageH);
+		u32 dequeIndex = (u32)(((u64)tileIndex * queue.dequeCount) / totalTileCount);
+		bool pushed = queue.Push(dequeIndex, &order, 1);
+		fplAssert(pushed);
+		++tileIndex;
 	}
+	queue.tileCount = tileIndex;
 
-	fplAssert(queue.workOrderCount == totalTileCount);	
+	fplAssert(queue.tileCount == totalTileCount);
+
+	// Publish the pixel count last, the workers start as soon as the queue is no longer empty
+	fplAtomicStoreU32(&queue.totalPixelCount, tilingInfo.imageW * tilingInfo.imageH);
 }
 
 static void ReleaseApp(App &app) {
+	fplMemoryFree(app.raytracer.accumulation);
 	fplMemoryFree(app.raytracer.image.pixels);
 }
 
+static void WakeWorker(Worker *worker) {
+	fplMutexLock(&worker->lockMutex);
+	fplConditionSignal(&worker->nonEmptyCondition);
+	fplMutexUnlock(&worker->lockMutex);
+}
+
+static bool SplitWorkOrder(Worker *worker, const WorkOrder &order) {
+	u32 width = order.xMaxPlusOne - order.xMin;
+	u32 height = order.yMaxPlusOne - order.yMin;
+	if (width < TILE_MIN_SPLIT_SIZE * 2 || height < TILE_MIN_SPLIT_SIZE * 2) {
+		return(false);
+	}
+	u32 xMid = order.xMin + width / 2;
+	u32 yMid = order.yMin + height / 2;
+	WorkOrder quads[4] = { order, order, order, order };
+	quads[0].xMaxPlusOne = quads[2].xMaxPlusOne = xMid;
+	quads[1].xMin = quads[3].xMin = xMid;
+	quads[0].yMaxPlusOne = quads[1].yMaxPlusOne = yMid;
+	quads[2].yMin = quads[3].yMin = yMid;
+	bool result = worker->queue->Push(worker->index, quads, fplArrayCount(quads));
+	if (result) {
+		// Idle workers wait for queued tiles, the new tiles are counted before they are woken up
+		for (u32 workerIndex = 0; workerIndex < worker->workerCount; ++workerIndex) {
+			if (workerIndex != worker->index) {
+				WakeWorker(worker->workers + workerIndex);
+			}
+		}
+	}
+	return(result);
+}
+
 static bool RaytraceFromQueue(Worker *worker) {
 	fplAssert(worker->queue != fpl_null);
 
-	u32 orderIndex = 0;
-	bool result = false;
-	if (worker->queue->Pop(orderIndex)) {
-		WorkOrder order = worker->queue->orders[orderIndex];
-		result = RaytracePart(*worker, order);
-		if (result) {
-			fplAtomicIncrementU32(&worker->queue->completionCount);
-		}
+	WorkOrder order;
+	bool stolen = false;
+	if (!worker->queue->Pop(worker->index, order, stolen)) {
+		return(false);
 	}
 
-	return(result);
+	// Cancellation is checked once per tile
+	if (worker->IsStopped()) {
+		return(false);
+	}
+
+	if (stolen) {
+		++worker->stats.stolenTileCount;
+	}
+
+	// Expensive tiles are split when the other workers are running out of work
+	if (worker->queue->IsStarving() && SplitWorkOrder(worker, order)) {
+		++worker->stats.splitTileCount;
+		return(true);
+	}
+
+	f64 startTime = fplGetTimeInMillisecondsHP();
+	RaytracePart(*worker, order);
+	worker->stats.busyTime += fplGetTimeInMillisecondsHP() - startTime;
+	++worker->stats.tileCount;
+
+	u32 pixelCount = (order.xMaxPlusOne - order.xMin) * (order.yMaxPlusOne - order.yMin);
+	fplAtomicFetchAndAddU32(&worker->queue->completedPixelCount, pixelCount);
+
+	return(true);
 }
 
 static void WorkerThreadProc(const fplThreadHandle *thread, void *opaqueData) {
 	Worker *worker = (Worker *)opaqueData;
 	worker->Start();
 	while (true) {
-		if (worker->queue->IsEmpty() || worker->queue->IsFinished()) {
-			fplMutexLock(&worker->lockMutex);
+		// @NOTE(final): The state is checked while holding the lock, otherwise we may miss a signal and wait forever
+		fplMutexLock(&worker->lockMutex);
+		// Without queued tiles, the worker sleeps until the next frame starts or another worker splits a tile
+		while (!worker->IsStopped() && (worker->queue->IsEmpty() || !worker->queue->HasQueuedTiles())) {
 			fplConditionWait(&worker->nonEmptyCondition, &worker->lockMutex, FPL_TIMEOUT_INFINITE);
-			fplMutexUnlock(&worker->lockMutex);
 		}
+		fplMutexUnlock(&worker->lockMutex);
 		if (worker->IsStopped()) {
 			break;
 		}
@@ -876,8 +1955,350 @@ static void WorkerThreadProc(const fplThreadHandle *thread, void *opaqueData) {
 	worker->Stop();
 }
 
+static void InitTilingInfo(TilingInfo &tilingInfo, const u32 imageW, const u32 imageH, const u32 tileSize) {
+	tilingInfo = {};
+	tilingInfo.imageW = imageW;
+	tilingInfo.imageH = imageH;
+	tilingInfo.tileSizeX = tilingInfo.tileSizeY = tileSize;
+	tilingInfo.tileCountX = (imageW + tilingInfo.tileSizeX - 1) / tilingInfo.tileSizeX;
+	tilingInfo.tileCountY = (imageH + tilingInfo.tileSizeY - 1) / tilingInfo.tileSizeY;
+}
+
+static Worker *StartWorkers(WorkQueue &queue, const TilingInfo &tilingInfo, const u32 workerCount) {
+	// Queue, one tile deque per worker with enough room for the initial tiles and the split tiles
+	u32 maxTileCount = tilingInfo.tileCountX * tilingInfo.tileCountY;
+	queue = {};
+	queue.Init(workerCount, maxTileCount + 64);
+
+	Worker *workers = new Worker[workerCount];
+	for (u32 workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+		Worker *worker = workers + workerIndex;
+		fplClearStruct(worker);
+		fplMutexInit(&worker->lockMutex);
+		fplConditionInit(&worker->nonEmptyCondition);
+		worker->queue = &queue;
+		worker->workers = workers;
+		worker->workerCount = workerCount;
+		worker->index = workerIndex;
+		worker->thread = fplThreadCreate(WorkerThreadProc, worker);
+	}
+	return(workers);
+}
+
+static void StopWorkers(WorkQueue &queue, Worker *workers, const u32 workerCount) {
+	// Send stop signal to all workers
+	for (u32 workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+		Worker *worker = workers + workerIndex;
+		fplAtomicStoreS32((volatile s32 *)&worker->state, (s32)WorkerState::Stopped);
+		WakeWorker(worker);
+	}
+
+	// Wait for all threads to finish
+	fplThreadWaitForAll(&workers[0].thread, workerCount, sizeof(Worker), FPL_TIMEOUT_INFINITE);
+
+	// Terminate unfinished threads
+	for (u32 workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+		Worker *worker = workers + workerIndex;
+		fplThreadTerminate(worker->thread);
+	}
+
+	// Release worker resources
+	for (u32 workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+		Worker *worker = workers + workerIndex;
+		fplConditionDestroy(&worker->nonEmptyCondition);
+		fplMutexDestroy(&worker->lockMutex);
+	}
+	delete[] workers;
+
+	queue.Release();
+}
+
+static void BeginFrame(App &app, WorkQueue &queue, Worker *workers, const u32 workerCount, const TilingInfo &tilingInfo) {
+	for (u32 workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+		fplClearStruct(&workers[workerIndex].stats);
+	}
+
+	FillQueue(app, queue, tilingInfo);
+
+	for (u32 workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+		Worker *worker = workers + workerIndex;
+		WakeWorker(worker);
+	}
+}
+
+static WorkerStats SumWorkerStats(const Worker *workers, const u32 workerCount) {
+	WorkerStats result = {};
+	for (u32 workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+		const WorkerStats &stats = workers[workerIndex].stats;
+		result.rayCount += stats.rayCount;
+		result.busyTime += stats.busyTime;
+		result.tileCount += stats.tileCount;
+		result.stolenTileCount += stats.stolenTileCount;
+		result.splitTileCount += stats.splitTileCount;
+	}
+	return(result);
+}
+
+// FNV-1a hash of the image pixels, to compare renders across runs and optimizations
+static u64 HashImage(const Image32 &image) {
+	u64 result = 14695981039346656037ULL;
+	const u8 *bytes = (const u8 *)image.pixels;
+	size_t size = sizeof(Pixel) * image.width * image.height;
+	for (size_t i = 0; i < size; ++i) {
+		result ^= bytes[i];
+		result *= 1099511628211ULL;
+	}
+	return(result);
+}
+
+static bool WriteImagePPM(const Image32 &image, const char *filePath) {
+	fplFileHandle file;
+	if (!fplCreateBinaryFile(filePath, &file)) {
+		return(false);
+	}
+	char header[64];
+	fplFormatString(header, fplArrayCount(header), "P6\n%u %u\n255\n", image.width, image.height);
+	size_t headerSize = fplGetStringLength(header);
+	bool result = fplWriteFileBlock(&file, header, headerSize) == headerSize;
+	std::vector<u8> row(image.width * 3);
+	for (u32 y = 0; result && y < image.height; ++y) {
+		const Pixel *sourceRow = image.pixels + (y * image.width);
+		for (u32 x = 0; x < image.width; ++x) {
+			row[x * 3 + 0] = sourceRow[x].r;
+			row[x * 3 + 1] = sourceRow[x].g;
+			row[x * 3 + 2] = sourceRow[x].b;
+		}
+		result = fplWriteFileBlock(&file, &row[0], row.size()) == row.size();
+	}
+	fplCloseFile(&file);
+	return(result);
+}
+
+struct HeadlessParameters {
+	const char *outputPath;
+	u64 seed;
+	u32 width;
+	u32 height;
+	u32 raysPerPixelCount;
+	u32 passCount;
+	u32 maxBounceCount;
+	u32 threadCount;
+	u32 sphereCount;
+	b32 useBVH;
+	b32 usePackets;
+	b32 measureScaling;
+};
+
+// Parses a decimal number, returns false for empty, non-numeric or too large values
+static bool ParseNumber(const char *p, u32 &out) {
+	if (!isdigit(*p)) {
+		return(false);
+	}
+	u64 v = 0;
+	while (isdigit(*p)) {
+		v = v * 10 + (u8)(*p - '0');
+		if (v > UINT32_MAX) {
+			return(false);
+		}
+		++p;
+	}
+	if (*p != 0) {
+		return(false);
+	}
+	out = (u32)v;
+	return(true);
+}
+
+static void PrintUsage() {
+	fplConsoleError("Usage: fpl_raytracer [sphere count] [-headless] [-w=640] [-h=360] [-spp=32] [-passes=1] [-bounces=4] [-threads=N] [-seed=1337] [-out=raytracer.ppm] [-nobvh] [-nopackets] [-noscaling]\n");
+	fplConsoleError("Width, height, samples per pixel and passes must be greater than zero.\n");
+}
+
+enum class ParseResult {
+	Windowed,
+	Headless,
+	Invalid,
+};
+
+// Parses -name=value parameters, prints the usage and returns ParseResult::Invalid for bad values
+static ParseResult ParseParameters(HeadlessParameters &params, u32 &sphereCount, const int argc, char **argv) {
+	bool isHeadless = false;
+	for (int i = 1; i < argc; ++i) {
+		const char *p = argv[i];
+		bool isValid = true;
+		if (p[0] != '-') {
+			isValid = ParseNumber(p, sphereCount);
+		} else {
+			++p;
+			const char *value = strchr(p, '=');
+			value = value != fpl_null ? value + 1 : "";
+			if (fplIsStringEqual(p, "headless")) {
+				isHeadless = true;
+			} else if (strncmp(p, "w=", 2) == 0) {
+				isValid = ParseNumber(value, params.width) && params.width > 0;
+			} else if (strncmp(p, "h=", 2) == 0) {
+				isValid = ParseNumber(value, params.height) && params.height > 0;
+			} else if (strncmp(p, "spp=", 4) == 0) {
+				isValid = ParseNumber(value, params.raysPerPixelCount) && params.raysPerPixelCount > 0;
+			} else if (strncmp(p, "passes=", 7) == 0) {
+				isValid = ParseNumber(value, params.passCount) && params.passCount > 0;
+			} else if (strncmp(p, "bounces=", 8) == 0) {
+				isValid = ParseNumber(value, params.maxBounceCount);
+			} else if (strncmp(p, "threads=", 8) == 0) {
+				isValid = ParseNumber(value, params.threadCount);
+			} else if (strncmp(p, "seed=", 5) == 0) {
+				u32 seed;
+				isValid = ParseNumber(value, seed);
+				params.seed = seed;
+			} else if (strncmp(p, "out=", 4) == 0) {
+				params.outputPath = value;
+			} else if (fplIsStringEqual(p, "nobvh")) {
+				params.useBVH = false;
+			} else if (fplIsStringEqual(p, "nopackets")) {
+				params.usePackets = false;
+			} else if (fplIsStringEqual(p, "noscaling")) {
+				params.measureScaling = false;
+			} else {
+				isValid = false;
+			}
+		}
+		if (!isValid) {
+			fplConsoleFormatError("Invalid parameter '%s'!\n", argv[i]);
+			PrintUsage();
+			return(ParseResult::Invalid);
+		}
+	}
+	params.sphereCount = sphereCount;
+	return(isHeadless ? ParseResult::Headless : ParseResult::Windowed);
+}
+
+// Renders the scene without a window for 1 to N threads and prints rays/s, per-thread utilization and scaling efficiency
+static int RunHeadless(const HeadlessParameters &params) {
+	if (!fplPlatformInit(fplInitFlags_None, fpl_null)) {
+		return -1;
+	}
+
+	TilingInfo tilingInfo;
+	InitTilingInfo(tilingInfo, params.width, params.height, 64);
+
+	// @NOTE(final): We use the STL to make our life easier, so we need to placement-new-initialize our App structure
+	App app = {};
+	new(&app)App();
+	LoadScene(app.scene, params.sphereCount);
+	InitRaytracer(app.raytracer, params.width, params.height);
+	app.raytracer.settings.seed = params.seed;
+	app.raytracer.settings.raysPerPixelCount = params.raysPerPixelCount;
+	app.raytracer.settings.maxBounceCount = params.maxBounceCount;
+	app.raytracer.settings.useBVH = params.useBVH;
+#if defined(FMATH_SIMD)
+	app.raytracer.settings.usePackets = params.usePackets;
+#endif
+
+	fplConsoleFormatOut("Headless render %u x %u, %u rays per pixel in %u passes, %u bounces, seed %llu, BVH %s, packets %s\n", params.width, params.height, params.raysPerPixelCount, params.passCount, params.maxBounceCount, (unsigned long long)params.seed, app.raytracer.settings.useBVH ? "on" : "off", app.raytracer.settings.usePackets ? "on" : "off");
+
+	u32 maxThreadCount = fplMax(params.threadCount, 1u);
+	u32 threadCount = params.measureScaling ? 1 : maxThreadCount;
+	f64 singleThreadTime = 0.0;
+	u64 firstHash = 0;
+	bool result = true;
+	while (true) {
+		WorkQueue queue;
+		Worker *workers = StartWorkers(queue, tilingInfo, threadCount);
+
+		app.raytracer.image.Fill(MakePixelFromRGBA(0, 0, 0, 255));
+
+		// The worker stats are cleared for every pass, so the totals and busy times are summed up here
+		WorkerStats total = {};
+		std::vector<f64> busyTimes(threadCount, 0.0);
+		f64 startTime = fplGetTimeInMillisecondsHP();
+		for (u32 passIndex = 0; passIndex < params.passCount; ++passIndex) {
+			app.raytracer.passIndex = passIndex;
+			BeginFrame(app, queue, workers, threadCount, tilingInfo);
+			while (!queue.IsFinished()) {
+				fplThreadSleep(1);
+			}
+			WorkerStats passTotal = SumWorkerStats(workers, threadCount);
+			total.rayCount += passTotal.rayCount;
+			total.busyTime += passTotal.busyTime;
+			total.tileCount += passTotal.tileCount;
+			total.stolenTileCount += passTotal.stolenTileCount;
+			total.splitTileCount += passTotal.splitTileCount;
+			for (u32 workerIndex = 0; workerIndex < threadCount; ++workerIndex) {
+				busyTimes[workerIndex] += workers[workerIndex].stats.busyTime;
+			}
+		}
+		f64 frameTime = fplGetTimeInMillisecondsHP() - startTime;
+
+		if (threadCount == 1) {
+			singleThreadTime = frameTime;
+		}
+		f64 raysPerSecond = frameTime > 0.0 ? (f64)total.rayCount / (frameTime / 1000.0) : 0.0;
+		u64 hash = HashImage(app.raytracer.image);
+		if (firstHash == 0) {
+			firstHash = hash;
+		}
+		fplConsoleFormatOut("%2u threads: %9.2f ms, %8.3f MRays/s, %u tiles (%u stolen, %u split), image hash %016llx%s\n", threadCount, frameTime, raysPerSecond / 1000000.0, total.tileCount, total.stolenTileCount, total.splitTileCount, (unsigned long long)hash, hash != firstHash ? " (differs!)" : "");
+		if (singleThreadTime > 0.0) {
+			f64 speedup = singleThreadTime / frameTime;
+			fplConsoleFormatOut("            speedup %.2fx, scaling efficiency %.1f%%\n", speedup, speedup / (f64)threadCount * 100.0);
+		}
+		fplConsoleFormatOut("            utilization:");
+		for (u32 workerIndex = 0; workerIndex < threadCount; ++workerIndex) {
+			f64 utilization = frameTime > 0.0 ? busyTimes[workerIndex] / frameTime : 0.0;
+			fplConsoleFormatOut(" %.0f%%", utilization * 100.0);
+		}
+		fplConsoleFormatOut("\n");
+
+		StopWorkers(queue, workers, threadCount);
+
+		if (hash != firstHash) {
+			result = false;
+		}
+		if (threadCount == maxThreadCount) {
+			break;
+		}
+		threadCount = fplMin(threadCount * 2, maxThreadCount);
+	}
+
+	if (params.outputPath != fpl_null && fplGetStringLength(params.outputPath) > 0) {
+		if (WriteImagePPM(app.raytracer.image, params.outputPath)) {
+			fplConsoleFormatOut("Written image to '%s'\n", params.outputPath);
+		} else {
+			fplConsoleFormatError("Failed writing image to '%s'!\n", params.outputPath);
+			result = false;
+		}
+	}
+
+	ReleaseApp(app);
+
+	fplPlatformRelease();
+	return(result ? 0 : -1);
+}
+
 int main(int argc, char **argv) {
-	RandomSeries rnd = {};
+	// Selectable scenes: Default scene, followed by random sphere scenes
+	const u32 sceneSphereCounts[] = { 0, 256, 1024, 4096, 16384 };
+
+	HeadlessParameters headlessParams = {};
+	headlessParams.outputPath = "raytracer.ppm";
+	headlessParams.seed = 1337;
+	headlessParams.width = 640;
+	headlessParams.height = 360;
+	headlessParams.raysPerPixelCount = 32;
+	headlessParams.passCount = 1;
+	headlessParams.maxBounceCount = 4;
+	headlessParams.threadCount = (u32)fplGetProcessorCoreCount();
+	headlessParams.useBVH = true;
+	headlessParams.usePackets = true;
+	headlessParams.measureScaling = true;
+
+	u32 sphereCount = 0;
+	ParseResult parseResult = ParseParameters(headlessParams, sphereCount, argc, argv);
+	if (parseResult == ParseResult::Invalid) {
+		return -1;
+	} else if (parseResult == ParseResult::Headless) {
+		return RunHeadless(headlessParams);
+	}
 
 	const u32 renderWidth = 1280;
 	const u32 renderHeight = 720;
@@ -909,47 +2330,44 @@ int main(int argc, char **argv) {
 		fplResizeVideoBackBuffer(renderWidth, renderHeight);
 
 		// Init worker parameters
-		TilingInfo tilingInfo = {};
-		tilingInfo.imageW = raytraceWidth;
-		tilingInfo.imageH = raytraceHeight;
-		tilingInfo.tileSizeX = tilingInfo.tileSizeY = 64;
-		tilingInfo.tileCountX = (raytraceWidth / tilingInfo.tileSizeX) + 1;
-		tilingInfo.tileCountY = (raytraceHeight / tilingInfo.tileSizeY) + 1;
+		TilingInfo tilingInfo;
+		InitTilingInfo(tilingInfo, raytraceWidth, raytraceHeight, 64);
 
 		// @NOTE(final): We use the STL to make our life easier, so we need to placement-new-initialize our App structure
 		App app = {};
 		new(&app)App();
-		InitApp(app, raytraceWidth, raytraceHeight);
-
-		// Queue
-		u32 maxTileCount = tilingInfo.tileCountX * tilingInfo.tileCountY;
-		WorkQueue queue = {};
-		queue.Init(maxTileCount);
+		InitApp(app, raytraceWidth, raytraceHeight, sphereCount);
 
 		// Init worker
 		u32 cpuCoreCount = (u32)fplGetProcessorCoreCount();
 		fplAssert(cpuCoreCount > 0);
-		u32 workerCount = (u32)cpuCoreCount - 1;
-		Worker *workers = new Worker[workerCount];
-		for (u32 workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
-			Worker *worker = workers + workerIndex;
-			fplClearStruct(worker);
-			fplMutexInit(&worker->lockMutex);
-			fplConditionInit(&worker->nonEmptyCondition);
-			worker->queue = &queue;
-			worker->thread = fplThreadCreate(WorkerThreadProc, worker);
-		}
+		u32 workerCount = fplMax(cpuCoreCount - 1, 1u);
+		WorkQueue queue;
+		Worker *workers = StartWorkers(queue, tilingInfo, workerCount);
 
 		bool refresh = true;
+		bool isFrameTimed = false;
+		f64 frameStartTime = 0.0;
+		u32 nextSphereCount = sphereCount;
 		while (fplWindowUpdate()) {
 			fplEvent ev;
 			while (fplPollEvent(&ev)) {
 				switch (ev.type) {
 					case fplEventType::fplEventType_Keyboard:
 					{
-						if (ev.keyboard.type == fplKeyboardEventType_Button) {
-							if (ev.keyboard.buttonState == fplButtonState_Release &&
-								ev.keyboard.mappedKey == fplKey_Space) {
+						if (ev.keyboard.type == fplKeyboardEventType_Button && ev.keyboard.buttonState == fplButtonState_Release) {
+							if (ev.keyboard.mappedKey == fplKey_Space) {
+								refresh = true;
+							} else if (ev.keyboard.mappedKey == fplKey_B) {
+								app.raytracer.settings.useBVH = !app.raytracer.settings.useBVH;
+								refresh = true;
+							} else if (ev.keyboard.mappedKey == fplKey_P) {
+#if defined(FMATH_SIMD)
+								app.raytracer.settings.usePackets = !app.raytracer.settings.usePackets;
+								refresh = true;
+#endif
+							} else if (ev.keyboard.mappedKey >= fplKey_1 && ev.keyboard.mappedKey < (fplKey_1 + fplArrayCount(sceneSphereCounts))) {
+								nextSphereCount = sceneSphereCounts[ev.keyboard.mappedKey - fplKey_1];
 								refresh = true;
 							}
 						}
@@ -957,15 +2375,26 @@ int main(int argc, char **argv) {
 				}
 			}
 
+			if (isFrameTimed && queue.IsFinished()) {
+				isFrameTimed = false;
+				f64 frameTime = fplGetTimeInMillisecondsHP() - frameStartTime;
+				WorkerStats total = SumWorkerStats(workers, workerCount);
+				f64 raysPerSecond = frameTime > 0.0 ? (f64)total.rayCount / (frameTime / 1000.0) : 0.0;
+				fplConsoleFormatOut("Rendered %zu objects with BVH %s, packets %s in %.2f ms, %llu rays, %.3f MRays/s, %u tiles (%u stolen, %u split)\n", app.scene.objects.size(), app.raytracer.settings.useBVH ? "on" : "off", app.raytracer.settings.usePackets ? "on" : "off", frameTime, (unsigned long long)total.rayCount, raysPerSecond / 1000000.0, total.tileCount, total.stolenTileCount, total.splitTileCount);
+			}
+
 			if (refresh) {
 				refresh = false;
 				if (queue.IsEmpty() || queue.IsFinished()) {
-					FillQueue(app, queue, tilingInfo);
-
-					for (u32 workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
-						Worker *worker = workers + workerIndex;
-						fplConditionSignal(&worker->nonEmptyCondition);
+					if (nextSphereCount != sphereCount) {
+						sphereCount = nextSphereCount;
+						LoadScene(app.scene, sphereCount);
 					}
+
+					frameStartTime = fplGetTimeInMillisecondsHP();
+					isFrameTimed = true;
+
+					BeginFrame(app, queue, workers, workerCount, tilingInfo);
 				}
 			}
 
@@ -974,31 +2403,7 @@ int main(int argc, char **argv) {
 			fplVideoFlip();
 		}
 
-		// Send stop signal to all workers
-		for (u32 workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
-			Worker *worker = workers + workerIndex;
-			fplAtomicStoreS32((volatile s32 *)&worker->state, (s32)WorkerState::Stopped);
-			fplConditionSignal(&worker->nonEmptyCondition);
-		}
-
-		// Wait for all threads to finish
-		fplThreadWaitForAll(&workers[0].thread, workerCount, sizeof(Worker), FPL_TIMEOUT_INFINITE);
-
-		// Terminate unfinished threads
-		for (u32 workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
-			Worker *worker = workers + workerIndex;
-			fplThreadTerminate(worker->thread);
-		}
-
-		// Release worker resources
-		for (u32 workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
-			Worker *worker = workers + workerIndex;
-			fplConditionDestroy(&worker->nonEmptyCondition);
-			fplMutexDestroy(&worker->lockMutex);
-		}
-		delete[] workers;
-
-		queue.Release();
+		StopWorkers(queue, workers, workerCount);
 
 		ReleaseApp(app);
 
@@ -1008,4 +2413,5 @@ int main(int argc, char **argv) {
 		fplPlatformRelease();
 		return 0;
 	}
-}
\ No newline at end of file
+	return -1;
+}
@@ -7,6 +7,7 @@ Description:
 	A tower defence clone.
 	Levels are loaded from .TMX files (Tiled-Editor).
 	All data (Waves, Enemies, Towers) are loaded from xml files.
+	Both can be cooked into binary files, which are loaded without any parsing.
 	Written in C++ (C-Style).
 
 Requirements:
@@ -14,10 +15,47 @@ Requirements:
 	- Final XML
 	- Final Framework
 
+Usage:
+	FPL_Towadev [-cook] [-flowfield] [-gamethread] [-headless] [-scale <creep multiplier>] [-towers <max tower count>]
+	            [-record <file>] [-replay <file>] [-nowindow] [-frames <count>] [-unlimited]
+
+	-cook: Converts the definitions and all levels used by the waves into binary files next to the sources, then exits.
+	The game loads a cooked file instead of its sources, as long as the sources have not been changed after cooking.
+
+	-flowfield: Creeps walk the shortest path to the goal, which towers can change but never block.
+
+	-gamethread: Updates the game on a separate thread, while the previous frame is rendered.
+
+	-headless: Benchmarks the simulation only: Runs all waves with a scripted tower layout at maximum speed,
+	without the game loop, rendering and input, then prints ticks/s, entity counts and a state checksum for each wave.
+	-scale: Multiplies the creep count of every spawner and divides its cooldown (Limited by the creep capacity).
+	-towers: Limits the number of towers placed along the way.
+
+	-record: Records the input of the played session into the given file.
+	-replay: Replays the session recorded in the given file, then prints frame time percentiles and verifies the state checksums.
+	-nowindow: Runs the full game loop (input, update and render commands) of the game or the replay without a window,
+	but neither executes the render commands nor outputs audio, then prints a summary. Unlike -headless, nothing is played by a script.
+	-frames: Exits after the given number of frames, when running without a window (Default: 600, a replay runs until its end).
+	-unlimited: Replays or runs without a window as fast as possible.
+
 Author:
 	Torsten Spaete
 
 Changelog:
+	## 2026-10-18
+	- Cook step (-cook) for levels and definitions into binary files, which are memory mapped on load
+	- Falls back to the .TMX/XML sources, when the cooked files are missing or outdated
+	- Headless benchmark mode (-headless)
+	- Towers do not fire when the bullet capacity is reached
+	- Flow field pathing mode (-flowfield), updated incrementally when towers are placed or removed
+	- Remove towers with the right mouse button (Half of the costs are refunded)
+	- Uniform creep grid (one cell per tile), rebuilt every tick
+	- Tower target detection and bullet collision only test creeps in nearby cells
+	- Towers with any-target lock mode only test the fire range when the gun is ready
+	- Optional game thread (-gamethread)
+	- Input recording and replay (-record, -replay, -nowindow, -unlimited)
+	- Runs without a window for a number of frames (-nowindow, -frames)
+
 	## 2019-04-27
 	- Use Vec2Normalize instead of dividing by length
 
@@ -143,6 +181,10 @@ License:
 #include <stdlib.h>
 #include <stdarg.h>
 
+#if defined(FPL_SUBPLATFORM_POSIX)
+#	include <sys/mman.h>
+#endif
+
 #define FMEM_IMPLEMENTATION
 #include <final_memory.h>
 
@@ -161,6 +203,9 @@ License:
 
 constexpr float ShotAngleTolerance = (Pi32 * 0.05f);
 
+// @NOTE(final): Set from the command line before the game is initialized
+static PathingMode globalStartupPathingMode = PathingMode::Waypoints;
+
 namespace gamelog {
 	enum class LogLevel {
 		Fatal = 0,
@@ -223,6 +268,9 @@ namespace level {
 	static Vec2i FindTilePosByEntityType(const Level &level, const EntityType type);
 	static void LoadWave(GameState &state, const int waveIndex);
 }
+namespace creeps {
+	static void SetCreepNextTarget(GameState &state, Creep &enemy);
+}
 namespace game {
 	static void NewGame(GameState &state);
 	static void SetSlowdown(GameState &state, const float duration, const WaveState nextState);
@@ -417,6 +465,64 @@ namespace utils {
 		bool result = (a.size == b.size) && (a.modifyDate == b.modifyDate);
 		return(result);
 	}
+
+	static bool WriteEntireFile(const char *filePath, void *data, const size_t size) {
+		bool result = false;
+		fplFileHandle file;
+		if (fplCreateBinaryFile(filePath, &file)) {
+			result = fplWriteFileBlock(&file, data, size) == size;
+			fplCloseFile(&file);
+		}
+		return(result);
+	}
+
+	static bool MapEntireFile(const char *filePath, MappedFile *outFile) {
+		*outFile = {};
+		fplFileHandle file;
+		if (!fplOpenBinaryFile(filePath, &file)) {
+			return(false);
+		}
+		bool result = false;
+		size_t fileSize = fplGetFileSizeFromHandle32(&file);
+		if (fileSize > 0) {
+#if defined(FPL_PLATFORM_WINDOWS)
+			HANDLE mappingHandle = CreateFileMappingW(file.internalHandle.win32FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (mappingHandle != nullptr) {
+				void *data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+				if (data != nullptr) {
+					outFile->data = (const uint8_t *)data;
+					outFile->size = fileSize;
+					outFile->mappingHandle = mappingHandle;
+					result = true;
+				} else {
+					CloseHandle(mappingHandle);
+				}
+			}
+#elif defined(FPL_SUBPLATFORM_POSIX)
+			void *data = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, file.internalHandle.posixFileHandle, 0);
+			if (data != MAP_FAILED) {
+				outFile->data = (const uint8_t *)data;
+				outFile->size = fileSize;
+				result = true;
+			}
+#endif
+		}
+		// @NOTE(final): The mapping stays valid after the file is closed
+		fplCloseFile(&file);
+		return(result);
+	}
+
+	static void UnmapEntireFile(MappedFile *file) {
+		if (file->data != nullptr) {
+#if defined(FPL_PLATFORM_WINDOWS)
+			UnmapViewOfFile(file->data);
+			CloseHandle(file->mappingHandle);
+#elif defined(FPL_SUBPLATFORM_POSIX)
+			munmap((void *)file->data, file->size);
+#endif
+		}
+		*file = {};
+	}
 }
 
 namespace render {
@@ -500,6 +606,225 @@ namespace render {
 	}
 }
 
+namespace flowfield {
+	static const Vec2i NeighborOffsets[4] = { V2iInit(1, 0), V2iInit(-1, 0), V2iInit(0, 1), V2iInit(0, -1) };
+
+	inline Vec2i GetNeighborPos(const Vec2i &tilePos, const size_t neighborIndex) {
+		const Vec2i &offset = NeighborOffsets[neighborIndex];
+		Vec2i result = V2iInit(tilePos.x + offset.x, tilePos.y + offset.y);
+		return(result);
+	}
+
+	inline int32_t GetTileIndex(const LevelDimension &dim, const Vec2i &tilePos) {
+		int32_t result = tilePos.y * (int32_t)dim.tileCountX + tilePos.x;
+		return(result);
+	}
+
+	inline Vec2i GetTilePos(const LevelDimension &dim, const int32_t tileIndex) {
+		Vec2i result = V2iInit(tileIndex % (int32_t)dim.tileCountX, tileIndex / (int32_t)dim.tileCountX);
+		return(result);
+	}
+
+	inline int32_t GetDistance(const Level &level, const Vec2i &tilePos) {
+		if (level.flowField.distances == nullptr || !IsValidTile(level.dimension, tilePos)) {
+			return FlowFieldUnreachable;
+		}
+		return level.flowField.distances[GetTileIndex(level.dimension, tilePos)];
+	}
+
+	static void PropagateDistances(Level &level, const int32_t seedCount) {
+		// Dijkstra with unit costs: The seeds are sorted by distance and the queue grows in ascending order as well,
+		// so always taking the smaller head of both visits every tile in the right order
+		FlowField &field = level.flowField;
+		const LevelDimension &dim = level.dimension;
+		int32_t seedIndex = 0;
+		int32_t head = 0;
+		int32_t tail = 0;
+		while (seedIndex < seedCount || head < tail) {
+			int32_t current;
+			if (head < tail && (seedIndex == seedCount || field.distances[field.queue[head]] <= field.distances[field.seeds[seedIndex]])) {
+				current = field.queue[head++];
+			} else {
+				current = field.seeds[seedIndex++];
+			}
+			Vec2i currentPos = GetTilePos(dim, current);
+			int32_t nextDistance = field.distances[current] + 1;
+			for (size_t i = 0; i < fplArrayCount(NeighborOffsets); ++i) {
+				Vec2i neighborPos = GetNeighborPos(currentPos, i);
+				if (IsValidTile(dim, neighborPos)) {
+					int32_t neighbor = GetTileIndex(dim, neighborPos);
+					if (!level.tiles[neighbor].isOccupied && nextDistance < field.distances[neighbor]) {
+						assert(tail < field.tileCount);
+						field.distances[neighbor] = nextDistance;
+						field.queue[tail++] = neighbor;
+					}
+				}
+			}
+		}
+	}
+
+	static void BuildFlowField(Level &level, const Vec2i &goalTilePos) {
+		FlowField &field = level.flowField;
+		field.goalTilePos = goalTilePos;
+		for (int32_t tileIndex = 0; tileIndex < field.tileCount; ++tileIndex) {
+			field.distances[tileIndex] = FlowFieldUnreachable;
+		}
+		if (IsValidTile(level.dimension, goalTilePos)) {
+			int32_t goalIndex = GetTileIndex(level.dimension, goalTilePos);
+			field.distances[goalIndex] = 0;
+			field.seeds[0] = goalIndex;
+			PropagateDistances(level, 1);
+		}
+	}
+
+	static void BlockTile(Level &level, const Vec2i &tilePos) {
+		// Only tiles which reached the goal through the blocked tile get new distances:
+		// Walk down from the blocked tile and invalidate every tile which has no other neighbor one step closer to the goal,
+		// then propagate again from the valid tiles around the invalidated ones.
+		FlowField &field = level.flowField;
+		const LevelDimension &dim = level.dimension;
+		constexpr uint8_t MarkQueued = 1;
+		constexpr uint8_t MarkInvalid = 2;
+		constexpr uint8_t MarkSeed = 3;
+		int32_t blockedIndex = GetTileIndex(dim, tilePos);
+		if (field.distances[blockedIndex] == FlowFieldUnreachable) {
+			return;
+		}
+		fplMemoryClear(field.marks, field.tileCount);
+		int32_t head = 0;
+		int32_t tail = 0;
+		field.queue[tail++] = blockedIndex;
+		field.marks[blockedIndex] = MarkQueued;
+		while (head < tail) {
+			// @NOTE(final): The queue is ascending by distance, so all neighbors one step closer to the goal are already decided
+			int32_t current = field.queue[head++];
+			int32_t oldDistance = field.distances[current];
+			Vec2i currentPos = GetTilePos(dim, current);
+			bool isSupported = false;
+			if (current != blockedIndex) {
+				for (size_t i = 0; i < fplArrayCount(NeighborOffsets); ++i) {
+					Vec2i neighborPos = GetNeighborPos(currentPos, i);
+					if (IsValidTile(dim, neighborPos)) {
+						int32_t neighbor = GetTileIndex(dim, neighborPos);
+						if (field.marks[neighbor] != MarkInvalid && field.distances[neighbor] == oldDistance - 1) {
+							isSupported = true;
+							break;
+						}
+					}
+				}
+			}
+			if (!isSupported) {
+				field.distances[current] = FlowFieldUnreachable;
+				field.marks[current] = MarkInvalid;
+				for (size_t i = 0; i < fplArrayCount(NeighborOffsets); ++i) {
+					Vec2i neighborPos = GetNeighborPos(currentPos, i);
+					if (IsValidTile(dim, neighborPos)) {
+						int32_t neighbor = GetTileIndex(dim, neighborPos);
+						if (field.marks[neighbor] == 0 && field.distances[neighbor] == oldDistance + 1) {
+							field.marks[neighbor] = MarkQueued;
+							field.queue[tail++] = neighbor;
+						}
+					}
+				}
+			}
+		}
+
+		// Seeds are all valid tiles next to an invalidated one, sorted by distance
+		int32_t seedCount = 0;
+		for (int32_t queueIndex = 0; queueIndex < tail; ++queueIndex) {
+			int32_t current = field.queue[queueIndex];
+			if (field.marks[current] != MarkInvalid) {
+				continue;
+			}
+			Vec2i currentPos = GetTilePos(dim, current);
+			for (size_t i = 0; i < fplArrayCount(NeighborOffsets); ++i) {
+				Vec2i neighborPos = GetNeighborPos(currentPos, i);
+				if (IsValidTile(dim, neighborPos)) {
+					int32_t neighbor = GetTileIndex(dim, neighborPos);
+					if (field.marks[neighbor] != MarkInvalid && field.marks[neighbor] != MarkSeed && field.distances[neighbor] != FlowFieldUnreachable) {
+						field.marks[neighbor] = MarkSeed;
+						int32_t seedPos = seedCount++;
+						while (seedPos > 0 && field.distances[field.seeds[seedPos - 1]] > field.distances[neighbor]) {
+							field.seeds[seedPos] = field.seeds[seedPos - 1];
+							--seedPos;
+						}
+						field.seeds[seedPos] = neighbor;
+					}
+				}
+			}
+		}
+		PropagateDistances(level, seedCount);
+	}
+
+	static void UnblockTile(Level &level, const Vec2i &tilePos) {
+		// Distances can only get shorter, so they are relaxed outwards from the freed tile
+		FlowField &field = level.flowField;
+		const LevelDimension &dim = level.dimension;
+		int32_t freedIndex = GetTileIndex(dim, tilePos);
+		int32_t bestDistance = FlowFieldUnreachable;
+		for (size_t i = 0; i < fplArrayCount(NeighborOffsets); ++i) {
+			int32_t neighborDistance = GetDistance(level, GetNeighborPos(tilePos, i));
+			if (neighborDistance != FlowFieldUnreachable) {
+				bestDistance = fplMin(bestDistance, neighborDistance + 1);
+			}
+		}
+		field.distances[freedIndex] = bestDistance;
+		if (bestDistance != FlowFieldUnreachable) {
+			field.seeds[0] = freedIndex;
+			PropagateDistances(level, 1);
+		}
+	}
+
+	static void MarkReachableTiles(Level &level, const Vec2i &blockedTilePos) {
+		// Flood fill from the goal as if the given tile were blocked, reachable tiles are marked with 1
+		FlowField &field = level.flowField;
+		const LevelDimension &dim = level.dimension;
+		fplMemoryClear(field.marks, field.tileCount);
+		if (!IsValidTile(dim, field.goalTilePos) || V2iEquals(field.goalTilePos, blockedTilePos)) {
+			return;
+		}
+		int32_t head = 0;
+		int32_t tail = 0;
+		int32_t goalIndex = GetTileIndex(dim, field.goalTilePos);
+		field.queue[tail++] = goalIndex;
+		field.marks[goalIndex] = 1;
+		while (head < tail) {
+			Vec2i currentPos = GetTilePos(dim, field.queue[head++]);
+			for (size_t i = 0; i < fplArrayCount(NeighborOffsets); ++i) {
+				Vec2i neighborPos = GetNeighborPos(currentPos, i);
+				if (IsValidTile(dim, neighborPos) && !V2iEquals(neighborPos, blockedTilePos)) {
+					int32_t neighbor = GetTileIndex(dim, neighborPos);
+					if (field.marks[neighbor] == 0 && !level.tiles[neighbor].isOccupied) {
+						field.marks[neighbor] = 1;
+						field.queue[tail++] = neighbor;
+					}
+				}
+			}
+		}
+	}
+
+	inline bool IsTileMarked(const Level &level, const Vec2i &tilePos) {
+		bool result = IsValidTile(level.dimension, tilePos) && (level.flowField.marks[GetTileIndex(level.dimension, tilePos)] != 0);
+		return(result);
+	}
+
+	static bool GetNextTile(const Level &level, const Vec2i &tilePos, Vec2i &outTilePos) {
+		// Steepest descent, on equal distance the first neighbor wins
+		int32_t bestDistance = GetDistance(level, tilePos);
+		bool result = false;
+		for (size_t i = 0; i < fplArrayCount(NeighborOffsets); ++i) {
+			Vec2i neighborPos = GetNeighborPos(tilePos, i);
+			int32_t neighborDistance = GetDistance(level, neighborPos);
+			if (neighborDistance < bestDistance) {
+				bestDistance = neighborDistance;
+				outTilePos = neighborPos;
+				result = true;
+			}
+		}
+		return(result);
+	}
+}
+
 namespace creeps {
 	static void SpawnEnemy(Creeps &enemies, const LevelDimension &dim, const Waypoints &waypoints, const Vec2f &spawnPos, const Vec2f &exitPos, const CreepData *data) {
 		assert(enemies.count < fplArrayCount(enemies.list));
@@ -530,6 +855,9 @@ namespace creeps {
 			}
 			if (spawner.spawnTimer <= 0) {
 				SpawnEnemy(state.enemies, state.level.dimension, state.waypoints, spawner.spawnPosition, spawner.exitPosition, spawner.spawnTemplate);
+				if (state.pathingMode == PathingMode::FlowField) {
+					SetCreepNextTarget(state, state.enemies.list[state.enemies.count - 1]);
+				}
 				--spawner.remainingCount;
 				if (spawner.remainingCount == 0) {
 					spawner.spawnTimer = 0;
@@ -579,6 +907,21 @@ namespace creeps {
 		Vec2i goalTilePos = level::FindTilePosByEntityType(state.level, EntityType::Goal);
 		assert(goalTilePos.x > -1 && goalTilePos.y > -1);
 		Vec2i creepTilePos = WorldToTile(dim, enemy.position);
+		if (state.pathingMode == PathingMode::FlowField) {
+			Vec2i nextTilePos;
+			if (V2iEquals(creepTilePos, goalTilePos)) {
+				enemy.hasTarget = false;
+				CreepReachedExit(state, enemy);
+			} else if (flowfield::GetNextTile(state.level, creepTilePos, nextTilePos)) {
+				enemy.targetPos = TileToWorld(dim, nextTilePos, TileExt);
+				enemy.facingDirection = V2fNormalize(enemy.targetPos - enemy.position);
+				enemy.hasTarget = true;
+			} else {
+				// @NOTE(final): Enclosed, wait until a tower is removed
+				enemy.hasTarget = false;
+			}
+			return;
+		}
 		if (enemy.targetWaypoint != nullptr) {
 			const Waypoint waypoint = *enemy.targetWaypoint;
 			assert(V2fLength(waypoint.direction) == 1);
@@ -599,6 +942,28 @@ namespace creeps {
 		}
 	}
 
+	static void UpdateCreepTargets(GameState &state) {
+		// Only creeps whose target tile is blocked or no longer leads to the goal are redirected
+		assert(state.pathingMode == PathingMode::FlowField);
+		const LevelDimension &dim = state.level.dimension;
+		for (size_t enemyIndex = 0; enemyIndex < state.enemies.count; ++enemyIndex) {
+			Creep &enemy = state.enemies.list[enemyIndex];
+			if (enemy.isDead) {
+				continue;
+			}
+			Vec2i creepTilePos = WorldToTile(dim, enemy.position);
+			Vec2i targetTilePos = WorldToTile(dim, enemy.targetPos);
+			int32_t targetDistance = flowfield::GetDistance(state.level, targetTilePos);
+			bool needsNewTarget = !enemy.hasTarget || (targetDistance == FlowFieldUnreachable);
+			if (!needsNewTarget && !V2iEquals(creepTilePos, targetTilePos)) {
+				needsNewTarget = targetDistance >= flowfield::GetDistance(state.level, creepTilePos);
+			}
+			if (needsNewTarget) {
+				SetCreepNextTarget(state, enemy);
+			}
+		}
+	}
+
 	static const CreepData *FindEnemyById(GameState &state, const char *id) {
 		for (size_t i = 0; i < state.assets.creepDefinitionCount; ++i) {
 			if (strcmp(state.assets.creepDefinitions[i].id, id) == 0) {
@@ -626,6 +991,94 @@ namespace creeps {
 			game::SetSlowdown(state, 6.0f, WaveState::Won);
 		}
 	}
+
+	static void RebuildCreepGrid(CreepGrid &grid, const Creeps &enemies) {
+		// Counting sort of all living creeps by cell, this keeps the creep indices ascending in each cell
+		fplClearStruct(&grid);
+		for (size_t enemyIndex = 0; enemyIndex < enemies.count; ++enemyIndex) {
+			const Creep &enemy = enemies.list[enemyIndex];
+			if (!enemy.isDead) {
+				Vec2i cell = WorldToCreepCell(enemy.position);
+				grid.cellStart[cell.y * CreepGridCountX + cell.x + 1]++;
+				grid.maxCollisionRadius = fplMax(grid.maxCollisionRadius, enemy.data->collisionRadius);
+			}
+		}
+		uint16_t cellCursor[CreepGridCellCount];
+		for (int cellIndex = 0; cellIndex < CreepGridCellCount; ++cellIndex) {
+			grid.cellStart[cellIndex + 1] += grid.cellStart[cellIndex];
+			cellCursor[cellIndex] = grid.cellStart[cellIndex];
+		}
+		for (size_t enemyIndex = 0; enemyIndex < enemies.count; ++enemyIndex) {
+			const Creep &enemy = enemies.list[enemyIndex];
+			if (!enemy.isDead) {
+				Vec2i cell = WorldToCreepCell(enemy.position);
+				grid.creepIndices[cellCursor[cell.y * CreepGridCountX + cell.x]++] = (uint16_t)enemyIndex;
+			}
+		}
+	}
+
+	static Creep *FindNearestCreep(Creeps &enemies, const CreepGrid &grid, const Vec2f &position, const float maxDistance) {
+		// Same result as testing all creeps: The nearest one, on equal distance the lowest index
+		float radius = maxDistance + CreepGridQueryPadding;
+		Vec2i minCell = WorldToCreepCell(position - V2fInit(radius, radius));
+		Vec2i maxCell = WorldToCreepCell(position + V2fInit(radius, radius));
+		Creep *result = nullptr;
+		size_t resultIndex = 0;
+		float bestDistance = FLT_MAX;
+		for (int cellY = minCell.y; cellY <= maxCell.y; ++cellY) {
+			for (int cellX = minCell.x; cellX <= maxCell.x; ++cellX) {
+				int cellIndex = cellY * CreepGridCountX + cellX;
+				for (uint16_t i = grid.cellStart[cellIndex]; i < grid.cellStart[cellIndex + 1]; ++i) {
+					size_t enemyIndex = grid.creepIndices[i];
+					Creep *testEnemy = &enemies.list[enemyIndex];
+					if (!testEnemy->isDead) {
+						float distanceRadius = V2fLength(testEnemy->position - position);
+						if ((distanceRadius < bestDistance) || ((distanceRadius == bestDistance) && (enemyIndex < resultIndex))) {
+							result = testEnemy;
+							resultIndex = enemyIndex;
+							bestDistance = distanceRadius;
+						}
+					}
+				}
+			}
+		}
+		if (result != nullptr && bestDistance > maxDistance) {
+			result = nullptr;
+		}
+		return(result);
+	}
+
+	static Creep *FindCollidingCreep(Creeps &enemies, const CreepGrid &grid, const Vec2f &position, const float collisionRadius) {
+		// Same result as testing all creeps: The overlapping creep with the lowest index
+		float radius = collisionRadius + grid.maxCollisionRadius + CreepGridQueryPadding;
+		Vec2i minCell = WorldToCreepCell(position - V2fInit(radius, radius));
+		Vec2i maxCell = WorldToCreepCell(position + V2fInit(radius, radius));
+		Creep *result = nullptr;
+		size_t resultIndex = 0;
+		for (int cellY = minCell.y; cellY <= maxCell.y; ++cellY) {
+			for (int cellX = minCell.x; cellX <= maxCell.x; ++cellX) {
+				int cellIndex = cellY * CreepGridCountX + cellX;
+				for (uint16_t i = grid.cellStart[cellIndex]; i < grid.cellStart[cellIndex + 1]; ++i) {
+					size_t enemyIndex = grid.creepIndices[i];
+					if (result != nullptr && enemyIndex > resultIndex) {
+						break;
+					}
+					Creep *testEnemy = &enemies.list[enemyIndex];
+					if (!testEnemy->isDead) {
+						Vec2f distance = testEnemy->position - position;
+						float bothRadi = collisionRadius + testEnemy->data->collisionRadius;
+						float d = V2fDot(distance, distance);
+						if (d < bothRadi * bothRadi) {
+							result = testEnemy;
+							resultIndex = enemyIndex;
+							break;
+						}
+					}
+				}
+			}
+		}
+		return(result);
+	}
 }
 
 namespace level {
@@ -1144,6 +1597,320 @@ namespace level {
 		return nullptr;
 	}
 
+	static bool ParseLevelFile(const char *filePath, LevelData &outLevel, fmemMemoryBlock *memory, fmemMemoryBlock *tempMemory) {
+		bool result = false;
+		FileContents fileData = utils::LoadEntireFile(filePath, tempMemory);
+		if (fileData.data != nullptr) {
+			fxmlContext ctx = {};
+			if (fxmlInitFromMemory(fileData.data, fileData.info.size, &ctx)) {
+				fxmlTag root = {};
+				if (fxmlParse(&ctx, &root)) {
+					outLevel = {};
+					if (ParseLevel(&root, outLevel, memory)) {
+						result = true;
+					} else {
+						gamelog::Error("Level file '%s' is not valid!", filePath);
+					}
+				} else {
+					gamelog::Error("Level file '%s' is not a valid XML file!", filePath);
+				}
+				fxmlFree(&ctx);
+			}
+		} else {
+			gamelog::Error("Level file '%s' could not be found!", filePath);
+		}
+		return(result);
+	}
+
+	//
+	// Cooked files
+	//
+	inline uint64_t AlignCookedOffset(const uint64_t offset) {
+		uint64_t result = (offset + CookedFileAlignment - 1) & ~(uint64_t)(CookedFileAlignment - 1);
+		return(result);
+	}
+
+	static void AddCookedSection(CookedFileHeader &header, const uint64_t count, const uint32_t stride) {
+		assert(header.sectionCount < CookedFileMaxSectionCount);
+		CookedSection &section = header.sections[header.sectionCount++];
+		section.offset = AlignCookedOffset(header.fileSize);
+		section.count = count;
+		section.stride = stride;
+		header.fileSize = section.offset + count * stride;
+	}
+
+	static bool IsInsideCookedSection(const CookedSection &section, const uint64_t offset, const uint64_t count) {
+		if (offset < section.offset || ((offset - section.offset) % section.stride) != 0) {
+			return(false);
+		}
+		uint64_t firstIndex = (offset - section.offset) / section.stride;
+		bool result = firstIndex <= section.count && count <= (section.count - firstIndex);
+		return(result);
+	}
+
+	static const CookedFileHeader *GetCookedFileHeader(const MappedFile &file, const char **sourcePaths, const uint32_t sourceCount, const uint32_t *sectionStrides, const uint32_t sectionCount) {
+		assert(sourceCount <= CookedFileMaxSourceCount && sectionCount <= CookedFileMaxSectionCount);
+		if (file.size < sizeof(CookedFileHeader)) {
+			return(nullptr);
+		}
+		const CookedFileHeader *header = (const CookedFileHeader *)file.data;
+		if (header->magic != CookedFileMagic || header->version != CookedFileVersion || header->headerSize != sizeof(CookedFileHeader) || header->fileSize != file.size) {
+			return(nullptr);
+		}
+		if (header->sourceCount != sourceCount || header->sectionCount != sectionCount) {
+			return(nullptr);
+		}
+		for (uint32_t sectionIndex = 0; sectionIndex < sectionCount; ++sectionIndex) {
+			const CookedSection &section = header->sections[sectionIndex];
+			if (section.stride != sectionStrides[sectionIndex] || (section.offset % CookedFileAlignment) != 0) {
+				return(nullptr);
+			}
+			if (section.offset > file.size || section.count > (file.size - section.offset) / section.stride) {
+				return(nullptr);
+			}
+		}
+		// @NOTE(final): A missing source file does not make the cooked file stale, so the game can be shipped with cooked files only
+		for (uint32_t sourceIndex = 0; sourceIndex < sourceCount; ++sourceIndex) {
+			FileInfo sourceInfo = utils::LoadFileInfo(sourcePaths[sourceIndex]);
+			if (sourceInfo.size > 0 && !utils::IsEqualFileInfo(sourceInfo, header->sources[sourceIndex])) {
+				return(nullptr);
+			}
+		}
+		return(header);
+	}
+
+	static bool LoadCookedLevel(const char *sourceFilePath, LevelData &outLevel, MappedFile *outFile) {
+		char cookedFilePath[FPL_MAX_PATH_LENGTH];
+		fplChangeFileExtension(sourceFilePath, CookedLevelFileExtension, cookedFilePath, fplArrayCount(cookedFilePath));
+		MappedFile file;
+		if (!utils::MapEntireFile(cookedFilePath, &file)) {
+			return(false);
+		}
+		const char *sourcePaths[] = { sourceFilePath };
+		const uint32_t sectionStrides[] = { sizeof(LevelData), sizeof(uint32_t), sizeof(UVRect) };
+		fplStaticAssert(fplArrayCount(sectionStrides) == (size_t)CookedLevelSection::Count);
+		const CookedFileHeader *header = GetCookedFileHeader(file, sourcePaths, fplArrayCount(sourcePaths), sectionStrides, fplArrayCount(sectionStrides));
+		if (header == nullptr || header->sections[(uint32_t)CookedLevelSection::Level].count != 1) {
+			gamelog::Verbose("Cooked level '%s' is invalid or outdated", cookedFilePath);
+			utils::UnmapEntireFile(&file);
+			return(false);
+		}
+
+		// Pointer fixups, the cooked level stores offsets which must be inside of their sections
+		outLevel = *(const LevelData *)(file.data + header->sections[(uint32_t)CookedLevelSection::Level].offset);
+		bool isValid = (outLevel.layerCount <= MAX_LAYER_COUNT) && (outLevel.tilesetCount <= MAX_TILESET_COUNT) && (outLevel.objectCount <= fplArrayCount(outLevel.objects));
+		for (size_t layerIndex = 0; isValid && layerIndex < outLevel.layerCount; ++layerIndex) {
+			LevelLayer &layer = outLevel.layers[layerIndex];
+			uint64_t offset = (uint64_t)(uintptr_t)layer.data;
+			// Layers are indexed by the level dimension, so they must match exactly
+			isValid = (layer.mapWidth == outLevel.mapWidth) && (layer.mapHeight == outLevel.mapHeight) && IsInsideCookedSection(header->sections[(uint32_t)CookedLevelSection::LayerData], offset, (uint64_t)layer.mapWidth * layer.mapHeight);
+			layer.data = (uint32_t *)(file.data + offset);
+		}
+		for (size_t tilesetIndex = 0; isValid && tilesetIndex < outLevel.tilesetCount; ++tilesetIndex) {
+			LevelTileset &tileset = outLevel.tilesets[tilesetIndex];
+			if (tileset.tileUVs != nullptr) {
+				uint64_t offset = (uint64_t)(uintptr_t)tileset.tileUVs;
+				isValid = IsInsideCookedSection(header->sections[(uint32_t)CookedLevelSection::TileUVs], offset, tileset.tileCount);
+				tileset.tileUVs = (UVRect *)(file.data + offset);
+			}
+		}
+		if (!isValid) {
+			gamelog::Error("Cooked level '%s' is corrupt!", cookedFilePath);
+			outLevel = {};
+			utils::UnmapEntireFile(&file);
+			return(false);
+		}
+
+		*outFile = file;
+		return(true);
+	}
+
+	static bool IsTerminatedCookedString(const char *str, const size_t capacity) {
+		for (size_t i = 0; i < capacity; ++i) {
+			if (str[i] == 0) {
+				return(true);
+			}
+		}
+		return(false);
+	}
+
+	static bool IsValidCookedCreep(const CreepData &creep) {
+		bool result = IsTerminatedCookedString(creep.id, fplArrayCount(creep.id));
+		return(result);
+	}
+
+	static bool IsValidCookedTower(const TowerData &tower) {
+		if (!IsTerminatedCookedString(tower.id, fplArrayCount(tower.id)) || tower.tubeCount > fplArrayCount(tower.tubes) || tower.partCount > fplArrayCount(tower.parts)) {
+			return(false);
+		}
+		for (size_t tubeIndex = 0; tubeIndex < tower.tubeCount; ++tubeIndex) {
+			if (tower.tubes[tubeIndex].partCount > fplArrayCount(tower.tubes[tubeIndex].parts)) {
+				return(false);
+			}
+		}
+		return(true);
+	}
+
+	static bool IsValidCookedWave(const WaveData &wave) {
+		if (!IsTerminatedCookedString(wave.levelId, fplArrayCount(wave.levelId)) || wave.spawnerCount > fplArrayCount(wave.spawners)) {
+			return(false);
+		}
+		for (size_t spawnerIndex = 0; spawnerIndex < wave.spawnerCount; ++spawnerIndex) {
+			const SpawnData &spawner = wave.spawners[spawnerIndex];
+			if (!IsTerminatedCookedString(spawner.spawnId, fplArrayCount(spawner.spawnId)) || !IsTerminatedCookedString(spawner.enemyId, fplArrayCount(spawner.enemyId))) {
+				return(false);
+			}
+		}
+		return(true);
+	}
+
+	static bool LoadCookedDefinitions(Assets &assets) {
+		char cookedFilePath[FPL_MAX_PATH_LENGTH];
+		fplPathCombine(cookedFilePath, fplArrayCount(cookedFilePath), 3, assets.dataPath, "levels", CookedDefinitionsFilename);
+		MappedFile file;
+		if (!utils::MapEntireFile(cookedFilePath, &file)) {
+			return(false);
+		}
+		char creepsFilePath[FPL_MAX_PATH_LENGTH];
+		char towersFilePath[FPL_MAX_PATH_LENGTH];
+		char wavesFilePath[FPL_MAX_PATH_LENGTH];
+		fplPathCombine(creepsFilePath, fplArrayCount(creepsFilePath), 3, assets.dataPath, "levels", CreepsDataFilename);
+		fplPathCombine(towersFilePath, fplArrayCount(towersFilePath), 3, assets.dataPath, "levels", TowersDataFilename);
+		fplPathCombine(wavesFilePath, fplArrayCount(wavesFilePath), 3, assets.dataPath, "levels", WavesDataFilename);
+		const char *sourcePaths[] = { creepsFilePath, towersFilePath, wavesFilePath };
+		const uint32_t sectionStrides[] = { sizeof(CreepData), sizeof(TowerData), sizeof(WaveData) };
+		fplStaticAssert(fplArrayCount(sectionStrides) == (size_t)CookedDefinitionsSection::Count);
+		const CookedFileHeader *header = GetCookedFileHeader(file, sourcePaths, fplArrayCount(sourcePaths), sectionStrides, fplArrayCount(sectionStrides));
+		bool result = false;
+		if (header != nullptr) {
+			const CookedSection &creepsSection = header->sections[(uint32_t)CookedDefinitionsSection::Creeps];
+			const CookedSection &towersSection = header->sections[(uint32_t)CookedDefinitionsSection::Towers];
+			const CookedSection &wavesSection = header->sections[(uint32_t)CookedDefinitionsSection::Waves];
+			bool isValid = creepsSection.count <= fplArrayCount(assets.creepDefinitions) && towersSection.count <= fplArrayCount(assets.towerDefinitions) && wavesSection.count <= fplArrayCount(assets.waveDefinitions);
+
+			// The definitions are used as-is, so every count and string must fit into its fixed array
+			const CreepData *cookedCreeps = (const CreepData *)(file.data + creepsSection.offset);
+			const TowerData *cookedTowers = (const TowerData *)(file.data + towersSection.offset);
+			const WaveData *cookedWaves = (const WaveData *)(file.data + wavesSection.offset);
+			for (size_t creepIndex = 0; isValid && creepIndex < creepsSection.count; ++creepIndex) {
+				isValid = IsValidCookedCreep(cookedCreeps[creepIndex]);
+			}
+			for (size_t towerIndex = 0; isValid && towerIndex < towersSection.count; ++towerIndex) {
+				isValid = IsValidCookedTower(cookedTowers[towerIndex]);
+			}
+			for (size_t waveIndex = 0; isValid && waveIndex < wavesSection.count; ++waveIndex) {
+				isValid = IsValidCookedWave(cookedWaves[waveIndex]);
+			}
+
+			if (isValid) {
+				// @NOTE(final): Definitions are copied, because creeps and towers are referencing them and a reload overwrites them in place
+				assets.creepDefinitionCount = (size_t)creepsSection.count;
+				assets.towerDefinitionCount = (size_t)towersSection.count;
+				assets.waveDefinitionCount = (size_t)wavesSection.count;
+				fplMemoryCopy(cookedCreeps, sizeof(CreepData) * assets.creepDefinitionCount, assets.creepDefinitions);
+				fplMemoryCopy(cookedTowers, sizeof(TowerData) * assets.towerDefinitionCount, assets.towerDefinitions);
+				fplMemoryCopy(cookedWaves, sizeof(WaveData) * assets.waveDefinitionCount, assets.waveDefinitions);
+				assets.creepsFileInfo = header->sources[(uint32_t)CookedDefinitionsSection::Creeps];
+				assets.towersFileInfo = header->sources[(uint32_t)CookedDefinitionsSection::Towers];
+				assets.wavesFileInfo = header->sources[(uint32_t)CookedDefinitionsSection::Waves];
+				result = true;
+			} else {
+				gamelog::Error("Cooked definitions '%s' are corrupt!", cookedFilePath);
+			}
+		} else {
+			gamelog::Verbose("Cooked definitions '%s' are invalid or outdated", cookedFilePath);
+		}
+		utils::UnmapEntireFile(&file);
+		return(result);
+	}
+
+	static bool CookDefinitions(const Assets &assets, fmemMemoryBlock *memory) {
+		char filePath[FPL_MAX_PATH_LENGTH];
+		CookedFileHeader header = {};
+		header.magic = CookedFileMagic;
+		header.version = CookedFileVersion;
+		header.headerSize = sizeof(CookedFileHeader);
+		header.fileSize = sizeof(CookedFileHeader);
+		header.sourceCount = 3;
+		header.sources[(uint32_t)CookedDefinitionsSection::Creeps] = assets.creepsFileInfo;
+		header.sources[(uint32_t)CookedDefinitionsSection::Towers] = assets.towersFileInfo;
+		header.sources[(uint32_t)CookedDefinitionsSection::Waves] = assets.wavesFileInfo;
+		AddCookedSection(header, assets.creepDefinitionCount, sizeof(CreepData));
+		AddCookedSection(header, assets.towerDefinitionCount, sizeof(TowerData));
+		AddCookedSection(header, assets.waveDefinitionCount, sizeof(WaveData));
+
+		uint8_t *fileData = fmemPush(memory, (size_t)header.fileSize, fmemPushFlags_Clear);
+		fplMemoryCopy(&header, sizeof(header), fileData);
+		fplMemoryCopy(assets.creepDefinitions, sizeof(CreepData) * assets.creepDefinitionCount, fileData + header.sections[(uint32_t)CookedDefinitionsSection::Creeps].offset);
+		fplMemoryCopy(assets.towerDefinitions, sizeof(TowerData) * assets.towerDefinitionCount, fileData + header.sections[(uint32_t)CookedDefinitionsSection::Towers].offset);
+		fplMemoryCopy(assets.waveDefinitions, sizeof(WaveData) * assets.waveDefinitionCount, fileData + header.sections[(uint32_t)CookedDefinitionsSection::Waves].offset);
+
+		fplPathCombine(filePath, fplArrayCount(filePath), 3, assets.dataPath, "levels", CookedDefinitionsFilename);
+		bool result = utils::WriteEntireFile(filePath, fileData, (size_t)header.fileSize);
+		return(result);
+	}
+
+	static bool CookLevel(const char *dataPath, const char *filename, fmemMemoryBlock *memory) {
+		char filePath[FPL_MAX_PATH_LENGTH];
+		fplPathCombine(filePath, fplArrayCount(filePath), 3, dataPath, "levels", filename);
+		LevelData *level = (LevelData *)fmemPush(memory, sizeof(LevelData), fmemPushFlags_Clear);
+		if (!ParseLevelFile(filePath, *level, memory, memory)) {
+			return(false);
+		}
+
+		uint64_t layerDataCount = 0;
+		for (size_t layerIndex = 0; layerIndex < level->layerCount; ++layerIndex) {
+			layerDataCount += (uint64_t)level->layers[layerIndex].mapWidth * level->layers[layerIndex].mapHeight;
+		}
+		uint64_t tileUVCount = 0;
+		for (size_t tilesetIndex = 0; tilesetIndex < level->tilesetCount; ++tilesetIndex) {
+			if (level->tilesets[tilesetIndex].tileUVs != nullptr) {
+				tileUVCount += level->tilesets[tilesetIndex].tileCount;
+			}
+		}
+
+		CookedFileHeader header = {};
+		header.magic = CookedFileMagic;
+		header.version = CookedFileVersion;
+		header.headerSize = sizeof(CookedFileHeader);
+		header.fileSize = sizeof(CookedFileHeader);
+		header.sourceCount = 1;
+		header.sources[0] = utils::LoadFileInfo(filePath);
+		AddCookedSection(header, 1, sizeof(LevelData));
+		AddCookedSection(header, layerDataCount, sizeof(uint32_t));
+		AddCookedSection(header, tileUVCount, sizeof(UVRect));
+
+		uint8_t *fileData = fmemPush(memory, (size_t)header.fileSize, fmemPushFlags_Clear);
+		fplMemoryCopy(&header, sizeof(header), fileData);
+
+		// Layer data and tile UVs are stored as raw arrays, the level refers to them by their offsets in the file
+		LevelData *cookedLevel = (LevelData *)(fileData + header.sections[(uint32_t)CookedLevelSection::Level].offset);
+		*cookedLevel = *level;
+		uint64_t layerDataOffset = header.sections[(uint32_t)CookedLevelSection::LayerData].offset;
+		for (size_t layerIndex = 0; layerIndex < level->layerCount; ++layerIndex) {
+			const LevelLayer &layer = level->layers[layerIndex];
+			size_t size = sizeof(uint32_t) * layer.mapWidth * layer.mapHeight;
+			fplMemoryCopy(layer.data, size, fileData + layerDataOffset);
+			cookedLevel->layers[layerIndex].data = (uint32_t *)(uintptr_t)layerDataOffset;
+			layerDataOffset += size;
+		}
+		uint64_t tileUVsOffset = header.sections[(uint32_t)CookedLevelSection::TileUVs].offset;
+		for (size_t tilesetIndex = 0; tilesetIndex < level->tilesetCount; ++tilesetIndex) {
+			const LevelTileset &tileset = level->tilesets[tilesetIndex];
+			if (tileset.tileUVs != nullptr) {
+				size_t size = sizeof(UVRect) * tileset.tileCount;
+				fplMemoryCopy(tileset.tileUVs, size, fileData + tileUVsOffset);
+				cookedLevel->tilesets[tilesetIndex].tileUVs = (UVRect *)(uintptr_t)tileUVsOffset;
+				tileUVsOffset += size;
+			}
+		}
+
+		char cookedFilePath[FPL_MAX_PATH_LENGTH];
+		fplChangeFileExtension(filePath, CookedLevelFileExtension, cookedFilePath, fplArrayCount(cookedFilePath));
+		bool result = utils::WriteEntireFile(cookedFilePath, fileData, (size_t)header.fileSize);
+		return(result);
+	}
+
 	static bool LoadLevel(GameState &state, const char *dataPath, const char *filename, LevelData &outLevel, fmemMemoryBlock *memory) {
 		bool result = false;
 
@@ -1151,75 +1918,78 @@ namespace level {
 		fplPathCombine(filePath, fplArrayCount(filePath), 3, dataPath, "levels", filename);
 		gamelog::Verbose("Loading level '%s'", filePath);
 
-		fmemMemoryBlock tempMem;
-		if (fmemBeginTemporary(&state.transientMem, &tempMem)) {
-			FileContents fileData = utils::LoadEntireFile(filePath, &tempMem);
-			if (fileData.data != nullptr) {
-				fxmlContext ctx = {};
-				if (fxmlInitFromMemory(fileData.data, fileData.info.size, &ctx)) {
-					fxmlTag root = {};
-					if (fxmlParse(&ctx, &root)) {
-						outLevel = {};
-						if (ParseLevel(&root, outLevel, memory)) {
-							LevelLayer *wayLayer = FindLayerByName(outLevel, "way");
-							assert(wayLayer != nullptr);
-
-							// Tiles
-							LevelTileset *wayTileset = FindLevelTileset(outLevel, "way");
-							assert(wayTileset != nullptr);
-							assert(state.level.tiles == nullptr);
-							state.level.dimension.tileCountX = outLevel.mapWidth;
-							state.level.dimension.tileCountY = outLevel.mapHeight;
-							state.level.dimension.gridWidth = outLevel.mapWidth * TileWidth;
-							state.level.dimension.gridHeight = outLevel.mapHeight * TileHeight;
-							state.level.dimension.gridOriginX = -WorldRadiusW + ((WorldWidth - state.level.dimension.gridWidth) * 0.5f);
-							state.level.dimension.gridOriginY = -WorldRadiusH + ControlsHeight;
-							state.level.tiles = (Tile *)fmemPush(memory, sizeof(Tile) * outLevel.mapWidth * outLevel.mapHeight, fmemPushFlags_Clear);
-							for (size_t y = 0; y < outLevel.mapHeight; ++y) {
-								for (size_t x = 0; x < outLevel.mapWidth; ++x) {
-									size_t tileIndex = y * outLevel.mapWidth + x;
-									uint32_t wayValue = wayLayer->data[tileIndex] > 0 ? ((wayLayer->data[tileIndex] - wayTileset->firstGid) + 1) : 0;
-									Tile tile = {};
-									tile.wayType = TilesetWayToTypeMapping[wayValue];
-									tile.entityType = EntityType::None;
-									state.level.tiles[tileIndex] = tile;
-								}
-							}
-
-							// Make waypoints/goal
-							for (size_t objIndex = 0; objIndex < outLevel.objectCount; ++objIndex) {
-								const ObjectData &obj = outLevel.objects[objIndex];
-								if (IsValidTile(state.level.dimension, obj.tilePos)) {
-									int tileIndex = obj.tilePos.y * outLevel.mapWidth + obj.tilePos.x;
-									switch (obj.type) {
-										case ObjectType::Goal:
-											state.level.tiles[tileIndex].entityType = EntityType::Goal;
-											break;
-										case ObjectType::Waypoint:
-											AddWaypoint(state.waypoints, state.level.dimension, obj.tilePos, obj.waypoint.direction);
-											break;
-										default:
-											break;
-									}
-								}
-							}
+		double loadStart = fplGetTimeInMillisecondsHP();
+		bool isLoaded = false;
+		bool isCooked = LoadCookedLevel(filePath, outLevel, &state.level.cookedFile);
+		if (isCooked) {
+			isLoaded = true;
+		} else {
+			fmemMemoryBlock tempMem;
+			if (fmemBeginTemporary(&state.transientMem, &tempMem)) {
+				isLoaded = ParseLevelFile(filePath, outLevel, memory, &tempMem);
+				fmemEndTemporary(&tempMem);
+			} else {
+				gamelog::Error("Failed begin temporary memory for load level!");
+			}
+		}
+		double loadTime = fplGetTimeInMillisecondsHP() - loadStart;
+
+		if (isLoaded) {
+			gamelog::Info("Loaded %s level '%s' in %.3f ms", isCooked ? "cooked" : "xml", filePath, loadTime);
+
+			LevelLayer *wayLayer = FindLayerByName(outLevel, "way");
+			assert(wayLayer != nullptr);
+
+			// Tiles
+			LevelTileset *wayTileset = FindLevelTileset(outLevel, "way");
+			assert(wayTileset != nullptr);
+			assert(state.level.tiles == nullptr);
+			state.level.dimension.tileCountX = outLevel.mapWidth;
+			state.level.dimension.tileCountY = outLevel.mapHeight;
+			state.level.dimension.gridWidth = outLevel.mapWidth * TileWidth;
+			state.level.dimension.gridHeight = outLevel.mapHeight * TileHeight;
+			state.level.dimension.gridOriginX = -WorldRadiusW + ((WorldWidth - state.level.dimension.gridWidth) * 0.5f);
+			state.level.dimension.gridOriginY = -WorldRadiusH + ControlsHeight;
+			state.level.tiles = (Tile *)fmemPush(memory, sizeof(Tile) * outLevel.mapWidth * outLevel.mapHeight, fmemPushFlags_Clear);
+			for (size_t y = 0; y < outLevel.mapHeight; ++y) {
+				for (size_t x = 0; x < outLevel.mapWidth; ++x) {
+					size_t tileIndex = y * outLevel.mapWidth + x;
+					uint32_t wayValue = wayLayer->data[tileIndex] > 0 ? ((wayLayer->data[tileIndex] - wayTileset->firstGid) + 1) : 0;
+					Tile tile = {};
+					tile.wayType = TilesetWayToTypeMapping[wayValue];
+					tile.entityType = EntityType::None;
+					state.level.tiles[tileIndex] = tile;
+				}
+			}
 
-							result = true;
-						} else {
-							gamelog::Error("Level file '%s' is not valid!", filePath);
-						}
-					} else {
-						gamelog::Error("Level file '%s' is not a valid XML file!", filePath);
+			// Make waypoints/goal
+			for (size_t objIndex = 0; objIndex < outLevel.objectCount; ++objIndex) {
+				const ObjectData &obj = outLevel.objects[objIndex];
+				if (IsValidTile(state.level.dimension, obj.tilePos)) {
+					int tileIndex = obj.tilePos.y * outLevel.mapWidth + obj.tilePos.x;
+					switch (obj.type) {
+						case ObjectType::Goal:
+							state.level.tiles[tileIndex].entityType = EntityType::Goal;
+							break;
+						case ObjectType::Waypoint:
+							AddWaypoint(state.waypoints, state.level.dimension, obj.tilePos, obj.waypoint.direction);
+							break;
+						default:
+							break;
 					}
-					fxmlFree(&ctx);
 				}
-			} else {
-				gamelog::Error("Level file '%s' could not be found!", filePath);
 			}
 
-			fmemEndTemporary(&tempMem);
-		} else {
-			gamelog::Error("Failed begin temporary memory for load level!");
+			// Flow field, always kept up to date - even when creeps follow the waypoints
+			FlowField &field = state.level.flowField;
+			field.tileCount = (int32_t)(outLevel.mapWidth * outLevel.mapHeight);
+			field.distances = (int32_t *)fmemPush(memory, sizeof(int32_t) * field.tileCount, fmemPushFlags_None);
+			field.queue = (int32_t *)fmemPush(memory, sizeof(int32_t) * field.tileCount, fmemPushFlags_None);
+			field.seeds = (int32_t *)fmemPush(memory, sizeof(int32_t) * field.tileCount, fmemPushFlags_None);
+			field.marks = (uint8_t *)fmemPush(memory, sizeof(uint8_t) * field.tileCount, fmemPushFlags_Clear);
+			flowfield::BuildFlowField(state.level, FindTilePosByEntityType(state.level, EntityType::Goal));
+
+			result = true;
 		}
 
 		return(result);
@@ -1253,6 +2023,8 @@ namespace level {
 		if (level.tiles != nullptr) {
 			level.tiles = nullptr;
 		}
+		level.flowField = {};
+		utils::UnmapEntireFile(&level.cookedFile);
 		level.data.layerCount = 0;
 		level.data.tilesetCount = 0;
 		level.data.objectCount = 0;
@@ -1366,6 +2138,7 @@ namespace towers {
 		TooManyTowers,
 		TileOccupied,
 		NotEnoughMoney,
+		BlocksPath,
 	};
 
 	inline CanPlaceTowerResult CanPlaceTower(GameState &state, const Vec2i &tilePos, const TowerData *tower) {
@@ -1379,12 +2152,39 @@ namespace towers {
 		if (tile == nullptr) {
 			return CanPlaceTowerResult::TileOccupied;
 		}
-		if (tile->isOccupied || tile->entityType != EntityType::None || tile->wayType != WayType::None) {
+		if (tile->isOccupied || tile->entityType != EntityType::None) {
+			return CanPlaceTowerResult::TileOccupied;
+		}
+		if (state.pathingMode == PathingMode::Waypoints && tile->wayType != WayType::None) {
 			return CanPlaceTowerResult::TileOccupied;
 		}
+		if (state.pathingMode == PathingMode::FlowField) {
+			for (size_t enemyIndex = 0; enemyIndex < state.enemies.count; ++enemyIndex) {
+				const Creep &enemy = state.enemies.list[enemyIndex];
+				if (!enemy.isDead && V2iEquals(WorldToTile(state.level.dimension, enemy.position), tilePos)) {
+					return CanPlaceTowerResult::TileOccupied;
+				}
+			}
+		}
 		if (state.stats.money < tower->costs) {
 			return CanPlaceTowerResult::NotEnoughMoney;
 		}
+		if (state.pathingMode == PathingMode::FlowField) {
+			// Every spawn and every living creep must still reach the goal
+			flowfield::MarkReachableTiles(state.level, tilePos);
+			for (size_t objectIndex = 0; objectIndex < state.level.data.objectCount; ++objectIndex) {
+				const ObjectData &obj = state.level.data.objects[objectIndex];
+				if (obj.type == ObjectType::Spawn && !flowfield::IsTileMarked(state.level, obj.tilePos)) {
+					return CanPlaceTowerResult::BlocksPath;
+				}
+			}
+			for (size_t enemyIndex = 0; enemyIndex < state.enemies.count; ++enemyIndex) {
+				const Creep &enemy = state.enemies.list[enemyIndex];
+				if (!enemy.isDead && !flowfield::IsTileMarked(state.level, WorldToTile(state.level.dimension, enemy.position))) {
+					return CanPlaceTowerResult::BlocksPath;
+				}
+			}
+		}
 		return(CanPlaceTowerResult::Success);
 	}
 
@@ -1399,6 +2199,10 @@ namespace towers {
 		Tile *tile = level::GetTile(state.level, tilePos);
 		assert(!tile->isOccupied);
 		tile->isOccupied = true;
+		flowfield::BlockTile(state.level, tilePos);
+		if (state.pathingMode == PathingMode::FlowField) {
+			creeps::UpdateCreepTargets(state);
+		}
 
 		assert(state.stats.money >= data->costs);
 		state.stats.money -= data->costs;
@@ -1406,6 +2210,30 @@ namespace towers {
 		return(tower);
 	}
 
+	static bool RemoveTower(GameState &state, const Vec2i &tilePos) {
+		for (size_t towerIndex = 0; towerIndex < state.towers.activeCount; ++towerIndex) {
+			Tower &tower = state.towers.activeList[towerIndex];
+			if (V2iEquals(WorldToTile(state.level.dimension, tower.position), tilePos)) {
+				// Half of the costs are refunded
+				state.stats.money += tower.data->costs / 2;
+				if (towerIndex < state.towers.activeCount - 1) {
+					tower = state.towers.activeList[state.towers.activeCount - 1];
+				}
+				--state.towers.activeCount;
+
+				Tile *tile = level::GetTile(state.level, tilePos);
+				assert(tile->isOccupied);
+				tile->isOccupied = false;
+				flowfield::UnblockTile(state.level, tilePos);
+				if (state.pathingMode == PathingMode::FlowField) {
+					creeps::UpdateCreepTargets(state);
+				}
+				return(true);
+			}
+		}
+		return(false);
+	}
+
 	static Vec2f PredictEnemyPosition(const Tower &tower, const Creep &enemy, const float deltaTime) {
 		// Based on:
 		// https://gamedev.stackexchange.com/questions/14469/2d-tower-defense-a-bullet-to-an-enemy
@@ -1474,7 +2302,10 @@ namespace towers {
 	static void ShootBullet(Bullets &bullets, Tower &tower) {
 		for (size_t tubeIndex = 0; tubeIndex < tower.data->tubeCount; ++tubeIndex) {
 			const WeaponTubeData *tube = tower.data->tubes + tubeIndex;
-			assert(bullets.count < fplArrayCount(bullets.list));
+			if (bullets.count == fplArrayCount(bullets.list)) {
+				// @NOTE(final): Only reachable in stress tests, the remaining tubes simply do not fire
+				break;
+			}
 			Bullet *bullet = &bullets.list[bullets.count++];
 			*bullet = {};
 			Vec2f targetDir = V2fInit(Cosine(tower.facingAngle), Sine(tower.facingAngle));
@@ -1505,19 +2336,8 @@ namespace towers {
 
 		// Detect a new target
 		if (!tower.hasTarget) {
-			float bestEnemyDistance = FLT_MAX;
-			Creep *bestEnemy = nullptr;
-			for (size_t enemyIndex = 0; enemyIndex < state.enemies.count; ++enemyIndex) {
-				Creep *testEnemy = &state.enemies.list[enemyIndex];
-				if (!testEnemy->isDead) {
-					float distanceRadius = V2fLength(testEnemy->position - tower.position);
-					if (distanceRadius < bestEnemyDistance) {
-						bestEnemy = testEnemy;
-						bestEnemyDistance = distanceRadius;
-					}
-				}
-			}
-			if (bestEnemy != nullptr && bestEnemyDistance <= tower.data->detectionRadius) {
+			Creep *bestEnemy = creeps::FindNearestCreep(state.enemies, state.enemyGrid, tower.position, tower.data->detectionRadius);
+			if (bestEnemy != nullptr) {
 				tower.targetEnemy = bestEnemy;
 				tower.targetId = bestEnemy->id;
 				tower.hasTarget = true;
@@ -1549,12 +2369,14 @@ namespace towers {
 		// Shoot
 		//
 		if (tower.data->enemyLockOnMode == EnemyLockTargetMode::Any) {
-			for (size_t enemyIndex = 0; enemyIndex < state.enemies.count; ++enemyIndex) {
-				Creep &enemy = state.enemies.list[enemyIndex];
-				if (!enemy.isDead) {
-					bool inFireRange = towers::InFireRange(tower, enemy, deltaTime);
-					if (inFireRange && tower.canFire) {
+			// @NOTE(final): The fire range is not limited by distance, but shooting does not depend on which enemy is in range.
+			// So we only test while the gun is ready and stop at the first enemy in range.
+			if (tower.canFire) {
+				for (size_t enemyIndex = 0; enemyIndex < state.enemies.count; ++enemyIndex) {
+					Creep &enemy = state.enemies.list[enemyIndex];
+					if (!enemy.isDead && towers::InFireRange(tower, enemy, deltaTime)) {
 						ShootBullet(state.bullets, tower);
+						break;
 					}
 				}
 			}
@@ -1599,6 +2421,12 @@ namespace game {
 		state.waveStateAfterSlowdown = nextState;
 	}
 
+	static void GetDataPath(char *outPath, const size_t maxOutPathLen) {
+		fplGetExecutableFilePath(outPath, maxOutPathLen);
+		fplExtractFilePath(outPath, outPath, maxOutPathLen);
+		fplPathCombine(outPath, maxOutPathLen, 2, outPath, "data");
+	}
+
 	static void ReleaseAssets(Assets &assets) {
 		ReleaseFontAsset(assets.overlayFont);
 		ReleaseFontAsset(assets.hudFont);
@@ -1625,10 +2453,12 @@ namespace game {
 		if (fmemBeginTemporary(&gameState.transientMem, &tempMem)) {
 			Assets &assets = gameState.assets;
 
-			// Towers/Enemies/Waves
-			level::LoadCreepDefinitions(assets, CreepsDataFilename, false, &tempMem);
-			level::LoadTowerDefinitions(assets, TowersDataFilename, false, &tempMem);
-			level::LoadWaveDefinitions(assets, WavesDataFilename, false, &tempMem);
+			// Towers/Enemies/Waves, from the cooked file when it is up to date
+			if (!level::LoadCookedDefinitions(assets)) {
+				level::LoadCreepDefinitions(assets, CreepsDataFilename, false, &tempMem);
+				level::LoadTowerDefinitions(assets, TowersDataFilename, false, &tempMem);
+				level::LoadWaveDefinitions(assets, WavesDataFilename, false, &tempMem);
+			}
 
 			// Fonts
 			char fontDataPath[1024];
@@ -1682,9 +2512,7 @@ namespace game {
 	static bool InitGame(GameState &state, GameMemory &gameMemory) {
 		gamelog::Verbose("Initialize Game");
 
-		fplGetExecutableFilePath(state.assets.dataPath, fplArrayCount(state.assets.dataPath));
-		fplExtractFilePath(state.assets.dataPath, state.assets.dataPath, fplArrayCount(state.assets.dataPath));
-		fplPathCombine(state.assets.dataPath, fplArrayCount(state.assets.dataPath), 2, state.assets.dataPath, "data");
+		GetDataPath(state.assets.dataPath, fplArrayCount(state.assets.dataPath));
 		gamelog::Info("Using assets path: %s", state.assets.dataPath);
 
 		size_t levelMemorySize = FMEM_MEGABYTES(32);
@@ -1702,6 +2530,7 @@ namespace game {
 		}
 
 		state.isDebugRendering = true;
+		state.pathingMode = globalStartupPathingMode;
 
 		LoadAssets(state, *gameMemory.render);
 
@@ -1899,6 +2728,11 @@ extern void GameInput(GameMemory &gameMemory, const Input &input) {
 				}
 			}
 		}
+
+		// Tower removal
+		if (WasPressed(input.mouse.right) && !ui::UIIsHot(state->ui)) {
+			towers::RemoveTower(*state, state->mouseTilePos);
+		}
 	}
 }
 
@@ -1991,6 +2825,9 @@ extern void GameUpdate(GameMemory &gameMemory, const Input &input) {
 			creeps::UpdateSpawner(*state, spawner, dt);
 		}
 
+		// Creeps do not move until the next update, so towers and bullets can share one grid
+		creeps::RebuildCreepGrid(state->enemyGrid, state->enemies);
+
 		// Update towers
 		if (updateGameCode) {
 			for (size_t towerIndex = 0; towerIndex < state->towers.activeCount; ++towerIndex) {
@@ -2007,19 +2844,11 @@ extern void GameUpdate(GameMemory &gameMemory, const Input &input) {
 			if (!bullet.isDestroyed) {
 				bullet.position += bullet.velocity * dt;
 				if (!bullet.hasHit) {
-					for (size_t enemyIndex = 0; enemyIndex < state->enemies.count; ++enemyIndex) {
-						Creep &enemy = state->enemies.list[enemyIndex];
-						if (!enemy.isDead) {
-							Vec2f distance = enemy.position - bullet.position;
-							float bothRadi = bullet.data->collisionRadius + enemy.data->collisionRadius;
-							float d = V2fDot(distance, distance);
-							if (d < bothRadi * bothRadi) {
-								bullet.hasHit = true;
-								if (updateGameCode) {
-									creeps::CreepHit(*state, enemy, bullet);
-								}
-								break;
-							}
+					Creep *enemy = creeps::FindCollidingCreep(state->enemies, state->enemyGrid, bullet.position, bullet.data->collisionRadius);
+					if (enemy != nullptr) {
+						bullet.hasHit = true;
+						if (updateGameCode) {
+							creeps::CreepHit(*state, *enemy, bullet);
 						}
 					}
 				}
@@ -2215,10 +3044,26 @@ extern void GameRender(GameMemory &gameMemory, const float alpha) {
 	*vertAlloc.count = count;
 
 	if (state->isDebugRendering) {
-		// Waypoints
-		for (Waypoint *waypoint = state->waypoints.first; waypoint != nullptr; waypoint = waypoint->next) {
-			PushRectangleCenter(renderState, waypoint->position, V2fInitScalar(MaxTileSize * 0.15f), V4fInit(1, 0, 1, 1), true, 0.0f);
-			PushLine(renderState, waypoint->position, waypoint->position + waypoint->direction * level::WaypointDirectionWidth, V4fInit(1, 1, 1, 1), 1.0f);
+		if (state->pathingMode == PathingMode::FlowField) {
+			// Flow field directions
+			for (int y = 0; y < (int)dim.tileCountY; ++y) {
+				for (int x = 0; x < (int)dim.tileCountX; ++x) {
+					Vec2i tilePos = V2iInit(x, y);
+					Vec2i nextTilePos;
+					if (flowfield::GetNextTile(level, tilePos, nextTilePos)) {
+						Vec2f tileCenter = TileToWorld(dim, tilePos, TileExt);
+						Vec2f direction = V2fNormalize(TileToWorld(dim, nextTilePos, TileExt) - tileCenter);
+						PushRectangleCenter(renderState, tileCenter, V2fInitScalar(MaxTileSize * 0.05f), V4fInit(1, 0, 1, 1), true, 0.0f);
+						PushLine(renderState, tileCenter, tileCenter + direction * (MaxTileRadius * 0.75f), V4fInit(1, 1, 1, 1), 1.0f);
+					}
+				}
+			}
+		} else {
+			// Waypoints
+			for (Waypoint *waypoint = state->waypoints.first; waypoint != nullptr; waypoint = waypoint->next) {
+				PushRectangleCenter(renderState, waypoint->position, V2fInitScalar(MaxTileSize * 0.15f), V4fInit(1, 0, 1, 1), true, 0.0f);
+				PushLine(renderState, waypoint->position, waypoint->position + waypoint->direction * level::WaypointDirectionWidth, V4fInit(1, 1, 1, 1), 1.0f);
+			}
 		}
 	}
 
@@ -2401,14 +3246,364 @@ extern void GameUpdateAndRender(GameMemory &gameMemory, const Input &input, cons
 	GameRender(gameMemory, alpha);
 }
 
+namespace cook {
+	static int RunCook() {
+		if (!fplPlatformInit(fplInitFlags_None, nullptr)) {
+			return -1;
+		}
+
+		fmemMemoryBlock memory = {};
+		if (!fmemInit(&memory, fmemType_Growable, FMEM_MEGABYTES(16))) {
+			fplPlatformRelease();
+			return -1;
+		}
+
+		// Definitions are always loaded from the sources
+		Assets *assets = (Assets *)fmemPush(&memory, sizeof(Assets), fmemPushFlags_Clear);
+		game::GetDataPath(assets->dataPath, fplArrayCount(assets->dataPath));
+		level::LoadCreepDefinitions(*assets, CreepsDataFilename, false, &memory);
+		level::LoadTowerDefinitions(*assets, TowersDataFilename, false, &memory);
+		level::LoadWaveDefinitions(*assets, WavesDataFilename, false, &memory);
+
+		int result = 0;
+		if (assets->creepsFileInfo.size == 0 || assets->towersFileInfo.size == 0 || assets->wavesFileInfo.size == 0) {
+			fplConsoleFormatError("Definitions not found in '%s'!\n", assets->dataPath);
+			result = -1;
+		} else if (level::CookDefinitions(*assets, &memory)) {
+			fplConsoleFormatOut("Cooked '%s': %zu creeps, %zu towers, %zu waves\n", CookedDefinitionsFilename, assets->creepDefinitionCount, assets->towerDefinitionCount, assets->waveDefinitionCount);
+		} else {
+			fplConsoleFormatError("Failed cooking definitions to '%s'!\n", CookedDefinitionsFilename);
+			result = -1;
+		}
+
+		// Every level which is used by any wave
+		for (size_t waveIndex = 0; waveIndex < assets->waveDefinitionCount; ++waveIndex) {
+			const char *levelId = assets->waveDefinitions[waveIndex].levelId;
+			bool isDuplicate = false;
+			for (size_t prevWaveIndex = 0; prevWaveIndex < waveIndex; ++prevWaveIndex) {
+				if (fplIsStringEqual(assets->waveDefinitions[prevWaveIndex].levelId, levelId)) {
+					isDuplicate = true;
+					break;
+				}
+			}
+			if (isDuplicate) {
+				continue;
+			}
+			char levelFilename[1024];
+			fplCopyString(levelId, levelFilename, fplArrayCount(levelFilename));
+			fplChangeFileExtension(levelFilename, ".tmx", levelFilename, fplArrayCount(levelFilename));
+			if (level::CookLevel(assets->dataPath, levelFilename, &memory)) {
+				fplConsoleFormatOut("Cooked level '%s'\n", levelFilename);
+			} else {
+				fplConsoleFormatError("Failed cooking level '%s'!\n", levelFilename);
+				result = -1;
+			}
+		}
+
+		fmemFree(&memory);
+		fplPlatformRelease();
+		return(result);
+	}
+}
+
+namespace headless {
+	constexpr float TickDeltaTime = 1.0f / 60.0f;
+	constexpr uint64_t MaxTicksPerWave = 60 * 60 * 30; // 30 minutes of game time
+	constexpr uint64_t FNV64Offset = 0xcbf29ce484222325ULL;
+	constexpr uint64_t FNV64Prime = 0x100000001b3ULL;
+
+	struct BenchmarkConfig {
+		int creepScale;
+		int maxTowerCount;
+	};
+
+	struct WaveStats {
+		uint64_t checksum;
+		uint64_t tickCount;
+		double updateTime;
+		size_t spawnedCreepCount;
+		size_t maxAliveCreepCount;
+		size_t maxBulletCount;
+		int startLifes;
+		int startMoney;
+	};
+
+	inline void HashBytes(uint64_t &hash, const void *data, const size_t size) {
+		const uint8_t *p = (const uint8_t *)data;
+		for (size_t i = 0; i < size; ++i) {
+			hash = (hash ^ p[i]) * FNV64Prime;
+		}
+	}
+
+	template<typename T>
+	inline void HashValue(uint64_t &hash, const T &value) {
+		HashBytes(hash, &value, sizeof(value));
+	}
+
+	static void HashGameState(uint64_t &hash, const GameState &state) {
+		// @NOTE(final): Only simulation state, no pointers - so the checksum is the same across runs and builds
+		HashValue(hash, state.enemies.count);
+		for (size_t enemyIndex = 0; enemyIndex < state.enemies.count; ++enemyIndex) {
+			const Creep &enemy = state.enemies.list[enemyIndex];
+			HashValue(hash, enemy.id);
+			HashValue(hash, enemy.position);
+			HashValue(hash, enemy.hp);
+			HashValue(hash, enemy.isDead);
+		}
+		HashValue(hash, state.bullets.count);
+		for (size_t bulletIndex = 0; bulletIndex < state.bullets.count; ++bulletIndex) {
+			const Bullet &bullet = state.bullets.list[bulletIndex];
+			HashValue(hash, bullet.position);
+			HashValue(hash, bullet.velocity);
+		}
+		for (size_t towerIndex = 0; towerIndex < state.towers.activeCount; ++towerIndex) {
+			const Tower &tower = state.towers.activeList[towerIndex];
+			HashValue(hash, tower.targetId);
+			HashValue(hash, tower.facingAngle);
+			HashValue(hash, tower.gunTimer);
+		}
+		HashValue(hash, state.stats.money);
+		HashValue(hash, state.stats.lifes);
+		HashValue(hash, state.wave.state);
+	}
+
+	static uint64_t ComputeGameChecksum(GameMemory &gameMemory) {
+		uint64_t result = FNV64Offset;
+		HashGameState(result, *gameMemory.game);
+		return(result);
+	}
+
+	static void PlaceTowerLayout(GameState &state, const BenchmarkConfig &config) {
+		// Every free tile next to the way gets a tower, cycling through all tower definitions
+		const LevelDimension &dim = state.level.dimension;
+		size_t maxTowerCount = fplMin((size_t)config.maxTowerCount, fplArrayCount(state.towers.activeList));
+		size_t definitionIndex = 0;
+		for (int y = 0; y < (int)dim.tileCountY; ++y) {
+			for (int x = 0; x < (int)dim.tileCountX; ++x) {
+				if (state.towers.activeCount >= maxTowerCount || state.assets.towerDefinitionCount == 0) {
+					return;
+				}
+				bool isNextToWay = false;
+				for (int dy = -1; dy <= 1 && !isNextToWay; ++dy) {
+					for (int dx = -1; dx <= 1 && !isNextToWay; ++dx) {
+						Tile *neighbor = level::GetTile(state.level, V2iInit(x + dx, y + dy));
+						isNextToWay = (neighbor != nullptr) && (neighbor->wayType != WayType::None);
+					}
+				}
+				Vec2i tilePos = V2iInit(x, y);
+				const TowerData *tower = &state.assets.towerDefinitions[definitionIndex];
+				state.towers.selectedIndex = (int)definitionIndex;
+				if (isNextToWay && towers::CanPlaceTower(state, tilePos, tower) == towers::CanPlaceTowerResult::Success) {
+					towers::PlaceTower(state, tilePos, tower);
+					definitionIndex = (definitionIndex + 1) % state.assets.towerDefinitionCount;
+				}
+			}
+		}
+	}
+
+	static void ScaleWave(GameState &state, const BenchmarkConfig &config) {
+		// More creeps which spawn faster, limited by the creep capacity
+		size_t totalCount = state.wave.totalEnemyCount;
+		if (totalCount == 0 || config.creepScale <= 1) {
+			return;
+		}
+		size_t scale = fplMin((size_t)config.creepScale, MaxCreepCount / totalCount);
+		if (scale <= 1) {
+			return;
+		}
+		for (size_t spawnerIndex = 0; spawnerIndex < state.spawners.count; ++spawnerIndex) {
+			CreepSpawner &spawner = state.spawners.list[spawnerIndex];
+			spawner.totalCount *= scale;
+			spawner.remainingCount *= scale;
+			spawner.cooldown /= (float)scale;
+		}
+		state.wave.totalEnemyCount = totalCount * scale;
+	}
+
+	static void BeginWave(GameState &state, const BenchmarkConfig &config, WaveStats &stats) {
+		// Loading a different level removes all towers
+		if (state.towers.activeCount == 0) {
+			PlaceTowerLayout(state, config);
+		}
+		ScaleWave(state, config);
+		stats = {};
+		stats.checksum = FNV64Offset;
+		stats.spawnedCreepCount = state.wave.totalEnemyCount;
+		stats.startLifes = state.stats.lifes;
+		stats.startMoney = state.stats.money;
+	}
+
+	static void PrintWave(const GameState &state, const int waveIndex, const WaveStats &stats) {
+		fplConsoleFormatOut("Wave %d: %llu ticks in %.2f ms (%.0f ticks/s, %.3f ms/tick)\n",
+			waveIndex + 1,
+			(unsigned long long)stats.tickCount,
+			stats.updateTime,
+			stats.updateTime > 0 ? stats.tickCount / (stats.updateTime / 1000.0) : 0.0,
+			stats.tickCount > 0 ? stats.updateTime / stats.tickCount : 0.0);
+		fplConsoleFormatOut("\tTowers: %zu, creeps: %zu (max alive %zu, leaked %d), max bullets: %zu, money earned: %d\n",
+			state.towers.activeCount,
+			stats.spawnedCreepCount,
+			stats.maxAliveCreepCount,
+			stats.startLifes - state.stats.lifes,
+			stats.maxBulletCount,
+			state.stats.money - stats.startMoney);
+		fplConsoleFormatOut("\tChecksum: %016llx\n", (unsigned long long)stats.checksum);
+	}
+
+	static int RunBenchmark(const BenchmarkConfig &config) {
+		if (!fplPlatformInit(fplInitFlags_None, nullptr)) {
+			return -1;
+		}
+
+		fmemMemoryBlock gameMemoryBlock = {};
+		fmemMemoryBlock renderMemoryBlock = {};
+		if (!fmemInit(&gameMemoryBlock, fmemType_Growable, FMEM_MEGABYTES(128)) || !fmemInit(&renderMemoryBlock, fmemType_Growable, FMEM_MEGABYTES(32))) {
+			fplPlatformRelease();
+			return -1;
+		}
+
+		// Assets are pushed into the render state, but it is never executed
+		RenderState renderState = {};
+		InitRenderState(renderState, renderMemoryBlock);
+
+		GameMemory gameMem = {};
+		gameMem.memory = &gameMemoryBlock;
+		gameMem.render = &renderState;
+		int result = -1;
+		if (GameInit(gameMem)) {
+			GameState &state = *gameMem.game;
+
+			// @NOTE(final): No lifes or money limits, so every wave runs to the end regardless of the tower layout
+			state.stats.lifes = INT32_MAX / 2;
+			state.stats.money = INT32_MAX / 2;
+
+			Input input = {};
+			input.isActive = true;
+			input.deltaTime = TickDeltaTime;
+			input.framesPerSeconds = 1.0f / TickDeltaTime;
+
+			fplConsoleFormatOut("Headless benchmark (creep scale %d, max towers %d, %s)\n", config.creepScale, config.maxTowerCount, state.pathingMode == PathingMode::FlowField ? "flow field" : "waypoints");
+
+			uint64_t totalChecksum = FNV64Offset;
+			uint64_t totalTickCount = 0;
+			double totalUpdateTime = 0.0;
+			WaveStats stats;
+			int waveIndex = state.wave.activeIndex;
+			BeginWave(state, config, stats);
+			result = 0;
+			for (;;) {
+				double updateStart = fplGetTimeInMillisecondsHP();
+				GameUpdate(gameMem, input);
+				stats.updateTime += fplGetTimeInMillisecondsHP() - updateStart;
+				stats.tickCount++;
+
+				size_t aliveCount = 0;
+				for (size_t enemyIndex = 0; enemyIndex < state.enemies.count; ++enemyIndex) {
+					if (!state.enemies.list[enemyIndex].isDead) {
+						++aliveCount;
+					}
+				}
+				stats.maxAliveCreepCount = fplMax(stats.maxAliveCreepCount, aliveCount);
+				stats.maxBulletCount = fplMax(stats.maxBulletCount, state.bullets.count);
+				HashGameState(stats.checksum, state);
+
+				bool isFinished = state.wave.state == WaveState::Won || state.wave.state == WaveState::Lost;
+				if (isFinished || state.wave.activeIndex != waveIndex) {
+					PrintWave(state, waveIndex, stats);
+					HashValue(totalChecksum, stats.checksum);
+					totalTickCount += stats.tickCount;
+					totalUpdateTime += stats.updateTime;
+					if (isFinished) {
+						break;
+					}
+					waveIndex = state.wave.activeIndex;
+					BeginWave(state, config, stats);
+				} else if (stats.tickCount >= MaxTicksPerWave) {
+					fplConsoleFormatError("Wave %d did not finish after %llu ticks!\n", waveIndex + 1, (unsigned long long)stats.tickCount);
+					result = -1;
+					break;
+				}
+			}
+
+			fplConsoleFormatOut("Total: %llu ticks in %.2f ms (%.0f ticks/s), checksum: %016llx\n",
+				(unsigned long long)totalTickCount,
+				totalUpdateTime,
+				totalUpdateTime > 0 ? totalTickCount / (totalUpdateTime / 1000.0) : 0.0,
+				(unsigned long long)totalChecksum);
+
+			GameRelease(gameMem);
+		}
+
+		fmemFree(&renderMemoryBlock);
+		fmemFree(&gameMemoryBlock);
+		fplPlatformRelease();
+		return(result);
+	}
+}
+
 #define FINAL_GAMEPLATFORM_IMPLEMENTATION
 #include <final_gameplatform.h>
 
 int main(int argc, char *argv[]) {
+	bool isHeadless = false;
+	bool isCook = false;
+	bool useGameThread = false;
+	const char *recordFilePath = nullptr;
+	const char *replayFilePath = nullptr;
+	bool isWithoutWindow = false;
+	bool isUnlimited = false;
+	uint32_t frameCount = 0;
+	headless::BenchmarkConfig benchmarkConfig = {};
+	benchmarkConfig.creepScale = 1;
+	benchmarkConfig.maxTowerCount = INT32_MAX;
+	for (int i = 1; i < argc; ++i) {
+		if (fplIsStringEqual(argv[i], "-headless")) {
+			isHeadless = true;
+		} else if (fplIsStringEqual(argv[i], "-cook")) {
+			isCook = true;
+		} else if (fplIsStringEqual(argv[i], "-flowfield")) {
+			globalStartupPathingMode = PathingMode::FlowField;
+		} else if (fplIsStringEqual(argv[i], "-gamethread")) {
+			useGameThread = true;
+		} else if (fplIsStringEqual(argv[i], "-record") && (i + 1) < argc) {
+			recordFilePath = argv[++i];
+		} else if (fplIsStringEqual(argv[i], "-replay") && (i + 1) < argc) {
+			replayFilePath = argv[++i];
+		} else if (fplIsStringEqual(argv[i], "-nowindow")) {
+			isWithoutWindow = true;
+		} else if (fplIsStringEqual(argv[i], "-frames") && (i + 1) < argc) {
+			int frames = utils::StringToInt(argv[++i], 0);
+			frameCount = (uint32_t)fplMax(0, frames);
+		} else if (fplIsStringEqual(argv[i], "-unlimited")) {
+			isUnlimited = true;
+		} else if (fplIsStringEqual(argv[i], "-scale") && (i + 1) < argc) {
+			int creepScale = utils::StringToInt(argv[++i], 1);
+			benchmarkConfig.creepScale = fplMax(1, creepScale);
+		} else if (fplIsStringEqual(argv[i], "-towers") && (i + 1) < argc) {
+			int maxTowerCount = utils::StringToInt(argv[++i], 0);
+			benchmarkConfig.maxTowerCount = fplMax(0, maxTowerCount);
+		}
+	}
+	if (isCook) {
+		int result = cook::RunCook();
+		return(result);
+	}
+	if (isHeadless) {
+		int result = headless::RunBenchmark(benchmarkConfig);
+		return(result);
+	}
+
 	GameConfiguration config = {};
 	config.title = L"FPL Demo | Towadev";
 	config.disableInactiveDetection = true;
 	config.noUpdateRenderSeparation = true;
+	config.useGameThread = useGameThread;
+	config.recordFilePath = recordFilePath;
+	config.replayFilePath = replayFilePath;
+	config.isHeadless = isWithoutWindow;
+	config.headlessFrameCount = frameCount;
+	config.isUnlimited = isUnlimited;
+	config.checksum = headless::ComputeGameChecksum;
 	gamelog::Verbose("Startup game application '%s'", config.title);
 	int result = GameMain(config);
 	return(result);
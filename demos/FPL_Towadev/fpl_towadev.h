@@ -35,6 +35,14 @@ constexpr float ControlsHeight = TileHeight;
 constexpr float ControlsOriginX = -WorldRadiusW;
 constexpr float ControlsOriginY = -WorldRadiusH;
 
+constexpr size_t MaxCreepCount = 1024;
+
+// Creep grid covers the entire world with one cell per tile, including the controls row
+constexpr int CreepGridCountX = FieldTileCountX;
+constexpr int CreepGridCountY = FieldTileCountY + 1;
+constexpr int CreepGridCellCount = CreepGridCountX * CreepGridCountY;
+constexpr float CreepGridQueryPadding = 0.001f;
+
 
 const Vec4f TextBackColor = V4fInit(0.2f, 0.2f, 0.8f, 1);
 const Vec4f TextForeColor = V4fInit(1, 1, 1, 1);
@@ -42,6 +50,8 @@ const Vec4f TextForeColor = V4fInit(1, 1, 1, 1);
 const char *TowersDataFilename = "towers.xml";
 const char *WavesDataFilename = "waves.xml";
 const char *CreepsDataFilename = "creeps.xml";
+const char *CookedDefinitionsFilename = "definitions.cooked";
+const char *CookedLevelFileExtension = ".cooked";
 
 typedef const void *UIID;
 
@@ -55,6 +65,57 @@ struct FileContents {
 	uint8_t *data;
 };
 
+// Read-only view of a whole file mapped into memory
+struct MappedFile {
+	const uint8_t *data;
+	size_t size;
+#if defined(FPL_PLATFORM_WINDOWS)
+	HANDLE mappingHandle;
+#endif
+};
+
+// Cooked files are memory images of the runtime structures, written by the cook step (-cook)
+// They are only valid for builds with the same structure layout, so every section stores the element size
+constexpr uint32_t CookedFileMagic = 'T' | ('W' << 8) | ('C' << 16) | ('F' << 24);
+constexpr uint32_t CookedFileVersion = 1;
+constexpr size_t CookedFileMaxSourceCount = 4;
+constexpr size_t CookedFileMaxSectionCount = 4;
+constexpr size_t CookedFileAlignment = 16;
+
+struct CookedSection {
+	// Offset from the start of the file
+	uint64_t offset;
+	uint64_t count;
+	uint32_t stride;
+};
+
+struct CookedFileHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t headerSize;
+	uint32_t sourceCount;
+	uint32_t sectionCount;
+	uint64_t fileSize;
+	// Source files the cooked file was made from, it is stale when any of them has changed
+	FileInfo sources[CookedFileMaxSourceCount];
+	CookedSection sections[CookedFileMaxSectionCount];
+};
+
+enum class CookedDefinitionsSection : uint32_t {
+	Creeps = 0,
+	Towers,
+	Waves,
+	Count,
+};
+
+enum class CookedLevelSection : uint32_t {
+	// LevelData with offsets instead of pointers for the layer data and the tile UVs
+	Level = 0,
+	LayerData,
+	TileUVs,
+	Count,
+};
+
 struct UIInput {
 	Vec2f userPosition;
 	ButtonState leftButton;
@@ -472,10 +533,17 @@ struct Waypoints {
 
 struct Creeps {
 	uint64_t creepIdCounter;
-	Creep list[1024];
+	Creep list[MaxCreepCount];
 	size_t count;
 };
 
+struct CreepGrid {
+	// Creep indices of cell i are in creepIndices[cellStart[i]] to creepIndices[cellStart[i + 1] - 1], in ascending order
+	uint16_t cellStart[CreepGridCellCount + 1];
+	uint16_t creepIndices[MaxCreepCount];
+	float maxCollisionRadius;
+};
+
 struct Bullets {
 	Bullet list[10240];
 	size_t count;
@@ -501,11 +569,34 @@ struct LevelDimension {
 	float gridHeight;
 };
 
+enum class PathingMode {
+	// Creeps follow the waypoints of the level
+	Waypoints = 0,
+	// Creeps walk downhill on the flow field, towers can be placed on the way as long as they do not block it
+	FlowField,
+};
+
+constexpr int32_t FlowFieldUnreachable = INT32_MAX;
+
+struct FlowField {
+	// Number of tile steps to the goal for every tile, FlowFieldUnreachable for blocked or enclosed tiles
+	int32_t *distances;
+	// Scratch buffers for updates and queries, one entry for every tile
+	int32_t *queue;
+	int32_t *seeds;
+	uint8_t *marks;
+	Vec2i goalTilePos;
+	int32_t tileCount;
+};
+
 struct Level {
 	fmemMemoryBlock levelMem;
 	LevelData data;
+	// Layer data and tile UVs are pointing into the cooked file, when the level was loaded from it
+	MappedFile cookedFile;
 	char activeId[256];
 	LevelDimension dimension;
+	FlowField flowField;
 	Tile *tiles;
 	size_t tileCapacity;
 };
@@ -528,6 +619,7 @@ struct GameState {
 	Towers towers;
 	Bullets bullets;
 	Creeps enemies;
+	CreepGrid enemyGrid;
 	Waypoints waypoints;
 	CreepSpawners spawners;
 
@@ -555,6 +647,8 @@ struct GameState {
 	bool isSlowDown;
 	WaveState waveStateAfterSlowdown;
 
+	PathingMode pathingMode;
+
 	bool isExiting;
 	bool isDebugRendering;
 };
@@ -578,6 +672,14 @@ inline Vec2i WorldToTile(const LevelDimension &dim, const Vec2f &worldPos) {
 	return(result);
 }
 
+inline Vec2i WorldToCreepCell(const Vec2f &worldPos) {
+	// @NOTE(final): Positions outside the world are clamped into the border cells, so range queries stay conservative
+	int x = (int)floorf((worldPos.x + WorldRadiusW) / TileWidth);
+	int y = (int)floorf((worldPos.y + WorldRadiusH) / TileHeight);
+	Vec2i result = V2iInit(fplMax(0, fplMin(x, CreepGridCountX - 1)), fplMax(0, fplMin(y, CreepGridCountY - 1)));
+	return(result);
+}
+
 inline bool IsValidTile(const LevelDimension &dim, const Vec2i &tilePos) {
 	bool result = !(tilePos.x < 0 || tilePos.x >((int)dim.tileCountX - 1) || tilePos.y < 0 || tilePos.y >((int)dim.tileCountY - 1));
 	return(result);
@@ -418,6 +418,9 @@ static void RemovePlayItem(AudioPlayItems *playItems, AudioPlayItem *playItem) {
 }
 
 extern void AudioSystemStopSource(AudioSystem *audioSys, const uint64_t playId) {
+	if (audioSys == fpl_null) {
+		return;
+	}
 	AudioPlayItem *playItem = audioSys->playItems.first;
 	AudioPlayItem *foundPlayItem = fpl_null;
 	while (playItem != fpl_null) {
@@ -14,6 +14,12 @@
 #	define SUPPORTS_TIMED_BLOCK
 #endif
 
+#if defined(FPL_COMPILER_MSVC)
+#	define DEBUG_THREAD_LOCAL __declspec(thread)
+#else
+#	define DEBUG_THREAD_LOCAL __thread
+#endif
+
 typedef enum DebugType {
 	DebugType_Unknown = 0,
 	DebugType_FrameMarker,
@@ -24,7 +30,7 @@ typedef enum DebugType {
 
 typedef struct DebugEvent {
 	uint64_t clock;
-	char *guid;
+	const char *guid;
 #if defined(FPL_CPU_32BIT)
 	uint32_t guidPadding;
 #endif
@@ -35,12 +41,62 @@ typedef struct DebugEvent {
 } DebugEvent;
 fplStaticAssert(sizeof(DebugEvent) % 32 == 0);
 
-#define MAX_DEBUG_EVENT_COUNT (16 * 65536)
+// Number of events per thread and per frame
+#define MAX_DEBUG_EVENT_COUNT 65536
+// Number of threads which can record events at the same time
+#define MAX_DEBUG_THREAD_COUNT 16
 
-typedef struct DebugTable {
+typedef enum DebugRingState {
+	// Not used by any thread
+	DebugRingState_Free = 0,
+	// Claimed by a thread, but not initialized yet
+	DebugRingState_Claimed,
+	// Recording events
+	DebugRingState_Active,
+	// The thread has unregistered, the next frame swap collects the remaining events and frees the ring
+	DebugRingState_Released,
+} DebugRingState;
+
+//
+// Each thread records into its own double-buffered event ring, so recording never touches a shared cacheline.
+// The upper 32-bits of arrayIndex_EventIndex selects the active event array, the lower 32-bits are the next event index.
+// The frame swap exchanges this value atomically, which collects the events of the last frame without any lock.
+// Rings are reused: A thread claims a free ring on its first event and returns it with UnregisterDebugThread().
+//
+typedef struct DebugThreadRing {
 	DebugEvent events[2][MAX_DEBUG_EVENT_COUNT];
-	volatile uint64_t eventArrayIndex_EventIndex;
-	uint32_t currentEventArrayIndex;
+	volatile uint64_t arrayIndex_EventIndex;
+	uint8_t padding0[64 - sizeof(uint64_t)];
+	volatile uint32_t droppedEventCount;
+	volatile uint32_t state;
+	uint32_t threadID;
+	uint8_t padding1[64 - sizeof(uint32_t) * 3];
+} DebugThreadRing;
+
+typedef struct DebugCollectedEvents {
+	const DebugEvent *events;
+	uint32_t count;
+	uint32_t droppedCount;
+} DebugCollectedEvents;
+
+typedef struct DebugTable {
+	DebugThreadRing rings[MAX_DEBUG_THREAD_COUNT];
+	// Events of the last frame swap, per ring
+	DebugCollectedEvents collected[MAX_DEBUG_THREAD_COUNT];
+	// Events of threads which did not get a ring, because all rings were in use
+	volatile uint32_t droppedEventCount;
+	// Incremented every time a ring is freed, so threads without a ring only retry registration when it may succeed
+	volatile uint32_t freeRingGeneration;
+	volatile uint32_t currentEventArrayIndex;
+	uint32_t collectedRingCount;
+	uint32_t collectedDroppedCount;
+	// Clock calibration for the trace exporter
+	uint64_t startClock;
+	double startSeconds;
+	// Chrome trace exporter state
+	fplFileHandle traceFile;
+	uint64_t traceEventCount;
+	bool isTraceActive;
 } DebugTable;
 
 typedef struct DebugMemory {
@@ -50,36 +106,72 @@ typedef struct DebugMemory {
 
 extern DebugTable *globalDebugTable;
 extern DebugMemory *globalDebugMemory;
+extern DEBUG_THREAD_LOCAL DebugThreadRing *globalDebugThreadRing;
+// Free ring generation + 1 of the last failed registration of this thread, zero when it has never failed
+extern DEBUG_THREAD_LOCAL uint32_t globalDebugThreadFailedGeneration;
 
 extern void InitDebug(const size_t storageSize);
 extern void ReleaseDebug();
 
+// Returns the event ring for the calling thread, registers the thread on first use.
+// Returns null when all rings are in use, the registration is retried only after a ring was freed.
+extern DebugThreadRing *RegisterDebugThread();
+// Returns the ring of the calling thread, call this before a recording thread exits
+extern void UnregisterDebugThread();
+
+// Swaps the event arrays of all threads and makes the events of the last frame available in globalDebugTable->collected.
+// Must be called from one thread only (usually the main thread at the end of a frame).
+// When a chrome trace is active, the collected events are appended to the trace file.
+extern uint32_t DebugFrameSwap();
+
+// Chrome Trace Event JSON exporter (chrome://tracing, https://ui.perfetto.dev)
+extern bool BeginDebugChromeTrace(const char *filePath);
+extern void EndDebugChromeTrace();
+
 #if defined(DEBUG_ENABLED)
 
 #define UniqueFileCounterString__(a, b, c, d) a "|" #b "|" #c "|" d
 #define UniqueFileCounterString_(a, b, c, d) UniqueFileCounterString__(a, b, c, d)
 #define DEBUG_NAME(name) UniqueFileCounterString_(__FILE__, __LINE__, __COUNTER__, name)
 
-fpl_force_inline void RecordDebugEvent(DebugType type, char* guid, float value) {
+fpl_force_inline void RecordDebugEvent(DebugType type, const char *guid, float value) {
 	fplAssert(globalDebugTable);
-	uint64_t arrayIndex_EventIndex = fplAtomicIncrementU64(&globalDebugTable->eventArrayIndex_EventIndex);
+	DebugThreadRing *ring = globalDebugThreadRing;
+	if (ring == fpl_null) {
+		ring = RegisterDebugThread();
+		if (ring == fpl_null) {
+			fplAtomicIncrementU32(&globalDebugTable->droppedEventCount);
+			return;
+		}
+	}
+	// Only contended by the frame swap, never by other recording threads
+	uint64_t arrayIndex_EventIndex = fplAtomicFetchAndAddU64(&ring->arrayIndex_EventIndex, 1);
 	uint32_t eventIndex = arrayIndex_EventIndex & 0xFFFFFFFF;
-	fplAssert(eventIndex < fplArrayCount(globalDebugTable->events[0]));
-	DebugEvent *ev = globalDebugTable->events[arrayIndex_EventIndex >> 32] + eventIndex;
+	if (eventIndex >= MAX_DEBUG_EVENT_COUNT) {
+		fplAtomicIncrementU32(&ring->droppedEventCount);
+		return;
+	}
+	DebugEvent *ev = ring->events[arrayIndex_EventIndex >> 32] + eventIndex;
 	ev->clock = fplRDTSC();
 	ev->type = (uint8_t)type;
 	ev->coreIndex = 0;
-	ev->threadID = (uint16_t)fplGetCurrentThreadId();
+	ev->threadID = (uint16_t)ring->threadID;
 	ev->guid = guid;
 	ev->value = value;
 }
 
 #define FRAME_MARKER(secondsElapsed) \
-	{ RecordDebugEvent(DebugType_FrameMarker, DEBUG_NAME("Frame Marker"), secondsElapsed); }  
+	{ RecordDebugEvent(DebugType_FrameMarker, DEBUG_NAME("Frame Marker"), secondsElapsed); }
+
+#define BEGIN_BLOCK_(guid) {RecordDebugEvent(DebugType_BeginBlock, guid, 0.0f);}
+#define END_BLOCK_() {RecordDebugEvent(DebugType_EndBlock, DEBUG_NAME("::END_BLOCK::"), 0.0f);}
+
+#define BEGIN_BLOCK(name) BEGIN_BLOCK_(DEBUG_NAME(name))
+#define END_BLOCK() END_BLOCK_()
 
 #if defined(SUPPORTS_TIMED_BLOCK)
 struct TimedBlock {
-	TimedBlock(char *guid, U32 hitCountInit = 1) {
+	TimedBlock(const char *guid, uint32_t hitCountInit = 1) {
 		BEGIN_BLOCK_(guid);
 	}
 
@@ -93,20 +185,13 @@ struct TimedBlock {
 #	define TIMED_BLOCK(name, ...) TIMED_BLOCK_(DEBUG_NAME(name), __COUNTER__, ## __VA_ARGS__)
 #	define TIMED_FUNCTION(...) TIMED_BLOCK_(DEBUG_NAME(__FUNCTION__), ## __VA_ARGS__)
 #else
-#	define TIMED_BLOCK(...) 
-#	define TIMED_FUNCTION(...) 
+#	define TIMED_BLOCK(...)
+#	define TIMED_FUNCTION(...)
 #endif
 
-#define BEGIN_BLOCK_(guid) {RecordDebugEvent(DebugType_BeginBlock, guid);}
-#define END_BLOCK_() {RecordDebugEvent(DebugType_EndBlock, DEBUG_NAME("::END_BLOCK::"));}
-
-#define BEGIN_BLOCK(name) BEGIN_BLOCK_(DEBUG_NAME(name))
-#define END_BLOCK() END_BLOCK_()
-
-
 #else
-#	define TIMED_BLOCK(...) 
-#	define TIMED_FUNCTION(...) 
+#	define TIMED_BLOCK(...)
+#	define TIMED_FUNCTION(...)
 #	define BEGIN_BLOCK(...)
 #	define END_BLOCK(...)
 #	define FRAME_MARKER(...)
@@ -122,27 +207,209 @@ struct TimedBlock {
 
 DebugTable *globalDebugTable = fpl_null;
 DebugMemory *globalDebugMemory = fpl_null;
+DEBUG_THREAD_LOCAL DebugThreadRing *globalDebugThreadRing = fpl_null;
+DEBUG_THREAD_LOCAL uint32_t globalDebugThreadFailedGeneration = 0;
+
+#define DEBUG__ALIGNED_SIZE(size) (((size) + 63) & ~(size_t)63)
 
 extern void InitDebug(const size_t storageSize) {
 	fplAssert(globalDebugMemory == fpl_null);
 	fplAssert(globalDebugTable == fpl_null);
-	size_t totalSize = sizeof(DebugMemory) + 8 + sizeof(DebugTable) + 8 + storageSize;
-	void *base = fplMemoryAllocate(totalSize);
+	size_t memorySize = DEBUG__ALIGNED_SIZE(sizeof(DebugMemory));
+	size_t tableSize = DEBUG__ALIGNED_SIZE(sizeof(DebugTable));
+	size_t totalSize = memorySize + tableSize + storageSize;
+	void *base = fplMemoryAlignedAllocate(totalSize, 64);
+	fplMemoryClear(base, memorySize + tableSize);
 	globalDebugMemory = (DebugMemory *)base;
-	globalDebugMemory->storageBase = (uint8_t *)base + sizeof(DebugMemory) + 8 + sizeof(DebugTable) + 8;
+	globalDebugMemory->storageBase = (uint8_t *)base + memorySize + tableSize;
 	globalDebugMemory->storageSize = storageSize;
-	globalDebugTable = (DebugTable *)(uint8_t *)base + sizeof(DebugMemory) + 8;
+	globalDebugTable = (DebugTable *)((uint8_t *)base + memorySize);
+	globalDebugTable->startClock = fplRDTSC();
+	globalDebugTable->startSeconds = fplGetTimeInSecondsHP();
 }
 
 extern void ReleaseDebug() {
+	if (globalDebugTable != fpl_null && globalDebugTable->isTraceActive) {
+		EndDebugChromeTrace();
+	}
 	if (globalDebugMemory != fpl_null) {
-		fplAssert(globalDebugMemory->storageBase != fpl_null);
-		size_t offsetToBase = 8 + sizeof(DebugMemory) + 8 + sizeof(DebugTable);
-		void *base = (uint8_t *)globalDebugMemory->storageBase - offsetToBase;
-		fplMemoryFree(base);
+		// DebugMemory is always the base of the allocation
+		fplMemoryAlignedFree(globalDebugMemory);
 	}
 	globalDebugTable = fpl_null;
 	globalDebugMemory = fpl_null;
+	globalDebugThreadRing = fpl_null;
+	globalDebugThreadFailedGeneration = 0;
+}
+
+extern DebugThreadRing *RegisterDebugThread() {
+	DebugTable *table = globalDebugTable;
+	fplAssert(table != fpl_null);
+	if (globalDebugThreadRing == fpl_null) {
+		uint32_t generation = fplAtomicLoadU32(&table->freeRingGeneration);
+		if (globalDebugThreadFailedGeneration == generation + 1) {
+			// Already failed and no ring was freed since then
+			return fpl_null;
+		}
+		DebugThreadRing *ring = fpl_null;
+		for (uint32_t ringIndex = 0; ringIndex < MAX_DEBUG_THREAD_COUNT; ++ringIndex) {
+			if (fplIsAtomicCompareAndSwapU32(&table->rings[ringIndex].state, DebugRingState_Free, DebugRingState_Claimed)) {
+				ring = table->rings + ringIndex;
+				break;
+			}
+		}
+		if (ring == fpl_null) {
+			// Too many threads, events of this thread are dropped until a ring is freed
+			globalDebugThreadFailedGeneration = generation + 1;
+			return fpl_null;
+		}
+		// The frame swap skips claimed rings, so the ring is fully initialized before it becomes active
+		ring->threadID = fplGetCurrentThreadId();
+		fplAtomicStoreU32(&ring->droppedEventCount, 0);
+		uint64_t initialArrayIndex = (uint64_t)fplAtomicLoadU32(&table->currentEventArrayIndex) << 32;
+		fplAtomicStoreU64(&ring->arrayIndex_EventIndex, initialArrayIndex);
+		fplAtomicStoreU32(&ring->state, DebugRingState_Active);
+		// A frame swap may have skipped the claimed ring, move it to the new array unless the swap has done that already
+		uint64_t currentArrayIndex = (uint64_t)fplAtomicLoadU32(&table->currentEventArrayIndex) << 32;
+		if (currentArrayIndex != initialArrayIndex) {
+			fplIsAtomicCompareAndSwapU64(&ring->arrayIndex_EventIndex, initialArrayIndex, currentArrayIndex);
+		}
+		globalDebugThreadRing = ring;
+		globalDebugThreadFailedGeneration = 0;
+	}
+	return(globalDebugThreadRing);
+}
+
+extern void UnregisterDebugThread() {
+	DebugThreadRing *ring = globalDebugThreadRing;
+	if (ring != fpl_null) {
+		fplAssert(globalDebugTable != fpl_null);
+		globalDebugThreadRing = fpl_null;
+		fplAtomicStoreU32(&ring->state, DebugRingState_Released);
+	}
+	globalDebugThreadFailedGeneration = 0;
+}
+
+fpl_internal void Debug__TraceWrite(const char *text, const size_t len) {
+	fplAssert(globalDebugTable->isTraceActive);
+	fplWriteFileBlock32(&globalDebugTable->traceFile, (void *)text, (uint32_t)len);
+}
+
+// Writes "name" part of "file|line|counter|name" as escaped JSON string content
+fpl_internal size_t Debug__EscapeGuidName(const char *guid, char *buffer, const size_t maxBufferLen) {
+	const char *name = guid;
+	for (const char *p = guid; *p; ++p) {
+		if (*p == '|') {
+			name = p + 1;
+		}
+	}
+	size_t len = 0;
+	for (const char *p = name; *p && (len + 2) < maxBufferLen; ++p) {
+		if (*p == '"' || *p == '\\') {
+			buffer[len++] = '\\';
+		}
+		buffer[len++] = (*p < 0x20) ? ' ' : *p;
+	}
+	buffer[len] = 0;
+	return(len);
+}
+
+// The ring index is used as trace thread id, because thread ids are not available on every platform
+fpl_internal void Debug__TraceWriteEvents(const DebugEvent *events, const uint32_t count, const uint32_t ringIndex) {
+	DebugTable *table = globalDebugTable;
+	double elapsedSeconds = fplGetTimeInSecondsHP() - table->startSeconds;
+	uint64_t elapsedClocks = fplRDTSC() - table->startClock;
+	double microsecondsPerClock = (elapsedClocks > 0) ? ((elapsedSeconds * 1000000.0) / (double)elapsedClocks) : 0.0;
+	char nameBuffer[256];
+	char line[512];
+	for (uint32_t eventIndex = 0; eventIndex < count; ++eventIndex) {
+		const DebugEvent *ev = events + eventIndex;
+		double ts = (double)(ev->clock - table->startClock) * microsecondsPerClock;
+		const char *separator = table->traceEventCount > 0 ? ",\n" : "\n";
+		switch (ev->type) {
+			case DebugType_BeginBlock:
+				Debug__EscapeGuidName(ev->guid, nameBuffer, fplArrayCount(nameBuffer));
+				fplFormatString(line, fplArrayCount(line), "%s{\"name\":\"%s\",\"ph\":\"B\",\"ts\":%.3f,\"pid\":0,\"tid\":%u}", separator, nameBuffer, ts, ringIndex);
+				break;
+			case DebugType_EndBlock:
+				fplFormatString(line, fplArrayCount(line), "%s{\"ph\":\"E\",\"ts\":%.3f,\"pid\":0,\"tid\":%u}", separator, ts, ringIndex);
+				break;
+			case DebugType_FrameMarker:
+				fplFormatString(line, fplArrayCount(line), "%s{\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f,\"pid\":0,\"tid\":%u,\"args\":{\"seconds\":%f}}", separator, ts, ringIndex, ev->value);
+				break;
+			default:
+				continue;
+		}
+		Debug__TraceWrite(line, fplGetStringLength(line));
+		++table->traceEventCount;
+	}
+}
+
+extern uint32_t DebugFrameSwap() {
+	DebugTable *table = globalDebugTable;
+	fplAssert(table != fpl_null);
+	uint32_t nextArrayIndex = !table->currentEventArrayIndex;
+	// Published first, so threads registering during the swap start in the new array
+	fplAtomicStoreU32(&table->currentEventArrayIndex, nextArrayIndex);
+	uint32_t ringCount = 0;
+	uint32_t totalCount = 0;
+	for (uint32_t ringIndex = 0; ringIndex < MAX_DEBUG_THREAD_COUNT; ++ringIndex) {
+		DebugThreadRing *ring = table->rings + ringIndex;
+		DebugCollectedEvents *collected = table->collected + ringIndex;
+		uint32_t state = fplAtomicLoadU32(&ring->state);
+		if (state != DebugRingState_Active && state != DebugRingState_Released) {
+			fplClearStruct(collected);
+			continue;
+		}
+		uint64_t old = fplAtomicExchangeU64(&ring->arrayIndex_EventIndex, (uint64_t)nextArrayIndex << 32);
+		uint32_t oldArrayIndex = (uint32_t)(old >> 32);
+		uint32_t count = fplMin((uint32_t)(old & 0xFFFFFFFF), (uint32_t)MAX_DEBUG_EVENT_COUNT);
+		collected->events = ring->events[oldArrayIndex];
+		collected->count = count;
+		collected->droppedCount = fplAtomicExchangeU32(&ring->droppedEventCount, 0);
+		totalCount += count;
+		ringCount = ringIndex + 1;
+		if (state == DebugRingState_Released) {
+			// The owning thread is gone, all of its events are collected now
+			fplAtomicStoreU32(&ring->state, DebugRingState_Free);
+			fplAtomicIncrementU32(&table->freeRingGeneration);
+		}
+	}
+	table->collectedRingCount = ringCount;
+	table->collectedDroppedCount = fplAtomicExchangeU32(&table->droppedEventCount, 0);
+	if (table->isTraceActive) {
+		for (uint32_t ringIndex = 0; ringIndex < ringCount; ++ringIndex) {
+			Debug__TraceWriteEvents(table->collected[ringIndex].events, table->collected[ringIndex].count, ringIndex);
+		}
+	}
+	return(totalCount);
+}
+
+extern bool BeginDebugChromeTrace(const char *filePath) {
+	DebugTable *table = globalDebugTable;
+	fplAssert(table != fpl_null);
+	if (table->isTraceActive) {
+		return(false);
+	}
+	if (!fplCreateBinaryFile(filePath, &table->traceFile)) {
+		return(false);
+	}
+	table->isTraceActive = true;
+	table->traceEventCount = 0;
+	const char *header = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+	Debug__TraceWrite(header, fplGetStringLength(header));
+	return(true);
+}
+
+extern void EndDebugChromeTrace() {
+	DebugTable *table = globalDebugTable;
+	fplAssert(table != fpl_null);
+	if (table->isTraceActive) {
+		const char *footer = "\n]}\n";
+		Debug__TraceWrite(footer, fplGetStringLength(footer));
+		fplCloseFile(&table->traceFile);
+		table->isTraceActive = false;
+	}
 }
 
-#endif // FINAL_DEBUG_IMPLEMENTATION
\ No newline at end of file
+#endif // FINAL_DEBUG_IMPLEMENTATION
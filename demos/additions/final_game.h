@@ -77,9 +77,25 @@ struct Mouse {
 	};
 };
 
+// Frame time distribution over the last frames in milliseconds
+struct FrameTimeStats {
+	float p50;
+	float p95;
+	float p99;
+	float max;
+	// Expected frame time, either from the frame pacer or the median when pacing is disabled
+	float expected;
+	// Number of frames in the window and how many of them took more than 1.5x of the expected frame time
+	uint32_t frameCount;
+	uint32_t missedFrameCount;
+	// Total number of updates dropped, because the game could not catch up with the update rate
+	uint32_t droppedUpdateCount;
+};
+
 struct Input {
 	float deltaTime;
 	float framesPerSeconds;
+	FrameTimeStats frameStats;
 	int frameIndex;
 	union {
 		struct {
@@ -101,8 +117,13 @@ struct GameMemory {
 	struct GameState *game;
 	struct RenderState *render;
 	struct AudioSystem *audio;
+	// Seed for random number generators, recorded and replayed together with the input
+	uint32_t randomSeed;
 };
 
+// Computes a checksum of the simulation state, used to verify that a replay matches its recording
+typedef uint64_t (GameChecksumFunc)(GameMemory &gameMemory);
+
 enum class GameWindowActiveType : uint32_t {
 	None = 0,
 	GotFocus = 1 << 0,
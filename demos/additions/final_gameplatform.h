@@ -9,6 +9,17 @@ Description:
 	This file is part of the final_framework.
 
 Changelog:
+	## 2026-10-18
+	- Optional game thread (useGameThread): Input handling, update and render command generation runs on a separate thread,
+	  while the main thread renders and flips the previous frame from a double-buffered RenderState
+	- Configurable update rate and maximum catch-up updates per frame, dropped updates are counted
+	- Frame pacer with a target frame rate, sleeps for the most part and spins the rest to hit the deadline
+	- Rolling frame time histogram (p50/p95/p99, missed frames) in Input::frameStats and an optional overlay
+	- Input recording (recordFilePath) and deterministic replay (replayFilePath), optionally without a window
+	  and at maximum speed, verified with game state checksums (GameConfiguration::checksum)
+	- Headless mode (isHeadless) without window, OpenGL and audio device: Render commands are counted but not executed,
+	  audio is mixed into a null sink and the game exits after headlessFrameCount frames, followed by a summary
+
 	## 2019-01-31
 	- Center window on center from nearest display
 
@@ -38,11 +49,37 @@ struct GameConfiguration {
 	bool hideMouseCursor;
 	bool disableInactiveDetection;
 	bool noUpdateRenderSeparation;
+	// Updates the game on a separate thread, while the main thread renders the previous frame (One frame latency)
+	// The game must render through the RenderState only, since the OpenGL context belongs to the main thread
+	bool useGameThread;
+	bool noVSync;
+	// Draws the frame times of the last frames and the p50/p95/p99 lines on top of the game
+	bool showFrameStats;
+	// Rate in Hz for fixed-step updates (Default: 60)
+	uint32_t updateRate;
+	// Rate in Hz the frame pacer limits the frames to, zero disables the frame pacer
+	uint32_t targetFrameRate;
+	// Maximum number of updates per frame, the remaining time is dropped (Default: 6)
+	uint32_t maxUpdatesPerFrame;
+	// Records the input of every frame into this file (Optional)
+	const char *recordFilePath;
+	// Replays the input from this file instead of the input devices (Optional)
+	const char *replayFilePath;
+	// Runs without a window, OpenGL and audio output, for benchmarks and smoke tests
+	// Render commands are generated but not executed and audio is mixed into a null sink, so the game must render through the RenderState only
+	bool isHeadless;
+	// Number of frames after which a headless game exits (Default: DefaultHeadlessFrameCount, a replay runs until its end)
+	uint32_t headlessFrameCount;
+	// Runs replays and headless games as fast as possible, without VSync and frame pacing
+	bool isUnlimited;
+	// Computes a checksum of the game state, which is recorded periodically and verified on replay (Optional)
+	GameChecksumFunc *checksum;
 	uint32_t audioSampleRate;
 	uint32_t audioChannels;
 	fplAudioFormatType audioFormat;
 };
 
+// Returns 0 on success, -1 on errors and 1 when a replay was aborted or did not match its recording
 extern int GameMain(const GameConfiguration &config);
 
 #endif // FINAL_GAMEPLATFORM_H
@@ -274,11 +311,725 @@ static uint32_t GameAudioPlayback(const fplAudioDeviceFormat *outFormat, const u
 	return(result);
 }
 
+constexpr uint32_t DefaultUpdateRate = 60;
+constexpr uint32_t DefaultMaxUpdatesPerFrame = 6;
+// A headless game has no window to be closed, so it always exits after a number of frames
+constexpr uint32_t DefaultHeadlessFrameCount = 600;
+
+struct GameFrameContext {
+	GameMemory *gameMem;
+	const GameConfiguration *config;
+	const Input *input;
+	double targetDeltaTime;
+	double lastFrameTime;
+	double frameAccumulator;
+	// Duration in seconds and number of updates of the last game frame
+	double workDuration;
+	uint32_t updateCount;
+	uint32_t maxUpdateCount;
+	uint32_t droppedUpdateCount;
+};
+
+struct GameThread {
+	GameFrameContext *frame;
+	fplThreadHandle *handle;
+	fplSignalHandle startSignal;
+	fplSignalHandle finishedSignal;
+	volatile uint32_t isStopped;
+};
+
+// Durations in seconds, accumulated until the next fps timer tick
+struct GameThreadTiming {
+	double workDuration;
+	double renderDuration;
+	double waitDuration;
+};
+
+// Rolling window of the last frame times, with a histogram of 0.25 ms buckets for fast percentiles
+constexpr uint32_t FrameTimeWindowCount = 300;
+constexpr uint32_t FrameTimeBucketCount = 256;
+constexpr double FrameTimeBucketDuration = 0.25 / 1000.0;
+// Frames which took longer than the expected frame time multiplied by this factor are missed frames
+constexpr double MissedFrameFactor = 1.5;
+
+struct FrameTimeHistogram {
+	double frameTimes[FrameTimeWindowCount];
+	bool isMissed[FrameTimeWindowCount];
+	uint32_t buckets[FrameTimeBucketCount];
+	uint32_t count;
+	uint32_t next;
+	uint32_t missedCount;
+};
+
+static uint32_t GetFrameTimeBucket(const double frameTime) {
+	uint32_t result = (uint32_t)(frameTime / FrameTimeBucketDuration);
+	result = fplMin(result, FrameTimeBucketCount - 1);
+	return(result);
+}
+
+static void AddFrameTime(FrameTimeHistogram &histogram, const double frameTime, const bool isMissed) {
+	uint32_t index = histogram.next;
+	if(histogram.count == FrameTimeWindowCount) {
+		--histogram.buckets[GetFrameTimeBucket(histogram.frameTimes[index])];
+		if(histogram.isMissed[index]) {
+			--histogram.missedCount;
+		}
+	} else {
+		++histogram.count;
+	}
+	histogram.frameTimes[index] = frameTime;
+	histogram.isMissed[index] = isMissed;
+	++histogram.buckets[GetFrameTimeBucket(frameTime)];
+	if(isMissed) {
+		++histogram.missedCount;
+	}
+	histogram.next = (index + 1) % FrameTimeWindowCount;
+}
+
+// Returns the upper bound of the bucket containing the given percentile (Nearest rank) in seconds
+static double GetFrameTimePercentile(const uint32_t *buckets, const uint32_t count, const uint32_t percentile) {
+	if(count == 0) {
+		return(0.0);
+	}
+	uint32_t targetCount = (uint32_t)(((uint64_t)count * percentile + 99) / 100);
+	uint32_t sum = 0;
+	for(uint32_t bucketIndex = 0; bucketIndex < FrameTimeBucketCount; ++bucketIndex) {
+		sum += buckets[bucketIndex];
+		if(sum >= targetCount) {
+			return((double)(bucketIndex + 1) * FrameTimeBucketDuration);
+		}
+	}
+	return((double)FrameTimeBucketCount * FrameTimeBucketDuration);
+}
+
+static FrameTimeStats GetFrameTimeStats(const FrameTimeHistogram &histogram, const double expectedFrameTime, const uint32_t droppedUpdateCount) {
+	double maxFrameTime = 0.0;
+	for(uint32_t frameIndex = 0; frameIndex < histogram.count; ++frameIndex) {
+		maxFrameTime = fplMax(maxFrameTime, histogram.frameTimes[frameIndex]);
+	}
+	FrameTimeStats result = {};
+	result.p50 = (float)(GetFrameTimePercentile(histogram.buckets, histogram.count, 50) * 1000.0);
+	result.p95 = (float)(GetFrameTimePercentile(histogram.buckets, histogram.count, 95) * 1000.0);
+	result.p99 = (float)(GetFrameTimePercentile(histogram.buckets, histogram.count, 99) * 1000.0);
+	result.max = (float)(maxFrameTime * 1000.0);
+	result.expected = (float)(expectedFrameTime * 1000.0);
+	result.frameCount = histogram.count;
+	result.missedFrameCount = histogram.missedCount;
+	result.droppedUpdateCount = droppedUpdateCount;
+	return(result);
+}
+
+// Frame times of an entire session, summarized after replays and headless runs
+struct FrameTimeSummary {
+	uint32_t buckets[FrameTimeBucketCount];
+	uint32_t frameCount;
+	double maxFrameTime;
+	double totalFrameTime;
+};
+
+static void AddFrameTimeSummary(FrameTimeSummary &summary, const double frameTime) {
+	++summary.buckets[GetFrameTimeBucket(frameTime)];
+	++summary.frameCount;
+	summary.maxFrameTime = fplMax(summary.maxFrameTime, frameTime);
+	summary.totalFrameTime += frameTime;
+}
+
+static void PrintFrameTimeSummary(const FrameTimeSummary &summary) {
+	// Percentiles are bucket upper bounds, so they are limited to the exact maximum
+	double p50 = fplMin(GetFrameTimePercentile(summary.buckets, summary.frameCount, 50), summary.maxFrameTime);
+	double p95 = fplMin(GetFrameTimePercentile(summary.buckets, summary.frameCount, 95), summary.maxFrameTime);
+	double p99 = fplMin(GetFrameTimePercentile(summary.buckets, summary.frameCount, 99), summary.maxFrameTime);
+	fplConsoleFormatOut("Frame time: p50 %.3f ms, p95 %.3f ms, p99 %.3f ms, max %.3f ms\n", p50 * 1000.0, p95 * 1000.0, p99 * 1000.0, summary.maxFrameTime * 1000.0);
+}
+
+struct FramePacer {
+	double targetFrameTime;
+	double deadline;
+	// How much longer a sleep takes than requested, raises immediately and decays slowly
+	double sleepOvershoot;
+};
+
+static void InitFramePacer(FramePacer &pacer, const uint32_t targetFrameRate) {
+	pacer = {};
+	if(targetFrameRate > 0) {
+		pacer.targetFrameTime = 1.0 / (double)targetFrameRate;
+	}
+	pacer.sleepOvershoot = 1.0 / 1000.0;
+}
+
+static void ResetFramePacer(FramePacer &pacer) {
+	pacer.deadline = 0.0;
+}
+
+static void WaitForFrameDeadline(FramePacer &pacer) {
+	if(pacer.targetFrameTime <= 0.0) {
+		return;
+	}
+
+	double now = fplGetTimeInSecondsHP();
+	if(pacer.deadline <= 0.0 || now > pacer.deadline) {
+		// Deadline missed or first frame, start from now instead of catching up with shorter frames
+		pacer.deadline = now + pacer.targetFrameTime;
+		return;
+	}
+
+	// Sleep for the most part, sleeps are only precise to a millisecond or worse
+	for(;;) {
+		double sleepDuration = (pacer.deadline - fplGetTimeInSecondsHP()) - pacer.sleepOvershoot;
+		uint32_t sleepMsecs = (uint32_t)(sleepDuration * 1000.0);
+		if(sleepDuration <= 0.0 || sleepMsecs == 0) {
+			break;
+		}
+		double sleepStartTime = fplGetTimeInSecondsHP();
+		fplThreadSleep(sleepMsecs);
+		double overshoot = (fplGetTimeInSecondsHP() - sleepStartTime) - (double)sleepMsecs / 1000.0;
+		if(overshoot > pacer.sleepOvershoot) {
+			pacer.sleepOvershoot = fplMin(overshoot, pacer.targetFrameTime);
+		} else {
+			pacer.sleepOvershoot = pacer.sleepOvershoot * 0.95 + fplMax(overshoot, 0.0) * 0.05;
+		}
+	}
+
+	// Busy wait the rest, the remaining time is less than the expected sleep overshoot
+	while(fplGetTimeInSecondsHP() < pacer.deadline) {
+	}
+
+	pacer.deadline += pacer.targetFrameTime;
+}
+
+static void PushFrameStatsOverlay(RenderState &renderState, const FrameTimeHistogram &histogram, const FrameTimeStats &stats, const Vec2i &windowSize) {
+	const float barWidth = 2.0f;
+	const float graphHeight = 100.0f;
+	const float graphWidth = barWidth * (float)FrameTimeWindowCount;
+	const float margin = 10.0f;
+
+	// Twice the expected frame time fits into the graph
+	float maxFrameTime = fplMax(stats.expected * 2.0f, 1.0f);
+	float heightPerMsec = graphHeight / maxFrameTime;
+	Vec2f bottomLeft = V2fInit(margin, margin);
+
+	PushViewport(renderState, 0, 0, windowSize.w, windowSize.h);
+	SetMatrix(renderState, Mat4OrthoRH(0.0f, (float)windowSize.w, 0.0f, (float)windowSize.h, 0.0f, 1.0f));
+	PushRectangle(renderState, bottomLeft, V2fInit(graphWidth, graphHeight), V4fInit(0.0f, 0.0f, 0.0f, 0.5f), true, 1.0f);
+
+	// Oldest frame on the left
+	VertexAllocation bars = AllocateVertices(renderState, histogram.count * 2, V4fInit(0.2f, 0.6f, 1.0f, 1.0f), DrawMode::Lines, false, barWidth);
+	uint32_t firstIndex = (histogram.count == FrameTimeWindowCount) ? histogram.next : 0;
+	for(uint32_t frameIndex = 0; frameIndex < histogram.count; ++frameIndex) {
+		double frameTime = histogram.frameTimes[(firstIndex + frameIndex) % FrameTimeWindowCount];
+		float h = fplMin((float)(frameTime * 1000.0) * heightPerMsec, graphHeight);
+		float x = bottomLeft.x + (float)frameIndex * barWidth + barWidth * 0.5f;
+		bars.verts[frameIndex * 2 + 0] = V2fInit(x, bottomLeft.y);
+		bars.verts[frameIndex * 2 + 1] = V2fInit(x, bottomLeft.y + h);
+	}
+	*bars.count = histogram.count * 2;
+
+	const float lineTimes[] = { stats.expected, stats.p50, stats.p95, stats.p99 };
+	const Vec4f lineColors[] = { V4fInit(1.0f, 1.0f, 1.0f, 1.0f), V4fInit(0.0f, 1.0f, 0.0f, 1.0f), V4fInit(1.0f, 1.0f, 0.0f, 1.0f), V4fInit(1.0f, 0.0f, 0.0f, 1.0f) };
+	for(uint32_t lineIndex = 0; lineIndex < fplArrayCount(lineTimes); ++lineIndex) {
+		float y = bottomLeft.y + fplMin(lineTimes[lineIndex] * heightPerMsec, graphHeight);
+		PushLine(renderState, V2fInit(bottomLeft.x, y), V2fInit(bottomLeft.x + graphWidth, y), lineColors[lineIndex], 1.0f);
+	}
+}
+
+static void AdvanceGameFrame(GameFrameContext &frame, const double lastFrameTime, const bool resetAccumulator) {
+	frame.lastFrameTime = lastFrameTime;
+	if(resetAccumulator) {
+		frame.frameAccumulator = frame.targetDeltaTime;
+	} else if(!frame.config->noUpdateRenderSeparation) {
+		// Limit the catch-up updates, otherwise a slow frame leads to even more updates in the next one
+		double maxAccumulator = frame.targetDeltaTime * (double)frame.maxUpdateCount;
+		frame.frameAccumulator += lastFrameTime;
+		if(frame.frameAccumulator > maxAccumulator) {
+			frame.droppedUpdateCount += (uint32_t)((frame.frameAccumulator - maxAccumulator) / frame.targetDeltaTime);
+			frame.frameAccumulator = maxAccumulator;
+		}
+	}
+}
+
+static void UpdateAndRenderGame(GameFrameContext &frame) {
+	double startTime = fplGetTimeInSecondsHP();
+
+	GameMemory &gameMem = *frame.gameMem;
+	const Input &input = *frame.input;
+	const double targetDeltaTime = frame.targetDeltaTime;
+
+	ResetRenderState(*gameMem.render);
+
+	frame.updateCount = 0;
+	if(frame.config->noUpdateRenderSeparation) {
+		float alpha;
+		if(frame.lastFrameTime > 0) {
+			alpha = (float)frame.lastFrameTime / (float)targetDeltaTime;
+		} else {
+			alpha = 1.0f;
+		}
+		GameUpdateAndRender(gameMem, input, alpha);
+		// Combined update and render counts as one update
+		frame.updateCount = 1;
+	} else {
+		GameInput(gameMem, input);
+		while(frame.frameAccumulator >= targetDeltaTime) {
+			GameUpdate(gameMem, input);
+			frame.frameAccumulator -= targetDeltaTime;
+			++frame.updateCount;
+		}
+		float alpha = (float)frame.frameAccumulator / (float)targetDeltaTime;
+		GameRender(gameMem, alpha);
+	}
+
+	frame.workDuration = fplGetTimeInSecondsHP() - startTime;
+}
+
+static void GameThreadProc(const fplThreadHandle *thread, void *data) {
+	GameThread *gameThread = (GameThread *)data;
+	for(;;) {
+		fplSignalWaitForOne(&gameThread->startSignal, FPL_TIMEOUT_INFINITE);
+		if(fplAtomicLoadU32(&gameThread->isStopped)) {
+			break;
+		}
+		UpdateAndRenderGame(*gameThread->frame);
+		fplSignalSet(&gameThread->finishedSignal);
+	}
+}
+
+static bool StartGameThread(GameThread &gameThread, GameFrameContext *frame) {
+	gameThread = {};
+	gameThread.frame = frame;
+	if(!fplSignalInit(&gameThread.startSignal, fplSignalValue_Unset)) {
+		return(false);
+	}
+	// Set initially, so the first frame starts without waiting
+	if(!fplSignalInit(&gameThread.finishedSignal, fplSignalValue_Set)) {
+		fplSignalDestroy(&gameThread.startSignal);
+		return(false);
+	}
+	gameThread.handle = fplThreadCreate(GameThreadProc, &gameThread);
+	if(gameThread.handle == fpl_null) {
+		fplSignalDestroy(&gameThread.finishedSignal);
+		fplSignalDestroy(&gameThread.startSignal);
+		return(false);
+	}
+	return(true);
+}
+
+static void StopGameThread(GameThread &gameThread) {
+	// The game thread finishes its current frame first, when there is one
+	fplAtomicStoreU32(&gameThread.isStopped, 1);
+	fplSignalSet(&gameThread.startSignal);
+	fplThreadWaitForOne(gameThread.handle, FPL_TIMEOUT_INFINITE);
+	fplThreadTerminate(gameThread.handle);
+	fplSignalDestroy(&gameThread.finishedSignal);
+	fplSignalDestroy(&gameThread.startSignal);
+	gameThread.handle = fpl_null;
+}
+
+//
+// Input recording and replay
+//
+// File layout: InputRecordingHeader, followed by one record per frame:
+// - InputRecordFlags (1 byte)
+// - Frame time in seconds (double), drives the update accumulator exactly like in the recorded session
+// - Input changes, only when the input has changed since the last frame:
+//   Number of changes (uint16_t), then for each change the byte offset and length (uint16_t) followed by the bytes
+// - State checksum before the frame (uint64_t), only for every InputRecordingChecksumInterval frame
+//
+constexpr uint32_t InputRecordingMagic = 0x52494746; // FGIR
+constexpr uint32_t InputRecordingVersion = 1;
+constexpr uint32_t InputRecordingChecksumInterval = 60;
+constexpr uint32_t InputRecordingBufferSize = 64 * 1024;
+// Unchanged bytes between two changes, up to which both are merged into one change
+constexpr uint32_t InputRecordingMaxChangeGap = 4;
+fplStaticAssert(sizeof(Input) <= UINT16_MAX);
+
+enum class InputRecordFlags : uint8_t {
+	None = 0,
+	HasInput = 1 << 0,
+	HasChecksum = 1 << 1,
+	ResetAccumulator = 1 << 2,
+};
+FPL_ENUM_AS_FLAGS_OPERATORS(InputRecordFlags);
+
+struct InputRecordingHeader {
+	uint32_t magic;
+	uint32_t version;
+	// Recordings from builds with a different input layout are rejected
+	uint32_t inputSize;
+	uint32_t randomSeed;
+	uint32_t updateRate;
+	uint32_t maxUpdatesPerFrame;
+	// Written when the recording is finished
+	uint32_t frameCount;
+	uint32_t hasFinalChecksum;
+	uint64_t finalChecksum;
+	uint32_t noUpdateRenderSeparation;
+	uint32_t reserved;
+};
+fplStaticAssert(sizeof(InputRecordingHeader) == 48);
+
+struct InputRecorder {
+	uint8_t buffer[InputRecordingBufferSize];
+	InputRecordingHeader header;
+	Input lastInput;
+	fplFileHandle file;
+	uint32_t bufferUsed;
+	bool isWriteError;
+};
+
+struct InputReplay {
+	InputRecordingHeader header;
+	Input input;
+	uint8_t *data;
+	size_t size;
+	size_t position;
+	uint64_t mismatchFrameIndex;
+	uint32_t frameIndex;
+	uint32_t checksumCount;
+	uint32_t mismatchCount;
+	bool isFinished;
+};
+
+// Timing values are different in every session, so they are neither recorded nor compared
+static void ClearInputTiming(Input &input) {
+	input.deltaTime = 0.0f;
+	input.framesPerSeconds = 0.0f;
+	input.frameStats = {};
+	input.frameIndex = 0;
+}
+
+static void FlushInputRecording(InputRecorder &recorder) {
+	if(recorder.bufferUsed > 0) {
+		if(fplWriteFileBlock32(&recorder.file, recorder.buffer, recorder.bufferUsed) != recorder.bufferUsed) {
+			recorder.isWriteError = true;
+		}
+		recorder.bufferUsed = 0;
+	}
+}
+
+static void WriteInputRecording(InputRecorder &recorder, const void *data, const uint32_t size) {
+	fplAssert(size <= InputRecordingBufferSize);
+	if((recorder.bufferUsed + size) > InputRecordingBufferSize) {
+		FlushInputRecording(recorder);
+	}
+	fplMemoryCopy(data, size, recorder.buffer + recorder.bufferUsed);
+	recorder.bufferUsed += size;
+}
+
+static InputRecorder *StartInputRecording(const char *filePath, const InputRecordingHeader &header) {
+	InputRecorder *recorder = (InputRecorder *)fplMemoryAllocate(sizeof(InputRecorder));
+	if(recorder == fpl_null) {
+		return(fpl_null);
+	}
+	if(!fplCreateBinaryFile(filePath, &recorder->file)) {
+		fplConsoleFormatError("Failed to create input recording '%s'!\n", filePath);
+		fplMemoryFree(recorder);
+		return(fpl_null);
+	}
+	recorder->header = header;
+	// Placeholder, rewritten when the recording is finished
+	WriteInputRecording(*recorder, &recorder->header, sizeof(recorder->header));
+	return(recorder);
+}
+
+static void WriteInputChanges(InputRecorder &recorder, const Input &input) {
+	const uint8_t *newBytes = (const uint8_t *)&input;
+	const uint8_t *oldBytes = (const uint8_t *)&recorder.lastInput;
+	const uint32_t inputSize = (uint32_t)sizeof(Input);
+
+	// Count first, the changes are written after their count
+	uint16_t changeCount = 0;
+	for(uint32_t pass = 0; pass < 2; ++pass) {
+		if(pass == 1) {
+			WriteInputRecording(recorder, &changeCount, sizeof(changeCount));
+		}
+		uint32_t offset = 0;
+		while(offset < inputSize) {
+			if(newBytes[offset] == oldBytes[offset]) {
+				++offset;
+				continue;
+			}
+			uint32_t start = offset;
+			uint32_t end = offset + 1;
+			uint32_t gap = 0;
+			for(uint32_t i = end; i < inputSize && gap <= InputRecordingMaxChangeGap; ++i) {
+				if(newBytes[i] != oldBytes[i]) {
+					end = i + 1;
+					gap = 0;
+				} else {
+					++gap;
+				}
+			}
+			if(pass == 0) {
+				++changeCount;
+			} else {
+				uint16_t changeOffset = (uint16_t)start;
+				uint16_t changeLength = (uint16_t)(end - start);
+				WriteInputRecording(recorder, &changeOffset, sizeof(changeOffset));
+				WriteInputRecording(recorder, &changeLength, sizeof(changeLength));
+				WriteInputRecording(recorder, newBytes + start, changeLength);
+			}
+			offset = end;
+		}
+	}
+	recorder.lastInput = input;
+}
+
+static void RecordInputFrame(InputRecorder &recorder, const Input &input, const double frameTime, const bool resetAccumulator, const bool hasChecksum, const uint64_t checksum) {
+	Input recordInput = input;
+	ClearInputTiming(recordInput);
+
+	InputRecordFlags flags = InputRecordFlags::None;
+	if(memcmp(&recordInput, &recorder.lastInput, sizeof(Input)) != 0) {
+		flags |= InputRecordFlags::HasInput;
+	}
+	if(hasChecksum) {
+		flags |= InputRecordFlags::HasChecksum;
+	}
+	if(resetAccumulator) {
+		flags |= InputRecordFlags::ResetAccumulator;
+	}
+
+	WriteInputRecording(recorder, &flags, sizeof(flags));
+	WriteInputRecording(recorder, &frameTime, sizeof(frameTime));
+	if((flags & InputRecordFlags::HasInput) == InputRecordFlags::HasInput) {
+		WriteInputChanges(recorder, recordInput);
+	}
+	if(hasChecksum) {
+		WriteInputRecording(recorder, &checksum, sizeof(checksum));
+	}
+	++recorder.header.frameCount;
+}
+
+static bool FinishInputRecording(InputRecorder *recorder, const char *filePath, const bool hasFinalChecksum, const uint64_t finalChecksum) {
+	FlushInputRecording(*recorder);
+	recorder->header.hasFinalChecksum = hasFinalChecksum ? 1 : 0;
+	recorder->header.finalChecksum = finalChecksum;
+	fplSetFilePosition32(&recorder->file, 0, fplFilePositionMode_Beginning);
+	WriteInputRecording(*recorder, &recorder->header, sizeof(recorder->header));
+	FlushInputRecording(*recorder);
+	fplCloseFile(&recorder->file);
+	bool result = !recorder->isWriteError;
+	if(result) {
+		fplConsoleFormatOut("Recorded %u frames into '%s'\n", recorder->header.frameCount, filePath);
+	} else {
+		fplConsoleFormatError("Failed to write input recording '%s'!\n", filePath);
+	}
+	fplMemoryFree(recorder);
+	return(result);
+}
+
+static InputReplay *LoadInputReplay(const char *filePath, const bool noUpdateRenderSeparation) {
+	fplFileHandle file;
+	if(!fplOpenBinaryFile(filePath, &file)) {
+		fplConsoleFormatError("Input recording '%s' not found!\n", filePath);
+		return(fpl_null);
+	}
+	uint32_t fileSize = fplGetFileSizeFromHandle32(&file);
+	InputReplay *replay = fpl_null;
+	if(fileSize >= sizeof(InputRecordingHeader)) {
+		replay = (InputReplay *)fplMemoryAllocate(sizeof(InputReplay) + fileSize);
+		if(replay != fpl_null) {
+			replay->data = (uint8_t *)(replay + 1);
+			replay->size = fplReadFileBlock32(&file, fileSize, replay->data, fileSize);
+		}
+	}
+	fplCloseFile(&file);
+	if(replay == fpl_null || replay->size != fileSize) {
+		fplConsoleFormatError("Failed to read input recording '%s'!\n", filePath);
+		if(replay != fpl_null) {
+			fplMemoryFree(replay);
+		}
+		return(fpl_null);
+	}
+	fplMemoryCopy(replay->data, sizeof(replay->header), &replay->header);
+	const InputRecordingHeader &header = replay->header;
+	if(header.magic != InputRecordingMagic || header.version != InputRecordingVersion || header.inputSize != sizeof(Input) || header.updateRate == 0 || header.maxUpdatesPerFrame == 0 || header.noUpdateRenderSeparation != (noUpdateRenderSeparation ? 1U : 0U)) {
+		fplConsoleFormatError("Input recording '%s' is invalid or was recorded by an incompatible build!\n", filePath);
+		fplMemoryFree(replay);
+		return(fpl_null);
+	}
+	replay->position = sizeof(replay->header);
+	return(replay);
+}
+
+static bool ReadInputReplay(InputReplay &replay, void *target, const size_t size) {
+	if((replay.position + size) > replay.size) {
+		return(false);
+	}
+	fplMemoryCopy(replay.data + replay.position, size, target);
+	replay.position += size;
+	return(true);
+}
+
+static bool ReadInputChanges(InputReplay &replay) {
+	uint16_t changeCount;
+	if(!ReadInputReplay(replay, &changeCount, sizeof(changeCount))) {
+		return(false);
+	}
+	uint8_t *inputBytes = (uint8_t *)&replay.input;
+	for(uint16_t changeIndex = 0; changeIndex < changeCount; ++changeIndex) {
+		uint16_t changeOffset, changeLength;
+		if(!ReadInputReplay(replay, &changeOffset, sizeof(changeOffset)) || !ReadInputReplay(replay, &changeLength, sizeof(changeLength))) {
+			return(false);
+		}
+		if(((uint32_t)changeOffset + changeLength) > sizeof(Input) || !ReadInputReplay(replay, inputBytes + changeOffset, changeLength)) {
+			return(false);
+		}
+	}
+	return(true);
+}
+
+// Replaces the input with the recorded one, except for the timing values
+static bool ReadReplayFrame(InputReplay &replay, Input &input, double &outFrameTime, InputRecordFlags &outFlags, uint64_t &outChecksum) {
+	if(replay.frameIndex >= replay.header.frameCount) {
+		replay.isFinished = true;
+		return(false);
+	}
+	outChecksum = 0;
+	bool result = ReadInputReplay(replay, &outFlags, sizeof(outFlags)) && ReadInputReplay(replay, &outFrameTime, sizeof(outFrameTime));
+	if(result && (outFlags & InputRecordFlags::HasInput) == InputRecordFlags::HasInput) {
+		result = ReadInputChanges(replay);
+	}
+	if(result && (outFlags & InputRecordFlags::HasChecksum) == InputRecordFlags::HasChecksum) {
+		result = ReadInputReplay(replay, &outChecksum, sizeof(outChecksum));
+	}
+	if(!result) {
+		fplConsoleFormatError("Input recording is truncated at frame %u!\n", replay.frameIndex);
+		return(false);
+	}
+	Input replayInput = replay.input;
+	replayInput.deltaTime = input.deltaTime;
+	replayInput.framesPerSeconds = input.framesPerSeconds;
+	replayInput.frameStats = input.frameStats;
+	replayInput.frameIndex = input.frameIndex;
+	input = replayInput;
+	++replay.frameIndex;
+	return(true);
+}
+
+static void VerifyReplayChecksum(InputReplay &replay, const uint64_t frameIndex, const uint64_t expected, const uint64_t actual) {
+	++replay.checksumCount;
+	if(expected != actual) {
+		if(replay.mismatchCount == 0) {
+			replay.mismatchFrameIndex = frameIndex;
+		}
+		++replay.mismatchCount;
+	}
+}
+
+//
+// Headless mode
+//
+// Audio frames mixed at once into the null sink
+constexpr uint32_t NullAudioSinkFrameCount = 4096;
+// Window size the game sees in headless mode, replays use the recorded window size instead
+constexpr int HeadlessWindowWidth = 1280;
+constexpr int HeadlessWindowHeight = 720;
+
+// Replaces the audio device in headless mode, the audio system is mixed into a buffer which is never played
+struct NullAudioSink {
+	fplAudioDeviceFormat format;
+	uint8_t *samples;
+	// Fraction of a frame, which is carried over to the next mix
+	double pendingFrameCount;
+	uint64_t mixedFrameCount;
+};
+
+static bool InitNullAudioSink(NullAudioSink &sink, const fplAudioDeviceFormat &format) {
+	sink.format = format;
+	size_t bufferSize = fplGetAudioBufferSizeInBytes(format.type, format.channels, NullAudioSinkFrameCount);
+	sink.samples = (uint8_t *)fplMemoryAllocate(bufferSize);
+	return(sink.samples != fpl_null);
+}
+
+static void ReleaseNullAudioSink(NullAudioSink &sink) {
+	if(sink.samples != fpl_null) {
+		fplMemoryFree(sink.samples);
+		sink.samples = fpl_null;
+	}
+}
+
+// Mixes as many audio frames, as an audio device would have consumed in the given time
+static void MixNullAudioSink(NullAudioSink &sink, AudioSystem &audioSys, const double duration) {
+	sink.pendingFrameCount += duration * (double)sink.format.sampleRate;
+	uint32_t remainingFrameCount = (uint32_t)sink.pendingFrameCount;
+	sink.pendingFrameCount -= (double)remainingFrameCount;
+	while(remainingFrameCount > 0) {
+		uint32_t frameCount = fplMin(remainingFrameCount, NullAudioSinkFrameCount);
+		AudioSystemWriteSamples(&audioSys, sink.samples, &sink.format, frameCount);
+		sink.mixedFrameCount += frameCount;
+		remainingFrameCount -= frameCount;
+	}
+}
+
+// Without a window there is no OpenGL, so textures are never uploaded and render commands are only counted
+static uint32_t DiscardRenderState(RenderState &renderState) {
+	renderState.textureOperationCount = 0;
+	uint32_t result = 0;
+	uint8_t *mem = (uint8_t *)renderState.memory.base;
+	size_t remaining = renderState.memory.used;
+	while(remaining > 0) {
+		const CommandHeader *header = (const CommandHeader *)mem;
+		size_t commandSize = sizeof(*header) + header->dataSize;
+		fplAssert(commandSize <= remaining);
+		mem += commandSize;
+		remaining -= commandSize;
+		++result;
+	}
+	return(result);
+}
+
+// Records or replays the input and the accumulator values of one frame, returns false when the replay is over
+static bool RecordOrReplayFrame(InputRecorder *recorder, InputReplay *replay, GameMemory &gameMem, GameChecksumFunc *checksum, Input &input, double &frameTime, bool &resetAccumulator) {
+	if(recorder != fpl_null) {
+		bool hasChecksum = (checksum != fpl_null) && ((recorder->header.frameCount % InputRecordingChecksumInterval) == 0);
+		uint64_t stateChecksum = hasChecksum ? checksum(gameMem) : 0;
+		RecordInputFrame(*recorder, input, frameTime, resetAccumulator, hasChecksum, stateChecksum);
+	} else if(replay != fpl_null) {
+		uint32_t frameIndex = replay->frameIndex;
+		InputRecordFlags flags;
+		uint64_t recordedChecksum;
+		if(!ReadReplayFrame(*replay, input, frameTime, flags, recordedChecksum)) {
+			return(false);
+		}
+		resetAccumulator = (flags & InputRecordFlags::ResetAccumulator) == InputRecordFlags::ResetAccumulator;
+		if(checksum != fpl_null && (flags & InputRecordFlags::HasChecksum) == InputRecordFlags::HasChecksum) {
+			VerifyReplayChecksum(*replay, frameIndex, recordedChecksum, checksum(gameMem));
+		}
+	}
+	return(true);
+}
+
+// Returns true when the replay has finished and all checksums has matched
+static bool FinishInputReplay(InputReplay *replay, const char *filePath, GameMemory &gameMem, GameChecksumFunc *checksum, const FrameTimeSummary &frameTimes) {
+	const InputRecordingHeader &header = replay->header;
+	if(replay->isFinished && checksum != fpl_null && header.hasFinalChecksum) {
+		VerifyReplayChecksum(*replay, header.frameCount, header.finalChecksum, checksum(gameMem));
+	}
+
+	double totalTime = frameTimes.totalFrameTime;
+	fplConsoleFormatOut("Replay '%s': %u / %u frames in %.3f s (%.1f fps)%s\n", filePath, replay->frameIndex, header.frameCount, totalTime, (totalTime > 0.0) ? (replay->frameIndex / totalTime) : 0.0, replay->isFinished ? "" : ", aborted");
+	PrintFrameTimeSummary(frameTimes);
+	if(checksum == fpl_null) {
+		fplConsoleOut("Checksums: Not supported by the game\n");
+	} else if(replay->mismatchCount == 0) {
+		fplConsoleFormatOut("Checksums: %u verified, all matched\n", replay->checksumCount);
+	} else {
+		fplConsoleFormatOut("Checksums: %u verified, %u mismatched, first mismatch at frame %llu\n", replay->checksumCount, replay->mismatchCount, (unsigned long long)replay->mismatchFrameIndex);
+	}
+	bool result = replay->isFinished && (replay->mismatchCount == 0);
+	fplMemoryFree(replay);
+	return(result);
+}
+
 extern int GameMain(const GameConfiguration &config) {
 	fplSettings settings = fplMakeDefaultSettings();
 	settings.video.driver = fplVideoDriverType_OpenGL;
 	settings.video.graphics.opengl.compabilityFlags = fplOpenGLCompabilityFlags_Legacy;
-	settings.video.isVSync = true;
+	const bool isReplay = config.replayFilePath != fpl_null;
+	const bool isHeadless = config.isHeadless;
+	const bool isUnlimited = (isReplay || isHeadless) && config.isUnlimited;
+	settings.video.isVSync = !config.noVSync && !isUnlimited;
 	if (config.audioSampleRate > 0) {
 		settings.audio.targetFormat.sampleRate = config.audioSampleRate;
 		settings.audio.targetFormat.bufferSizeInFrames = fplGetAudioBufferSizeInFrames(settings.audio.targetFormat.sampleRate, settings.audio.targetFormat.bufferSizeInMilliseconds);
@@ -289,27 +1040,41 @@ extern int GameMain(const GameConfiguration &config) {
 		settings.audio.targetFormat.channels = config.audioChannels;
 	fplWideStringToUTF8String(config.title, wcslen(config.title), settings.window.title, fplArrayCount(settings.window.title));
 
-	if(!fplPlatformInit(fplInitFlags_All, &settings)) {
+	if(!fplPlatformInit(isHeadless ? fplInitFlags_None : fplInitFlags_All, &settings)) {
 		return -1;
 	}
 
-	//
-	// Center window on nearest display from cursor
-	//
-	int32_t cursorX, cursorY;
-	if (fplQueryCursorPosition(&cursorX, &cursorY)) {
-		fplDisplayInfo display = fplZeroInit;
-		fplWindowSize winSize = fplZeroInit;
-		if (fplGetWindowSize(&winSize) && fplGetDisplayFromPosition(cursorX, cursorY, &display)) {
-			int32_t newX = display.virtualPosition.left + (display.virtualSize.width - winSize.width) / 2;
-			int32_t newY = display.virtualPosition.top + (display.virtualSize.height - winSize.height) / 2;
-			fplSetWindowPosition(newX, newY);
+	InputReplay *replay = fpl_null;
+	if(isReplay) {
+		replay = LoadInputReplay(config.replayFilePath, config.noUpdateRenderSeparation);
+		if(replay == fpl_null) {
+			fplPlatformRelease();
+			return -1;
 		}
 	}
 
-	if(!fglLoadOpenGL(true)) {
-		fplPlatformRelease();
-		return -1;
+	if(!isHeadless) {
+		//
+		// Center window on nearest display from cursor
+		//
+		int32_t cursorX, cursorY;
+		if (fplQueryCursorPosition(&cursorX, &cursorY)) {
+			fplDisplayInfo display = fplZeroInit;
+			fplWindowSize winSize = fplZeroInit;
+			if (fplGetWindowSize(&winSize) && fplGetDisplayFromPosition(cursorX, cursorY, &display)) {
+				int32_t newX = display.virtualPosition.left + (display.virtualSize.width - winSize.width) / 2;
+				int32_t newY = display.virtualPosition.top + (display.virtualSize.height - winSize.height) / 2;
+				fplSetWindowPosition(newX, newY);
+			}
+		}
+
+		if(!fglLoadOpenGL(true)) {
+			if(replay != fpl_null) {
+				fplMemoryFree(replay);
+			}
+			fplPlatformRelease();
+			return -1;
+		}
 	}
 
 	bool wasError = false;
@@ -318,41 +1083,93 @@ extern int GameMain(const GameConfiguration &config) {
 	if(!fmemInit(&gameMemoryBlock, fmemType_Growable, FMEM_MEGABYTES(128))) {
 		wasError = true;
 	}
-	fmemMemoryBlock renderMemoryBlock = {};
-	if(!fmemInit(&renderMemoryBlock, fmemType_Growable, FMEM_MEGABYTES(32))) {
-		wasError = true;
+	// Render commands are double-buffered when the game runs on its own thread
+	fmemMemoryBlock renderMemoryBlocks[2] = {};
+	uint32_t renderStateCount = config.useGameThread ? 2 : 1;
+	for(uint32_t renderStateIndex = 0; renderStateIndex < renderStateCount; ++renderStateIndex) {
+		if(!fmemInit(&renderMemoryBlocks[renderStateIndex], fmemType_Growable, FMEM_MEGABYTES(32))) {
+			wasError = true;
+		}
 	}
 
 	AudioSystem audioSys = {};
+	NullAudioSink nullAudioSink = {};
 	fplAudioDeviceFormat targetAudioFormat = fplZeroInit;
-	if (!fplGetAudioHardwareFormat(&targetAudioFormat)) {
+	if(isHeadless) {
+		// No audio device, the audio system is mixed into the null sink instead
+		targetAudioFormat.type = (config.audioFormat != fplAudioFormatType_None) ? config.audioFormat : fplAudioFormatType_S16;
+		targetAudioFormat.channels = (config.audioChannels > 0) ? config.audioChannels : 2;
+		targetAudioFormat.sampleRate = (config.audioSampleRate > 0) ? config.audioSampleRate : 48000;
+		if(!InitNullAudioSink(nullAudioSink, targetAudioFormat)) {
+			wasError = true;
+		}
+	} else if (!fplGetAudioHardwareFormat(&targetAudioFormat)) {
 		wasError = true;
 	}
 	if(!AudioSystemInit(&audioSys, &targetAudioFormat)) {
 		wasError = true;
 	}
 
-	fplSetAudioClientReadCallback(GameAudioPlayback, &audioSys);
-	if(fplPlayAudio() != fplAudioResultType_Success) {
-		wasError = true;
+	if(!isHeadless) {
+		fplSetAudioClientReadCallback(GameAudioPlayback, &audioSys);
+		if(fplPlayAudio() != fplAudioResultType_Success) {
+			wasError = true;
+		}
 	}
 
-	RenderState renderState = {};
-	InitRenderState(renderState, renderMemoryBlock);
-	InitOpenGLRenderer();
+	RenderState renderStates[2] = {};
+	for(uint32_t renderStateIndex = 0; renderStateIndex < renderStateCount; ++renderStateIndex) {
+		InitRenderState(renderStates[renderStateIndex], renderMemoryBlocks[renderStateIndex]);
+	}
+	if(!isHeadless) {
+		InitOpenGLRenderer();
+	}
 
 	GameMemory gameMem = {};
 	gameMem.audio = &audioSys;
 	gameMem.memory = &gameMemoryBlock;
-	gameMem.render = &renderState;
+	gameMem.render = &renderStates[0];
+	gameMem.randomSeed = (replay != fpl_null) ? replay->header.randomSeed : (uint32_t)fplGetTimeInMillisecondsLP();
 	if(!GameInit(gameMem)) {
 		wasError = true;
 	}
 
+	bool isReplayFailed = false;
 	if(!wasError) {
-		const double TargetDeltaTime = 1.0 / 60.0;
+		// A replay runs with the update settings of its recording
+		uint32_t updateRate = (config.updateRate > 0) ? config.updateRate : DefaultUpdateRate;
+		uint32_t maxUpdatesPerFrame = (config.maxUpdatesPerFrame > 0) ? config.maxUpdatesPerFrame : DefaultMaxUpdatesPerFrame;
+		uint32_t targetFrameRate = config.targetFrameRate;
+		if(replay != fpl_null) {
+			updateRate = replay->header.updateRate;
+			maxUpdatesPerFrame = replay->header.maxUpdatesPerFrame;
+		}
+		if(isUnlimited) {
+			targetFrameRate = 0;
+		} else if(isHeadless) {
+			// Without VSync, the frame pacer runs a headless game in real time
+			targetFrameRate = updateRate;
+		}
+		const double TargetDeltaTime = 1.0 / (double)updateRate;
+		uint32_t headlessFrameCount = config.headlessFrameCount;
+		if(isHeadless && replay == fpl_null && headlessFrameCount == 0) {
+			headlessFrameCount = DefaultHeadlessFrameCount;
+		}
 
-		if(config.hideMouseCursor) {
+		InputRecorder *recorder = fpl_null;
+		if(replay == fpl_null && config.recordFilePath != fpl_null) {
+			InputRecordingHeader header = {};
+			header.magic = InputRecordingMagic;
+			header.version = InputRecordingVersion;
+			header.inputSize = sizeof(Input);
+			header.randomSeed = gameMem.randomSeed;
+			header.updateRate = updateRate;
+			header.maxUpdatesPerFrame = maxUpdatesPerFrame;
+			header.noUpdateRenderSeparation = config.noUpdateRenderSeparation ? 1 : 0;
+			recorder = StartInputRecording(config.recordFilePath, header);
+		}
+
+		if(config.hideMouseCursor && !isHeadless) {
 			fplSetWindowCursorEnabled(false);
 		}
 
@@ -363,19 +1180,49 @@ extern int GameMain(const GameConfiguration &config) {
 		GameWindowActiveType windowActiveType[2] = { GameWindowActiveType::None, GameWindowActiveType::None };
 		newInput->defaultControllerIndex = oldInput->defaultControllerIndex = -1;
 
+		GameFrameContext frame = {};
+		frame.gameMem = &gameMem;
+		frame.config = &config;
+		frame.targetDeltaTime = TargetDeltaTime;
+		frame.frameAccumulator = TargetDeltaTime;
+		frame.maxUpdateCount = maxUpdatesPerFrame;
+
+		FramePacer framePacer;
+		InitFramePacer(framePacer, targetFrameRate);
+		FrameTimeHistogram frameHistogram = {};
+		FrameTimeStats frameStats = {};
+
+		GameThread gameThread = {};
+		GameThreadTiming threadTiming = {};
+		if(config.useGameThread) {
+			if(!StartGameThread(gameThread, &frame)) {
+				fplDebugOut("Failed to start the game thread, fallback to single threaded game loop\n");
+			}
+		}
+
+		// Totals of the entire session, for the summary of replays and headless runs
+		FrameTimeSummary sessionFrameTimes = {};
+		uint64_t sessionUpdateCount = 0;
+		uint64_t sessionRenderCommandCount = 0;
+
 		uint32_t frameCount = 0;
 		uint32_t updateCount = 0;
 		double lastTime = fplGetTimeInSecondsHP();
 		double fpsTimerInSecs = fplGetTimeInSecondsHP();
-		double frameAccumulator = TargetDeltaTime;
 		double lastFramesPerSecond = 0.0;
 		double lastFrameTime = 0.0;
 		int frameIndex = 0;
 
-		while(!IsGameExiting(gameMem) && fplWindowUpdate()) {
+		while(isHeadless || fplWindowUpdate()) {
+			if(isHeadless && headlessFrameCount > 0 && (uint32_t)frameIndex >= headlessFrameCount) {
+				break;
+			}
+
 			// Window size
 			fplWindowSize winArea;
-			if(fplGetWindowSize(&winArea)) {
+			if(isHeadless) {
+				newInput->windowSize = V2iInit(HeadlessWindowWidth, HeadlessWindowHeight);
+			} else if(fplGetWindowSize(&winArea)) {
 				newInput->windowSize.x = winArea.width;
 				newInput->windowSize.y = winArea.height;
 			}
@@ -383,6 +1230,7 @@ extern int GameMain(const GameConfiguration &config) {
 			// Remember previous state
 			newInput->deltaTime = (float)TargetDeltaTime;
 			newInput->framesPerSeconds = (float)lastFramesPerSecond;
+			newInput->frameStats = frameStats;
 			newInput->defaultControllerIndex = oldInput->defaultControllerIndex;
 			Controller *oldKeyboardController = &oldInput->keyboard;
 			Controller *newKeyboardController = &newInput->keyboard;
@@ -414,65 +1262,125 @@ extern int GameMain(const GameConfiguration &config) {
 
 			// Events
 			windowActiveType[1] = windowActiveType[0];
-			ProcessEvents(newInput, oldInput, &windowActiveType[0], &lastMousePos);
+			if(!isHeadless) {
+				ProcessEvents(newInput, oldInput, &windowActiveType[0], &lastMousePos);
+			}
 			if(config.disableInactiveDetection) {
 				newInput->isActive = (windowActiveType[0] & GameWindowActiveType::Minimized) != GameWindowActiveType::Minimized;
 			} else {
 				newInput->isActive = ((windowActiveType[0] & GameWindowActiveType::Minimized) != GameWindowActiveType::Minimized) && ((windowActiveType[0] & GameWindowActiveType::LostFocus) != GameWindowActiveType::LostFocus);
 			}
 
+			bool resetAccumulator = false;
 			if(windowActiveType[0] != windowActiveType[1]) {
 				// We dont want to have delta time jumps when game was inactive
 				lastTime = fplGetTimeInSecondsHP();
 				lastFramesPerSecond = 0.0f;
 				fpsTimerInSecs = fplGetTimeInSecondsHP();
 				updateCount = frameCount = 0;
-				frameAccumulator = TargetDeltaTime;
+				threadTiming = {};
+				resetAccumulator = true;
+				ResetFramePacer(framePacer);
 			}
 
-			ResetRenderState(renderState);
+			if(gameThread.handle != fpl_null) {
+				// Wait until the game thread has finished the previous frame, the frame context is not touched before that
+				double waitStartTime = fplGetTimeInSecondsHP();
+				fplSignalWaitForOne(&gameThread.finishedSignal, FPL_TIMEOUT_INFINITE);
+				threadTiming.waitDuration += fplGetTimeInSecondsHP() - waitStartTime;
+				threadTiming.workDuration += frame.workDuration;
+				updateCount += frame.updateCount;
+				sessionUpdateCount += frame.updateCount;
+				frame.workDuration = 0.0;
+				frame.updateCount = 0;
+
+				if(IsGameExiting(gameMem)) {
+					break;
+				}
+
+				// Swap render states, the finished one is rendered while the game thread fills the other one
+				RenderState *readyRenderState = gameMem.render;
+				gameMem.render = (readyRenderState == &renderStates[0]) ? &renderStates[1] : &renderStates[0];
+
+				// Texture handles are written here, while the game thread is idle
+				if(isHeadless) {
+					sessionRenderCommandCount += DiscardRenderState(*readyRenderState);
+				} else {
+					ProcessTextureOperations(*readyRenderState);
+				}
+
+				// Record or replay the input, while the game thread is idle
+				double frameTime = isHeadless ? TargetDeltaTime : lastFrameTime;
+				if(!RecordOrReplayFrame(recorder, replay, gameMem, config.checksum, *newInput, frameTime, resetAccumulator)) {
+					break;
+				}
+
+				// Game Update + Render commands
+				AdvanceGameFrame(frame, frameTime, resetAccumulator);
+				frame.input = newInput;
+				fplSignalSet(&gameThread.startSignal);
 
-			// Game Update
-			if(config.noUpdateRenderSeparation) {
-				float alpha;
-				if(lastFrameTime > 0) {
-					alpha = (float)lastFrameTime / (float)TargetDeltaTime;
+				// Render
+				if(isHeadless) {
+					MixNullAudioSink(nullAudioSink, audioSys, frameTime);
 				} else {
-					alpha = 1.0f;
+					if(config.showFrameStats) {
+						PushFrameStatsOverlay(*readyRenderState, frameHistogram, frameStats, newInput->windowSize);
+					}
+					double renderStartTime = fplGetTimeInSecondsHP();
+					RenderWithOpenGL(*readyRenderState);
+					fplVideoFlip();
+					threadTiming.renderDuration += fplGetTimeInSecondsHP() - renderStartTime;
 				}
-				GameUpdateAndRender(gameMem, *newInput, alpha);
 			} else {
-				GameInput(gameMem, *newInput);
-				while(frameAccumulator >= TargetDeltaTime) {
-					GameUpdate(gameMem, *newInput);
-					frameAccumulator -= TargetDeltaTime;
-					++updateCount;
+				if(IsGameExiting(gameMem)) {
+					break;
 				}
-			}
 
-			// @TODO(final): Yield thread when we are running too fast
-			double endWorkTime = fplGetTimeInSecondsHP();
-			double workDuration = endWorkTime - lastTime;
+				double frameTime = isHeadless ? TargetDeltaTime : lastFrameTime;
+				if(!RecordOrReplayFrame(recorder, replay, gameMem, config.checksum, *newInput, frameTime, resetAccumulator)) {
+					break;
+				}
 
-			// Render
-			if(!config.noUpdateRenderSeparation) {
-				float alpha = (float)frameAccumulator / (float)TargetDeltaTime;
-				GameRender(gameMem, alpha);
+				// Game Update + Render commands
+				AdvanceGameFrame(frame, frameTime, resetAccumulator);
+				frame.input = newInput;
+				UpdateAndRenderGame(frame);
+				updateCount += frame.updateCount;
+				sessionUpdateCount += frame.updateCount;
+
+				// Render
+				if(isHeadless) {
+					sessionRenderCommandCount += DiscardRenderState(*gameMem.render);
+					MixNullAudioSink(nullAudioSink, audioSys, frameTime);
+				} else {
+					if(config.showFrameStats) {
+						PushFrameStatsOverlay(*gameMem.render, frameHistogram, frameStats, newInput->windowSize);
+					}
+					RenderWithOpenGL(*gameMem.render);
+					fplVideoFlip();
+				}
 			}
-			RenderWithOpenGL(renderState);
-			fplVideoFlip();
 			++frameCount;
 
+			// Frame pacing
+			WaitForFrameDeadline(framePacer);
+
 			// Timing
 			double endTime = fplGetTimeInSecondsHP();
 			double frameDuration = endTime - lastTime;
 			lastFrameTime = frameDuration;
 			lastFramesPerSecond = 1.0f / frameDuration;
-			if(!config.noUpdateRenderSeparation) {
-				frameAccumulator += frameDuration;
-				frameAccumulator = fplMin(0.1, frameAccumulator);
-			}
 			lastTime = endTime;
+
+			// Frame time histogram, without pacing the median is the expected frame time (VSync interval)
+			double expectedFrameTime = (framePacer.targetFrameTime > 0.0) ? framePacer.targetFrameTime : (double)frameStats.p50 / 1000.0;
+			bool isMissedFrame = (expectedFrameTime > 0.0) && (frameDuration > expectedFrameTime * MissedFrameFactor);
+			AddFrameTime(frameHistogram, frameDuration, isMissedFrame);
+			frameStats = GetFrameTimeStats(frameHistogram, expectedFrameTime, frame.droppedUpdateCount);
+			if(replay != fpl_null || isHeadless) {
+				AddFrameTimeSummary(sessionFrameTimes, frameDuration);
+			}
 			if(endTime >= (fpsTimerInSecs + 1.0)) {
 				fpsTimerInSecs = endTime;
 #if 0
@@ -480,6 +1388,19 @@ extern int GameMain(const GameConfiguration &config) {
 				fplFormatAnsiString(charBuffer, fplArrayCount(charBuffer), "Fps: %d, Ups: %d\n", frameCount, updateCount);
 				OutputDebugStringA(charBuffer);
 #endif
+				if(gameThread.handle != fpl_null && frameCount > 0) {
+					// Overlap is the part of the game work which was hidden behind rendering, instead of waited for
+					const GameThreadTiming &t = threadTiming;
+					double hiddenDuration = fplMax(0.0, t.workDuration - t.waitDuration);
+					double overlapPercentage = (t.workDuration > 0.0) ? (hiddenDuration / t.workDuration * 100.0) : 0.0;
+					double toAverageMs = 1000.0 / (double)frameCount;
+					fplDebugFormatOut("Fps: %u, Ups: %u, Game: %.3f ms, Render: %.3f ms, Wait: %.3f ms, Overlap: %.1f %%\n", frameCount, updateCount, t.workDuration * toAverageMs, t.renderDuration * toAverageMs, t.waitDuration * toAverageMs, overlapPercentage);
+				}
+				if(config.showFrameStats) {
+					const FrameTimeStats &f = frameStats;
+					fplDebugFormatOut("Frame time: p50 %.2f ms, p95 %.2f ms, p99 %.2f ms, max %.2f ms, expected %.2f ms, missed %u / %u, dropped updates %u\n", f.p50, f.p95, f.p99, f.max, f.expected, f.missedFrameCount, f.frameCount, f.droppedUpdateCount);
+				}
+				threadTiming = {};
 				frameCount = 0;
 				updateCount = 0;
 			}
@@ -492,25 +1413,60 @@ extern int GameMain(const GameConfiguration &config) {
 			}
 		}
 
-		if(config.hideMouseCursor) {
+		if(gameThread.handle != fpl_null) {
+			StopGameThread(gameThread);
+		}
+
+		if(recorder != fpl_null) {
+			bool hasFinalChecksum = config.checksum != fpl_null;
+			uint64_t finalChecksum = hasFinalChecksum ? config.checksum(gameMem) : 0;
+			FinishInputRecording(recorder, config.recordFilePath, hasFinalChecksum, finalChecksum);
+		}
+		if(replay != fpl_null) {
+			isReplayFailed = !FinishInputReplay(replay, config.replayFilePath, gameMem, config.checksum, sessionFrameTimes);
+			replay = fpl_null;
+		} else if(isHeadless) {
+			double totalTime = sessionFrameTimes.totalFrameTime;
+			fplConsoleFormatOut("Headless: %u frames, %llu updates in %.3f s (%.1f fps)\n", sessionFrameTimes.frameCount, (unsigned long long)sessionUpdateCount, totalTime, (totalTime > 0.0) ? (sessionFrameTimes.frameCount / totalTime) : 0.0);
+			PrintFrameTimeSummary(sessionFrameTimes);
+		}
+		if(isHeadless) {
+			double renderCommandsPerFrame = (sessionFrameTimes.frameCount > 0) ? ((double)sessionRenderCommandCount / (double)sessionFrameTimes.frameCount) : 0.0;
+			double mixedAudioDuration = (double)nullAudioSink.mixedFrameCount / (double)nullAudioSink.format.sampleRate;
+			fplConsoleFormatOut("Render commands: %.1f per frame (not executed), Audio: %llu frames mixed (%.3f s)\n", renderCommandsPerFrame, (unsigned long long)nullAudioSink.mixedFrameCount, mixedAudioDuration);
+		}
+
+		if(config.hideMouseCursor && !isHeadless) {
 			fplSetWindowCursorEnabled(true);
 		}
 
 		GameRelease(gameMem);
 	}
 
-	fplStopAudio();
+	if(replay != fpl_null) {
+		fplMemoryFree(replay);
+	}
+
+	if(!isHeadless) {
+		fplStopAudio();
+	}
 
 	AudioSystemShutdown(&audioSys);
+	ReleaseNullAudioSink(nullAudioSink);
 
 	fmemFree(&gameMemoryBlock);
-	fmemFree(&renderMemoryBlock);
+	for(uint32_t renderStateIndex = 0; renderStateIndex < renderStateCount; ++renderStateIndex) {
+		fmemFree(&renderMemoryBlocks[renderStateIndex]);
+	}
 
-	fglUnloadOpenGL();
+	if(!isHeadless) {
+		fglUnloadOpenGL();
+	}
 
 	fplPlatformRelease();
 
-	int result = wasError ? -1 : 0;
+	// A replay which does not match its recording is not an error, but reported in the result
+	int result = wasError ? -1 : (isReplayFailed ? 1 : 0);
 	return (result);
 }
 
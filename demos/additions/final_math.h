@@ -12,6 +12,16 @@ License:
 	Copyright 2017-2020 Torsten Spaete
 
 Changelog
+	## 2026-10-18:
+	- Added compile-time selectable SIMD backend (SSE2/AVX/NEON) for Mat4f and Vec4f operations, AVX only widens the batch functions
+	- Added optional 16-byte aligned storage for Vec4f and Mat4f (FMATH_ALIGNED_TYPES)
+	- Added Mat4MultVec4, V4fDot, V4fLength, V4fNormalize
+	- Added ApproxInvSquareRoot and V3fNormalizeApprox
+	- Added V3fMin, V3fMax
+	- Added public SIMD lane functions (LaneF32, LaneLoad, LaneAdd, LaneSelect, LaneMoveMask, etc.)
+	- Added structure-of-arrays batch functions (BatchTransformPoints2/3, BatchNormalize2/3, BatchLerp, BatchAABBOverlap2, BatchDistanceSquared2/3)
+	- Fixed V2fDistanceSquared and V3fDistanceSquared returning the squared product instead of the squared distance
+
 	## 2019-05-10:
 	- Added Vec3f math operator overloaded functions
 	- Renamed Mat4OrthoLH to Mat4OrthoRH
@@ -38,6 +48,51 @@ Changelog
 #include <math.h>
 #include <float.h>
 
+//
+// SIMD backend detection
+// - Define FMATH_NO_SIMD to force the scalar code path
+// - Define FMATH_ALIGNED_TYPES to align Vec4f/Mat4f to 16 bytes.
+//   This is off by default, because the types are copied into unaligned push buffers (final_render.h).
+//   The SIMD code path uses unaligned loads/stores, so it works either way.
+//
+#if !defined(FMATH_NO_SIMD)
+#	if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#		define FMATH_SIMD_NEON
+#	elif defined(__AVX__)
+#		define FMATH_SIMD_AVX
+#		define FMATH_SIMD_SSE2
+#	elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#		define FMATH_SIMD_SSE2
+#	endif
+#endif
+
+#if defined(FMATH_SIMD_AVX)
+#	include <immintrin.h>
+#	define FMATH_SIMD_NAME "AVX"
+#elif defined(FMATH_SIMD_SSE2)
+#	include <emmintrin.h>
+#	define FMATH_SIMD_NAME "SSE2"
+#elif defined(FMATH_SIMD_NEON)
+#	include <arm_neon.h>
+#	define FMATH_SIMD_NAME "NEON"
+#else
+#	define FMATH_SIMD_NAME "Scalar"
+#endif
+
+#if defined(FMATH_SIMD_SSE2) || defined(FMATH_SIMD_NEON)
+#	define FMATH_SIMD
+#endif
+
+#if defined(FMATH_ALIGNED_TYPES)
+#	if defined(FPL_COMPILER_MSVC)
+#		define FMATH_ALIGN16 __declspec(align(16))
+#	else
+#		define FMATH_ALIGN16 __attribute__((aligned(16)))
+#	endif
+#else
+#	define FMATH_ALIGN16
+#endif
+
 const float Pi32 = (float)M_PI;
 const float Tau32 = (float)M_PI * 2.0f;
 const float Deg2Rad = (float)M_PI / 180.0f;
@@ -240,7 +295,7 @@ fpl_force_inline Vec3f V3f(const float x, const float y, const float z) {
 }
 #endif
 
-typedef union Vec4f {
+typedef union FMATH_ALIGN16 Vec4f {
 	struct {
 		union {
 			Vec3f xyz;
@@ -350,7 +405,7 @@ fpl_force_inline Mat2f M2f(const Mat2f &other) {
 }
 #endif
 
-typedef union Mat4f {
+typedef union FMATH_ALIGN16 Mat4f {
 	struct {
 		Vec4f col1;
 		Vec4f col2;
@@ -440,6 +495,25 @@ fpl_force_inline float SquareRoot(const float value) {
 	float result = sqrtf(value);
 	return(result);
 }
+// Approximated 1/sqrt(x), refined by one newton-raphson step (~22 bits precision)
+fpl_force_inline float ApproxInvSquareRoot(const float value) {
+#if defined(FMATH_SIMD_SSE2)
+	__m128 v = _mm_set_ss(value);
+	__m128 y = _mm_rsqrt_ss(v);
+	__m128 yy = _mm_mul_ss(y, y);
+	y = _mm_mul_ss(_mm_mul_ss(_mm_set_ss(0.5f), y), _mm_sub_ss(_mm_set_ss(3.0f), _mm_mul_ss(v, yy)));
+	float result = _mm_cvtss_f32(y);
+#elif defined(FMATH_SIMD_NEON)
+	float32x2_t v = vdup_n_f32(value);
+	float32x2_t y = vrsqrte_f32(v);
+	y = vmul_f32(y, vrsqrts_f32(vmul_f32(v, y), y));
+	float result = vget_lane_f32(y, 0);
+#else
+	float result = 1.0f / sqrtf(value);
+#endif
+	return(result);
+}
+
 fpl_force_inline float RadiansToDegrees(const float radians) {
 	float result = radians * Rad2Deg;
 	return(result);
@@ -568,8 +642,9 @@ fpl_force_inline Vec2f V2fMultMat2(const Mat2f A, const Vec2f v) {
 }
 
 fpl_force_inline float V2fDistanceSquared(const Vec2f a, const Vec2f b) {
-	float f = (b.x - a.x) * (b.y - a.y);
-	float result = f * f;
+	float dx = b.x - a.x;
+	float dy = b.y - a.y;
+	float result = dx * dx + dy * dy;
 	return(result);
 }
 
@@ -691,8 +766,10 @@ fpl_force_inline float V3fDot(const Vec3f a, const Vec3f b) {
 }
 
 fpl_force_inline float V3fDistanceSquared(const Vec3f a, const Vec3f b) {
-	float f = (b.x - a.x) * (b.y - a.y) * (b.z - a.z);
-	float result = f * f;
+	float dx = b.x - a.x;
+	float dy = b.y - a.y;
+	float dz = b.z - a.z;
+	float result = dx * dx + dy * dy + dz * dz;
 	return(result);
 }
 
@@ -735,6 +812,65 @@ fpl_force_inline Vec3f V3fHadamard(const Vec3f a, const Vec3f b) {
 	return(result);
 }
 
+fpl_force_inline Vec3f V3fMin(const Vec3f a, const Vec3f b) {
+	Vec3f result = V3fInit(Min(a.x, b.x), Min(a.y, b.y), Min(a.z, b.z));
+	return(result);
+}
+
+fpl_force_inline Vec3f V3fMax(const Vec3f a, const Vec3f b) {
+	Vec3f result = V3fInit(Max(a.x, b.x), Max(a.y, b.y), Max(a.z, b.z));
+	return(result);
+}
+
+/* Same as V3fNormalize, but uses a approximated inverse square root. Returns zero for zero vectors. */
+fpl_force_inline Vec3f V3fNormalizeApprox(const Vec3f v) {
+	float l2 = V3fDot(v, v);
+	float invL = l2 > 0.0f ? ApproxInvSquareRoot(l2) : 0.0f;
+	Vec3f result = V3fMultScalar(v, invL);
+	return(result);
+}
+
+//
+// Vec4f
+//
+fpl_force_inline float V4fDot(const Vec4f a, const Vec4f b) {
+#if defined(FMATH_SIMD_SSE2)
+	__m128 m = _mm_mul_ps(_mm_loadu_ps(a.m), _mm_loadu_ps(b.m));
+	__m128 s = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+	s = _mm_add_ss(s, _mm_movehl_ps(s, s));
+	float result = _mm_cvtss_f32(s);
+#elif defined(FMATH_SIMD_NEON)
+	float32x4_t m = vmulq_f32(vld1q_f32(a.m), vld1q_f32(b.m));
+	float32x2_t s = vadd_f32(vget_low_f32(m), vget_high_f32(m));
+	float result = vget_lane_f32(vpadd_f32(s, s), 0);
+#else
+	float result = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+#endif
+	return(result);
+}
+
+fpl_force_inline float V4fLength(const Vec4f v) {
+	float result = sqrtf(V4fDot(v, v));
+	return(result);
+}
+
+fpl_force_inline Vec4f V4fNormalize(const Vec4f v) {
+	float l = V4fLength(v);
+	if (l == 0) {
+		l = 1;
+	}
+	float invL = 1.0f / l;
+	Vec4f result;
+#if defined(FMATH_SIMD_SSE2)
+	_mm_storeu_ps(result.m, _mm_mul_ps(_mm_loadu_ps(v.m), _mm_set1_ps(invL)));
+#elif defined(FMATH_SIMD_NEON)
+	vst1q_f32(result.m, vmulq_n_f32(vld1q_f32(v.m), invL));
+#else
+	result = V4fInit(v.x * invL, v.y * invL, v.z * invL, v.w * invL);
+#endif
+	return(result);
+}
+
 //
 // Mat2f
 //
@@ -923,7 +1059,10 @@ fpl_force_inline static Mat4f Mat4RotationZFromM2f(const Mat2f m) {
 	return (result);
 }
 
-fpl_force_inline Mat4f Mat4Mult(const Mat4f a, const Mat4f b) {
+//
+// Mat4f multiplication (Scalar)
+//
+fpl_force_inline Mat4f Mat4MultScalar(const Mat4f a, const Mat4f b) {
 	Mat4f result;
 	for (int i = 0; i < 16; i += 4) {
 		for (int j = 0; j < 4; ++j) {
@@ -937,22 +1076,457 @@ fpl_force_inline Mat4f Mat4Mult(const Mat4f a, const Mat4f b) {
 	return(result);
 }
 
+/* Row-vector times matrix (v * M) */
+fpl_force_inline Vec4f Vec4MultMat4Scalar(const Mat4f mat, const Vec4f v) {
+	Vec4f result;
+	result.x = mat.r[0][0] * v.m[0] + mat.r[0][1] * v.m[1] + mat.r[0][2] * v.m[2] + mat.r[0][3] * v.m[3];
+	result.y = mat.r[1][0] * v.m[0] + mat.r[1][1] * v.m[1] + mat.r[1][2] * v.m[2] + mat.r[1][3] * v.m[3];
+	result.z = mat.r[2][0] * v.m[0] + mat.r[2][1] * v.m[1] + mat.r[2][2] * v.m[2] + mat.r[2][3] * v.m[3];
+	result.w = mat.r[3][0] * v.m[0] + mat.r[3][1] * v.m[1] + mat.r[3][2] * v.m[2] + mat.r[3][3] * v.m[3];
+	return(result);
+}
+
+/* Matrix times column-vector (M * v) */
+fpl_force_inline Vec4f Mat4MultVec4Scalar(const Mat4f mat, const Vec4f v) {
+	Vec4f result;
+	result.x = mat.col1.x * v.x + mat.col2.x * v.y + mat.col3.x * v.z + mat.col4.x * v.w;
+	result.y = mat.col1.y * v.x + mat.col2.y * v.y + mat.col3.y * v.z + mat.col4.y * v.w;
+	result.z = mat.col1.z * v.x + mat.col2.z * v.y + mat.col3.z * v.z + mat.col4.z * v.w;
+	result.w = mat.col1.w * v.x + mat.col2.w * v.y + mat.col3.w * v.z + mat.col4.w * v.w;
+	return(result);
+}
+
+//
+// Mat4f multiplication (SIMD)
+// Same operation order as the scalar path, so results are bit-identical when no FMA contraction happens.
+//
+#if defined(FMATH_SIMD)
+fpl_force_inline Mat4f Mat4MultSIMD(const Mat4f a, const Mat4f b) {
+	Mat4f result;
+	// AVX builds use this kernel as well: Two 4x4 products per 256-bit register need extra lane shuffles and were slower than scalar
+#if defined(FMATH_SIMD_SSE2)
+	__m128 a0 = _mm_loadu_ps(a.m + 0);
+	__m128 a1 = _mm_loadu_ps(a.m + 4);
+	__m128 a2 = _mm_loadu_ps(a.m + 8);
+	__m128 a3 = _mm_loadu_ps(a.m + 12);
+	for (int i = 0; i < 16; i += 4) {
+		__m128 bb = _mm_loadu_ps(b.m + i);
+		__m128 r = _mm_mul_ps(a0, _mm_shuffle_ps(bb, bb, 0x00));
+		r = _mm_add_ps(r, _mm_mul_ps(a1, _mm_shuffle_ps(bb, bb, 0x55)));
+		r = _mm_add_ps(r, _mm_mul_ps(a2, _mm_shuffle_ps(bb, bb, 0xAA)));
+		r = _mm_add_ps(r, _mm_mul_ps(a3, _mm_shuffle_ps(bb, bb, 0xFF)));
+		_mm_storeu_ps(result.m + i, r);
+	}
+#elif defined(FMATH_SIMD_NEON)
+	float32x4_t a0 = vld1q_f32(a.m + 0);
+	float32x4_t a1 = vld1q_f32(a.m + 4);
+	float32x4_t a2 = vld1q_f32(a.m + 8);
+	float32x4_t a3 = vld1q_f32(a.m + 12);
+	for (int i = 0; i < 16; i += 4) {
+		float32x4_t bb = vld1q_f32(b.m + i);
+		float32x4_t r = vmulq_lane_f32(a0, vget_low_f32(bb), 0);
+		r = vaddq_f32(r, vmulq_lane_f32(a1, vget_low_f32(bb), 1));
+		r = vaddq_f32(r, vmulq_lane_f32(a2, vget_high_f32(bb), 0));
+		r = vaddq_f32(r, vmulq_lane_f32(a3, vget_high_f32(bb), 1));
+		vst1q_f32(result.m + i, r);
+	}
+#endif
+	return(result);
+}
+
+fpl_force_inline Vec4f Vec4MultMat4SIMD(const Mat4f mat, const Vec4f v) {
+	Vec4f result;
+#if defined(FMATH_SIMD_SSE2)
+	__m128 t0 = _mm_loadu_ps(mat.m + 0);
+	__m128 t1 = _mm_loadu_ps(mat.m + 4);
+	__m128 t2 = _mm_loadu_ps(mat.m + 8);
+	__m128 t3 = _mm_loadu_ps(mat.m + 12);
+	_MM_TRANSPOSE4_PS(t0, t1, t2, t3);
+	__m128 r = _mm_mul_ps(t0, _mm_set1_ps(v.x));
+	r = _mm_add_ps(r, _mm_mul_ps(t1, _mm_set1_ps(v.y)));
+	r = _mm_add_ps(r, _mm_mul_ps(t2, _mm_set1_ps(v.z)));
+	r = _mm_add_ps(r, _mm_mul_ps(t3, _mm_set1_ps(v.w)));
+	_mm_storeu_ps(result.m, r);
+#elif defined(FMATH_SIMD_NEON)
+	// De-interleaving load transposes the matrix
+	float32x4x4_t t = vld4q_f32(mat.m);
+	float32x4_t r = vmulq_n_f32(t.val[0], v.x);
+	r = vaddq_f32(r, vmulq_n_f32(t.val[1], v.y));
+	r = vaddq_f32(r, vmulq_n_f32(t.val[2], v.z));
+	r = vaddq_f32(r, vmulq_n_f32(t.val[3], v.w));
+	vst1q_f32(result.m, r);
+#endif
+	return(result);
+}
+
+// Note: Measured with FMATH_Benchmark, this is not faster than Mat4MultVec4Scalar (roughly 1.0x with SSE2).
+// A single column-vector product has too little work to hide the lane broadcasts and the store of the result,
+// the batch functions below are the better choice when transforming many points.
+fpl_force_inline Vec4f Mat4MultVec4SIMD(const Mat4f mat, const Vec4f v) {
+	Vec4f result;
+#if defined(FMATH_SIMD_SSE2)
+	__m128 r = _mm_mul_ps(_mm_loadu_ps(mat.m + 0), _mm_set1_ps(v.x));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(mat.m + 4), _mm_set1_ps(v.y)));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(mat.m + 8), _mm_set1_ps(v.z)));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(mat.m + 12), _mm_set1_ps(v.w)));
+	_mm_storeu_ps(result.m, r);
+#elif defined(FMATH_SIMD_NEON)
+	float32x4_t r = vmulq_n_f32(vld1q_f32(mat.m + 0), v.x);
+	r = vaddq_f32(r, vmulq_n_f32(vld1q_f32(mat.m + 4), v.y));
+	r = vaddq_f32(r, vmulq_n_f32(vld1q_f32(mat.m + 8), v.z));
+	r = vaddq_f32(r, vmulq_n_f32(vld1q_f32(mat.m + 12), v.w));
+	vst1q_f32(result.m, r);
+#endif
+	return(result);
+}
+#endif // FMATH_SIMD
+
+//
+// Mat4f multiplication (Selected backend)
+//
+fpl_force_inline Mat4f Mat4Mult(const Mat4f a, const Mat4f b) {
+#if defined(FMATH_SIMD)
+	Mat4f result = Mat4MultSIMD(a, b);
+#else
+	Mat4f result = Mat4MultScalar(a, b);
+#endif
+	return(result);
+}
+
+fpl_force_inline Vec4f Vec4MultMat4(const Mat4f mat, const Vec4f v) {
+#if defined(FMATH_SIMD)
+	Vec4f result = Vec4MultMat4SIMD(mat, v);
+#else
+	Vec4f result = Vec4MultMat4Scalar(mat, v);
+#endif
+	return(result);
+}
+
+fpl_force_inline Vec4f Mat4MultVec4(const Mat4f mat, const Vec4f v) {
+#if defined(FMATH_SIMD)
+	Vec4f result = Mat4MultVec4SIMD(mat, v);
+#else
+	Vec4f result = Mat4MultVec4Scalar(mat, v);
+#endif
+	return(result);
+}
+
 #if defined(__cplusplus)
 fpl_force_inline Mat4f operator *(const Mat4f &a, const Mat4f &b) {
 	Mat4f result = Mat4Mult(a, b);
 	return(result);
 }
+
+fpl_force_inline Vec4f operator *(const Mat4f &mat, const Vec4f &v) {
+	Vec4f result = Mat4MultVec4(mat, v);
+	return(result);
+}
 #endif // __cplusplus
 
-fpl_force_inline Vec4f Vec4MultMat4(const Mat4f mat, const Vec4f v) {
-	Vec4f result;
-	result.x = mat.r[0][0] * v.m[0] + mat.r[0][1] * v.m[1] + mat.r[0][2] * v.m[2] + mat.r[0][3] * v.m[3];
-	result.y = mat.r[1][0] * v.m[0] + mat.r[1][1] * v.m[1] + mat.r[1][2] * v.m[2] + mat.r[1][3] * v.m[3];
-	result.z = mat.r[2][0] * v.m[0] + mat.r[2][1] * v.m[1] + mat.r[2][2] * v.m[2] + mat.r[2][3] * v.m[3];
-	result.w = mat.r[3][0] * v.m[0] + mat.r[3][1] * v.m[1] + mat.r[3][2] * v.m[2] + mat.r[3][3] * v.m[3];
+//
+// SIMD lane helpers (internal)
+// 8-wide on AVX, 4-wide on SSE2/NEON, 1-wide on the scalar path
+//
+#if defined(FMATH_SIMD_AVX)
+#	define FMATH_SIMD_WIDTH 8
+typedef __m256 fmath__SIMDFloat;
+fpl_force_inline fmath__SIMDFloat fmath__SIMDLoad(const float *p) { return _mm256_loadu_ps(p); }
+fpl_force_inline void fmath__SIMDStore(float *p, const fmath__SIMDFloat v) { _mm256_storeu_ps(p, v); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDSet1(const float v) { return _mm256_set1_ps(v); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDAdd(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm256_add_ps(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDSub(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm256_sub_ps(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDMul(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm256_mul_ps(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDDiv(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm256_div_ps(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDSqrt(const fmath__SIMDFloat a) { return _mm256_sqrt_ps(a); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDCmpEq(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDCmpLe(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDCmpLt(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDAnd(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm256_and_ps(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDOr(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm256_or_ps(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDMin(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm256_min_ps(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDMax(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm256_max_ps(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDSelect(const fmath__SIMDFloat mask, const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm256_blendv_ps(b, a, mask); }
+fpl_force_inline int fmath__SIMDMoveMask(const fmath__SIMDFloat mask) { return _mm256_movemask_ps(mask); }
+#elif defined(FMATH_SIMD_SSE2)
+#	define FMATH_SIMD_WIDTH 4
+typedef __m128 fmath__SIMDFloat;
+fpl_force_inline fmath__SIMDFloat fmath__SIMDLoad(const float *p) { return _mm_loadu_ps(p); }
+fpl_force_inline void fmath__SIMDStore(float *p, const fmath__SIMDFloat v) { _mm_storeu_ps(p, v); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDSet1(const float v) { return _mm_set1_ps(v); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDAdd(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm_add_ps(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDSub(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm_sub_ps(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDMul(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm_mul_ps(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDDiv(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm_div_ps(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDSqrt(const fmath__SIMDFloat a) { return _mm_sqrt_ps(a); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDCmpEq(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm_cmpeq_ps(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDCmpLe(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm_cmple_ps(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDCmpLt(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm_cmplt_ps(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDAnd(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm_and_ps(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDOr(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm_or_ps(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDMin(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm_min_ps(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDMax(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm_max_ps(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDSelect(const fmath__SIMDFloat mask, const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+fpl_force_inline int fmath__SIMDMoveMask(const fmath__SIMDFloat mask) { return _mm_movemask_ps(mask); }
+#elif defined(FMATH_SIMD_NEON)
+#	define FMATH_SIMD_WIDTH 4
+typedef float32x4_t fmath__SIMDFloat;
+fpl_force_inline fmath__SIMDFloat fmath__SIMDLoad(const float *p) { return vld1q_f32(p); }
+fpl_force_inline void fmath__SIMDStore(float *p, const fmath__SIMDFloat v) { vst1q_f32(p, v); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDSet1(const float v) { return vdupq_n_f32(v); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDAdd(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return vaddq_f32(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDSub(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return vsubq_f32(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDMul(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return vmulq_f32(a, b); }
+#	if defined(__aarch64__) || defined(_M_ARM64)
+fpl_force_inline fmath__SIMDFloat fmath__SIMDDiv(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return vdivq_f32(a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDSqrt(const fmath__SIMDFloat a) { return vsqrtq_f32(a); }
+#	else
+fpl_force_inline fmath__SIMDFloat fmath__SIMDDiv(const fmath__SIMDFloat a, const fmath__SIMDFloat b) {
+	float32x4_t r = vrecpeq_f32(b);
+	r = vmulq_f32(r, vrecpsq_f32(b, r));
+	r = vmulq_f32(r, vrecpsq_f32(b, r));
+	return vmulq_f32(a, r);
+}
+fpl_force_inline fmath__SIMDFloat fmath__SIMDSqrt(const fmath__SIMDFloat a) {
+	float tmp[4];
+	vst1q_f32(tmp, a);
+	for (int i = 0; i < 4; ++i) tmp[i] = sqrtf(tmp[i]);
+	return vld1q_f32(tmp);
+}
+#	endif
+fpl_force_inline fmath__SIMDFloat fmath__SIMDCmpEq(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return vreinterpretq_f32_u32(vceqq_f32(a, b)); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDCmpLe(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return vreinterpretq_f32_u32(vcleq_f32(a, b)); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDCmpLt(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return vreinterpretq_f32_u32(vcltq_f32(a, b)); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDAnd(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDOr(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDMin(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return vbslq_f32(vcltq_f32(a, b), a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDMax(const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return vbslq_f32(vcgtq_f32(a, b), a, b); }
+fpl_force_inline fmath__SIMDFloat fmath__SIMDSelect(const fmath__SIMDFloat mask, const fmath__SIMDFloat a, const fmath__SIMDFloat b) { return vbslq_f32(vreinterpretq_u32_f32(mask), a, b); }
+fpl_force_inline int fmath__SIMDMoveMask(const fmath__SIMDFloat mask) {
+	uint32x4_t m = vshrq_n_u32(vreinterpretq_u32_f32(mask), 31);
+	int result = (int)(vgetq_lane_u32(m, 0) | (vgetq_lane_u32(m, 1) << 1) | (vgetq_lane_u32(m, 2) << 2) | (vgetq_lane_u32(m, 3) << 3));
+	return(result);
+}
+#else
+#	define FMATH_SIMD_WIDTH 1
+#endif
+
+//
+// SIMD lanes
+// FMATH_SIMD_WIDTH floats processed at once, only available when FMATH_SIMD is defined.
+// Compare functions return all bits set in matching lanes, use them as mask for LaneAnd, LaneSelect and LaneMoveMask.
+//
+#if defined(FMATH_SIMD)
+typedef fmath__SIMDFloat LaneF32;
+fpl_force_inline LaneF32 LaneLoad(const float *p) { return fmath__SIMDLoad(p); }
+fpl_force_inline void LaneStore(float *p, const LaneF32 v) { fmath__SIMDStore(p, v); }
+fpl_force_inline LaneF32 LaneSet1(const float v) { return fmath__SIMDSet1(v); }
+fpl_force_inline LaneF32 LaneAdd(const LaneF32 a, const LaneF32 b) { return fmath__SIMDAdd(a, b); }
+fpl_force_inline LaneF32 LaneSub(const LaneF32 a, const LaneF32 b) { return fmath__SIMDSub(a, b); }
+fpl_force_inline LaneF32 LaneMul(const LaneF32 a, const LaneF32 b) { return fmath__SIMDMul(a, b); }
+fpl_force_inline LaneF32 LaneDiv(const LaneF32 a, const LaneF32 b) { return fmath__SIMDDiv(a, b); }
+fpl_force_inline LaneF32 LaneSqrt(const LaneF32 a) { return fmath__SIMDSqrt(a); }
+fpl_force_inline LaneF32 LaneMin(const LaneF32 a, const LaneF32 b) { return fmath__SIMDMin(a, b); }
+fpl_force_inline LaneF32 LaneMax(const LaneF32 a, const LaneF32 b) { return fmath__SIMDMax(a, b); }
+fpl_force_inline LaneF32 LaneCmpEq(const LaneF32 a, const LaneF32 b) { return fmath__SIMDCmpEq(a, b); }
+fpl_force_inline LaneF32 LaneCmpLe(const LaneF32 a, const LaneF32 b) { return fmath__SIMDCmpLe(a, b); }
+fpl_force_inline LaneF32 LaneCmpLt(const LaneF32 a, const LaneF32 b) { return fmath__SIMDCmpLt(a, b); }
+fpl_force_inline LaneF32 LaneAnd(const LaneF32 a, const LaneF32 b) { return fmath__SIMDAnd(a, b); }
+fpl_force_inline LaneF32 LaneOr(const LaneF32 a, const LaneF32 b) { return fmath__SIMDOr(a, b); }
+// Returns a for lanes whose mask bits are set, b otherwise
+fpl_force_inline LaneF32 LaneSelect(const LaneF32 mask, const LaneF32 a, const LaneF32 b) { return fmath__SIMDSelect(mask, a, b); }
+// Returns the sign bit of each lane as bit mask, lane 0 is the lowest bit
+fpl_force_inline int LaneMoveMask(const LaneF32 mask) { return fmath__SIMDMoveMask(mask); }
+#endif // FMATH_SIMD
+
+//
+// Batch (Structure-of-arrays)
+// All functions takes separated component arrays and process FMATH_SIMD_WIDTH elements at once, the remainder is processed by scalar code.
+// Input and output arrays may be the same, but must not overlap partially.
+//
+
+/* Transforms count 3D points (w = 1) by the given matrix (M * p) */
+fpl_force_inline static void BatchTransformPoints3(const Mat4f *mat, const float *xs, const float *ys, const float *zs, float *outXs, float *outYs, float *outZs, const size_t count) {
+	fplAssert(mat != fpl_null);
+	size_t i = 0;
+#if defined(FMATH_SIMD)
+	const fmath__SIMDFloat m00 = fmath__SIMDSet1(mat->col1.x), m01 = fmath__SIMDSet1(mat->col1.y), m02 = fmath__SIMDSet1(mat->col1.z);
+	const fmath__SIMDFloat m10 = fmath__SIMDSet1(mat->col2.x), m11 = fmath__SIMDSet1(mat->col2.y), m12 = fmath__SIMDSet1(mat->col2.z);
+	const fmath__SIMDFloat m20 = fmath__SIMDSet1(mat->col3.x), m21 = fmath__SIMDSet1(mat->col3.y), m22 = fmath__SIMDSet1(mat->col3.z);
+	const fmath__SIMDFloat m30 = fmath__SIMDSet1(mat->col4.x), m31 = fmath__SIMDSet1(mat->col4.y), m32 = fmath__SIMDSet1(mat->col4.z);
+	for (; i + FMATH_SIMD_WIDTH <= count; i += FMATH_SIMD_WIDTH) {
+		fmath__SIMDFloat x = fmath__SIMDLoad(xs + i);
+		fmath__SIMDFloat y = fmath__SIMDLoad(ys + i);
+		fmath__SIMDFloat z = fmath__SIMDLoad(zs + i);
+		fmath__SIMDFloat rx = fmath__SIMDAdd(fmath__SIMDAdd(fmath__SIMDAdd(fmath__SIMDMul(m00, x), fmath__SIMDMul(m10, y)), fmath__SIMDMul(m20, z)), m30);
+		fmath__SIMDFloat ry = fmath__SIMDAdd(fmath__SIMDAdd(fmath__SIMDAdd(fmath__SIMDMul(m01, x), fmath__SIMDMul(m11, y)), fmath__SIMDMul(m21, z)), m31);
+		fmath__SIMDFloat rz = fmath__SIMDAdd(fmath__SIMDAdd(fmath__SIMDAdd(fmath__SIMDMul(m02, x), fmath__SIMDMul(m12, y)), fmath__SIMDMul(m22, z)), m32);
+		fmath__SIMDStore(outXs + i, rx);
+		fmath__SIMDStore(outYs + i, ry);
+		fmath__SIMDStore(outZs + i, rz);
+	}
+#endif
+	for (; i < count; ++i) {
+		float x = xs[i], y = ys[i], z = zs[i];
+		outXs[i] = mat->col1.x * x + mat->col2.x * y + mat->col3.x * z + mat->col4.x;
+		outYs[i] = mat->col1.y * x + mat->col2.y * y + mat->col3.y * z + mat->col4.y;
+		outZs[i] = mat->col1.z * x + mat->col2.z * y + mat->col3.z * z + mat->col4.z;
+	}
+}
+
+/* Transforms count 2D points (z = 0, w = 1) by the given matrix (M * p) */
+fpl_force_inline static void BatchTransformPoints2(const Mat4f *mat, const float *xs, const float *ys, float *outXs, float *outYs, const size_t count) {
+	fplAssert(mat != fpl_null);
+	size_t i = 0;
+#if defined(FMATH_SIMD)
+	const fmath__SIMDFloat m00 = fmath__SIMDSet1(mat->col1.x), m01 = fmath__SIMDSet1(mat->col1.y);
+	const fmath__SIMDFloat m10 = fmath__SIMDSet1(mat->col2.x), m11 = fmath__SIMDSet1(mat->col2.y);
+	const fmath__SIMDFloat m30 = fmath__SIMDSet1(mat->col4.x), m31 = fmath__SIMDSet1(mat->col4.y);
+	for (; i + FMATH_SIMD_WIDTH <= count; i += FMATH_SIMD_WIDTH) {
+		fmath__SIMDFloat x = fmath__SIMDLoad(xs + i);
+		fmath__SIMDFloat y = fmath__SIMDLoad(ys + i);
+		fmath__SIMDFloat rx = fmath__SIMDAdd(fmath__SIMDAdd(fmath__SIMDMul(m00, x), fmath__SIMDMul(m10, y)), m30);
+		fmath__SIMDFloat ry = fmath__SIMDAdd(fmath__SIMDAdd(fmath__SIMDMul(m01, x), fmath__SIMDMul(m11, y)), m31);
+		fmath__SIMDStore(outXs + i, rx);
+		fmath__SIMDStore(outYs + i, ry);
+	}
+#endif
+	for (; i < count; ++i) {
+		float x = xs[i], y = ys[i];
+		outXs[i] = mat->col1.x * x + mat->col2.x * y + mat->col4.x;
+		outYs[i] = mat->col1.y * x + mat->col2.y * y + mat->col4.y;
+	}
+}
+
+/* Normalizes count 3D vectors, zero vectors stay zero (Same as V3fNormalize) */
+fpl_force_inline static void BatchNormalize3(const float *xs, const float *ys, const float *zs, float *outXs, float *outYs, float *outZs, const size_t count) {
+	size_t i = 0;
+#if defined(FMATH_SIMD)
+	const fmath__SIMDFloat zero = fmath__SIMDSet1(0.0f);
+	const fmath__SIMDFloat one = fmath__SIMDSet1(1.0f);
+	for (; i + FMATH_SIMD_WIDTH <= count; i += FMATH_SIMD_WIDTH) {
+		fmath__SIMDFloat x = fmath__SIMDLoad(xs + i);
+		fmath__SIMDFloat y = fmath__SIMDLoad(ys + i);
+		fmath__SIMDFloat z = fmath__SIMDLoad(zs + i);
+		fmath__SIMDFloat l = fmath__SIMDSqrt(fmath__SIMDAdd(fmath__SIMDAdd(fmath__SIMDMul(x, x), fmath__SIMDMul(y, y)), fmath__SIMDMul(z, z)));
+		l = fmath__SIMDSelect(fmath__SIMDCmpEq(l, zero), one, l);
+		fmath__SIMDFloat invL = fmath__SIMDDiv(one, l);
+		fmath__SIMDStore(outXs + i, fmath__SIMDMul(x, invL));
+		fmath__SIMDStore(outYs + i, fmath__SIMDMul(y, invL));
+		fmath__SIMDStore(outZs + i, fmath__SIMDMul(z, invL));
+	}
+#endif
+	for (; i < count; ++i) {
+		Vec3f v = V3fNormalize(V3fInit(xs[i], ys[i], zs[i]));
+		outXs[i] = v.x;
+		outYs[i] = v.y;
+		outZs[i] = v.z;
+	}
+}
+
+/* Normalizes count 2D vectors, zero vectors stay zero (Same as V2fNormalize) */
+fpl_force_inline static void BatchNormalize2(const float *xs, const float *ys, float *outXs, float *outYs, const size_t count) {
+	size_t i = 0;
+#if defined(FMATH_SIMD)
+	const fmath__SIMDFloat zero = fmath__SIMDSet1(0.0f);
+	const fmath__SIMDFloat one = fmath__SIMDSet1(1.0f);
+	for (; i + FMATH_SIMD_WIDTH <= count; i += FMATH_SIMD_WIDTH) {
+		fmath__SIMDFloat x = fmath__SIMDLoad(xs + i);
+		fmath__SIMDFloat y = fmath__SIMDLoad(ys + i);
+		fmath__SIMDFloat l = fmath__SIMDSqrt(fmath__SIMDAdd(fmath__SIMDMul(x, x), fmath__SIMDMul(y, y)));
+		l = fmath__SIMDSelect(fmath__SIMDCmpEq(l, zero), one, l);
+		fmath__SIMDFloat invL = fmath__SIMDDiv(one, l);
+		fmath__SIMDStore(outXs + i, fmath__SIMDMul(x, invL));
+		fmath__SIMDStore(outYs + i, fmath__SIMDMul(y, invL));
+	}
+#endif
+	for (; i < count; ++i) {
+		Vec2f v = V2fNormalize(V2fInit(xs[i], ys[i]));
+		outXs[i] = v.x;
+		outYs[i] = v.y;
+	}
+}
+
+/* Linear interpolation of count scalars (Same as ScalarLerp), call it once per component array */
+fpl_force_inline static void BatchLerp(const float *as, const float t, const float *bs, float *outs, const size_t count) {
+	size_t i = 0;
+#if defined(FMATH_SIMD)
+	const fmath__SIMDFloat tt = fmath__SIMDSet1(t);
+	const fmath__SIMDFloat invT = fmath__SIMDSet1(1.0f - t);
+	for (; i + FMATH_SIMD_WIDTH <= count; i += FMATH_SIMD_WIDTH) {
+		fmath__SIMDFloat a = fmath__SIMDLoad(as + i);
+		fmath__SIMDFloat b = fmath__SIMDLoad(bs + i);
+		fmath__SIMDStore(outs + i, fmath__SIMDAdd(fmath__SIMDMul(invT, a), fmath__SIMDMul(tt, b)));
+	}
+#endif
+	for (; i < count; ++i) {
+		outs[i] = ScalarLerp(as[i], t, bs[i]);
+	}
+}
+
+/* Tests count 2D boxes against the given box (touching counts as overlap). Writes 1 or 0 per box and returns the number of overlaps */
+fpl_force_inline static size_t BatchAABBOverlap2(const float *minXs, const float *minYs, const float *maxXs, const float *maxYs, const Vec2f queryMin, const Vec2f queryMax, uint8_t *outResults, const size_t count) {
+	size_t result = 0;
+	size_t i = 0;
+#if defined(FMATH_SIMD)
+	const fmath__SIMDFloat qMinX = fmath__SIMDSet1(queryMin.x);
+	const fmath__SIMDFloat qMinY = fmath__SIMDSet1(queryMin.y);
+	const fmath__SIMDFloat qMaxX = fmath__SIMDSet1(queryMax.x);
+	const fmath__SIMDFloat qMaxY = fmath__SIMDSet1(queryMax.y);
+	for (; i + FMATH_SIMD_WIDTH <= count; i += FMATH_SIMD_WIDTH) {
+		fmath__SIMDFloat overlapX = fmath__SIMDAnd(fmath__SIMDCmpLe(fmath__SIMDLoad(minXs + i), qMaxX), fmath__SIMDCmpLe(qMinX, fmath__SIMDLoad(maxXs + i)));
+		fmath__SIMDFloat overlapY = fmath__SIMDAnd(fmath__SIMDCmpLe(fmath__SIMDLoad(minYs + i), qMaxY), fmath__SIMDCmpLe(qMinY, fmath__SIMDLoad(maxYs + i)));
+		int mask = fmath__SIMDMoveMask(fmath__SIMDAnd(overlapX, overlapY));
+		for (int lane = 0; lane < FMATH_SIMD_WIDTH; ++lane) {
+			uint8_t hit = (uint8_t)((mask >> lane) & 1);
+			outResults[i + lane] = hit;
+			result += hit;
+		}
+	}
+#endif
+	for (; i < count; ++i) {
+		bool hit = (minXs[i] <= queryMax.x) && (queryMin.x <= maxXs[i]) && (minYs[i] <= queryMax.y) && (queryMin.y <= maxYs[i]);
+		outResults[i] = hit ? 1 : 0;
+		result += hit ? 1 : 0;
+	}
 	return(result);
 }
 
+/* Computes the squared distances from count 3D points to the given point */
+fpl_force_inline static void BatchDistanceSquared3(const float *xs, const float *ys, const float *zs, const Vec3f p, float *outs, const size_t count) {
+	size_t i = 0;
+#if defined(FMATH_SIMD)
+	const fmath__SIMDFloat px = fmath__SIMDSet1(p.x);
+	const fmath__SIMDFloat py = fmath__SIMDSet1(p.y);
+	const fmath__SIMDFloat pz = fmath__SIMDSet1(p.z);
+	for (; i + FMATH_SIMD_WIDTH <= count; i += FMATH_SIMD_WIDTH) {
+		fmath__SIMDFloat dx = fmath__SIMDSub(px, fmath__SIMDLoad(xs + i));
+		fmath__SIMDFloat dy = fmath__SIMDSub(py, fmath__SIMDLoad(ys + i));
+		fmath__SIMDFloat dz = fmath__SIMDSub(pz, fmath__SIMDLoad(zs + i));
+		fmath__SIMDStore(outs + i, fmath__SIMDAdd(fmath__SIMDAdd(fmath__SIMDMul(dx, dx), fmath__SIMDMul(dy, dy)), fmath__SIMDMul(dz, dz)));
+	}
+#endif
+	for (; i < count; ++i) {
+		outs[i] = V3fDistanceSquared(V3fInit(xs[i], ys[i], zs[i]), p);
+	}
+}
+
+/* Computes the squared distances from count 2D points to the given point */
+fpl_force_inline static void BatchDistanceSquared2(const float *xs, const float *ys, const Vec2f p, float *outs, const size_t count) {
+	size_t i = 0;
+#if defined(FMATH_SIMD)
+	const fmath__SIMDFloat px = fmath__SIMDSet1(p.x);
+	const fmath__SIMDFloat py = fmath__SIMDSet1(p.y);
+	for (; i + FMATH_SIMD_WIDTH <= count; i += FMATH_SIMD_WIDTH) {
+		fmath__SIMDFloat dx = fmath__SIMDSub(px, fmath__SIMDLoad(xs + i));
+		fmath__SIMDFloat dy = fmath__SIMDSub(py, fmath__SIMDLoad(ys + i));
+		fmath__SIMDStore(outs + i, fmath__SIMDAdd(fmath__SIMDMul(dx, dx), fmath__SIMDMul(dy, dy)));
+	}
+#endif
+	for (; i < count; ++i) {
+		outs[i] = V2fDistanceSquared(V2fInit(xs[i], ys[i]), p);
+	}
+}
+
 //
 // Pixel
 //
@@ -24,6 +24,7 @@ extern void DrawCircle(const float centerX, const float centerY, const float rad
 extern void DrawNormal(const Vec2f &pos, const Vec2f &normal, const float length, const Vec4f &color);
 extern GLuint AllocateTexture(const uint32_t width, const uint32_t height, const void *data, const bool repeatable, const GLint filter, const bool isAlphaOnly = false);
 extern void InitOpenGLRenderer();
+extern void ProcessTextureOperations(RenderState &renderState);
 extern void RenderWithOpenGL(RenderState &renderState);
 
 #endif // FINAL_OPENGL_RENDER_H
@@ -139,7 +140,7 @@ extern void InitOpenGLRenderer() {
 	glEnable(GL_LINE_SMOOTH);
 }
 
-extern void RenderWithOpenGL(RenderState &renderState) {
+extern void ProcessTextureOperations(RenderState &renderState) {
 	size_t index = 0;
 	while(renderState.textureOperationCount > 0) {
 		TextureOperation &op = renderState.textureOperations[index];
@@ -158,6 +159,10 @@ extern void RenderWithOpenGL(RenderState &renderState) {
 		++index;
 	}
 	fplAssert(renderState.textureOperationCount == 0);
+}
+
+extern void RenderWithOpenGL(RenderState &renderState) {
+	ProcessTextureOperations(renderState);
 
 	glMatrixMode(GL_PROJECTION);
 	glLoadIdentity();
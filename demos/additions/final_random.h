@@ -10,6 +10,12 @@ Description:
 License:
 	MIT License
 	Copyright 2019 Torsten Spaete
+
+Changelog
+	## 2026-10-18:
+	- Added RandomStream (xoshiro256**) with jump/long-jump for non-overlapping per-thread streams
+	- Added RandomStreamX4, four interleaved streams advanced with SSE2/AVX2
+	- Added 4/8-wide uniform and cosine hemisphere generators and bulk fill functions
 */
 
 #ifndef FINAL_RANDOM_H
@@ -21,6 +27,12 @@ License:
 
 #include "final_math.h"
 
+// RandomStreamX4 uses AVX2 when the compiler targets it, otherwise the SSE2 backend of final_math.h
+#if defined(FMATH_SIMD_SSE2) && defined(__AVX2__)
+#	define FRANDOM_SIMD_AVX2
+#	include <immintrin.h>
+#endif
+
 // https://arvid.io/2018/07/02/better-cxx-prng/
 #define RANDOMTYPE_SPLITMIX 1
 #define RANDOMTYPE_XORSHIFT 2
@@ -128,4 +140,283 @@ inline Vec3f RandomUnitHemisphere(RandomSeries* series) {
 	return(result);
 }
 
+//
+// RandomStream (xoshiro256**)
+// http://prng.di.unimi.it/xoshiro256starstar.c
+//
+// Each stream has a period of 2^256 - 1. RandomStreamJump() advances a stream by 2^128 steps,
+// RandomStreamLongJump() by 2^192 steps, so streams created by jumping never overlap.
+// Use one stream per thread, never share a stream between threads.
+//
+struct RandomStream {
+	uint64_t s[4];
+};
+
+// A stream padded to a full cacheline, use this for arrays of per-thread streams to prevent false sharing
+#define RANDOM_CACHELINE_SIZE 64
+struct RandomStreamPadded {
+	RandomStream stream;
+	uint8_t padding[RANDOM_CACHELINE_SIZE - sizeof(RandomStream)];
+};
+fplStaticAssert(sizeof(RandomStreamPadded) == RANDOM_CACHELINE_SIZE);
+
+inline uint64_t Random__SplitMix64(uint64_t *state) {
+	uint64_t z = (*state += UINT64_C(0x9E3779B97F4A7C15));
+	z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+	z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+	return z ^ (z >> 31);
+}
+
+inline uint64_t Random__RotL64(const uint64_t x, const int k) {
+	return (x << k) | (x >> (64 - k));
+}
+
+inline RandomStream RandomStreamSeed(const uint64_t seed) {
+	// State must not be all zero, splitmix64 expansion guarantees that
+	uint64_t state = seed;
+	RandomStream result = {};
+	for (int i = 0; i < 4; ++i) {
+		result.s[i] = Random__SplitMix64(&state);
+	}
+	return(result);
+}
+
+inline uint64_t RandomStreamU64(RandomStream *stream) {
+	uint64_t *s = stream->s;
+	const uint64_t result = Random__RotL64(s[1] * 5, 7) * 9;
+	const uint64_t t = s[1] << 17;
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = Random__RotL64(s[3], 45);
+	return(result);
+}
+
+inline void Random__Jump(RandomStream *stream, const uint64_t jumpTable[4]) {
+	uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+	for (int i = 0; i < 4; ++i) {
+		for (int b = 0; b < 64; ++b) {
+			if (jumpTable[i] & (UINT64_C(1) << b)) {
+				s0 ^= stream->s[0];
+				s1 ^= stream->s[1];
+				s2 ^= stream->s[2];
+				s3 ^= stream->s[3];
+			}
+			RandomStreamU64(stream);
+		}
+	}
+	stream->s[0] = s0;
+	stream->s[1] = s1;
+	stream->s[2] = s2;
+	stream->s[3] = s3;
+}
+
+// Advances the stream by 2^128 steps
+inline void RandomStreamJump(RandomStream *stream) {
+	static const uint64_t jumpTable[] = { UINT64_C(0x180ec6d33cfd0aba), UINT64_C(0xd5a61266f0c9392c), UINT64_C(0xa9582618e03fc9aa), UINT64_C(0x39abdc4529b1661c) };
+	Random__Jump(stream, jumpTable);
+}
+
+// Advances the stream by 2^192 steps
+inline void RandomStreamLongJump(RandomStream *stream) {
+	static const uint64_t longJumpTable[] = { UINT64_C(0x76e15d3efefdcbbf), UINT64_C(0xc5004e441c522fb3), UINT64_C(0x77710069854ee241), UINT64_C(0x39109bb02acbe635) };
+	Random__Jump(stream, longJumpTable);
+}
+
+// Initializes count non-overlapping streams from one seed, stream N is the seeded stream jumped N times
+inline void RandomStreamsInit(RandomStream *streams, const size_t count, const uint64_t seed) {
+	RandomStream current = RandomStreamSeed(seed);
+	for (size_t i = 0; i < count; ++i) {
+		streams[i] = current;
+		RandomStreamJump(&current);
+	}
+}
+
+inline void RandomStreamsInitPadded(RandomStreamPadded *streams, const size_t count, const uint64_t seed) {
+	RandomStream current = RandomStreamSeed(seed);
+	for (size_t i = 0; i < count; ++i) {
+		streams[i].stream = current;
+		RandomStreamJump(&current);
+	}
+}
+
+inline uint32_t RandomStreamU32(RandomStream *stream) {
+	uint32_t result = (uint32_t)(RandomStreamU64(stream) >> 32);
+	return(result);
+}
+
+// Upper 24 bits to float in range of 0.0 to 1.0 (exclusive)
+inline float Random__U32ToUnilateral(const uint32_t value) {
+	float result = (float)(value >> 8) * (1.0f / 16777216.0f);
+	return(result);
+}
+
+// 0.0 to 1.0 (exclusive)
+inline float RandomStreamUnilateral(RandomStream *stream) {
+	float result = Random__U32ToUnilateral(RandomStreamU32(stream));
+	return(result);
+}
+
+// -1.0 to +1.0 (exclusive)
+inline float RandomStreamBilateral(RandomStream *stream) {
+	float result = -1.0f + 2.0f * RandomStreamUnilateral(stream);
+	return(result);
+}
+
+inline Vec3f RandomStreamUnitHemisphere(RandomStream *stream) {
+	float u1 = RandomStreamUnilateral(stream);
+	float u2 = RandomStreamUnilateral(stream);
+	Vec3f result = CosineSampleHemisphere(u1, u2);
+	return(result);
+}
+
+inline void RandomStreamFillU32(RandomStream *stream, uint32_t *out, const size_t count) {
+	size_t i = 0;
+	for (; i + 2 <= count; i += 2) {
+		uint64_t v = RandomStreamU64(stream);
+		out[i + 0] = (uint32_t)(v >> 32);
+		out[i + 1] = (uint32_t)v;
+	}
+	if (i < count) {
+		out[i] = RandomStreamU32(stream);
+	}
+}
+
+inline void RandomStreamFillUnilateral(RandomStream *stream, float *out, const size_t count) {
+	size_t i = 0;
+	for (; i + 2 <= count; i += 2) {
+		uint64_t v = RandomStreamU64(stream);
+		out[i + 0] = Random__U32ToUnilateral((uint32_t)(v >> 32));
+		out[i + 1] = Random__U32ToUnilateral((uint32_t)v);
+	}
+	if (i < count) {
+		out[i] = RandomStreamUnilateral(stream);
+	}
+}
+
+//
+// RandomStreamX4
+// Four interleaved, non-overlapping xoshiro256** streams (lane N is the seeded stream jumped N times).
+// The state is stored as structure-of-arrays and advanced with AVX2 (4 lanes) or SSE2 (2x2 lanes).
+//
+struct RandomStreamX4 {
+	uint64_t s[4][4]; // [state word][lane]
+};
+
+inline RandomStreamX4 RandomStreamX4Seed(const uint64_t seed) {
+	RandomStreamX4 result = {};
+	RandomStream current = RandomStreamSeed(seed);
+	for (int lane = 0; lane < 4; ++lane) {
+		for (int word = 0; word < 4; ++word) {
+			result.s[word][lane] = current.s[word];
+		}
+		RandomStreamJump(&current);
+	}
+	return(result);
+}
+
+// Writes one 64-bit value per lane
+inline void RandomStreamX4U64(RandomStreamX4 *stream, uint64_t out[4]) {
+#if defined(FRANDOM_SIMD_AVX2)
+	__m256i s0 = _mm256_loadu_si256((const __m256i *)stream->s[0]);
+	__m256i s1 = _mm256_loadu_si256((const __m256i *)stream->s[1]);
+	__m256i s2 = _mm256_loadu_si256((const __m256i *)stream->s[2]);
+	__m256i s3 = _mm256_loadu_si256((const __m256i *)stream->s[3]);
+	// rotl(s1 * 5, 7) * 9
+	__m256i m5 = _mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1);
+	__m256i r7 = _mm256_or_si256(_mm256_slli_epi64(m5, 7), _mm256_srli_epi64(m5, 57));
+	__m256i result = _mm256_add_epi64(_mm256_slli_epi64(r7, 3), r7);
+	__m256i t = _mm256_slli_epi64(s1, 17);
+	s2 = _mm256_xor_si256(s2, s0);
+	s3 = _mm256_xor_si256(s3, s1);
+	s1 = _mm256_xor_si256(s1, s2);
+	s0 = _mm256_xor_si256(s0, s3);
+	s2 = _mm256_xor_si256(s2, t);
+	s3 = _mm256_or_si256(_mm256_slli_epi64(s3, 45), _mm256_srli_epi64(s3, 19));
+	_mm256_storeu_si256((__m256i *)stream->s[0], s0);
+	_mm256_storeu_si256((__m256i *)stream->s[1], s1);
+	_mm256_storeu_si256((__m256i *)stream->s[2], s2);
+	_mm256_storeu_si256((__m256i *)stream->s[3], s3);
+	_mm256_storeu_si256((__m256i *)out, result);
+#elif defined(FMATH_SIMD_SSE2)
+	for (int half = 0; half < 4; half += 2) {
+		__m128i s0 = _mm_loadu_si128((const __m128i *)(stream->s[0] + half));
+		__m128i s1 = _mm_loadu_si128((const __m128i *)(stream->s[1] + half));
+		__m128i s2 = _mm_loadu_si128((const __m128i *)(stream->s[2] + half));
+		__m128i s3 = _mm_loadu_si128((const __m128i *)(stream->s[3] + half));
+		__m128i m5 = _mm_add_epi64(_mm_slli_epi64(s1, 2), s1);
+		__m128i r7 = _mm_or_si128(_mm_slli_epi64(m5, 7), _mm_srli_epi64(m5, 57));
+		__m128i result = _mm_add_epi64(_mm_slli_epi64(r7, 3), r7);
+		__m128i t = _mm_slli_epi64(s1, 17);
+		s2 = _mm_xor_si128(s2, s0);
+		s3 = _mm_xor_si128(s3, s1);
+		s1 = _mm_xor_si128(s1, s2);
+		s0 = _mm_xor_si128(s0, s3);
+		s2 = _mm_xor_si128(s2, t);
+		s3 = _mm_or_si128(_mm_slli_epi64(s3, 45), _mm_srli_epi64(s3, 19));
+		_mm_storeu_si128((__m128i *)(stream->s[0] + half), s0);
+		_mm_storeu_si128((__m128i *)(stream->s[1] + half), s1);
+		_mm_storeu_si128((__m128i *)(stream->s[2] + half), s2);
+		_mm_storeu_si128((__m128i *)(stream->s[3] + half), s3);
+		_mm_storeu_si128((__m128i *)(out + half), result);
+	}
+#else
+	for (int lane = 0; lane < 4; ++lane) {
+		uint64_t s1 = stream->s[1][lane];
+		out[lane] = Random__RotL64(s1 * 5, 7) * 9;
+		uint64_t t = s1 << 17;
+		stream->s[2][lane] ^= stream->s[0][lane];
+		stream->s[3][lane] ^= stream->s[1][lane];
+		stream->s[1][lane] ^= stream->s[2][lane];
+		stream->s[0][lane] ^= stream->s[3][lane];
+		stream->s[2][lane] ^= t;
+		stream->s[3][lane] = Random__RotL64(stream->s[3][lane], 45);
+	}
+#endif
+}
+
+// 4 uniforms in range of 0.0 to 1.0 (exclusive), one per lane
+inline void RandomStreamX4Unilateral4(RandomStreamX4 *stream, float out[4]) {
+	uint64_t values[4];
+	RandomStreamX4U64(stream, values);
+	for (int lane = 0; lane < 4; ++lane) {
+		out[lane] = Random__U32ToUnilateral((uint32_t)(values[lane] >> 32));
+	}
+}
+
+// 8 uniforms in range of 0.0 to 1.0 (exclusive), both 32-bit halves of each lane are used
+inline void RandomStreamX4Unilateral8(RandomStreamX4 *stream, float out[8]) {
+	uint64_t values[4];
+	RandomStreamX4U64(stream, values);
+	for (int lane = 0; lane < 4; ++lane) {
+		out[lane + 0] = Random__U32ToUnilateral((uint32_t)(values[lane] >> 32));
+		out[lane + 4] = Random__U32ToUnilateral((uint32_t)values[lane]);
+	}
+}
+
+// 4 cosine weighted directions in the unit hemisphere around +Z
+inline void RandomStreamX4UnitHemisphere4(RandomStreamX4 *stream, Vec3f out[4]) {
+	float u[8];
+	RandomStreamX4Unilateral8(stream, u);
+	for (int lane = 0; lane < 4; ++lane) {
+		out[lane] = CosineSampleHemisphere(u[lane], u[lane + 4]);
+	}
+}
+
+inline void RandomStreamX4FillUnilateral(RandomStreamX4 *stream, float *out, const size_t count) {
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		RandomStreamX4Unilateral8(stream, out + i);
+	}
+	if (i < count) {
+		float tail[8];
+		RandomStreamX4Unilateral8(stream, tail);
+		for (size_t j = 0; i < count; ++i, ++j) {
+			out[i] = tail[j];
+		}
+	}
+}
+
 #endif // FINAL_RANDOM_H
\ No newline at end of file
@@ -103,7 +103,7 @@ SOFTWARE.
 
 /*!
 	\file final_dynamic_opengl.h
-	\version v0.3.5.0 beta
+	\version v0.3.6.0 beta
 	\author Torsten Spaete
 	\brief Final Dynamic OpenGL (FGL) - A open source C99 single file header OpenGL-Loader library.
 */
@@ -112,6 +112,14 @@ SOFTWARE.
 	\page page_changelog Changelog
 	\tableofcontents
 
+ 	## v0.3.6.0 beta:
+ 	- New: Added fglLoadOpenGLFunctionsForVersion() for loading only the functions up to a version
+ 	- New: Added fglGetOpenGLLoadStats() for the time and number of resolved functions
+ 	- New: Added FGL_MAX_OPENGL_VERSION to strip declarations of newer versions
+ 	- Fixed: OpenGL 4.6 functions was never loaded
+ 	- Fixed: isGL_VERSION_#_# flags was never set, they are set only when the context supports the version and all its functions are loaded
+ 	- Fixed: Loading again for a lower version keeps no functions or flags of the higher versions
+
  	## v0.3.5.0 beta:
  	- Fixed: Fixed incompabilties with MingW compiler (FARPROC)
 
@@ -258,6 +266,11 @@ SOFTWARE.
 #	define FGL_APIENTRY
 #endif
 
+//! Highest OpenGL version (major * 10 + minor) for which types and functions are declared, lower it to shrink the function table
+#ifndef FGL_MAX_OPENGL_VERSION
+#	define FGL_MAX_OPENGL_VERSION 46
+#endif
+
 #if FGL_AS_PRIVATE
 	//! API functions exported as static
 #	define fdyngl_api static
@@ -375,6 +388,20 @@ extern "C" {
 		bool forwardCompability;
 	} fglOpenGLContextCreationParameters;
 
+	//! OpenGL function loading statistics
+	typedef struct fglOpenGLLoadStats {
+		//! Time spent for resolving the functions in milliseconds, zero when no wall clock is available
+		double loadTimeMs;
+		//! Number of functions requested
+		uint32_t requestedProcCount;
+		//! Number of functions resolved successfully
+		uint32_t resolvedProcCount;
+		//! Highest version (major * 10 + minor) which is supported by the context and has all its functions loaded
+		uint32_t loadedVersion;
+		//! Version (major * 10 + minor) reported by the current context or zero when unknown
+		uint32_t contextVersion;
+	} fglOpenGLLoadStats;
+
 	//! Sets the context parameters to default values
 	fdyngl_api void fglSetDefaultOpenGLContextCreationParameters(fglOpenGLContextCreationParameters *outParams);
 
@@ -393,6 +420,12 @@ extern "C" {
 	//! Load all opengl functions
 	fdyngl_api void fglLoadOpenGLFunctions();
 
+	//! Load the opengl functions up to the given version only, pass zero to use the version of the current rendering context
+	fdyngl_api void fglLoadOpenGLFunctionsForVersion(const uint32_t majorVersion, const uint32_t minorVersion);
+
+	//! Returns the statistics of the last function loading
+	fdyngl_api const fglOpenGLLoadStats *fglGetOpenGLLoadStats();
+
 	//! Presents the current frame for the given opengl context
 	fdyngl_api void fglPresentOpenGL(const fglOpenGLContext *context);
 
@@ -1684,7 +1717,7 @@ extern "C" {
 	typedef void (FGL_APIENTRY gl_viewport_func)(GLint x, GLint y, GLsizei width, GLsizei height);
 	static gl_viewport_func* glViewport;
 #	endif // GL_VERSION_1_1
-#	ifndef GL_VERSION_1_2
+#	if !defined(GL_VERSION_1_2) && (FGL_MAX_OPENGL_VERSION >= 12)
 #		define GL_VERSION_1_2 1
 	static bool isGL_VERSION_1_2;
 #	define GL_UNSIGNED_BYTE_3_3_2 0x8032
@@ -1737,7 +1770,7 @@ extern "C" {
 	typedef void (FGL_APIENTRY gl_copy_tex_sub_image3d_func)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height);
 	static gl_copy_tex_sub_image3d_func* glCopyTexSubImage3D;
 #	endif // GL_VERSION_1_2
-#	ifndef GL_VERSION_1_3
+#	if !defined(GL_VERSION_1_3) && (FGL_MAX_OPENGL_VERSION >= 13)
 #		define GL_VERSION_1_3 1
 	static bool isGL_VERSION_1_3;
 #	define GL_TEXTURE0 0x84C0
@@ -1929,7 +1962,7 @@ extern "C" {
 	typedef void (FGL_APIENTRY gl_mult_transpose_matrixd_func)(const GLdouble *m);
 	static gl_mult_transpose_matrixd_func* glMultTransposeMatrixd;
 #	endif // GL_VERSION_1_3
-#	ifndef GL_VERSION_1_4
+#	if !defined(GL_VERSION_1_4) && (FGL_MAX_OPENGL_VERSION >= 14)
 #		define GL_VERSION_1_4 1
 	static bool isGL_VERSION_1_4;
 #	define GL_BLEND_DST_RGB 0x80C8
@@ -2077,7 +2110,7 @@ extern "C" {
 	typedef void (FGL_APIENTRY gl_blend_equation_func)(GLenum mode);
 	static gl_blend_equation_func* glBlendEquation;
 #	endif // GL_VERSION_1_4
-#	ifndef GL_VERSION_1_5
+#	if !defined(GL_VERSION_1_5) && (FGL_MAX_OPENGL_VERSION >= 15)
 #		define GL_VERSION_1_5 1
 	static bool isGL_VERSION_1_5;
 	typedef ptrdiff_t GLsizeiptr;
@@ -2171,7 +2204,7 @@ extern "C" {
 	typedef void (FGL_APIENTRY gl_get_buffer_pointerv_func)(GLenum target, GLenum pname, void **params);
 	static gl_get_buffer_pointerv_func* glGetBufferPointerv;
 #	endif // GL_VERSION_1_5
-#	ifndef GL_VERSION_2_0
+#	if !defined(GL_VERSION_2_0) && (FGL_MAX_OPENGL_VERSION >= 20)
 #		define GL_VERSION_2_0 1
 	static bool isGL_VERSION_2_0;
 	typedef char GLchar;
@@ -2446,7 +2479,7 @@ extern "C" {
 	typedef void (FGL_APIENTRY gl_vertex_attrib_pointer_func)(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer);
 	static gl_vertex_attrib_pointer_func* glVertexAttribPointer;
 #	endif // GL_VERSION_2_0
-#	ifndef GL_VERSION_2_1
+#	if !defined(GL_VERSION_2_1) && (FGL_MAX_OPENGL_VERSION >= 21)
 #		define GL_VERSION_2_1 1
 	static bool isGL_VERSION_2_1;
 #	define GL_PIXEL_PACK_BUFFER 0x88EB
@@ -2485,7 +2518,7 @@ extern "C" {
 	typedef void (FGL_APIENTRY gl_uniform_matrix4x3fv_func)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
 	static gl_uniform_matrix4x3fv_func* glUniformMatrix4x3fv;
 #	endif // GL_VERSION_2_1
-#	ifndef GL_VERSION_3_0
+#	if !defined(GL_VERSION_3_0) && (FGL_MAX_OPENGL_VERSION >= 30)
 #		define GL_VERSION_3_0 1
 	static bool isGL_VERSION_3_0;
 #	define GL_COMPARE_REF_TO_TEXTURE 0x884E
@@ -2894,7 +2927,7 @@ extern "C" {
 	typedef GLboolean(FGL_APIENTRY gl_is_vertex_array_func)(GLuint array);
 	static gl_is_vertex_array_func* glIsVertexArray;
 #	endif // GL_VERSION_3_0
-#	ifndef GL_VERSION_3_1
+#	if !defined(GL_VERSION_3_1) && (FGL_MAX_OPENGL_VERSION >= 31)
 #		define GL_VERSION_3_1 1
 	static bool isGL_VERSION_3_1;
 #	define GL_SAMPLER_2D_RECT 0x8B63
@@ -2983,7 +3016,7 @@ extern "C" {
 	typedef void (FGL_APIENTRY gl_uniform_block_binding_func)(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding);
 	static gl_uniform_block_binding_func* glUniformBlockBinding;
 #	endif // GL_VERSION_3_1
-#	ifndef GL_VERSION_3_2
+#	if !defined(GL_VERSION_3_2) && (FGL_MAX_OPENGL_VERSION >= 32)
 #		define GL_VERSION_3_2 1
 	static bool isGL_VERSION_3_2;
 	typedef struct __GLsync *GLsync;
@@ -3092,7 +3125,7 @@ extern "C" {
 	typedef void (FGL_APIENTRY gl_sample_maski_func)(GLuint maskNumber, GLbitfield mask);
 	static gl_sample_maski_func* glSampleMaski;
 #	endif // GL_VERSION_3_2
-#	ifndef GL_VERSION_3_3
+#	if !defined(GL_VERSION_3_3) && (FGL_MAX_OPENGL_VERSION >= 33)
 #		define GL_VERSION_3_3 1
 	static bool isGL_VERSION_3_3;
 #	define GL_VERTEX_ATTRIB_ARRAY_DIVISOR 0x88FE
@@ -3228,7 +3261,7 @@ extern "C" {
 	typedef void (FGL_APIENTRY gl_secondary_color_p3uiv_func)(GLenum type, const GLuint *color);
 	static gl_secondary_color_p3uiv_func* glSecondaryColorP3uiv;
 #	endif // GL_VERSION_3_3
-#	ifndef GL_VERSION_4_0
+#	if !defined(GL_VERSION_4_0) && (FGL_MAX_OPENGL_VERSION >= 40)
 #		define GL_VERSION_4_0 1
 	static bool isGL_VERSION_4_0;
 #	define GL_SAMPLE_SHADING 0x8C36
@@ -3401,7 +3434,7 @@ extern "C" {
 	typedef void (FGL_APIENTRY gl_get_query_indexediv_func)(GLenum target, GLuint index, GLenum pname, GLint *params);
 	static gl_get_query_indexediv_func* glGetQueryIndexediv;
 #	endif // GL_VERSION_4_0
-#	ifndef GL_VERSION_4_1
+#	if !defined(GL_VERSION_4_1) && (FGL_MAX_OPENGL_VERSION >= 41)
 #		define GL_VERSION_4_1 1
 	static bool isGL_VERSION_4_1;
 #	define GL_FIXED 0x140C
@@ -3616,7 +3649,7 @@ extern "C" {
 	typedef void (FGL_APIENTRY gl_get_doublei_v_func)(GLenum target, GLuint index, GLdouble *data);
 	static gl_get_doublei_v_func* glGetDoublei_v;
 #	endif // GL_VERSION_4_1
-#	ifndef GL_VERSION_4_2
+#	if !defined(GL_VERSION_4_2) && (FGL_MAX_OPENGL_VERSION >= 42)
 #		define GL_VERSION_4_2 1
 	static bool isGL_VERSION_4_2;
 #	define GL_COPY_READ_BUFFER_BINDING 0x8F36
@@ -3756,7 +3789,7 @@ extern "C" {
 	typedef void (FGL_APIENTRY gl_draw_transform_feedback_stream_instanced_func)(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount);
 	static gl_draw_transform_feedback_stream_instanced_func* glDrawTransformFeedbackStreamInstanced;
 #	endif // GL_VERSION_4_2
-#	ifndef GL_VERSION_4_3
+#	if !defined(GL_VERSION_4_3) && (FGL_MAX_OPENGL_VERSION >= 43)
 #		define GL_VERSION_4_3 1
 	static bool isGL_VERSION_4_3;
 	typedef void (FGL_APIENTRY *GLDEBUGPROC)(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *message, const void *userParam);
@@ -4106,7 +4139,7 @@ extern "C" {
 	typedef void (FGL_APIENTRY gl_get_object_ptr_label_func)(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label);
 	static gl_get_object_ptr_label_func* glGetObjectPtrLabel;
 #	endif // GL_VERSION_4_3
-#	ifndef GL_VERSION_4_4
+#	if !defined(GL_VERSION_4_4) && (FGL_MAX_OPENGL_VERSION >= 44)
 #		define GL_VERSION_4_4 1
 	static bool isGL_VERSION_4_4;
 #	define GL_MAX_VERTEX_ATTRIB_STRIDE 0x82E5
@@ -4147,7 +4180,7 @@ extern "C" {
 	typedef void (FGL_APIENTRY gl_bind_vertex_buffers_func)(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides);
 	static gl_bind_vertex_buffers_func* glBindVertexBuffers;
 #	endif // GL_VERSION_4_4
-#	ifndef GL_VERSION_4_5
+#	if !defined(GL_VERSION_4_5) && (FGL_MAX_OPENGL_VERSION >= 45)
 #		define GL_VERSION_4_5 1
 	static bool isGL_VERSION_4_5;
 #	define GL_CONTEXT_LOST 0x0507
@@ -4417,7 +4450,7 @@ extern "C" {
 	typedef void (FGL_APIENTRY gl_texture_barrier_func)(void);
 	static gl_texture_barrier_func* glTextureBarrier;
 #	endif // GL_VERSION_4_5
-#	ifndef GL_VERSION_4_6
+#	if !defined(GL_VERSION_4_6) && (FGL_MAX_OPENGL_VERSION >= 46)
 #		define GL_VERSION_4_6 1
 	static bool isGL_VERSION_4_6;
 #	define GL_SHADER_BINARY_FORMAT_SPIR_V 0x9551
@@ -4472,6 +4505,9 @@ extern "C" {
 #include <assert.h> // assert
 #include <stdarg.h> // va_start, va_end
 #include <stdio.h> // vsnprintf
+#if defined(FGL_PLATFORM_POSIX)
+#	include <time.h> // clock_gettime, CLOCK_MONOTONIC
+#endif
 
 static size_t fgl__GetStringLen(const char *str) {
 	size_t result = 0;
@@ -4853,7 +4889,14 @@ typedef struct fglOpenGLState {
 		fglPosixOpenGLApi posix;
 #		endif
 	};
+	fglOpenGLLoadStats loadStats;
 	char lastError[256];
+	//! Highest version to load, functions of newer versions are cleared
+	uint32_t loadMaxVersion;
+	//! Version of the functions currently resolved
+	uint32_t loadBlockVersion;
+	//! Number of functions of the current version which failed to resolve
+	uint32_t loadBlockMissingCount;
 	bool isLoaded;
 } fglOpenGLState;
 
@@ -4888,1102 +4931,1233 @@ static void *fgl__GetOpenGLProcAddress(const fglOpenGLState *state, const char *
 	return(result);
 }
 
-static void fgl__LoadOpenGLExtensions(const fglOpenGLState *state) {
+static double fgl__GetTimeInMilliseconds() {
+#	if defined(FGL_PLATFORM_WIN32)
+	LARGE_INTEGER frequency, counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return((double)counter.QuadPart / (double)frequency.QuadPart * 1000.0);
+#	elif defined(FGL_PLATFORM_POSIX) && defined(CLOCK_MONOTONIC)
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return((double)t.tv_sec * 1000.0 + (double)t.tv_nsec / 1000000.0);
+#	elif defined(TIME_UTC)
+	// Strict ISO C hides clock_gettime(), C11 has a wall clock at least
+	struct timespec t;
+	timespec_get(&t, TIME_UTC);
+	return((double)t.tv_sec * 1000.0 + (double)t.tv_nsec / 1000000.0);
+#	else
+	// No wall clock available, clock() would measure cpu time only
+	return(0.0);
+#	endif
+}
+
+// Functions of versions above the load version are not resolved and set to null
+static void *fgl__ResolveOpenGLProc(fglOpenGLState *state, const char *name) {
+	if(state->loadBlockVersion > state->loadMaxVersion) {
+		return(fgl_null);
+	}
+	void *result = fgl__GetOpenGLProcAddress(state, name);
+	++state->loadStats.requestedProcCount;
+	if(result != fgl_null) {
+		++state->loadStats.resolvedProcCount;
+	} else {
+		++state->loadBlockMissingCount;
+	}
+	return(result);
+}
+
+static void fgl__BeginOpenGLVersion(fglOpenGLState *state, const uint32_t version) {
+	state->loadBlockVersion = version;
+	state->loadBlockMissingCount = 0;
+}
+
+// Returns true when the version was loaded, is supported by the context and all of its functions are resolved
+static bool fgl__EndOpenGLVersion(fglOpenGLState *state) {
+	uint32_t version = state->loadBlockVersion;
+	if(version > state->loadMaxVersion || state->loadBlockMissingCount > 0) {
+		return(false);
+	}
+	// Without a current context the version is unknown, so only the function pointers are checked
+	uint32_t contextVersion = state->loadStats.contextVersion;
+	if(contextVersion > 0 && version > contextVersion) {
+		return(false);
+	}
+	state->loadStats.loadedVersion = version;
+	return(true);
+}
+
+// Returns the version (major * 10 + minor) of the current rendering context or zero when unknown
+static uint32_t fgl__GetCurrentOpenGLVersion(const fglOpenGLState *state) {
+	gl_get_string_func *getString = (gl_get_string_func *)fgl__GetOpenGLProcAddress(state, "glGetString");
+	if(getString == fgl_null) {
+		return(0);
+	}
+	const char *p = (const char *)getString(GL_VERSION);
+	if(p == fgl_null) {
+		return(0);
+	}
+	// Skip prefixes such as "OpenGL ES "
+	while(*p && (*p < '0' || *p > '9')) {
+		++p;
+	}
+	uint32_t major = 0;
+	while(*p >= '0' && *p <= '9') {
+		major = major * 10 + (uint32_t)(*p++ - '0');
+	}
+	uint32_t minor = 0;
+	if(*p == '.') {
+		++p;
+		while(*p >= '0' && *p <= '9') {
+			minor = minor * 10 + (uint32_t)(*p++ - '0');
+		}
+	}
+	// The version is encoded as major * 10 + minor, there are no minor versions above 9
+	if(minor > 9) {
+		minor = 9;
+	}
+	return(major * 10 + minor);
+}
+
+static void fgl__LoadOpenGLExtensions(fglOpenGLState *state) {
 	assert(state != fgl_null);
 #	if GL_VERSION_1_1
-	glAccum = (gl_accum_func *)fgl__GetOpenGLProcAddress(state, "glAccum");
-	glAlphaFunc = (gl_alpha_func_func *)fgl__GetOpenGLProcAddress(state, "glAlphaFunc");
-	glAreTexturesResident = (gl_are_textures_resident_func *)fgl__GetOpenGLProcAddress(state, "glAreTexturesResident");
-	glArrayElement = (gl_array_element_func *)fgl__GetOpenGLProcAddress(state, "glArrayElement");
-	glBegin = (gl_begin_func *)fgl__GetOpenGLProcAddress(state, "glBegin");
-	glBindTexture = (gl_bind_texture_func *)fgl__GetOpenGLProcAddress(state, "glBindTexture");
-	glBitmap = (gl_bitmap_func *)fgl__GetOpenGLProcAddress(state, "glBitmap");
-	glBlendFunc = (gl_blend_func_func *)fgl__GetOpenGLProcAddress(state, "glBlendFunc");
-	glCallList = (gl_call_list_func *)fgl__GetOpenGLProcAddress(state, "glCallList");
-	glCallLists = (gl_call_lists_func *)fgl__GetOpenGLProcAddress(state, "glCallLists");
-	glClear = (gl_clear_func *)fgl__GetOpenGLProcAddress(state, "glClear");
-	glClearAccum = (gl_clear_accum_func *)fgl__GetOpenGLProcAddress(state, "glClearAccum");
-	glClearColor = (gl_clear_color_func *)fgl__GetOpenGLProcAddress(state, "glClearColor");
-	glClearDepth = (gl_clear_depth_func *)fgl__GetOpenGLProcAddress(state, "glClearDepth");
-	glClearIndex = (gl_clear_index_func *)fgl__GetOpenGLProcAddress(state, "glClearIndex");
-	glClearStencil = (gl_clear_stencil_func *)fgl__GetOpenGLProcAddress(state, "glClearStencil");
-	glClipPlane = (gl_clip_plane_func *)fgl__GetOpenGLProcAddress(state, "glClipPlane");
-	glColor3b = (gl_color3b_func *)fgl__GetOpenGLProcAddress(state, "glColor3b");
-	glColor3bv = (gl_color3bv_func *)fgl__GetOpenGLProcAddress(state, "glColor3bv");
-	glColor3d = (gl_color3d_func *)fgl__GetOpenGLProcAddress(state, "glColor3d");
-	glColor3dv = (gl_color3dv_func *)fgl__GetOpenGLProcAddress(state, "glColor3dv");
-	glColor3f = (gl_color3f_func *)fgl__GetOpenGLProcAddress(state, "glColor3f");
-	glColor3fv = (gl_color3fv_func *)fgl__GetOpenGLProcAddress(state, "glColor3fv");
-	glColor3i = (gl_color3i_func *)fgl__GetOpenGLProcAddress(state, "glColor3i");
-	glColor3iv = (gl_color3iv_func *)fgl__GetOpenGLProcAddress(state, "glColor3iv");
-	glColor3s = (gl_color3s_func *)fgl__GetOpenGLProcAddress(state, "glColor3s");
-	glColor3sv = (gl_color3sv_func *)fgl__GetOpenGLProcAddress(state, "glColor3sv");
-	glColor3ub = (gl_color3ub_func *)fgl__GetOpenGLProcAddress(state, "glColor3ub");
-	glColor3ubv = (gl_color3ubv_func *)fgl__GetOpenGLProcAddress(state, "glColor3ubv");
-	glColor3ui = (gl_color3ui_func *)fgl__GetOpenGLProcAddress(state, "glColor3ui");
-	glColor3uiv = (gl_color3uiv_func *)fgl__GetOpenGLProcAddress(state, "glColor3uiv");
-	glColor3us = (gl_color3us_func *)fgl__GetOpenGLProcAddress(state, "glColor3us");
-	glColor3usv = (gl_color3usv_func *)fgl__GetOpenGLProcAddress(state, "glColor3usv");
-	glColor4b = (gl_color4b_func *)fgl__GetOpenGLProcAddress(state, "glColor4b");
-	glColor4bv = (gl_color4bv_func *)fgl__GetOpenGLProcAddress(state, "glColor4bv");
-	glColor4d = (gl_color4d_func *)fgl__GetOpenGLProcAddress(state, "glColor4d");
-	glColor4dv = (gl_color4dv_func *)fgl__GetOpenGLProcAddress(state, "glColor4dv");
-	glColor4f = (gl_color4f_func *)fgl__GetOpenGLProcAddress(state, "glColor4f");
-	glColor4fv = (gl_color4fv_func *)fgl__GetOpenGLProcAddress(state, "glColor4fv");
-	glColor4i = (gl_color4i_func *)fgl__GetOpenGLProcAddress(state, "glColor4i");
-	glColor4iv = (gl_color4iv_func *)fgl__GetOpenGLProcAddress(state, "glColor4iv");
-	glColor4s = (gl_color4s_func *)fgl__GetOpenGLProcAddress(state, "glColor4s");
-	glColor4sv = (gl_color4sv_func *)fgl__GetOpenGLProcAddress(state, "glColor4sv");
-	glColor4ub = (gl_color4ub_func *)fgl__GetOpenGLProcAddress(state, "glColor4ub");
-	glColor4ubv = (gl_color4ubv_func *)fgl__GetOpenGLProcAddress(state, "glColor4ubv");
-	glColor4ui = (gl_color4ui_func *)fgl__GetOpenGLProcAddress(state, "glColor4ui");
-	glColor4uiv = (gl_color4uiv_func *)fgl__GetOpenGLProcAddress(state, "glColor4uiv");
-	glColor4us = (gl_color4us_func *)fgl__GetOpenGLProcAddress(state, "glColor4us");
-	glColor4usv = (gl_color4usv_func *)fgl__GetOpenGLProcAddress(state, "glColor4usv");
-	glColorMask = (gl_color_mask_func *)fgl__GetOpenGLProcAddress(state, "glColorMask");
-	glColorMaterial = (gl_color_material_func *)fgl__GetOpenGLProcAddress(state, "glColorMaterial");
-	glColorPointer = (gl_color_pointer_func *)fgl__GetOpenGLProcAddress(state, "glColorPointer");
-	glCopyPixels = (gl_copy_pixels_func *)fgl__GetOpenGLProcAddress(state, "glCopyPixels");
-	glCopyTexImage1D = (gl_copy_tex_image1d_func *)fgl__GetOpenGLProcAddress(state, "glCopyTexImage1D");
-	glCopyTexImage2D = (gl_copy_tex_image2d_func *)fgl__GetOpenGLProcAddress(state, "glCopyTexImage2D");
-	glCopyTexSubImage1D = (gl_copy_tex_sub_image1d_func *)fgl__GetOpenGLProcAddress(state, "glCopyTexSubImage1D");
-	glCopyTexSubImage2D = (gl_copy_tex_sub_image2d_func *)fgl__GetOpenGLProcAddress(state, "glCopyTexSubImage2D");
-	glCullFace = (gl_cull_face_func *)fgl__GetOpenGLProcAddress(state, "glCullFace");
-	glDeleteLists = (gl_delete_lists_func *)fgl__GetOpenGLProcAddress(state, "glDeleteLists");
-	glDeleteTextures = (gl_delete_textures_func *)fgl__GetOpenGLProcAddress(state, "glDeleteTextures");
-	glDepthFunc = (gl_depth_func_func *)fgl__GetOpenGLProcAddress(state, "glDepthFunc");
-	glDepthMask = (gl_depth_mask_func *)fgl__GetOpenGLProcAddress(state, "glDepthMask");
-	glDepthRange = (gl_depth_range_func *)fgl__GetOpenGLProcAddress(state, "glDepthRange");
-	glDisable = (gl_disable_func *)fgl__GetOpenGLProcAddress(state, "glDisable");
-	glDisableClientState = (gl_disable_client_state_func *)fgl__GetOpenGLProcAddress(state, "glDisableClientState");
-	glDrawArrays = (gl_draw_arrays_func *)fgl__GetOpenGLProcAddress(state, "glDrawArrays");
-	glDrawBuffer = (gl_draw_buffer_func *)fgl__GetOpenGLProcAddress(state, "glDrawBuffer");
-	glDrawElements = (gl_draw_elements_func *)fgl__GetOpenGLProcAddress(state, "glDrawElements");
-	glDrawPixels = (gl_draw_pixels_func *)fgl__GetOpenGLProcAddress(state, "glDrawPixels");
-	glEdgeFlag = (gl_edge_flag_func *)fgl__GetOpenGLProcAddress(state, "glEdgeFlag");
-	glEdgeFlagPointer = (gl_edge_flag_pointer_func *)fgl__GetOpenGLProcAddress(state, "glEdgeFlagPointer");
-	glEdgeFlagv = (gl_edge_flagv_func *)fgl__GetOpenGLProcAddress(state, "glEdgeFlagv");
-	glEnable = (gl_enable_func *)fgl__GetOpenGLProcAddress(state, "glEnable");
-	glEnableClientState = (gl_enable_client_state_func *)fgl__GetOpenGLProcAddress(state, "glEnableClientState");
-	glEnd = (gl_end_func *)fgl__GetOpenGLProcAddress(state, "glEnd");
-	glEndList = (gl_end_list_func *)fgl__GetOpenGLProcAddress(state, "glEndList");
-	glEvalCoord1d = (gl_eval_coord1d_func *)fgl__GetOpenGLProcAddress(state, "glEvalCoord1d");
-	glEvalCoord1dv = (gl_eval_coord1dv_func *)fgl__GetOpenGLProcAddress(state, "glEvalCoord1dv");
-	glEvalCoord1f = (gl_eval_coord1f_func *)fgl__GetOpenGLProcAddress(state, "glEvalCoord1f");
-	glEvalCoord1fv = (gl_eval_coord1fv_func *)fgl__GetOpenGLProcAddress(state, "glEvalCoord1fv");
-	glEvalCoord2d = (gl_eval_coord2d_func *)fgl__GetOpenGLProcAddress(state, "glEvalCoord2d");
-	glEvalCoord2dv = (gl_eval_coord2dv_func *)fgl__GetOpenGLProcAddress(state, "glEvalCoord2dv");
-	glEvalCoord2f = (gl_eval_coord2f_func *)fgl__GetOpenGLProcAddress(state, "glEvalCoord2f");
-	glEvalCoord2fv = (gl_eval_coord2fv_func *)fgl__GetOpenGLProcAddress(state, "glEvalCoord2fv");
-	glEvalMesh1 = (gl_eval_mesh1_func *)fgl__GetOpenGLProcAddress(state, "glEvalMesh1");
-	glEvalMesh2 = (gl_eval_mesh2_func *)fgl__GetOpenGLProcAddress(state, "glEvalMesh2");
-	glEvalPoint1 = (gl_eval_point1_func *)fgl__GetOpenGLProcAddress(state, "glEvalPoint1");
-	glEvalPoint2 = (gl_eval_point2_func *)fgl__GetOpenGLProcAddress(state, "glEvalPoint2");
-	glFeedbackBuffer = (gl_feedback_buffer_func *)fgl__GetOpenGLProcAddress(state, "glFeedbackBuffer");
-	glFinish = (gl_finish_func *)fgl__GetOpenGLProcAddress(state, "glFinish");
-	glFlush = (gl_flush_func *)fgl__GetOpenGLProcAddress(state, "glFlush");
-	glFogf = (gl_fogf_func *)fgl__GetOpenGLProcAddress(state, "glFogf");
-	glFogfv = (gl_fogfv_func *)fgl__GetOpenGLProcAddress(state, "glFogfv");
-	glFogi = (gl_fogi_func *)fgl__GetOpenGLProcAddress(state, "glFogi");
-	glFogiv = (gl_fogiv_func *)fgl__GetOpenGLProcAddress(state, "glFogiv");
-	glFrontFace = (gl_front_face_func *)fgl__GetOpenGLProcAddress(state, "glFrontFace");
-	glFrustum = (gl_frustum_func *)fgl__GetOpenGLProcAddress(state, "glFrustum");
-	glGenLists = (gl_gen_lists_func *)fgl__GetOpenGLProcAddress(state, "glGenLists");
-	glGenTextures = (gl_gen_textures_func *)fgl__GetOpenGLProcAddress(state, "glGenTextures");
-	glGetBooleanv = (gl_get_booleanv_func *)fgl__GetOpenGLProcAddress(state, "glGetBooleanv");
-	glGetClipPlane = (gl_get_clip_plane_func *)fgl__GetOpenGLProcAddress(state, "glGetClipPlane");
-	glGetDoublev = (gl_get_doublev_func *)fgl__GetOpenGLProcAddress(state, "glGetDoublev");
-	glGetError = (gl_get_error_func *)fgl__GetOpenGLProcAddress(state, "glGetError");
-	glGetFloatv = (gl_get_floatv_func *)fgl__GetOpenGLProcAddress(state, "glGetFloatv");
-	glGetIntegerv = (gl_get_integerv_func *)fgl__GetOpenGLProcAddress(state, "glGetIntegerv");
-	glGetLightfv = (gl_get_lightfv_func *)fgl__GetOpenGLProcAddress(state, "glGetLightfv");
-	glGetLightiv = (gl_get_lightiv_func *)fgl__GetOpenGLProcAddress(state, "glGetLightiv");
-	glGetMapdv = (gl_get_mapdv_func *)fgl__GetOpenGLProcAddress(state, "glGetMapdv");
-	glGetMapfv = (gl_get_mapfv_func *)fgl__GetOpenGLProcAddress(state, "glGetMapfv");
-	glGetMapiv = (gl_get_mapiv_func *)fgl__GetOpenGLProcAddress(state, "glGetMapiv");
-	glGetMaterialfv = (gl_get_materialfv_func *)fgl__GetOpenGLProcAddress(state, "glGetMaterialfv");
-	glGetMaterialiv = (gl_get_materialiv_func *)fgl__GetOpenGLProcAddress(state, "glGetMaterialiv");
-	glGetPixelMapfv = (gl_get_pixel_mapfv_func *)fgl__GetOpenGLProcAddress(state, "glGetPixelMapfv");
-	glGetPixelMapuiv = (gl_get_pixel_mapuiv_func *)fgl__GetOpenGLProcAddress(state, "glGetPixelMapuiv");
-	glGetPixelMapusv = (gl_get_pixel_mapusv_func *)fgl__GetOpenGLProcAddress(state, "glGetPixelMapusv");
-	glGetPointerv = (gl_get_pointerv_func *)fgl__GetOpenGLProcAddress(state, "glGetPointerv");
-	glGetPolygonStipple = (gl_get_polygon_stipple_func *)fgl__GetOpenGLProcAddress(state, "glGetPolygonStipple");
-	glGetString = (gl_get_string_func *)fgl__GetOpenGLProcAddress(state, "glGetString");
-	glGetTexEnvfv = (gl_get_tex_envfv_func *)fgl__GetOpenGLProcAddress(state, "glGetTexEnvfv");
-	glGetTexEnviv = (gl_get_tex_enviv_func *)fgl__GetOpenGLProcAddress(state, "glGetTexEnviv");
-	glGetTexGendv = (gl_get_tex_gendv_func *)fgl__GetOpenGLProcAddress(state, "glGetTexGendv");
-	glGetTexGenfv = (gl_get_tex_genfv_func *)fgl__GetOpenGLProcAddress(state, "glGetTexGenfv");
-	glGetTexGeniv = (gl_get_tex_geniv_func *)fgl__GetOpenGLProcAddress(state, "glGetTexGeniv");
-	glGetTexImage = (gl_get_tex_image_func *)fgl__GetOpenGLProcAddress(state, "glGetTexImage");
-	glGetTexLevelParameterfv = (gl_get_tex_level_parameterfv_func *)fgl__GetOpenGLProcAddress(state, "glGetTexLevelParameterfv");
-	glGetTexLevelParameteriv = (gl_get_tex_level_parameteriv_func *)fgl__GetOpenGLProcAddress(state, "glGetTexLevelParameteriv");
-	glGetTexParameterfv = (gl_get_tex_parameterfv_func *)fgl__GetOpenGLProcAddress(state, "glGetTexParameterfv");
-	glGetTexParameteriv = (gl_get_tex_parameteriv_func *)fgl__GetOpenGLProcAddress(state, "glGetTexParameteriv");
-	glHint = (gl_hint_func *)fgl__GetOpenGLProcAddress(state, "glHint");
-	glIndexMask = (gl_index_mask_func *)fgl__GetOpenGLProcAddress(state, "glIndexMask");
-	glIndexPointer = (gl_index_pointer_func *)fgl__GetOpenGLProcAddress(state, "glIndexPointer");
-	glIndexd = (gl_indexd_func *)fgl__GetOpenGLProcAddress(state, "glIndexd");
-	glIndexdv = (gl_indexdv_func *)fgl__GetOpenGLProcAddress(state, "glIndexdv");
-	glIndexf = (gl_indexf_func *)fgl__GetOpenGLProcAddress(state, "glIndexf");
-	glIndexfv = (gl_indexfv_func *)fgl__GetOpenGLProcAddress(state, "glIndexfv");
-	glIndexi = (gl_indexi_func *)fgl__GetOpenGLProcAddress(state, "glIndexi");
-	glIndexiv = (gl_indexiv_func *)fgl__GetOpenGLProcAddress(state, "glIndexiv");
-	glIndexs = (gl_indexs_func *)fgl__GetOpenGLProcAddress(state, "glIndexs");
-	glIndexsv = (gl_indexsv_func *)fgl__GetOpenGLProcAddress(state, "glIndexsv");
-	glIndexub = (gl_indexub_func *)fgl__GetOpenGLProcAddress(state, "glIndexub");
-	glIndexubv = (gl_indexubv_func *)fgl__GetOpenGLProcAddress(state, "glIndexubv");
-	glInitNames = (gl_init_names_func *)fgl__GetOpenGLProcAddress(state, "glInitNames");
-	glInterleavedArrays = (gl_interleaved_arrays_func *)fgl__GetOpenGLProcAddress(state, "glInterleavedArrays");
-	glIsEnabled = (gl_is_enabled_func *)fgl__GetOpenGLProcAddress(state, "glIsEnabled");
-	glIsList = (gl_is_list_func *)fgl__GetOpenGLProcAddress(state, "glIsList");
-	glIsTexture = (gl_is_texture_func *)fgl__GetOpenGLProcAddress(state, "glIsTexture");
-	glLightModelf = (gl_light_modelf_func *)fgl__GetOpenGLProcAddress(state, "glLightModelf");
-	glLightModelfv = (gl_light_modelfv_func *)fgl__GetOpenGLProcAddress(state, "glLightModelfv");
-	glLightModeli = (gl_light_modeli_func *)fgl__GetOpenGLProcAddress(state, "glLightModeli");
-	glLightModeliv = (gl_light_modeliv_func *)fgl__GetOpenGLProcAddress(state, "glLightModeliv");
-	glLightf = (gl_lightf_func *)fgl__GetOpenGLProcAddress(state, "glLightf");
-	glLightfv = (gl_lightfv_func *)fgl__GetOpenGLProcAddress(state, "glLightfv");
-	glLighti = (gl_lighti_func *)fgl__GetOpenGLProcAddress(state, "glLighti");
-	glLightiv = (gl_lightiv_func *)fgl__GetOpenGLProcAddress(state, "glLightiv");
-	glLineStipple = (gl_line_stipple_func *)fgl__GetOpenGLProcAddress(state, "glLineStipple");
-	glLineWidth = (gl_line_width_func *)fgl__GetOpenGLProcAddress(state, "glLineWidth");
-	glListBase = (gl_list_base_func *)fgl__GetOpenGLProcAddress(state, "glListBase");
-	glLoadIdentity = (gl_load_identity_func *)fgl__GetOpenGLProcAddress(state, "glLoadIdentity");
-	glLoadMatrixd = (gl_load_matrixd_func *)fgl__GetOpenGLProcAddress(state, "glLoadMatrixd");
-	glLoadMatrixf = (gl_load_matrixf_func *)fgl__GetOpenGLProcAddress(state, "glLoadMatrixf");
-	glLoadName = (gl_load_name_func *)fgl__GetOpenGLProcAddress(state, "glLoadName");
-	glLogicOp = (gl_logic_op_func *)fgl__GetOpenGLProcAddress(state, "glLogicOp");
-	glMap1d = (gl_map1d_func *)fgl__GetOpenGLProcAddress(state, "glMap1d");
-	glMap1f = (gl_map1f_func *)fgl__GetOpenGLProcAddress(state, "glMap1f");
-	glMap2d = (gl_map2d_func *)fgl__GetOpenGLProcAddress(state, "glMap2d");
-	glMap2f = (gl_map2f_func *)fgl__GetOpenGLProcAddress(state, "glMap2f");
-	glMapGrid1d = (gl_map_grid1d_func *)fgl__GetOpenGLProcAddress(state, "glMapGrid1d");
-	glMapGrid1f = (gl_map_grid1f_func *)fgl__GetOpenGLProcAddress(state, "glMapGrid1f");
-	glMapGrid2d = (gl_map_grid2d_func *)fgl__GetOpenGLProcAddress(state, "glMapGrid2d");
-	glMapGrid2f = (gl_map_grid2f_func *)fgl__GetOpenGLProcAddress(state, "glMapGrid2f");
-	glMaterialf = (gl_materialf_func *)fgl__GetOpenGLProcAddress(state, "glMaterialf");
-	glMaterialfv = (gl_materialfv_func *)fgl__GetOpenGLProcAddress(state, "glMaterialfv");
-	glMateriali = (gl_materiali_func *)fgl__GetOpenGLProcAddress(state, "glMateriali");
-	glMaterialiv = (gl_materialiv_func *)fgl__GetOpenGLProcAddress(state, "glMaterialiv");
-	glMatrixMode = (gl_matrix_mode_func *)fgl__GetOpenGLProcAddress(state, "glMatrixMode");
-	glMultMatrixd = (gl_mult_matrixd_func *)fgl__GetOpenGLProcAddress(state, "glMultMatrixd");
-	glMultMatrixf = (gl_mult_matrixf_func *)fgl__GetOpenGLProcAddress(state, "glMultMatrixf");
-	glNewList = (gl_new_list_func *)fgl__GetOpenGLProcAddress(state, "glNewList");
-	glNormal3b = (gl_normal3b_func *)fgl__GetOpenGLProcAddress(state, "glNormal3b");
-	glNormal3bv = (gl_normal3bv_func *)fgl__GetOpenGLProcAddress(state, "glNormal3bv");
-	glNormal3d = (gl_normal3d_func *)fgl__GetOpenGLProcAddress(state, "glNormal3d");
-	glNormal3dv = (gl_normal3dv_func *)fgl__GetOpenGLProcAddress(state, "glNormal3dv");
-	glNormal3f = (gl_normal3f_func *)fgl__GetOpenGLProcAddress(state, "glNormal3f");
-	glNormal3fv = (gl_normal3fv_func *)fgl__GetOpenGLProcAddress(state, "glNormal3fv");
-	glNormal3i = (gl_normal3i_func *)fgl__GetOpenGLProcAddress(state, "glNormal3i");
-	glNormal3iv = (gl_normal3iv_func *)fgl__GetOpenGLProcAddress(state, "glNormal3iv");
-	glNormal3s = (gl_normal3s_func *)fgl__GetOpenGLProcAddress(state, "glNormal3s");
-	glNormal3sv = (gl_normal3sv_func *)fgl__GetOpenGLProcAddress(state, "glNormal3sv");
-	glNormalPointer = (gl_normal_pointer_func *)fgl__GetOpenGLProcAddress(state, "glNormalPointer");
-	glOrtho = (gl_ortho_func *)fgl__GetOpenGLProcAddress(state, "glOrtho");
-	glPassThrough = (gl_pass_through_func *)fgl__GetOpenGLProcAddress(state, "glPassThrough");
-	glPixelMapfv = (gl_pixel_mapfv_func *)fgl__GetOpenGLProcAddress(state, "glPixelMapfv");
-	glPixelMapuiv = (gl_pixel_mapuiv_func *)fgl__GetOpenGLProcAddress(state, "glPixelMapuiv");
-	glPixelMapusv = (gl_pixel_mapusv_func *)fgl__GetOpenGLProcAddress(state, "glPixelMapusv");
-	glPixelStoref = (gl_pixel_storef_func *)fgl__GetOpenGLProcAddress(state, "glPixelStoref");
-	glPixelStorei = (gl_pixel_storei_func *)fgl__GetOpenGLProcAddress(state, "glPixelStorei");
-	glPixelTransferf = (gl_pixel_transferf_func *)fgl__GetOpenGLProcAddress(state, "glPixelTransferf");
-	glPixelTransferi = (gl_pixel_transferi_func *)fgl__GetOpenGLProcAddress(state, "glPixelTransferi");
-	glPixelZoom = (gl_pixel_zoom_func *)fgl__GetOpenGLProcAddress(state, "glPixelZoom");
-	glPointSize = (gl_point_size_func *)fgl__GetOpenGLProcAddress(state, "glPointSize");
-	glPolygonMode = (gl_polygon_mode_func *)fgl__GetOpenGLProcAddress(state, "glPolygonMode");
-	glPolygonOffset = (gl_polygon_offset_func *)fgl__GetOpenGLProcAddress(state, "glPolygonOffset");
-	glPolygonStipple = (gl_polygon_stipple_func *)fgl__GetOpenGLProcAddress(state, "glPolygonStipple");
-	glPopAttrib = (gl_pop_attrib_func *)fgl__GetOpenGLProcAddress(state, "glPopAttrib");
-	glPopClientAttrib = (gl_pop_client_attrib_func *)fgl__GetOpenGLProcAddress(state, "glPopClientAttrib");
-	glPopMatrix = (gl_pop_matrix_func *)fgl__GetOpenGLProcAddress(state, "glPopMatrix");
-	glPopName = (gl_pop_name_func *)fgl__GetOpenGLProcAddress(state, "glPopName");
-	glPrioritizeTextures = (gl_prioritize_textures_func *)fgl__GetOpenGLProcAddress(state, "glPrioritizeTextures");
-	glPushAttrib = (gl_push_attrib_func *)fgl__GetOpenGLProcAddress(state, "glPushAttrib");
-	glPushClientAttrib = (gl_push_client_attrib_func *)fgl__GetOpenGLProcAddress(state, "glPushClientAttrib");
-	glPushMatrix = (gl_push_matrix_func *)fgl__GetOpenGLProcAddress(state, "glPushMatrix");
-	glPushName = (gl_push_name_func *)fgl__GetOpenGLProcAddress(state, "glPushName");
-	glRasterPos2d = (gl_raster_pos2d_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos2d");
-	glRasterPos2dv = (gl_raster_pos2dv_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos2dv");
-	glRasterPos2f = (gl_raster_pos2f_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos2f");
-	glRasterPos2fv = (gl_raster_pos2fv_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos2fv");
-	glRasterPos2i = (gl_raster_pos2i_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos2i");
-	glRasterPos2iv = (gl_raster_pos2iv_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos2iv");
-	glRasterPos2s = (gl_raster_pos2s_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos2s");
-	glRasterPos2sv = (gl_raster_pos2sv_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos2sv");
-	glRasterPos3d = (gl_raster_pos3d_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos3d");
-	glRasterPos3dv = (gl_raster_pos3dv_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos3dv");
-	glRasterPos3f = (gl_raster_pos3f_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos3f");
-	glRasterPos3fv = (gl_raster_pos3fv_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos3fv");
-	glRasterPos3i = (gl_raster_pos3i_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos3i");
-	glRasterPos3iv = (gl_raster_pos3iv_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos3iv");
-	glRasterPos3s = (gl_raster_pos3s_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos3s");
-	glRasterPos3sv = (gl_raster_pos3sv_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos3sv");
-	glRasterPos4d = (gl_raster_pos4d_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos4d");
-	glRasterPos4dv = (gl_raster_pos4dv_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos4dv");
-	glRasterPos4f = (gl_raster_pos4f_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos4f");
-	glRasterPos4fv = (gl_raster_pos4fv_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos4fv");
-	glRasterPos4i = (gl_raster_pos4i_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos4i");
-	glRasterPos4iv = (gl_raster_pos4iv_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos4iv");
-	glRasterPos4s = (gl_raster_pos4s_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos4s");
-	glRasterPos4sv = (gl_raster_pos4sv_func *)fgl__GetOpenGLProcAddress(state, "glRasterPos4sv");
-	glReadBuffer = (gl_read_buffer_func *)fgl__GetOpenGLProcAddress(state, "glReadBuffer");
-	glReadPixels = (gl_read_pixels_func *)fgl__GetOpenGLProcAddress(state, "glReadPixels");
-	glRectd = (gl_rectd_func *)fgl__GetOpenGLProcAddress(state, "glRectd");
-	glRectdv = (gl_rectdv_func *)fgl__GetOpenGLProcAddress(state, "glRectdv");
-	glRectf = (gl_rectf_func *)fgl__GetOpenGLProcAddress(state, "glRectf");
-	glRectfv = (gl_rectfv_func *)fgl__GetOpenGLProcAddress(state, "glRectfv");
-	glRecti = (gl_recti_func *)fgl__GetOpenGLProcAddress(state, "glRecti");
-	glRectiv = (gl_rectiv_func *)fgl__GetOpenGLProcAddress(state, "glRectiv");
-	glRects = (gl_rects_func *)fgl__GetOpenGLProcAddress(state, "glRects");
-	glRectsv = (gl_rectsv_func *)fgl__GetOpenGLProcAddress(state, "glRectsv");
-	glRenderMode = (gl_render_mode_func *)fgl__GetOpenGLProcAddress(state, "glRenderMode");
-	glRotated = (gl_rotated_func *)fgl__GetOpenGLProcAddress(state, "glRotated");
-	glRotatef = (gl_rotatef_func *)fgl__GetOpenGLProcAddress(state, "glRotatef");
-	glScaled = (gl_scaled_func *)fgl__GetOpenGLProcAddress(state, "glScaled");
-	glScalef = (gl_scalef_func *)fgl__GetOpenGLProcAddress(state, "glScalef");
-	glScissor = (gl_scissor_func *)fgl__GetOpenGLProcAddress(state, "glScissor");
-	glSelectBuffer = (gl_select_buffer_func *)fgl__GetOpenGLProcAddress(state, "glSelectBuffer");
-	glShadeModel = (gl_shade_model_func *)fgl__GetOpenGLProcAddress(state, "glShadeModel");
-	glStencilFunc = (gl_stencil_func_func *)fgl__GetOpenGLProcAddress(state, "glStencilFunc");
-	glStencilMask = (gl_stencil_mask_func *)fgl__GetOpenGLProcAddress(state, "glStencilMask");
-	glStencilOp = (gl_stencil_op_func *)fgl__GetOpenGLProcAddress(state, "glStencilOp");
-	glTexCoord1d = (gl_tex_coord1d_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord1d");
-	glTexCoord1dv = (gl_tex_coord1dv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord1dv");
-	glTexCoord1f = (gl_tex_coord1f_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord1f");
-	glTexCoord1fv = (gl_tex_coord1fv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord1fv");
-	glTexCoord1i = (gl_tex_coord1i_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord1i");
-	glTexCoord1iv = (gl_tex_coord1iv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord1iv");
-	glTexCoord1s = (gl_tex_coord1s_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord1s");
-	glTexCoord1sv = (gl_tex_coord1sv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord1sv");
-	glTexCoord2d = (gl_tex_coord2d_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord2d");
-	glTexCoord2dv = (gl_tex_coord2dv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord2dv");
-	glTexCoord2f = (gl_tex_coord2f_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord2f");
-	glTexCoord2fv = (gl_tex_coord2fv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord2fv");
-	glTexCoord2i = (gl_tex_coord2i_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord2i");
-	glTexCoord2iv = (gl_tex_coord2iv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord2iv");
-	glTexCoord2s = (gl_tex_coord2s_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord2s");
-	glTexCoord2sv = (gl_tex_coord2sv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord2sv");
-	glTexCoord3d = (gl_tex_coord3d_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord3d");
-	glTexCoord3dv = (gl_tex_coord3dv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord3dv");
-	glTexCoord3f = (gl_tex_coord3f_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord3f");
-	glTexCoord3fv = (gl_tex_coord3fv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord3fv");
-	glTexCoord3i = (gl_tex_coord3i_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord3i");
-	glTexCoord3iv = (gl_tex_coord3iv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord3iv");
-	glTexCoord3s = (gl_tex_coord3s_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord3s");
-	glTexCoord3sv = (gl_tex_coord3sv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord3sv");
-	glTexCoord4d = (gl_tex_coord4d_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord4d");
-	glTexCoord4dv = (gl_tex_coord4dv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord4dv");
-	glTexCoord4f = (gl_tex_coord4f_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord4f");
-	glTexCoord4fv = (gl_tex_coord4fv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord4fv");
-	glTexCoord4i = (gl_tex_coord4i_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord4i");
-	glTexCoord4iv = (gl_tex_coord4iv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord4iv");
-	glTexCoord4s = (gl_tex_coord4s_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord4s");
-	glTexCoord4sv = (gl_tex_coord4sv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoord4sv");
-	glTexCoordPointer = (gl_tex_coord_pointer_func *)fgl__GetOpenGLProcAddress(state, "glTexCoordPointer");
-	glTexEnvf = (gl_tex_envf_func *)fgl__GetOpenGLProcAddress(state, "glTexEnvf");
-	glTexEnvfv = (gl_tex_envfv_func *)fgl__GetOpenGLProcAddress(state, "glTexEnvfv");
-	glTexEnvi = (gl_tex_envi_func *)fgl__GetOpenGLProcAddress(state, "glTexEnvi");
-	glTexEnviv = (gl_tex_enviv_func *)fgl__GetOpenGLProcAddress(state, "glTexEnviv");
-	glTexGend = (gl_tex_gend_func *)fgl__GetOpenGLProcAddress(state, "glTexGend");
-	glTexGendv = (gl_tex_gendv_func *)fgl__GetOpenGLProcAddress(state, "glTexGendv");
-	glTexGenf = (gl_tex_genf_func *)fgl__GetOpenGLProcAddress(state, "glTexGenf");
-	glTexGenfv = (gl_tex_genfv_func *)fgl__GetOpenGLProcAddress(state, "glTexGenfv");
-	glTexGeni = (gl_tex_geni_func *)fgl__GetOpenGLProcAddress(state, "glTexGeni");
-	glTexGeniv = (gl_tex_geniv_func *)fgl__GetOpenGLProcAddress(state, "glTexGeniv");
-	glTexImage1D = (gl_tex_image1d_func *)fgl__GetOpenGLProcAddress(state, "glTexImage1D");
-	glTexImage2D = (gl_tex_image2d_func *)fgl__GetOpenGLProcAddress(state, "glTexImage2D");
-	glTexParameterf = (gl_tex_parameterf_func *)fgl__GetOpenGLProcAddress(state, "glTexParameterf");
-	glTexParameterfv = (gl_tex_parameterfv_func *)fgl__GetOpenGLProcAddress(state, "glTexParameterfv");
-	glTexParameteri = (gl_tex_parameteri_func *)fgl__GetOpenGLProcAddress(state, "glTexParameteri");
-	glTexParameteriv = (gl_tex_parameteriv_func *)fgl__GetOpenGLProcAddress(state, "glTexParameteriv");
-	glTexSubImage1D = (gl_tex_sub_image1d_func *)fgl__GetOpenGLProcAddress(state, "glTexSubImage1D");
-	glTexSubImage2D = (gl_tex_sub_image2d_func *)fgl__GetOpenGLProcAddress(state, "glTexSubImage2D");
-	glTranslated = (gl_translated_func *)fgl__GetOpenGLProcAddress(state, "glTranslated");
-	glTranslatef = (gl_translatef_func *)fgl__GetOpenGLProcAddress(state, "glTranslatef");
-	glVertex2d = (gl_vertex2d_func *)fgl__GetOpenGLProcAddress(state, "glVertex2d");
-	glVertex2dv = (gl_vertex2dv_func *)fgl__GetOpenGLProcAddress(state, "glVertex2dv");
-	glVertex2f = (gl_vertex2f_func *)fgl__GetOpenGLProcAddress(state, "glVertex2f");
-	glVertex2fv = (gl_vertex2fv_func *)fgl__GetOpenGLProcAddress(state, "glVertex2fv");
-	glVertex2i = (gl_vertex2i_func *)fgl__GetOpenGLProcAddress(state, "glVertex2i");
-	glVertex2iv = (gl_vertex2iv_func *)fgl__GetOpenGLProcAddress(state, "glVertex2iv");
-	glVertex2s = (gl_vertex2s_func *)fgl__GetOpenGLProcAddress(state, "glVertex2s");
-	glVertex2sv = (gl_vertex2sv_func *)fgl__GetOpenGLProcAddress(state, "glVertex2sv");
-	glVertex3d = (gl_vertex3d_func *)fgl__GetOpenGLProcAddress(state, "glVertex3d");
-	glVertex3dv = (gl_vertex3dv_func *)fgl__GetOpenGLProcAddress(state, "glVertex3dv");
-	glVertex3f = (gl_vertex3f_func *)fgl__GetOpenGLProcAddress(state, "glVertex3f");
-	glVertex3fv = (gl_vertex3fv_func *)fgl__GetOpenGLProcAddress(state, "glVertex3fv");
-	glVertex3i = (gl_vertex3i_func *)fgl__GetOpenGLProcAddress(state, "glVertex3i");
-	glVertex3iv = (gl_vertex3iv_func *)fgl__GetOpenGLProcAddress(state, "glVertex3iv");
-	glVertex3s = (gl_vertex3s_func *)fgl__GetOpenGLProcAddress(state, "glVertex3s");
-	glVertex3sv = (gl_vertex3sv_func *)fgl__GetOpenGLProcAddress(state, "glVertex3sv");
-	glVertex4d = (gl_vertex4d_func *)fgl__GetOpenGLProcAddress(state, "glVertex4d");
-	glVertex4dv = (gl_vertex4dv_func *)fgl__GetOpenGLProcAddress(state, "glVertex4dv");
-	glVertex4f = (gl_vertex4f_func *)fgl__GetOpenGLProcAddress(state, "glVertex4f");
-	glVertex4fv = (gl_vertex4fv_func *)fgl__GetOpenGLProcAddress(state, "glVertex4fv");
-	glVertex4i = (gl_vertex4i_func *)fgl__GetOpenGLProcAddress(state, "glVertex4i");
-	glVertex4iv = (gl_vertex4iv_func *)fgl__GetOpenGLProcAddress(state, "glVertex4iv");
-	glVertex4s = (gl_vertex4s_func *)fgl__GetOpenGLProcAddress(state, "glVertex4s");
-	glVertex4sv = (gl_vertex4sv_func *)fgl__GetOpenGLProcAddress(state, "glVertex4sv");
-	glVertexPointer = (gl_vertex_pointer_func *)fgl__GetOpenGLProcAddress(state, "glVertexPointer");
-	glViewport = (gl_viewport_func *)fgl__GetOpenGLProcAddress(state, "glViewport");
+	fgl__BeginOpenGLVersion(state, 11);
+	glAccum = (gl_accum_func *)fgl__ResolveOpenGLProc(state, "glAccum");
+	glAlphaFunc = (gl_alpha_func_func *)fgl__ResolveOpenGLProc(state, "glAlphaFunc");
+	glAreTexturesResident = (gl_are_textures_resident_func *)fgl__ResolveOpenGLProc(state, "glAreTexturesResident");
+	glArrayElement = (gl_array_element_func *)fgl__ResolveOpenGLProc(state, "glArrayElement");
+	glBegin = (gl_begin_func *)fgl__ResolveOpenGLProc(state, "glBegin");
+	glBindTexture = (gl_bind_texture_func *)fgl__ResolveOpenGLProc(state, "glBindTexture");
+	glBitmap = (gl_bitmap_func *)fgl__ResolveOpenGLProc(state, "glBitmap");
+	glBlendFunc = (gl_blend_func_func *)fgl__ResolveOpenGLProc(state, "glBlendFunc");
+	glCallList = (gl_call_list_func *)fgl__ResolveOpenGLProc(state, "glCallList");
+	glCallLists = (gl_call_lists_func *)fgl__ResolveOpenGLProc(state, "glCallLists");
+	glClear = (gl_clear_func *)fgl__ResolveOpenGLProc(state, "glClear");
+	glClearAccum = (gl_clear_accum_func *)fgl__ResolveOpenGLProc(state, "glClearAccum");
+	glClearColor = (gl_clear_color_func *)fgl__ResolveOpenGLProc(state, "glClearColor");
+	glClearDepth = (gl_clear_depth_func *)fgl__ResolveOpenGLProc(state, "glClearDepth");
+	glClearIndex = (gl_clear_index_func *)fgl__ResolveOpenGLProc(state, "glClearIndex");
+	glClearStencil = (gl_clear_stencil_func *)fgl__ResolveOpenGLProc(state, "glClearStencil");
+	glClipPlane = (gl_clip_plane_func *)fgl__ResolveOpenGLProc(state, "glClipPlane");
+	glColor3b = (gl_color3b_func *)fgl__ResolveOpenGLProc(state, "glColor3b");
+	glColor3bv = (gl_color3bv_func *)fgl__ResolveOpenGLProc(state, "glColor3bv");
+	glColor3d = (gl_color3d_func *)fgl__ResolveOpenGLProc(state, "glColor3d");
+	glColor3dv = (gl_color3dv_func *)fgl__ResolveOpenGLProc(state, "glColor3dv");
+	glColor3f = (gl_color3f_func *)fgl__ResolveOpenGLProc(state, "glColor3f");
+	glColor3fv = (gl_color3fv_func *)fgl__ResolveOpenGLProc(state, "glColor3fv");
+	glColor3i = (gl_color3i_func *)fgl__ResolveOpenGLProc(state, "glColor3i");
+	glColor3iv = (gl_color3iv_func *)fgl__ResolveOpenGLProc(state, "glColor3iv");
+	glColor3s = (gl_color3s_func *)fgl__ResolveOpenGLProc(state, "glColor3s");
+	glColor3sv = (gl_color3sv_func *)fgl__ResolveOpenGLProc(state, "glColor3sv");
+	glColor3ub = (gl_color3ub_func *)fgl__ResolveOpenGLProc(state, "glColor3ub");
+	glColor3ubv = (gl_color3ubv_func *)fgl__ResolveOpenGLProc(state, "glColor3ubv");
+	glColor3ui = (gl_color3ui_func *)fgl__ResolveOpenGLProc(state, "glColor3ui");
+	glColor3uiv = (gl_color3uiv_func *)fgl__ResolveOpenGLProc(state, "glColor3uiv");
+	glColor3us = (gl_color3us_func *)fgl__ResolveOpenGLProc(state, "glColor3us");
+	glColor3usv = (gl_color3usv_func *)fgl__ResolveOpenGLProc(state, "glColor3usv");
+	glColor4b = (gl_color4b_func *)fgl__ResolveOpenGLProc(state, "glColor4b");
+	glColor4bv = (gl_color4bv_func *)fgl__ResolveOpenGLProc(state, "glColor4bv");
+	glColor4d = (gl_color4d_func *)fgl__ResolveOpenGLProc(state, "glColor4d");
+	glColor4dv = (gl_color4dv_func *)fgl__ResolveOpenGLProc(state, "glColor4dv");
+	glColor4f = (gl_color4f_func *)fgl__ResolveOpenGLProc(state, "glColor4f");
+	glColor4fv = (gl_color4fv_func *)fgl__ResolveOpenGLProc(state, "glColor4fv");
+	glColor4i = (gl_color4i_func *)fgl__ResolveOpenGLProc(state, "glColor4i");
+	glColor4iv = (gl_color4iv_func *)fgl__ResolveOpenGLProc(state, "glColor4iv");
+	glColor4s = (gl_color4s_func *)fgl__ResolveOpenGLProc(state, "glColor4s");
+	glColor4sv = (gl_color4sv_func *)fgl__ResolveOpenGLProc(state, "glColor4sv");
+	glColor4ub = (gl_color4ub_func *)fgl__ResolveOpenGLProc(state, "glColor4ub");
+	glColor4ubv = (gl_color4ubv_func *)fgl__ResolveOpenGLProc(state, "glColor4ubv");
+	glColor4ui = (gl_color4ui_func *)fgl__ResolveOpenGLProc(state, "glColor4ui");
+	glColor4uiv = (gl_color4uiv_func *)fgl__ResolveOpenGLProc(state, "glColor4uiv");
+	glColor4us = (gl_color4us_func *)fgl__ResolveOpenGLProc(state, "glColor4us");
+	glColor4usv = (gl_color4usv_func *)fgl__ResolveOpenGLProc(state, "glColor4usv");
+	glColorMask = (gl_color_mask_func *)fgl__ResolveOpenGLProc(state, "glColorMask");
+	glColorMaterial = (gl_color_material_func *)fgl__ResolveOpenGLProc(state, "glColorMaterial");
+	glColorPointer = (gl_color_pointer_func *)fgl__ResolveOpenGLProc(state, "glColorPointer");
+	glCopyPixels = (gl_copy_pixels_func *)fgl__ResolveOpenGLProc(state, "glCopyPixels");
+	glCopyTexImage1D = (gl_copy_tex_image1d_func *)fgl__ResolveOpenGLProc(state, "glCopyTexImage1D");
+	glCopyTexImage2D = (gl_copy_tex_image2d_func *)fgl__ResolveOpenGLProc(state, "glCopyTexImage2D");
+	glCopyTexSubImage1D = (gl_copy_tex_sub_image1d_func *)fgl__ResolveOpenGLProc(state, "glCopyTexSubImage1D");
+	glCopyTexSubImage2D = (gl_copy_tex_sub_image2d_func *)fgl__ResolveOpenGLProc(state, "glCopyTexSubImage2D");
+	glCullFace = (gl_cull_face_func *)fgl__ResolveOpenGLProc(state, "glCullFace");
+	glDeleteLists = (gl_delete_lists_func *)fgl__ResolveOpenGLProc(state, "glDeleteLists");
+	glDeleteTextures = (gl_delete_textures_func *)fgl__ResolveOpenGLProc(state, "glDeleteTextures");
+	glDepthFunc = (gl_depth_func_func *)fgl__ResolveOpenGLProc(state, "glDepthFunc");
+	glDepthMask = (gl_depth_mask_func *)fgl__ResolveOpenGLProc(state, "glDepthMask");
+	glDepthRange = (gl_depth_range_func *)fgl__ResolveOpenGLProc(state, "glDepthRange");
+	glDisable = (gl_disable_func *)fgl__ResolveOpenGLProc(state, "glDisable");
+	glDisableClientState = (gl_disable_client_state_func *)fgl__ResolveOpenGLProc(state, "glDisableClientState");
+	glDrawArrays = (gl_draw_arrays_func *)fgl__ResolveOpenGLProc(state, "glDrawArrays");
+	glDrawBuffer = (gl_draw_buffer_func *)fgl__ResolveOpenGLProc(state, "glDrawBuffer");
+	glDrawElements = (gl_draw_elements_func *)fgl__ResolveOpenGLProc(state, "glDrawElements");
+	glDrawPixels = (gl_draw_pixels_func *)fgl__ResolveOpenGLProc(state, "glDrawPixels");
+	glEdgeFlag = (gl_edge_flag_func *)fgl__ResolveOpenGLProc(state, "glEdgeFlag");
+	glEdgeFlagPointer = (gl_edge_flag_pointer_func *)fgl__ResolveOpenGLProc(state, "glEdgeFlagPointer");
+	glEdgeFlagv = (gl_edge_flagv_func *)fgl__ResolveOpenGLProc(state, "glEdgeFlagv");
+	glEnable = (gl_enable_func *)fgl__ResolveOpenGLProc(state, "glEnable");
+	glEnableClientState = (gl_enable_client_state_func *)fgl__ResolveOpenGLProc(state, "glEnableClientState");
+	glEnd = (gl_end_func *)fgl__ResolveOpenGLProc(state, "glEnd");
+	glEndList = (gl_end_list_func *)fgl__ResolveOpenGLProc(state, "glEndList");
+	glEvalCoord1d = (gl_eval_coord1d_func *)fgl__ResolveOpenGLProc(state, "glEvalCoord1d");
+	glEvalCoord1dv = (gl_eval_coord1dv_func *)fgl__ResolveOpenGLProc(state, "glEvalCoord1dv");
+	glEvalCoord1f = (gl_eval_coord1f_func *)fgl__ResolveOpenGLProc(state, "glEvalCoord1f");
+	glEvalCoord1fv = (gl_eval_coord1fv_func *)fgl__ResolveOpenGLProc(state, "glEvalCoord1fv");
+	glEvalCoord2d = (gl_eval_coord2d_func *)fgl__ResolveOpenGLProc(state, "glEvalCoord2d");
+	glEvalCoord2dv = (gl_eval_coord2dv_func *)fgl__ResolveOpenGLProc(state, "glEvalCoord2dv");
+	glEvalCoord2f = (gl_eval_coord2f_func *)fgl__ResolveOpenGLProc(state, "glEvalCoord2f");
+	glEvalCoord2fv = (gl_eval_coord2fv_func *)fgl__ResolveOpenGLProc(state, "glEvalCoord2fv");
+	glEvalMesh1 = (gl_eval_mesh1_func *)fgl__ResolveOpenGLProc(state, "glEvalMesh1");
+	glEvalMesh2 = (gl_eval_mesh2_func *)fgl__ResolveOpenGLProc(state, "glEvalMesh2");
+	glEvalPoint1 = (gl_eval_point1_func *)fgl__ResolveOpenGLProc(state, "glEvalPoint1");
+	glEvalPoint2 = (gl_eval_point2_func *)fgl__ResolveOpenGLProc(state, "glEvalPoint2");
+	glFeedbackBuffer = (gl_feedback_buffer_func *)fgl__ResolveOpenGLProc(state, "glFeedbackBuffer");
+	glFinish = (gl_finish_func *)fgl__ResolveOpenGLProc(state, "glFinish");
+	glFlush = (gl_flush_func *)fgl__ResolveOpenGLProc(state, "glFlush");
+	glFogf = (gl_fogf_func *)fgl__ResolveOpenGLProc(state, "glFogf");
+	glFogfv = (gl_fogfv_func *)fgl__ResolveOpenGLProc(state, "glFogfv");
+	glFogi = (gl_fogi_func *)fgl__ResolveOpenGLProc(state, "glFogi");
+	glFogiv = (gl_fogiv_func *)fgl__ResolveOpenGLProc(state, "glFogiv");
+	glFrontFace = (gl_front_face_func *)fgl__ResolveOpenGLProc(state, "glFrontFace");
+	glFrustum = (gl_frustum_func *)fgl__ResolveOpenGLProc(state, "glFrustum");
+	glGenLists = (gl_gen_lists_func *)fgl__ResolveOpenGLProc(state, "glGenLists");
+	glGenTextures = (gl_gen_textures_func *)fgl__ResolveOpenGLProc(state, "glGenTextures");
+	glGetBooleanv = (gl_get_booleanv_func *)fgl__ResolveOpenGLProc(state, "glGetBooleanv");
+	glGetClipPlane = (gl_get_clip_plane_func *)fgl__ResolveOpenGLProc(state, "glGetClipPlane");
+	glGetDoublev = (gl_get_doublev_func *)fgl__ResolveOpenGLProc(state, "glGetDoublev");
+	glGetError = (gl_get_error_func *)fgl__ResolveOpenGLProc(state, "glGetError");
+	glGetFloatv = (gl_get_floatv_func *)fgl__ResolveOpenGLProc(state, "glGetFloatv");
+	glGetIntegerv = (gl_get_integerv_func *)fgl__ResolveOpenGLProc(state, "glGetIntegerv");
+	glGetLightfv = (gl_get_lightfv_func *)fgl__ResolveOpenGLProc(state, "glGetLightfv");
+	glGetLightiv = (gl_get_lightiv_func *)fgl__ResolveOpenGLProc(state, "glGetLightiv");
+	glGetMapdv = (gl_get_mapdv_func *)fgl__ResolveOpenGLProc(state, "glGetMapdv");
+	glGetMapfv = (gl_get_mapfv_func *)fgl__ResolveOpenGLProc(state, "glGetMapfv");
+	glGetMapiv = (gl_get_mapiv_func *)fgl__ResolveOpenGLProc(state, "glGetMapiv");
+	glGetMaterialfv = (gl_get_materialfv_func *)fgl__ResolveOpenGLProc(state, "glGetMaterialfv");
+	glGetMaterialiv = (gl_get_materialiv_func *)fgl__ResolveOpenGLProc(state, "glGetMaterialiv");
+	glGetPixelMapfv = (gl_get_pixel_mapfv_func *)fgl__ResolveOpenGLProc(state, "glGetPixelMapfv");
+	glGetPixelMapuiv = (gl_get_pixel_mapuiv_func *)fgl__ResolveOpenGLProc(state, "glGetPixelMapuiv");
+	glGetPixelMapusv = (gl_get_pixel_mapusv_func *)fgl__ResolveOpenGLProc(state, "glGetPixelMapusv");
+	glGetPointerv = (gl_get_pointerv_func *)fgl__ResolveOpenGLProc(state, "glGetPointerv");
+	glGetPolygonStipple = (gl_get_polygon_stipple_func *)fgl__ResolveOpenGLProc(state, "glGetPolygonStipple");
+	glGetString = (gl_get_string_func *)fgl__ResolveOpenGLProc(state, "glGetString");
+	glGetTexEnvfv = (gl_get_tex_envfv_func *)fgl__ResolveOpenGLProc(state, "glGetTexEnvfv");
+	glGetTexEnviv = (gl_get_tex_enviv_func *)fgl__ResolveOpenGLProc(state, "glGetTexEnviv");
+	glGetTexGendv = (gl_get_tex_gendv_func *)fgl__ResolveOpenGLProc(state, "glGetTexGendv");
+	glGetTexGenfv = (gl_get_tex_genfv_func *)fgl__ResolveOpenGLProc(state, "glGetTexGenfv");
+	glGetTexGeniv = (gl_get_tex_geniv_func *)fgl__ResolveOpenGLProc(state, "glGetTexGeniv");
+	glGetTexImage = (gl_get_tex_image_func *)fgl__ResolveOpenGLProc(state, "glGetTexImage");
+	glGetTexLevelParameterfv = (gl_get_tex_level_parameterfv_func *)fgl__ResolveOpenGLProc(state, "glGetTexLevelParameterfv");
+	glGetTexLevelParameteriv = (gl_get_tex_level_parameteriv_func *)fgl__ResolveOpenGLProc(state, "glGetTexLevelParameteriv");
+	glGetTexParameterfv = (gl_get_tex_parameterfv_func *)fgl__ResolveOpenGLProc(state, "glGetTexParameterfv");
+	glGetTexParameteriv = (gl_get_tex_parameteriv_func *)fgl__ResolveOpenGLProc(state, "glGetTexParameteriv");
+	glHint = (gl_hint_func *)fgl__ResolveOpenGLProc(state, "glHint");
+	glIndexMask = (gl_index_mask_func *)fgl__ResolveOpenGLProc(state, "glIndexMask");
+	glIndexPointer = (gl_index_pointer_func *)fgl__ResolveOpenGLProc(state, "glIndexPointer");
+	glIndexd = (gl_indexd_func *)fgl__ResolveOpenGLProc(state, "glIndexd");
+	glIndexdv = (gl_indexdv_func *)fgl__ResolveOpenGLProc(state, "glIndexdv");
+	glIndexf = (gl_indexf_func *)fgl__ResolveOpenGLProc(state, "glIndexf");
+	glIndexfv = (gl_indexfv_func *)fgl__ResolveOpenGLProc(state, "glIndexfv");
+	glIndexi = (gl_indexi_func *)fgl__ResolveOpenGLProc(state, "glIndexi");
+	glIndexiv = (gl_indexiv_func *)fgl__ResolveOpenGLProc(state, "glIndexiv");
+	glIndexs = (gl_indexs_func *)fgl__ResolveOpenGLProc(state, "glIndexs");
+	glIndexsv = (gl_indexsv_func *)fgl__ResolveOpenGLProc(state, "glIndexsv");
+	glIndexub = (gl_indexub_func *)fgl__ResolveOpenGLProc(state, "glIndexub");
+	glIndexubv = (gl_indexubv_func *)fgl__ResolveOpenGLProc(state, "glIndexubv");
+	glInitNames = (gl_init_names_func *)fgl__ResolveOpenGLProc(state, "glInitNames");
+	glInterleavedArrays = (gl_interleaved_arrays_func *)fgl__ResolveOpenGLProc(state, "glInterleavedArrays");
+	glIsEnabled = (gl_is_enabled_func *)fgl__ResolveOpenGLProc(state, "glIsEnabled");
+	glIsList = (gl_is_list_func *)fgl__ResolveOpenGLProc(state, "glIsList");
+	glIsTexture = (gl_is_texture_func *)fgl__ResolveOpenGLProc(state, "glIsTexture");
+	glLightModelf = (gl_light_modelf_func *)fgl__ResolveOpenGLProc(state, "glLightModelf");
+	glLightModelfv = (gl_light_modelfv_func *)fgl__ResolveOpenGLProc(state, "glLightModelfv");
+	glLightModeli = (gl_light_modeli_func *)fgl__ResolveOpenGLProc(state, "glLightModeli");
+	glLightModeliv = (gl_light_modeliv_func *)fgl__ResolveOpenGLProc(state, "glLightModeliv");
+	glLightf = (gl_lightf_func *)fgl__ResolveOpenGLProc(state, "glLightf");
+	glLightfv = (gl_lightfv_func *)fgl__ResolveOpenGLProc(state, "glLightfv");
+	glLighti = (gl_lighti_func *)fgl__ResolveOpenGLProc(state, "glLighti");
+	glLightiv = (gl_lightiv_func *)fgl__ResolveOpenGLProc(state, "glLightiv");
+	glLineStipple = (gl_line_stipple_func *)fgl__ResolveOpenGLProc(state, "glLineStipple");
+	glLineWidth = (gl_line_width_func *)fgl__ResolveOpenGLProc(state, "glLineWidth");
+	glListBase = (gl_list_base_func *)fgl__ResolveOpenGLProc(state, "glListBase");
+	glLoadIdentity = (gl_load_identity_func *)fgl__ResolveOpenGLProc(state, "glLoadIdentity");
+	glLoadMatrixd = (gl_load_matrixd_func *)fgl__ResolveOpenGLProc(state, "glLoadMatrixd");
+	glLoadMatrixf = (gl_load_matrixf_func *)fgl__ResolveOpenGLProc(state, "glLoadMatrixf");
+	glLoadName = (gl_load_name_func *)fgl__ResolveOpenGLProc(state, "glLoadName");
+	glLogicOp = (gl_logic_op_func *)fgl__ResolveOpenGLProc(state, "glLogicOp");
+	glMap1d = (gl_map1d_func *)fgl__ResolveOpenGLProc(state, "glMap1d");
+	glMap1f = (gl_map1f_func *)fgl__ResolveOpenGLProc(state, "glMap1f");
+	glMap2d = (gl_map2d_func *)fgl__ResolveOpenGLProc(state, "glMap2d");
+	glMap2f = (gl_map2f_func *)fgl__ResolveOpenGLProc(state, "glMap2f");
+	glMapGrid1d = (gl_map_grid1d_func *)fgl__ResolveOpenGLProc(state, "glMapGrid1d");
+	glMapGrid1f = (gl_map_grid1f_func *)fgl__ResolveOpenGLProc(state, "glMapGrid1f");
+	glMapGrid2d = (gl_map_grid2d_func *)fgl__ResolveOpenGLProc(state, "glMapGrid2d");
+	glMapGrid2f = (gl_map_grid2f_func *)fgl__ResolveOpenGLProc(state, "glMapGrid2f");
+	glMaterialf = (gl_materialf_func *)fgl__ResolveOpenGLProc(state, "glMaterialf");
+	glMaterialfv = (gl_materialfv_func *)fgl__ResolveOpenGLProc(state, "glMaterialfv");
+	glMateriali = (gl_materiali_func *)fgl__ResolveOpenGLProc(state, "glMateriali");
+	glMaterialiv = (gl_materialiv_func *)fgl__ResolveOpenGLProc(state, "glMaterialiv");
+	glMatrixMode = (gl_matrix_mode_func *)fgl__ResolveOpenGLProc(state, "glMatrixMode");
+	glMultMatrixd = (gl_mult_matrixd_func *)fgl__ResolveOpenGLProc(state, "glMultMatrixd");
+	glMultMatrixf = (gl_mult_matrixf_func *)fgl__ResolveOpenGLProc(state, "glMultMatrixf");
+	glNewList = (gl_new_list_func *)fgl__ResolveOpenGLProc(state, "glNewList");
+	glNormal3b = (gl_normal3b_func *)fgl__ResolveOpenGLProc(state, "glNormal3b");
+	glNormal3bv = (gl_normal3bv_func *)fgl__ResolveOpenGLProc(state, "glNormal3bv");
+	glNormal3d = (gl_normal3d_func *)fgl__ResolveOpenGLProc(state, "glNormal3d");
+	glNormal3dv = (gl_normal3dv_func *)fgl__ResolveOpenGLProc(state, "glNormal3dv");
+	glNormal3f = (gl_normal3f_func *)fgl__ResolveOpenGLProc(state, "glNormal3f");
+	glNormal3fv = (gl_normal3fv_func *)fgl__ResolveOpenGLProc(state, "glNormal3fv");
+	glNormal3i = (gl_normal3i_func *)fgl__ResolveOpenGLProc(state, "glNormal3i");
+	glNormal3iv = (gl_normal3iv_func *)fgl__ResolveOpenGLProc(state, "glNormal3iv");
+	glNormal3s = (gl_normal3s_func *)fgl__ResolveOpenGLProc(state, "glNormal3s");
+	glNormal3sv = (gl_normal3sv_func *)fgl__ResolveOpenGLProc(state, "glNormal3sv");
+	glNormalPointer = (gl_normal_pointer_func *)fgl__ResolveOpenGLProc(state, "glNormalPointer");
+	glOrtho = (gl_ortho_func *)fgl__ResolveOpenGLProc(state, "glOrtho");
+	glPassThrough = (gl_pass_through_func *)fgl__ResolveOpenGLProc(state, "glPassThrough");
+	glPixelMapfv = (gl_pixel_mapfv_func *)fgl__ResolveOpenGLProc(state, "glPixelMapfv");
+	glPixelMapuiv = (gl_pixel_mapuiv_func *)fgl__ResolveOpenGLProc(state, "glPixelMapuiv");
+	glPixelMapusv = (gl_pixel_mapusv_func *)fgl__ResolveOpenGLProc(state, "glPixelMapusv");
+	glPixelStoref = (gl_pixel_storef_func *)fgl__ResolveOpenGLProc(state, "glPixelStoref");
+	glPixelStorei = (gl_pixel_storei_func *)fgl__ResolveOpenGLProc(state, "glPixelStorei");
+	glPixelTransferf = (gl_pixel_transferf_func *)fgl__ResolveOpenGLProc(state, "glPixelTransferf");
+	glPixelTransferi = (gl_pixel_transferi_func *)fgl__ResolveOpenGLProc(state, "glPixelTransferi");
+	glPixelZoom = (gl_pixel_zoom_func *)fgl__ResolveOpenGLProc(state, "glPixelZoom");
+	glPointSize = (gl_point_size_func *)fgl__ResolveOpenGLProc(state, "glPointSize");
+	glPolygonMode = (gl_polygon_mode_func *)fgl__ResolveOpenGLProc(state, "glPolygonMode");
+	glPolygonOffset = (gl_polygon_offset_func *)fgl__ResolveOpenGLProc(state, "glPolygonOffset");
+	glPolygonStipple = (gl_polygon_stipple_func *)fgl__ResolveOpenGLProc(state, "glPolygonStipple");
+	glPopAttrib = (gl_pop_attrib_func *)fgl__ResolveOpenGLProc(state, "glPopAttrib");
+	glPopClientAttrib = (gl_pop_client_attrib_func *)fgl__ResolveOpenGLProc(state, "glPopClientAttrib");
+	glPopMatrix = (gl_pop_matrix_func *)fgl__ResolveOpenGLProc(state, "glPopMatrix");
+	glPopName = (gl_pop_name_func *)fgl__ResolveOpenGLProc(state, "glPopName");
+	glPrioritizeTextures = (gl_prioritize_textures_func *)fgl__ResolveOpenGLProc(state, "glPrioritizeTextures");
+	glPushAttrib = (gl_push_attrib_func *)fgl__ResolveOpenGLProc(state, "glPushAttrib");
+	glPushClientAttrib = (gl_push_client_attrib_func *)fgl__ResolveOpenGLProc(state, "glPushClientAttrib");
+	glPushMatrix = (gl_push_matrix_func *)fgl__ResolveOpenGLProc(state, "glPushMatrix");
+	glPushName = (gl_push_name_func *)fgl__ResolveOpenGLProc(state, "glPushName");
+	glRasterPos2d = (gl_raster_pos2d_func *)fgl__ResolveOpenGLProc(state, "glRasterPos2d");
+	glRasterPos2dv = (gl_raster_pos2dv_func *)fgl__ResolveOpenGLProc(state, "glRasterPos2dv");
+	glRasterPos2f = (gl_raster_pos2f_func *)fgl__ResolveOpenGLProc(state, "glRasterPos2f");
+	glRasterPos2fv = (gl_raster_pos2fv_func *)fgl__ResolveOpenGLProc(state, "glRasterPos2fv");
+	glRasterPos2i = (gl_raster_pos2i_func *)fgl__ResolveOpenGLProc(state, "glRasterPos2i");
+	glRasterPos2iv = (gl_raster_pos2iv_func *)fgl__ResolveOpenGLProc(state, "glRasterPos2iv");
+	glRasterPos2s = (gl_raster_pos2s_func *)fgl__ResolveOpenGLProc(state, "glRasterPos2s");
+	glRasterPos2sv = (gl_raster_pos2sv_func *)fgl__ResolveOpenGLProc(state, "glRasterPos2sv");
+	glRasterPos3d = (gl_raster_pos3d_func *)fgl__ResolveOpenGLProc(state, "glRasterPos3d");
+	glRasterPos3dv = (gl_raster_pos3dv_func *)fgl__ResolveOpenGLProc(state, "glRasterPos3dv");
+	glRasterPos3f = (gl_raster_pos3f_func *)fgl__ResolveOpenGLProc(state, "glRasterPos3f");
+	glRasterPos3fv = (gl_raster_pos3fv_func *)fgl__ResolveOpenGLProc(state, "glRasterPos3fv");
+	glRasterPos3i = (gl_raster_pos3i_func *)fgl__ResolveOpenGLProc(state, "glRasterPos3i");
+	glRasterPos3iv = (gl_raster_pos3iv_func *)fgl__ResolveOpenGLProc(state, "glRasterPos3iv");
+	glRasterPos3s = (gl_raster_pos3s_func *)fgl__ResolveOpenGLProc(state, "glRasterPos3s");
+	glRasterPos3sv = (gl_raster_pos3sv_func *)fgl__ResolveOpenGLProc(state, "glRasterPos3sv");
+	glRasterPos4d = (gl_raster_pos4d_func *)fgl__ResolveOpenGLProc(state, "glRasterPos4d");
+	glRasterPos4dv = (gl_raster_pos4dv_func *)fgl__ResolveOpenGLProc(state, "glRasterPos4dv");
+	glRasterPos4f = (gl_raster_pos4f_func *)fgl__ResolveOpenGLProc(state, "glRasterPos4f");
+	glRasterPos4fv = (gl_raster_pos4fv_func *)fgl__ResolveOpenGLProc(state, "glRasterPos4fv");
+	glRasterPos4i = (gl_raster_pos4i_func *)fgl__ResolveOpenGLProc(state, "glRasterPos4i");
+	glRasterPos4iv = (gl_raster_pos4iv_func *)fgl__ResolveOpenGLProc(state, "glRasterPos4iv");
+	glRasterPos4s = (gl_raster_pos4s_func *)fgl__ResolveOpenGLProc(state, "glRasterPos4s");
+	glRasterPos4sv = (gl_raster_pos4sv_func *)fgl__ResolveOpenGLProc(state, "glRasterPos4sv");
+	glReadBuffer = (gl_read_buffer_func *)fgl__ResolveOpenGLProc(state, "glReadBuffer");
+	glReadPixels = (gl_read_pixels_func *)fgl__ResolveOpenGLProc(state, "glReadPixels");
+	glRectd = (gl_rectd_func *)fgl__ResolveOpenGLProc(state, "glRectd");
+	glRectdv = (gl_rectdv_func *)fgl__ResolveOpenGLProc(state, "glRectdv");
+	glRectf = (gl_rectf_func *)fgl__ResolveOpenGLProc(state, "glRectf");
+	glRectfv = (gl_rectfv_func *)fgl__ResolveOpenGLProc(state, "glRectfv");
+	glRecti = (gl_recti_func *)fgl__ResolveOpenGLProc(state, "glRecti");
+	glRectiv = (gl_rectiv_func *)fgl__ResolveOpenGLProc(state, "glRectiv");
+	glRects = (gl_rects_func *)fgl__ResolveOpenGLProc(state, "glRects");
+	glRectsv = (gl_rectsv_func *)fgl__ResolveOpenGLProc(state, "glRectsv");
+	glRenderMode = (gl_render_mode_func *)fgl__ResolveOpenGLProc(state, "glRenderMode");
+	glRotated = (gl_rotated_func *)fgl__ResolveOpenGLProc(state, "glRotated");
+	glRotatef = (gl_rotatef_func *)fgl__ResolveOpenGLProc(state, "glRotatef");
+	glScaled = (gl_scaled_func *)fgl__ResolveOpenGLProc(state, "glScaled");
+	glScalef = (gl_scalef_func *)fgl__ResolveOpenGLProc(state, "glScalef");
+	glScissor = (gl_scissor_func *)fgl__ResolveOpenGLProc(state, "glScissor");
+	glSelectBuffer = (gl_select_buffer_func *)fgl__ResolveOpenGLProc(state, "glSelectBuffer");
+	glShadeModel = (gl_shade_model_func *)fgl__ResolveOpenGLProc(state, "glShadeModel");
+	glStencilFunc = (gl_stencil_func_func *)fgl__ResolveOpenGLProc(state, "glStencilFunc");
+	glStencilMask = (gl_stencil_mask_func *)fgl__ResolveOpenGLProc(state, "glStencilMask");
+	glStencilOp = (gl_stencil_op_func *)fgl__ResolveOpenGLProc(state, "glStencilOp");
+	glTexCoord1d = (gl_tex_coord1d_func *)fgl__ResolveOpenGLProc(state, "glTexCoord1d");
+	glTexCoord1dv = (gl_tex_coord1dv_func *)fgl__ResolveOpenGLProc(state, "glTexCoord1dv");
+	glTexCoord1f = (gl_tex_coord1f_func *)fgl__ResolveOpenGLProc(state, "glTexCoord1f");
+	glTexCoord1fv = (gl_tex_coord1fv_func *)fgl__ResolveOpenGLProc(state, "glTexCoord1fv");
+	glTexCoord1i = (gl_tex_coord1i_func *)fgl__ResolveOpenGLProc(state, "glTexCoord1i");
+	glTexCoord1iv = (gl_tex_coord1iv_func *)fgl__ResolveOpenGLProc(state, "glTexCoord1iv");
+	glTexCoord1s = (gl_tex_coord1s_func *)fgl__ResolveOpenGLProc(state, "glTexCoord1s");
+	glTexCoord1sv = (gl_tex_coord1sv_func *)fgl__ResolveOpenGLProc(state, "glTexCoord1sv");
+	glTexCoord2d = (gl_tex_coord2d_func *)fgl__ResolveOpenGLProc(state, "glTexCoord2d");
+	glTexCoord2dv = (gl_tex_coord2dv_func *)fgl__ResolveOpenGLProc(state, "glTexCoord2dv");
+	glTexCoord2f = (gl_tex_coord2f_func *)fgl__ResolveOpenGLProc(state, "glTexCoord2f");
+	glTexCoord2fv = (gl_tex_coord2fv_func *)fgl__ResolveOpenGLProc(state, "glTexCoord2fv");
+	glTexCoord2i = (gl_tex_coord2i_func *)fgl__ResolveOpenGLProc(state, "glTexCoord2i");
+	glTexCoord2iv = (gl_tex_coord2iv_func *)fgl__ResolveOpenGLProc(state, "glTexCoord2iv");
+	glTexCoord2s = (gl_tex_coord2s_func *)fgl__ResolveOpenGLProc(state, "glTexCoord2s");
+	glTexCoord2sv = (gl_tex_coord2sv_func *)fgl__ResolveOpenGLProc(state, "glTexCoord2sv");
+	glTexCoord3d = (gl_tex_coord3d_func *)fgl__ResolveOpenGLProc(state, "glTexCoord3d");
+	glTexCoord3dv = (gl_tex_coord3dv_func *)fgl__ResolveOpenGLProc(state, "glTexCoord3dv");
+	glTexCoord3f = (gl_tex_coord3f_func *)fgl__ResolveOpenGLProc(state, "glTexCoord3f");
+	glTexCoord3fv = (gl_tex_coord3fv_func *)fgl__ResolveOpenGLProc(state, "glTexCoord3fv");
+	glTexCoord3i = (gl_tex_coord3i_func *)fgl__ResolveOpenGLProc(state, "glTexCoord3i");
+	glTexCoord3iv = (gl_tex_coord3iv_func *)fgl__ResolveOpenGLProc(state, "glTexCoord3iv");
+	glTexCoord3s = (gl_tex_coord3s_func *)fgl__ResolveOpenGLProc(state, "glTexCoord3s");
+	glTexCoord3sv = (gl_tex_coord3sv_func *)fgl__ResolveOpenGLProc(state, "glTexCoord3sv");
+	glTexCoord4d = (gl_tex_coord4d_func *)fgl__ResolveOpenGLProc(state, "glTexCoord4d");
+	glTexCoord4dv = (gl_tex_coord4dv_func *)fgl__ResolveOpenGLProc(state, "glTexCoord4dv");
+	glTexCoord4f = (gl_tex_coord4f_func *)fgl__ResolveOpenGLProc(state, "glTexCoord4f");
+	glTexCoord4fv = (gl_tex_coord4fv_func *)fgl__ResolveOpenGLProc(state, "glTexCoord4fv");
+	glTexCoord4i = (gl_tex_coord4i_func *)fgl__ResolveOpenGLProc(state, "glTexCoord4i");
+	glTexCoord4iv = (gl_tex_coord4iv_func *)fgl__ResolveOpenGLProc(state, "glTexCoord4iv");
+	glTexCoord4s = (gl_tex_coord4s_func *)fgl__ResolveOpenGLProc(state, "glTexCoord4s");
+	glTexCoord4sv = (gl_tex_coord4sv_func *)fgl__ResolveOpenGLProc(state, "glTexCoord4sv");
+	glTexCoordPointer = (gl_tex_coord_pointer_func *)fgl__ResolveOpenGLProc(state, "glTexCoordPointer");
+	glTexEnvf = (gl_tex_envf_func *)fgl__ResolveOpenGLProc(state, "glTexEnvf");
+	glTexEnvfv = (gl_tex_envfv_func *)fgl__ResolveOpenGLProc(state, "glTexEnvfv");
+	glTexEnvi = (gl_tex_envi_func *)fgl__ResolveOpenGLProc(state, "glTexEnvi");
+	glTexEnviv = (gl_tex_enviv_func *)fgl__ResolveOpenGLProc(state, "glTexEnviv");
+	glTexGend = (gl_tex_gend_func *)fgl__ResolveOpenGLProc(state, "glTexGend");
+	glTexGendv = (gl_tex_gendv_func *)fgl__ResolveOpenGLProc(state, "glTexGendv");
+	glTexGenf = (gl_tex_genf_func *)fgl__ResolveOpenGLProc(state, "glTexGenf");
+	glTexGenfv = (gl_tex_genfv_func *)fgl__ResolveOpenGLProc(state, "glTexGenfv");
+	glTexGeni = (gl_tex_geni_func *)fgl__ResolveOpenGLProc(state, "glTexGeni");
+	glTexGeniv = (gl_tex_geniv_func *)fgl__ResolveOpenGLProc(state, "glTexGeniv");
+	glTexImage1D = (gl_tex_image1d_func *)fgl__ResolveOpenGLProc(state, "glTexImage1D");
+	glTexImage2D = (gl_tex_image2d_func *)fgl__ResolveOpenGLProc(state, "glTexImage2D");
+	glTexParameterf = (gl_tex_parameterf_func *)fgl__ResolveOpenGLProc(state, "glTexParameterf");
+	glTexParameterfv = (gl_tex_parameterfv_func *)fgl__ResolveOpenGLProc(state, "glTexParameterfv");
+	glTexParameteri = (gl_tex_parameteri_func *)fgl__ResolveOpenGLProc(state, "glTexParameteri");
+	glTexParameteriv = (gl_tex_parameteriv_func *)fgl__ResolveOpenGLProc(state, "glTexParameteriv");
+	glTexSubImage1D = (gl_tex_sub_image1d_func *)fgl__ResolveOpenGLProc(state, "glTexSubImage1D");
+	glTexSubImage2D = (gl_tex_sub_image2d_func *)fgl__ResolveOpenGLProc(state, "glTexSubImage2D");
+	glTranslated = (gl_translated_func *)fgl__ResolveOpenGLProc(state, "glTranslated");
+	glTranslatef = (gl_translatef_func *)fgl__ResolveOpenGLProc(state, "glTranslatef");
+	glVertex2d = (gl_vertex2d_func *)fgl__ResolveOpenGLProc(state, "glVertex2d");
+	glVertex2dv = (gl_vertex2dv_func *)fgl__ResolveOpenGLProc(state, "glVertex2dv");
+	glVertex2f = (gl_vertex2f_func *)fgl__ResolveOpenGLProc(state, "glVertex2f");
+	glVertex2fv = (gl_vertex2fv_func *)fgl__ResolveOpenGLProc(state, "glVertex2fv");
+	glVertex2i = (gl_vertex2i_func *)fgl__ResolveOpenGLProc(state, "glVertex2i");
+	glVertex2iv = (gl_vertex2iv_func *)fgl__ResolveOpenGLProc(state, "glVertex2iv");
+	glVertex2s = (gl_vertex2s_func *)fgl__ResolveOpenGLProc(state, "glVertex2s");
+	glVertex2sv = (gl_vertex2sv_func *)fgl__ResolveOpenGLProc(state, "glVertex2sv");
+	glVertex3d = (gl_vertex3d_func *)fgl__ResolveOpenGLProc(state, "glVertex3d");
+	glVertex3dv = (gl_vertex3dv_func *)fgl__ResolveOpenGLProc(state, "glVertex3dv");
+	glVertex3f = (gl_vertex3f_func *)fgl__ResolveOpenGLProc(state, "glVertex3f");
+	glVertex3fv = (gl_vertex3fv_func *)fgl__ResolveOpenGLProc(state, "glVertex3fv");
+	glVertex3i = (gl_vertex3i_func *)fgl__ResolveOpenGLProc(state, "glVertex3i");
+	glVertex3iv = (gl_vertex3iv_func *)fgl__ResolveOpenGLProc(state, "glVertex3iv");
+	glVertex3s = (gl_vertex3s_func *)fgl__ResolveOpenGLProc(state, "glVertex3s");
+	glVertex3sv = (gl_vertex3sv_func *)fgl__ResolveOpenGLProc(state, "glVertex3sv");
+	glVertex4d = (gl_vertex4d_func *)fgl__ResolveOpenGLProc(state, "glVertex4d");
+	glVertex4dv = (gl_vertex4dv_func *)fgl__ResolveOpenGLProc(state, "glVertex4dv");
+	glVertex4f = (gl_vertex4f_func *)fgl__ResolveOpenGLProc(state, "glVertex4f");
+	glVertex4fv = (gl_vertex4fv_func *)fgl__ResolveOpenGLProc(state, "glVertex4fv");
+	glVertex4i = (gl_vertex4i_func *)fgl__ResolveOpenGLProc(state, "glVertex4i");
+	glVertex4iv = (gl_vertex4iv_func *)fgl__ResolveOpenGLProc(state, "glVertex4iv");
+	glVertex4s = (gl_vertex4s_func *)fgl__ResolveOpenGLProc(state, "glVertex4s");
+	glVertex4sv = (gl_vertex4sv_func *)fgl__ResolveOpenGLProc(state, "glVertex4sv");
+	glVertexPointer = (gl_vertex_pointer_func *)fgl__ResolveOpenGLProc(state, "glVertexPointer");
+	glViewport = (gl_viewport_func *)fgl__ResolveOpenGLProc(state, "glViewport");
+	isGL_VERSION_1_1 = fgl__EndOpenGLVersion(state);
 #	endif //GL_VERSION_1_1
 
 #	if GL_VERSION_1_2
-	glDrawRangeElements = (gl_draw_range_elements_func *)fgl__GetOpenGLProcAddress(state, "glDrawRangeElements");
-	glTexImage3D = (gl_tex_image3d_func *)fgl__GetOpenGLProcAddress(state, "glTexImage3D");
-	glTexSubImage3D = (gl_tex_sub_image3d_func *)fgl__GetOpenGLProcAddress(state, "glTexSubImage3D");
-	glCopyTexSubImage3D = (gl_copy_tex_sub_image3d_func *)fgl__GetOpenGLProcAddress(state, "glCopyTexSubImage3D");
+	fgl__BeginOpenGLVersion(state, 12);
+	glDrawRangeElements = (gl_draw_range_elements_func *)fgl__ResolveOpenGLProc(state, "glDrawRangeElements");
+	glTexImage3D = (gl_tex_image3d_func *)fgl__ResolveOpenGLProc(state, "glTexImage3D");
+	glTexSubImage3D = (gl_tex_sub_image3d_func *)fgl__ResolveOpenGLProc(state, "glTexSubImage3D");
+	glCopyTexSubImage3D = (gl_copy_tex_sub_image3d_func *)fgl__ResolveOpenGLProc(state, "glCopyTexSubImage3D");
+	isGL_VERSION_1_2 = fgl__EndOpenGLVersion(state);
 #	endif //GL_VERSION_1_2
 
 #	if GL_VERSION_1_3
-	glActiveTexture = (gl_active_texture_func *)fgl__GetOpenGLProcAddress(state, "glActiveTexture");
-	glSampleCoverage = (gl_sample_coverage_func *)fgl__GetOpenGLProcAddress(state, "glSampleCoverage");
-	glCompressedTexImage3D = (gl_compressed_tex_image3d_func *)fgl__GetOpenGLProcAddress(state, "glCompressedTexImage3D");
-	glCompressedTexImage2D = (gl_compressed_tex_image2d_func *)fgl__GetOpenGLProcAddress(state, "glCompressedTexImage2D");
-	glCompressedTexImage1D = (gl_compressed_tex_image1d_func *)fgl__GetOpenGLProcAddress(state, "glCompressedTexImage1D");
-	glCompressedTexSubImage3D = (gl_compressed_tex_sub_image3d_func *)fgl__GetOpenGLProcAddress(state, "glCompressedTexSubImage3D");
-	glCompressedTexSubImage2D = (gl_compressed_tex_sub_image2d_func *)fgl__GetOpenGLProcAddress(state, "glCompressedTexSubImage2D");
-	glCompressedTexSubImage1D = (gl_compressed_tex_sub_image1d_func *)fgl__GetOpenGLProcAddress(state, "glCompressedTexSubImage1D");
-	glGetCompressedTexImage = (gl_get_compressed_tex_image_func *)fgl__GetOpenGLProcAddress(state, "glGetCompressedTexImage");
-	glClientActiveTexture = (gl_client_active_texture_func *)fgl__GetOpenGLProcAddress(state, "glClientActiveTexture");
-	glMultiTexCoord1d = (gl_multi_tex_coord1d_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord1d");
-	glMultiTexCoord1dv = (gl_multi_tex_coord1dv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord1dv");
-	glMultiTexCoord1f = (gl_multi_tex_coord1f_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord1f");
-	glMultiTexCoord1fv = (gl_multi_tex_coord1fv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord1fv");
-	glMultiTexCoord1i = (gl_multi_tex_coord1i_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord1i");
-	glMultiTexCoord1iv = (gl_multi_tex_coord1iv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord1iv");
-	glMultiTexCoord1s = (gl_multi_tex_coord1s_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord1s");
-	glMultiTexCoord1sv = (gl_multi_tex_coord1sv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord1sv");
-	glMultiTexCoord2d = (gl_multi_tex_coord2d_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord2d");
-	glMultiTexCoord2dv = (gl_multi_tex_coord2dv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord2dv");
-	glMultiTexCoord2f = (gl_multi_tex_coord2f_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord2f");
-	glMultiTexCoord2fv = (gl_multi_tex_coord2fv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord2fv");
-	glMultiTexCoord2i = (gl_multi_tex_coord2i_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord2i");
-	glMultiTexCoord2iv = (gl_multi_tex_coord2iv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord2iv");
-	glMultiTexCoord2s = (gl_multi_tex_coord2s_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord2s");
-	glMultiTexCoord2sv = (gl_multi_tex_coord2sv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord2sv");
-	glMultiTexCoord3d = (gl_multi_tex_coord3d_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord3d");
-	glMultiTexCoord3dv = (gl_multi_tex_coord3dv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord3dv");
-	glMultiTexCoord3f = (gl_multi_tex_coord3f_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord3f");
-	glMultiTexCoord3fv = (gl_multi_tex_coord3fv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord3fv");
-	glMultiTexCoord3i = (gl_multi_tex_coord3i_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord3i");
-	glMultiTexCoord3iv = (gl_multi_tex_coord3iv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord3iv");
-	glMultiTexCoord3s = (gl_multi_tex_coord3s_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord3s");
-	glMultiTexCoord3sv = (gl_multi_tex_coord3sv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord3sv");
-	glMultiTexCoord4d = (gl_multi_tex_coord4d_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord4d");
-	glMultiTexCoord4dv = (gl_multi_tex_coord4dv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord4dv");
-	glMultiTexCoord4f = (gl_multi_tex_coord4f_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord4f");
-	glMultiTexCoord4fv = (gl_multi_tex_coord4fv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord4fv");
-	glMultiTexCoord4i = (gl_multi_tex_coord4i_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord4i");
-	glMultiTexCoord4iv = (gl_multi_tex_coord4iv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord4iv");
-	glMultiTexCoord4s = (gl_multi_tex_coord4s_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord4s");
-	glMultiTexCoord4sv = (gl_multi_tex_coord4sv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoord4sv");
-	glLoadTransposeMatrixf = (gl_load_transpose_matrixf_func *)fgl__GetOpenGLProcAddress(state, "glLoadTransposeMatrixf");
-	glLoadTransposeMatrixd = (gl_load_transpose_matrixd_func *)fgl__GetOpenGLProcAddress(state, "glLoadTransposeMatrixd");
-	glMultTransposeMatrixf = (gl_mult_transpose_matrixf_func *)fgl__GetOpenGLProcAddress(state, "glMultTransposeMatrixf");
-	glMultTransposeMatrixd = (gl_mult_transpose_matrixd_func *)fgl__GetOpenGLProcAddress(state, "glMultTransposeMatrixd");
+	fgl__BeginOpenGLVersion(state, 13);
+	glActiveTexture = (gl_active_texture_func *)fgl__ResolveOpenGLProc(state, "glActiveTexture");
+	glSampleCoverage = (gl_sample_coverage_func *)fgl__ResolveOpenGLProc(state, "glSampleCoverage");
+	glCompressedTexImage3D = (gl_compressed_tex_image3d_func *)fgl__ResolveOpenGLProc(state, "glCompressedTexImage3D");
+	glCompressedTexImage2D = (gl_compressed_tex_image2d_func *)fgl__ResolveOpenGLProc(state, "glCompressedTexImage2D");
+	glCompressedTexImage1D = (gl_compressed_tex_image1d_func *)fgl__ResolveOpenGLProc(state, "glCompressedTexImage1D");
+	glCompressedTexSubImage3D = (gl_compressed_tex_sub_image3d_func *)fgl__ResolveOpenGLProc(state, "glCompressedTexSubImage3D");
+	glCompressedTexSubImage2D = (gl_compressed_tex_sub_image2d_func *)fgl__ResolveOpenGLProc(state, "glCompressedTexSubImage2D");
+	glCompressedTexSubImage1D = (gl_compressed_tex_sub_image1d_func *)fgl__ResolveOpenGLProc(state, "glCompressedTexSubImage1D");
+	glGetCompressedTexImage = (gl_get_compressed_tex_image_func *)fgl__ResolveOpenGLProc(state, "glGetCompressedTexImage");
+	glClientActiveTexture = (gl_client_active_texture_func *)fgl__ResolveOpenGLProc(state, "glClientActiveTexture");
+	glMultiTexCoord1d = (gl_multi_tex_coord1d_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord1d");
+	glMultiTexCoord1dv = (gl_multi_tex_coord1dv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord1dv");
+	glMultiTexCoord1f = (gl_multi_tex_coord1f_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord1f");
+	glMultiTexCoord1fv = (gl_multi_tex_coord1fv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord1fv");
+	glMultiTexCoord1i = (gl_multi_tex_coord1i_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord1i");
+	glMultiTexCoord1iv = (gl_multi_tex_coord1iv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord1iv");
+	glMultiTexCoord1s = (gl_multi_tex_coord1s_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord1s");
+	glMultiTexCoord1sv = (gl_multi_tex_coord1sv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord1sv");
+	glMultiTexCoord2d = (gl_multi_tex_coord2d_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord2d");
+	glMultiTexCoord2dv = (gl_multi_tex_coord2dv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord2dv");
+	glMultiTexCoord2f = (gl_multi_tex_coord2f_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord2f");
+	glMultiTexCoord2fv = (gl_multi_tex_coord2fv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord2fv");
+	glMultiTexCoord2i = (gl_multi_tex_coord2i_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord2i");
+	glMultiTexCoord2iv = (gl_multi_tex_coord2iv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord2iv");
+	glMultiTexCoord2s = (gl_multi_tex_coord2s_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord2s");
+	glMultiTexCoord2sv = (gl_multi_tex_coord2sv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord2sv");
+	glMultiTexCoord3d = (gl_multi_tex_coord3d_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord3d");
+	glMultiTexCoord3dv = (gl_multi_tex_coord3dv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord3dv");
+	glMultiTexCoord3f = (gl_multi_tex_coord3f_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord3f");
+	glMultiTexCoord3fv = (gl_multi_tex_coord3fv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord3fv");
+	glMultiTexCoord3i = (gl_multi_tex_coord3i_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord3i");
+	glMultiTexCoord3iv = (gl_multi_tex_coord3iv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord3iv");
+	glMultiTexCoord3s = (gl_multi_tex_coord3s_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord3s");
+	glMultiTexCoord3sv = (gl_multi_tex_coord3sv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord3sv");
+	glMultiTexCoord4d = (gl_multi_tex_coord4d_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord4d");
+	glMultiTexCoord4dv = (gl_multi_tex_coord4dv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord4dv");
+	glMultiTexCoord4f = (gl_multi_tex_coord4f_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord4f");
+	glMultiTexCoord4fv = (gl_multi_tex_coord4fv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord4fv");
+	glMultiTexCoord4i = (gl_multi_tex_coord4i_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord4i");
+	glMultiTexCoord4iv = (gl_multi_tex_coord4iv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord4iv");
+	glMultiTexCoord4s = (gl_multi_tex_coord4s_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord4s");
+	glMultiTexCoord4sv = (gl_multi_tex_coord4sv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoord4sv");
+	glLoadTransposeMatrixf = (gl_load_transpose_matrixf_func *)fgl__ResolveOpenGLProc(state, "glLoadTransposeMatrixf");
+	glLoadTransposeMatrixd = (gl_load_transpose_matrixd_func *)fgl__ResolveOpenGLProc(state, "glLoadTransposeMatrixd");
+	glMultTransposeMatrixf = (gl_mult_transpose_matrixf_func *)fgl__ResolveOpenGLProc(state, "glMultTransposeMatrixf");
+	glMultTransposeMatrixd = (gl_mult_transpose_matrixd_func *)fgl__ResolveOpenGLProc(state, "glMultTransposeMatrixd");
+	isGL_VERSION_1_3 = fgl__EndOpenGLVersion(state);
 #	endif //GL_VERSION_1_3
 
 #	if GL_VERSION_1_4
-	glBlendFuncSeparate = (gl_blend_func_separate_func *)fgl__GetOpenGLProcAddress(state, "glBlendFuncSeparate");
-	glMultiDrawArrays = (gl_multi_draw_arrays_func *)fgl__GetOpenGLProcAddress(state, "glMultiDrawArrays");
-	glMultiDrawElements = (gl_multi_draw_elements_func *)fgl__GetOpenGLProcAddress(state, "glMultiDrawElements");
-	glPointParameterf = (gl_point_parameterf_func *)fgl__GetOpenGLProcAddress(state, "glPointParameterf");
-	glPointParameterfv = (gl_point_parameterfv_func *)fgl__GetOpenGLProcAddress(state, "glPointParameterfv");
-	glPointParameteri = (gl_point_parameteri_func *)fgl__GetOpenGLProcAddress(state, "glPointParameteri");
-	glPointParameteriv = (gl_point_parameteriv_func *)fgl__GetOpenGLProcAddress(state, "glPointParameteriv");
-	glFogCoordf = (gl_fog_coordf_func *)fgl__GetOpenGLProcAddress(state, "glFogCoordf");
-	glFogCoordfv = (gl_fog_coordfv_func *)fgl__GetOpenGLProcAddress(state, "glFogCoordfv");
-	glFogCoordd = (gl_fog_coordd_func *)fgl__GetOpenGLProcAddress(state, "glFogCoordd");
-	glFogCoorddv = (gl_fog_coorddv_func *)fgl__GetOpenGLProcAddress(state, "glFogCoorddv");
-	glFogCoordPointer = (gl_fog_coord_pointer_func *)fgl__GetOpenGLProcAddress(state, "glFogCoordPointer");
-	glSecondaryColor3b = (gl_secondary_color3b_func *)fgl__GetOpenGLProcAddress(state, "glSecondaryColor3b");
-	glSecondaryColor3bv = (gl_secondary_color3bv_func *)fgl__GetOpenGLProcAddress(state, "glSecondaryColor3bv");
-	glSecondaryColor3d = (gl_secondary_color3d_func *)fgl__GetOpenGLProcAddress(state, "glSecondaryColor3d");
-	glSecondaryColor3dv = (gl_secondary_color3dv_func *)fgl__GetOpenGLProcAddress(state, "glSecondaryColor3dv");
-	glSecondaryColor3f = (gl_secondary_color3f_func *)fgl__GetOpenGLProcAddress(state, "glSecondaryColor3f");
-	glSecondaryColor3fv = (gl_secondary_color3fv_func *)fgl__GetOpenGLProcAddress(state, "glSecondaryColor3fv");
-	glSecondaryColor3i = (gl_secondary_color3i_func *)fgl__GetOpenGLProcAddress(state, "glSecondaryColor3i");
-	glSecondaryColor3iv = (gl_secondary_color3iv_func *)fgl__GetOpenGLProcAddress(state, "glSecondaryColor3iv");
-	glSecondaryColor3s = (gl_secondary_color3s_func *)fgl__GetOpenGLProcAddress(state, "glSecondaryColor3s");
-	glSecondaryColor3sv = (gl_secondary_color3sv_func *)fgl__GetOpenGLProcAddress(state, "glSecondaryColor3sv");
-	glSecondaryColor3ub = (gl_secondary_color3ub_func *)fgl__GetOpenGLProcAddress(state, "glSecondaryColor3ub");
-	glSecondaryColor3ubv = (gl_secondary_color3ubv_func *)fgl__GetOpenGLProcAddress(state, "glSecondaryColor3ubv");
-	glSecondaryColor3ui = (gl_secondary_color3ui_func *)fgl__GetOpenGLProcAddress(state, "glSecondaryColor3ui");
-	glSecondaryColor3uiv = (gl_secondary_color3uiv_func *)fgl__GetOpenGLProcAddress(state, "glSecondaryColor3uiv");
-	glSecondaryColor3us = (gl_secondary_color3us_func *)fgl__GetOpenGLProcAddress(state, "glSecondaryColor3us");
-	glSecondaryColor3usv = (gl_secondary_color3usv_func *)fgl__GetOpenGLProcAddress(state, "glSecondaryColor3usv");
-	glSecondaryColorPointer = (gl_secondary_color_pointer_func *)fgl__GetOpenGLProcAddress(state, "glSecondaryColorPointer");
-	glWindowPos2d = (gl_window_pos2d_func *)fgl__GetOpenGLProcAddress(state, "glWindowPos2d");
-	glWindowPos2dv = (gl_window_pos2dv_func *)fgl__GetOpenGLProcAddress(state, "glWindowPos2dv");
-	glWindowPos2f = (gl_window_pos2f_func *)fgl__GetOpenGLProcAddress(state, "glWindowPos2f");
-	glWindowPos2fv = (gl_window_pos2fv_func *)fgl__GetOpenGLProcAddress(state, "glWindowPos2fv");
-	glWindowPos2i = (gl_window_pos2i_func *)fgl__GetOpenGLProcAddress(state, "glWindowPos2i");
-	glWindowPos2iv = (gl_window_pos2iv_func *)fgl__GetOpenGLProcAddress(state, "glWindowPos2iv");
-	glWindowPos2s = (gl_window_pos2s_func *)fgl__GetOpenGLProcAddress(state, "glWindowPos2s");
-	glWindowPos2sv = (gl_window_pos2sv_func *)fgl__GetOpenGLProcAddress(state, "glWindowPos2sv");
-	glWindowPos3d = (gl_window_pos3d_func *)fgl__GetOpenGLProcAddress(state, "glWindowPos3d");
-	glWindowPos3dv = (gl_window_pos3dv_func *)fgl__GetOpenGLProcAddress(state, "glWindowPos3dv");
-	glWindowPos3f = (gl_window_pos3f_func *)fgl__GetOpenGLProcAddress(state, "glWindowPos3f");
-	glWindowPos3fv = (gl_window_pos3fv_func *)fgl__GetOpenGLProcAddress(state, "glWindowPos3fv");
-	glWindowPos3i = (gl_window_pos3i_func *)fgl__GetOpenGLProcAddress(state, "glWindowPos3i");
-	glWindowPos3iv = (gl_window_pos3iv_func *)fgl__GetOpenGLProcAddress(state, "glWindowPos3iv");
-	glWindowPos3s = (gl_window_pos3s_func *)fgl__GetOpenGLProcAddress(state, "glWindowPos3s");
-	glWindowPos3sv = (gl_window_pos3sv_func *)fgl__GetOpenGLProcAddress(state, "glWindowPos3sv");
-	glBlendColor = (gl_blend_color_func *)fgl__GetOpenGLProcAddress(state, "glBlendColor");
-	glBlendEquation = (gl_blend_equation_func *)fgl__GetOpenGLProcAddress(state, "glBlendEquation");
+	fgl__BeginOpenGLVersion(state, 14);
+	glBlendFuncSeparate = (gl_blend_func_separate_func *)fgl__ResolveOpenGLProc(state, "glBlendFuncSeparate");
+	glMultiDrawArrays = (gl_multi_draw_arrays_func *)fgl__ResolveOpenGLProc(state, "glMultiDrawArrays");
+	glMultiDrawElements = (gl_multi_draw_elements_func *)fgl__ResolveOpenGLProc(state, "glMultiDrawElements");
+	glPointParameterf = (gl_point_parameterf_func *)fgl__ResolveOpenGLProc(state, "glPointParameterf");
+	glPointParameterfv = (gl_point_parameterfv_func *)fgl__ResolveOpenGLProc(state, "glPointParameterfv");
+	glPointParameteri = (gl_point_parameteri_func *)fgl__ResolveOpenGLProc(state, "glPointParameteri");
+	glPointParameteriv = (gl_point_parameteriv_func *)fgl__ResolveOpenGLProc(state, "glPointParameteriv");
+	glFogCoordf = (gl_fog_coordf_func *)fgl__ResolveOpenGLProc(state, "glFogCoordf");
+	glFogCoordfv = (gl_fog_coordfv_func *)fgl__ResolveOpenGLProc(state, "glFogCoordfv");
+	glFogCoordd = (gl_fog_coordd_func *)fgl__ResolveOpenGLProc(state, "glFogCoordd");
+	glFogCoorddv = (gl_fog_coorddv_func *)fgl__ResolveOpenGLProc(state, "glFogCoorddv");
+	glFogCoordPointer = (gl_fog_coord_pointer_func *)fgl__ResolveOpenGLProc(state, "glFogCoordPointer");
+	glSecondaryColor3b = (gl_secondary_color3b_func *)fgl__ResolveOpenGLProc(state, "glSecondaryColor3b");
+	glSecondaryColor3bv = (gl_secondary_color3bv_func *)fgl__ResolveOpenGLProc(state, "glSecondaryColor3bv");
+	glSecondaryColor3d = (gl_secondary_color3d_func *)fgl__ResolveOpenGLProc(state, "glSecondaryColor3d");
+	glSecondaryColor3dv = (gl_secondary_color3dv_func *)fgl__ResolveOpenGLProc(state, "glSecondaryColor3dv");
+	glSecondaryColor3f = (gl_secondary_color3f_func *)fgl__ResolveOpenGLProc(state, "glSecondaryColor3f");
+	glSecondaryColor3fv = (gl_secondary_color3fv_func *)fgl__ResolveOpenGLProc(state, "glSecondaryColor3fv");
+	glSecondaryColor3i = (gl_secondary_color3i_func *)fgl__ResolveOpenGLProc(state, "glSecondaryColor3i");
+	glSecondaryColor3iv = (gl_secondary_color3iv_func *)fgl__ResolveOpenGLProc(state, "glSecondaryColor3iv");
+	glSecondaryColor3s = (gl_secondary_color3s_func *)fgl__ResolveOpenGLProc(state, "glSecondaryColor3s");
+	glSecondaryColor3sv = (gl_secondary_color3sv_func *)fgl__ResolveOpenGLProc(state, "glSecondaryColor3sv");
+	glSecondaryColor3ub = (gl_secondary_color3ub_func *)fgl__ResolveOpenGLProc(state, "glSecondaryColor3ub");
+	glSecondaryColor3ubv = (gl_secondary_color3ubv_func *)fgl__ResolveOpenGLProc(state, "glSecondaryColor3ubv");
+	glSecondaryColor3ui = (gl_secondary_color3ui_func *)fgl__ResolveOpenGLProc(state, "glSecondaryColor3ui");
+	glSecondaryColor3uiv = (gl_secondary_color3uiv_func *)fgl__ResolveOpenGLProc(state, "glSecondaryColor3uiv");
+	glSecondaryColor3us = (gl_secondary_color3us_func *)fgl__ResolveOpenGLProc(state, "glSecondaryColor3us");
+	glSecondaryColor3usv = (gl_secondary_color3usv_func *)fgl__ResolveOpenGLProc(state, "glSecondaryColor3usv");
+	glSecondaryColorPointer = (gl_secondary_color_pointer_func *)fgl__ResolveOpenGLProc(state, "glSecondaryColorPointer");
+	glWindowPos2d = (gl_window_pos2d_func *)fgl__ResolveOpenGLProc(state, "glWindowPos2d");
+	glWindowPos2dv = (gl_window_pos2dv_func *)fgl__ResolveOpenGLProc(state, "glWindowPos2dv");
+	glWindowPos2f = (gl_window_pos2f_func *)fgl__ResolveOpenGLProc(state, "glWindowPos2f");
+	glWindowPos2fv = (gl_window_pos2fv_func *)fgl__ResolveOpenGLProc(state, "glWindowPos2fv");
+	glWindowPos2i = (gl_window_pos2i_func *)fgl__ResolveOpenGLProc(state, "glWindowPos2i");
+	glWindowPos2iv = (gl_window_pos2iv_func *)fgl__ResolveOpenGLProc(state, "glWindowPos2iv");
+	glWindowPos2s = (gl_window_pos2s_func *)fgl__ResolveOpenGLProc(state, "glWindowPos2s");
+	glWindowPos2sv = (gl_window_pos2sv_func *)fgl__ResolveOpenGLProc(state, "glWindowPos2sv");
+	glWindowPos3d = (gl_window_pos3d_func *)fgl__ResolveOpenGLProc(state, "glWindowPos3d");
+	glWindowPos3dv = (gl_window_pos3dv_func *)fgl__ResolveOpenGLProc(state, "glWindowPos3dv");
+	glWindowPos3f = (gl_window_pos3f_func *)fgl__ResolveOpenGLProc(state, "glWindowPos3f");
+	glWindowPos3fv = (gl_window_pos3fv_func *)fgl__ResolveOpenGLProc(state, "glWindowPos3fv");
+	glWindowPos3i = (gl_window_pos3i_func *)fgl__ResolveOpenGLProc(state, "glWindowPos3i");
+	glWindowPos3iv = (gl_window_pos3iv_func *)fgl__ResolveOpenGLProc(state, "glWindowPos3iv");
+	glWindowPos3s = (gl_window_pos3s_func *)fgl__ResolveOpenGLProc(state, "glWindowPos3s");
+	glWindowPos3sv = (gl_window_pos3sv_func *)fgl__ResolveOpenGLProc(state, "glWindowPos3sv");
+	glBlendColor = (gl_blend_color_func *)fgl__ResolveOpenGLProc(state, "glBlendColor");
+	glBlendEquation = (gl_blend_equation_func *)fgl__ResolveOpenGLProc(state, "glBlendEquation");
+	isGL_VERSION_1_4 = fgl__EndOpenGLVersion(state);
 #	endif //GL_VERSION_1_4
 
 #	if GL_VERSION_1_5
-	glGenQueries = (gl_gen_queries_func *)fgl__GetOpenGLProcAddress(state, "glGenQueries");
-	glDeleteQueries = (gl_delete_queries_func *)fgl__GetOpenGLProcAddress(state, "glDeleteQueries");
-	glIsQuery = (gl_is_query_func *)fgl__GetOpenGLProcAddress(state, "glIsQuery");
-	glBeginQuery = (gl_begin_query_func *)fgl__GetOpenGLProcAddress(state, "glBeginQuery");
-	glEndQuery = (gl_end_query_func *)fgl__GetOpenGLProcAddress(state, "glEndQuery");
-	glGetQueryiv = (gl_get_queryiv_func *)fgl__GetOpenGLProcAddress(state, "glGetQueryiv");
-	glGetQueryObjectiv = (gl_get_query_objectiv_func *)fgl__GetOpenGLProcAddress(state, "glGetQueryObjectiv");
-	glGetQueryObjectuiv = (gl_get_query_objectuiv_func *)fgl__GetOpenGLProcAddress(state, "glGetQueryObjectuiv");
-	glBindBuffer = (gl_bind_buffer_func *)fgl__GetOpenGLProcAddress(state, "glBindBuffer");
-	glDeleteBuffers = (gl_delete_buffers_func *)fgl__GetOpenGLProcAddress(state, "glDeleteBuffers");
-	glGenBuffers = (gl_gen_buffers_func *)fgl__GetOpenGLProcAddress(state, "glGenBuffers");
-	glIsBuffer = (gl_is_buffer_func *)fgl__GetOpenGLProcAddress(state, "glIsBuffer");
-	glBufferData = (gl_buffer_data_func *)fgl__GetOpenGLProcAddress(state, "glBufferData");
-	glBufferSubData = (gl_buffer_sub_data_func *)fgl__GetOpenGLProcAddress(state, "glBufferSubData");
-	glGetBufferSubData = (gl_get_buffer_sub_data_func *)fgl__GetOpenGLProcAddress(state, "glGetBufferSubData");
-	glMapBuffer = (gl_map_buffer_func *)fgl__GetOpenGLProcAddress(state, "glMapBuffer");
-	glUnmapBuffer = (gl_unmap_buffer_func *)fgl__GetOpenGLProcAddress(state, "glUnmapBuffer");
-	glGetBufferParameteriv = (gl_get_buffer_parameteriv_func *)fgl__GetOpenGLProcAddress(state, "glGetBufferParameteriv");
-	glGetBufferPointerv = (gl_get_buffer_pointerv_func *)fgl__GetOpenGLProcAddress(state, "glGetBufferPointerv");
+	fgl__BeginOpenGLVersion(state, 15);
+	glGenQueries = (gl_gen_queries_func *)fgl__ResolveOpenGLProc(state, "glGenQueries");
+	glDeleteQueries = (gl_delete_queries_func *)fgl__ResolveOpenGLProc(state, "glDeleteQueries");
+	glIsQuery = (gl_is_query_func *)fgl__ResolveOpenGLProc(state, "glIsQuery");
+	glBeginQuery = (gl_begin_query_func *)fgl__ResolveOpenGLProc(state, "glBeginQuery");
+	glEndQuery = (gl_end_query_func *)fgl__ResolveOpenGLProc(state, "glEndQuery");
+	glGetQueryiv = (gl_get_queryiv_func *)fgl__ResolveOpenGLProc(state, "glGetQueryiv");
+	glGetQueryObjectiv = (gl_get_query_objectiv_func *)fgl__ResolveOpenGLProc(state, "glGetQueryObjectiv");
+	glGetQueryObjectuiv = (gl_get_query_objectuiv_func *)fgl__ResolveOpenGLProc(state, "glGetQueryObjectuiv");
+	glBindBuffer = (gl_bind_buffer_func *)fgl__ResolveOpenGLProc(state, "glBindBuffer");
+	glDeleteBuffers = (gl_delete_buffers_func *)fgl__ResolveOpenGLProc(state, "glDeleteBuffers");
+	glGenBuffers = (gl_gen_buffers_func *)fgl__ResolveOpenGLProc(state, "glGenBuffers");
+	glIsBuffer = (gl_is_buffer_func *)fgl__ResolveOpenGLProc(state, "glIsBuffer");
+	glBufferData = (gl_buffer_data_func *)fgl__ResolveOpenGLProc(state, "glBufferData");
+	glBufferSubData = (gl_buffer_sub_data_func *)fgl__ResolveOpenGLProc(state, "glBufferSubData");
+	glGetBufferSubData = (gl_get_buffer_sub_data_func *)fgl__ResolveOpenGLProc(state, "glGetBufferSubData");
+	glMapBuffer = (gl_map_buffer_func *)fgl__ResolveOpenGLProc(state, "glMapBuffer");
+	glUnmapBuffer = (gl_unmap_buffer_func *)fgl__ResolveOpenGLProc(state, "glUnmapBuffer");
+	glGetBufferParameteriv = (gl_get_buffer_parameteriv_func *)fgl__ResolveOpenGLProc(state, "glGetBufferParameteriv");
+	glGetBufferPointerv = (gl_get_buffer_pointerv_func *)fgl__ResolveOpenGLProc(state, "glGetBufferPointerv");
+	isGL_VERSION_1_5 = fgl__EndOpenGLVersion(state);
 #	endif //GL_VERSION_1_5
 
 #	if GL_VERSION_2_0
-	glBlendEquationSeparate = (gl_blend_equation_separate_func *)fgl__GetOpenGLProcAddress(state, "glBlendEquationSeparate");
-	glDrawBuffers = (gl_draw_buffers_func *)fgl__GetOpenGLProcAddress(state, "glDrawBuffers");
-	glStencilOpSeparate = (gl_stencil_op_separate_func *)fgl__GetOpenGLProcAddress(state, "glStencilOpSeparate");
-	glStencilFuncSeparate = (gl_stencil_func_separate_func *)fgl__GetOpenGLProcAddress(state, "glStencilFuncSeparate");
-	glStencilMaskSeparate = (gl_stencil_mask_separate_func *)fgl__GetOpenGLProcAddress(state, "glStencilMaskSeparate");
-	glAttachShader = (gl_attach_shader_func *)fgl__GetOpenGLProcAddress(state, "glAttachShader");
-	glBindAttribLocation = (gl_bind_attrib_location_func *)fgl__GetOpenGLProcAddress(state, "glBindAttribLocation");
-	glCompileShader = (gl_compile_shader_func *)fgl__GetOpenGLProcAddress(state, "glCompileShader");
-	glCreateProgram = (gl_create_program_func *)fgl__GetOpenGLProcAddress(state, "glCreateProgram");
-	glCreateShader = (gl_create_shader_func *)fgl__GetOpenGLProcAddress(state, "glCreateShader");
-	glDeleteProgram = (gl_delete_program_func *)fgl__GetOpenGLProcAddress(state, "glDeleteProgram");
-	glDeleteShader = (gl_delete_shader_func *)fgl__GetOpenGLProcAddress(state, "glDeleteShader");
-	glDetachShader = (gl_detach_shader_func *)fgl__GetOpenGLProcAddress(state, "glDetachShader");
-	glDisableVertexAttribArray = (gl_disable_vertex_attrib_array_func *)fgl__GetOpenGLProcAddress(state, "glDisableVertexAttribArray");
-	glEnableVertexAttribArray = (gl_enable_vertex_attrib_array_func *)fgl__GetOpenGLProcAddress(state, "glEnableVertexAttribArray");
-	glGetActiveAttrib = (gl_get_active_attrib_func *)fgl__GetOpenGLProcAddress(state, "glGetActiveAttrib");
-	glGetActiveUniform = (gl_get_active_uniform_func *)fgl__GetOpenGLProcAddress(state, "glGetActiveUniform");
-	glGetAttachedShaders = (gl_get_attached_shaders_func *)fgl__GetOpenGLProcAddress(state, "glGetAttachedShaders");
-	glGetAttribLocation = (gl_get_attrib_location_func *)fgl__GetOpenGLProcAddress(state, "glGetAttribLocation");
-	glGetProgramiv = (gl_get_programiv_func *)fgl__GetOpenGLProcAddress(state, "glGetProgramiv");
-	glGetProgramInfoLog = (gl_get_program_info_log_func *)fgl__GetOpenGLProcAddress(state, "glGetProgramInfoLog");
-	glGetShaderiv = (gl_get_shaderiv_func *)fgl__GetOpenGLProcAddress(state, "glGetShaderiv");
-	glGetShaderInfoLog = (gl_get_shader_info_log_func *)fgl__GetOpenGLProcAddress(state, "glGetShaderInfoLog");
-	glGetShaderSource = (gl_get_shader_source_func *)fgl__GetOpenGLProcAddress(state, "glGetShaderSource");
-	glGetUniformLocation = (gl_get_uniform_location_func *)fgl__GetOpenGLProcAddress(state, "glGetUniformLocation");
-	glGetUniformfv = (gl_get_uniformfv_func *)fgl__GetOpenGLProcAddress(state, "glGetUniformfv");
-	glGetUniformiv = (gl_get_uniformiv_func *)fgl__GetOpenGLProcAddress(state, "glGetUniformiv");
-	glGetVertexAttribdv = (gl_get_vertex_attribdv_func *)fgl__GetOpenGLProcAddress(state, "glGetVertexAttribdv");
-	glGetVertexAttribfv = (gl_get_vertex_attribfv_func *)fgl__GetOpenGLProcAddress(state, "glGetVertexAttribfv");
-	glGetVertexAttribiv = (gl_get_vertex_attribiv_func *)fgl__GetOpenGLProcAddress(state, "glGetVertexAttribiv");
-	glGetVertexAttribPointerv = (gl_get_vertex_attrib_pointerv_func *)fgl__GetOpenGLProcAddress(state, "glGetVertexAttribPointerv");
-	glIsProgram = (gl_is_program_func *)fgl__GetOpenGLProcAddress(state, "glIsProgram");
-	glIsShader = (gl_is_shader_func *)fgl__GetOpenGLProcAddress(state, "glIsShader");
-	glLinkProgram = (gl_link_program_func *)fgl__GetOpenGLProcAddress(state, "glLinkProgram");
-	glShaderSource = (gl_shader_source_func *)fgl__GetOpenGLProcAddress(state, "glShaderSource");
-	glUseProgram = (gl_use_program_func *)fgl__GetOpenGLProcAddress(state, "glUseProgram");
-	glUniform1f = (gl_uniform1f_func *)fgl__GetOpenGLProcAddress(state, "glUniform1f");
-	glUniform2f = (gl_uniform2f_func *)fgl__GetOpenGLProcAddress(state, "glUniform2f");
-	glUniform3f = (gl_uniform3f_func *)fgl__GetOpenGLProcAddress(state, "glUniform3f");
-	glUniform4f = (gl_uniform4f_func *)fgl__GetOpenGLProcAddress(state, "glUniform4f");
-	glUniform1i = (gl_uniform1i_func *)fgl__GetOpenGLProcAddress(state, "glUniform1i");
-	glUniform2i = (gl_uniform2i_func *)fgl__GetOpenGLProcAddress(state, "glUniform2i");
-	glUniform3i = (gl_uniform3i_func *)fgl__GetOpenGLProcAddress(state, "glUniform3i");
-	glUniform4i = (gl_uniform4i_func *)fgl__GetOpenGLProcAddress(state, "glUniform4i");
-	glUniform1fv = (gl_uniform1fv_func *)fgl__GetOpenGLProcAddress(state, "glUniform1fv");
-	glUniform2fv = (gl_uniform2fv_func *)fgl__GetOpenGLProcAddress(state, "glUniform2fv");
-	glUniform3fv = (gl_uniform3fv_func *)fgl__GetOpenGLProcAddress(state, "glUniform3fv");
-	glUniform4fv = (gl_uniform4fv_func *)fgl__GetOpenGLProcAddress(state, "glUniform4fv");
-	glUniform1iv = (gl_uniform1iv_func *)fgl__GetOpenGLProcAddress(state, "glUniform1iv");
-	glUniform2iv = (gl_uniform2iv_func *)fgl__GetOpenGLProcAddress(state, "glUniform2iv");
-	glUniform3iv = (gl_uniform3iv_func *)fgl__GetOpenGLProcAddress(state, "glUniform3iv");
-	glUniform4iv = (gl_uniform4iv_func *)fgl__GetOpenGLProcAddress(state, "glUniform4iv");
-	glUniformMatrix2fv = (gl_uniform_matrix2fv_func *)fgl__GetOpenGLProcAddress(state, "glUniformMatrix2fv");
-	glUniformMatrix3fv = (gl_uniform_matrix3fv_func *)fgl__GetOpenGLProcAddress(state, "glUniformMatrix3fv");
-	glUniformMatrix4fv = (gl_uniform_matrix4fv_func *)fgl__GetOpenGLProcAddress(state, "glUniformMatrix4fv");
-	glValidateProgram = (gl_validate_program_func *)fgl__GetOpenGLProcAddress(state, "glValidateProgram");
-	glVertexAttrib1d = (gl_vertex_attrib1d_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib1d");
-	glVertexAttrib1dv = (gl_vertex_attrib1dv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib1dv");
-	glVertexAttrib1f = (gl_vertex_attrib1f_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib1f");
-	glVertexAttrib1fv = (gl_vertex_attrib1fv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib1fv");
-	glVertexAttrib1s = (gl_vertex_attrib1s_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib1s");
-	glVertexAttrib1sv = (gl_vertex_attrib1sv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib1sv");
-	glVertexAttrib2d = (gl_vertex_attrib2d_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib2d");
-	glVertexAttrib2dv = (gl_vertex_attrib2dv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib2dv");
-	glVertexAttrib2f = (gl_vertex_attrib2f_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib2f");
-	glVertexAttrib2fv = (gl_vertex_attrib2fv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib2fv");
-	glVertexAttrib2s = (gl_vertex_attrib2s_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib2s");
-	glVertexAttrib2sv = (gl_vertex_attrib2sv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib2sv");
-	glVertexAttrib3d = (gl_vertex_attrib3d_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib3d");
-	glVertexAttrib3dv = (gl_vertex_attrib3dv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib3dv");
-	glVertexAttrib3f = (gl_vertex_attrib3f_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib3f");
-	glVertexAttrib3fv = (gl_vertex_attrib3fv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib3fv");
-	glVertexAttrib3s = (gl_vertex_attrib3s_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib3s");
-	glVertexAttrib3sv = (gl_vertex_attrib3sv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib3sv");
-	glVertexAttrib4Nbv = (gl_vertex_attrib4_nbv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib4Nbv");
-	glVertexAttrib4Niv = (gl_vertex_attrib4_niv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib4Niv");
-	glVertexAttrib4Nsv = (gl_vertex_attrib4_nsv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib4Nsv");
-	glVertexAttrib4Nub = (gl_vertex_attrib4_nub_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib4Nub");
-	glVertexAttrib4Nubv = (gl_vertex_attrib4_nubv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib4Nubv");
-	glVertexAttrib4Nuiv = (gl_vertex_attrib4_nuiv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib4Nuiv");
-	glVertexAttrib4Nusv = (gl_vertex_attrib4_nusv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib4Nusv");
-	glVertexAttrib4bv = (gl_vertex_attrib4bv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib4bv");
-	glVertexAttrib4d = (gl_vertex_attrib4d_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib4d");
-	glVertexAttrib4dv = (gl_vertex_attrib4dv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib4dv");
-	glVertexAttrib4f = (gl_vertex_attrib4f_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib4f");
-	glVertexAttrib4fv = (gl_vertex_attrib4fv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib4fv");
-	glVertexAttrib4iv = (gl_vertex_attrib4iv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib4iv");
-	glVertexAttrib4s = (gl_vertex_attrib4s_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib4s");
-	glVertexAttrib4sv = (gl_vertex_attrib4sv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib4sv");
-	glVertexAttrib4ubv = (gl_vertex_attrib4ubv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib4ubv");
-	glVertexAttrib4uiv = (gl_vertex_attrib4uiv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib4uiv");
-	glVertexAttrib4usv = (gl_vertex_attrib4usv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttrib4usv");
-	glVertexAttribPointer = (gl_vertex_attrib_pointer_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribPointer");
+	fgl__BeginOpenGLVersion(state, 20);
+	glBlendEquationSeparate = (gl_blend_equation_separate_func *)fgl__ResolveOpenGLProc(state, "glBlendEquationSeparate");
+	glDrawBuffers = (gl_draw_buffers_func *)fgl__ResolveOpenGLProc(state, "glDrawBuffers");
+	glStencilOpSeparate = (gl_stencil_op_separate_func *)fgl__ResolveOpenGLProc(state, "glStencilOpSeparate");
+	glStencilFuncSeparate = (gl_stencil_func_separate_func *)fgl__ResolveOpenGLProc(state, "glStencilFuncSeparate");
+	glStencilMaskSeparate = (gl_stencil_mask_separate_func *)fgl__ResolveOpenGLProc(state, "glStencilMaskSeparate");
+	glAttachShader = (gl_attach_shader_func *)fgl__ResolveOpenGLProc(state, "glAttachShader");
+	glBindAttribLocation = (gl_bind_attrib_location_func *)fgl__ResolveOpenGLProc(state, "glBindAttribLocation");
+	glCompileShader = (gl_compile_shader_func *)fgl__ResolveOpenGLProc(state, "glCompileShader");
+	glCreateProgram = (gl_create_program_func *)fgl__ResolveOpenGLProc(state, "glCreateProgram");
+	glCreateShader = (gl_create_shader_func *)fgl__ResolveOpenGLProc(state, "glCreateShader");
+	glDeleteProgram = (gl_delete_program_func *)fgl__ResolveOpenGLProc(state, "glDeleteProgram");
+	glDeleteShader = (gl_delete_shader_func *)fgl__ResolveOpenGLProc(state, "glDeleteShader");
+	glDetachShader = (gl_detach_shader_func *)fgl__ResolveOpenGLProc(state, "glDetachShader");
+	glDisableVertexAttribArray = (gl_disable_vertex_attrib_array_func *)fgl__ResolveOpenGLProc(state, "glDisableVertexAttribArray");
+	glEnableVertexAttribArray = (gl_enable_vertex_attrib_array_func *)fgl__ResolveOpenGLProc(state, "glEnableVertexAttribArray");
+	glGetActiveAttrib = (gl_get_active_attrib_func *)fgl__ResolveOpenGLProc(state, "glGetActiveAttrib");
+	glGetActiveUniform = (gl_get_active_uniform_func *)fgl__ResolveOpenGLProc(state, "glGetActiveUniform");
+	glGetAttachedShaders = (gl_get_attached_shaders_func *)fgl__ResolveOpenGLProc(state, "glGetAttachedShaders");
+	glGetAttribLocation = (gl_get_attrib_location_func *)fgl__ResolveOpenGLProc(state, "glGetAttribLocation");
+	glGetProgramiv = (gl_get_programiv_func *)fgl__ResolveOpenGLProc(state, "glGetProgramiv");
+	glGetProgramInfoLog = (gl_get_program_info_log_func *)fgl__ResolveOpenGLProc(state, "glGetProgramInfoLog");
+	glGetShaderiv = (gl_get_shaderiv_func *)fgl__ResolveOpenGLProc(state, "glGetShaderiv");
+	glGetShaderInfoLog = (gl_get_shader_info_log_func *)fgl__ResolveOpenGLProc(state, "glGetShaderInfoLog");
+	glGetShaderSource = (gl_get_shader_source_func *)fgl__ResolveOpenGLProc(state, "glGetShaderSource");
+	glGetUniformLocation = (gl_get_uniform_location_func *)fgl__ResolveOpenGLProc(state, "glGetUniformLocation");
+	glGetUniformfv = (gl_get_uniformfv_func *)fgl__ResolveOpenGLProc(state, "glGetUniformfv");
+	glGetUniformiv = (gl_get_uniformiv_func *)fgl__ResolveOpenGLProc(state, "glGetUniformiv");
+	glGetVertexAttribdv = (gl_get_vertex_attribdv_func *)fgl__ResolveOpenGLProc(state, "glGetVertexAttribdv");
+	glGetVertexAttribfv = (gl_get_vertex_attribfv_func *)fgl__ResolveOpenGLProc(state, "glGetVertexAttribfv");
+	glGetVertexAttribiv = (gl_get_vertex_attribiv_func *)fgl__ResolveOpenGLProc(state, "glGetVertexAttribiv");
+	glGetVertexAttribPointerv = (gl_get_vertex_attrib_pointerv_func *)fgl__ResolveOpenGLProc(state, "glGetVertexAttribPointerv");
+	glIsProgram = (gl_is_program_func *)fgl__ResolveOpenGLProc(state, "glIsProgram");
+	glIsShader = (gl_is_shader_func *)fgl__ResolveOpenGLProc(state, "glIsShader");
+	glLinkProgram = (gl_link_program_func *)fgl__ResolveOpenGLProc(state, "glLinkProgram");
+	glShaderSource = (gl_shader_source_func *)fgl__ResolveOpenGLProc(state, "glShaderSource");
+	glUseProgram = (gl_use_program_func *)fgl__ResolveOpenGLProc(state, "glUseProgram");
+	glUniform1f = (gl_uniform1f_func *)fgl__ResolveOpenGLProc(state, "glUniform1f");
+	glUniform2f = (gl_uniform2f_func *)fgl__ResolveOpenGLProc(state, "glUniform2f");
+	glUniform3f = (gl_uniform3f_func *)fgl__ResolveOpenGLProc(state, "glUniform3f");
+	glUniform4f = (gl_uniform4f_func *)fgl__ResolveOpenGLProc(state, "glUniform4f");
+	glUniform1i = (gl_uniform1i_func *)fgl__ResolveOpenGLProc(state, "glUniform1i");
+	glUniform2i = (gl_uniform2i_func *)fgl__ResolveOpenGLProc(state, "glUniform2i");
+	glUniform3i = (gl_uniform3i_func *)fgl__ResolveOpenGLProc(state, "glUniform3i");
+	glUniform4i = (gl_uniform4i_func *)fgl__ResolveOpenGLProc(state, "glUniform4i");
+	glUniform1fv = (gl_uniform1fv_func *)fgl__ResolveOpenGLProc(state, "glUniform1fv");
+	glUniform2fv = (gl_uniform2fv_func *)fgl__ResolveOpenGLProc(state, "glUniform2fv");
+	glUniform3fv = (gl_uniform3fv_func *)fgl__ResolveOpenGLProc(state, "glUniform3fv");
+	glUniform4fv = (gl_uniform4fv_func *)fgl__ResolveOpenGLProc(state, "glUniform4fv");
+	glUniform1iv = (gl_uniform1iv_func *)fgl__ResolveOpenGLProc(state, "glUniform1iv");
+	glUniform2iv = (gl_uniform2iv_func *)fgl__ResolveOpenGLProc(state, "glUniform2iv");
+	glUniform3iv = (gl_uniform3iv_func *)fgl__ResolveOpenGLProc(state, "glUniform3iv");
+	glUniform4iv = (gl_uniform4iv_func *)fgl__ResolveOpenGLProc(state, "glUniform4iv");
+	glUniformMatrix2fv = (gl_uniform_matrix2fv_func *)fgl__ResolveOpenGLProc(state, "glUniformMatrix2fv");
+	glUniformMatrix3fv = (gl_uniform_matrix3fv_func *)fgl__ResolveOpenGLProc(state, "glUniformMatrix3fv");
+	glUniformMatrix4fv = (gl_uniform_matrix4fv_func *)fgl__ResolveOpenGLProc(state, "glUniformMatrix4fv");
+	glValidateProgram = (gl_validate_program_func *)fgl__ResolveOpenGLProc(state, "glValidateProgram");
+	glVertexAttrib1d = (gl_vertex_attrib1d_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib1d");
+	glVertexAttrib1dv = (gl_vertex_attrib1dv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib1dv");
+	glVertexAttrib1f = (gl_vertex_attrib1f_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib1f");
+	glVertexAttrib1fv = (gl_vertex_attrib1fv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib1fv");
+	glVertexAttrib1s = (gl_vertex_attrib1s_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib1s");
+	glVertexAttrib1sv = (gl_vertex_attrib1sv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib1sv");
+	glVertexAttrib2d = (gl_vertex_attrib2d_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib2d");
+	glVertexAttrib2dv = (gl_vertex_attrib2dv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib2dv");
+	glVertexAttrib2f = (gl_vertex_attrib2f_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib2f");
+	glVertexAttrib2fv = (gl_vertex_attrib2fv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib2fv");
+	glVertexAttrib2s = (gl_vertex_attrib2s_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib2s");
+	glVertexAttrib2sv = (gl_vertex_attrib2sv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib2sv");
+	glVertexAttrib3d = (gl_vertex_attrib3d_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib3d");
+	glVertexAttrib3dv = (gl_vertex_attrib3dv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib3dv");
+	glVertexAttrib3f = (gl_vertex_attrib3f_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib3f");
+	glVertexAttrib3fv = (gl_vertex_attrib3fv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib3fv");
+	glVertexAttrib3s = (gl_vertex_attrib3s_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib3s");
+	glVertexAttrib3sv = (gl_vertex_attrib3sv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib3sv");
+	glVertexAttrib4Nbv = (gl_vertex_attrib4_nbv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib4Nbv");
+	glVertexAttrib4Niv = (gl_vertex_attrib4_niv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib4Niv");
+	glVertexAttrib4Nsv = (gl_vertex_attrib4_nsv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib4Nsv");
+	glVertexAttrib4Nub = (gl_vertex_attrib4_nub_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib4Nub");
+	glVertexAttrib4Nubv = (gl_vertex_attrib4_nubv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib4Nubv");
+	glVertexAttrib4Nuiv = (gl_vertex_attrib4_nuiv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib4Nuiv");
+	glVertexAttrib4Nusv = (gl_vertex_attrib4_nusv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib4Nusv");
+	glVertexAttrib4bv = (gl_vertex_attrib4bv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib4bv");
+	glVertexAttrib4d = (gl_vertex_attrib4d_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib4d");
+	glVertexAttrib4dv = (gl_vertex_attrib4dv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib4dv");
+	glVertexAttrib4f = (gl_vertex_attrib4f_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib4f");
+	glVertexAttrib4fv = (gl_vertex_attrib4fv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib4fv");
+	glVertexAttrib4iv = (gl_vertex_attrib4iv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib4iv");
+	glVertexAttrib4s = (gl_vertex_attrib4s_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib4s");
+	glVertexAttrib4sv = (gl_vertex_attrib4sv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib4sv");
+	glVertexAttrib4ubv = (gl_vertex_attrib4ubv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib4ubv");
+	glVertexAttrib4uiv = (gl_vertex_attrib4uiv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib4uiv");
+	glVertexAttrib4usv = (gl_vertex_attrib4usv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttrib4usv");
+	glVertexAttribPointer = (gl_vertex_attrib_pointer_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribPointer");
+	isGL_VERSION_2_0 = fgl__EndOpenGLVersion(state);
 #	endif //GL_VERSION_2_0
 
 #	if GL_VERSION_2_1
-	glUniformMatrix2x3fv = (gl_uniform_matrix2x3fv_func *)fgl__GetOpenGLProcAddress(state, "glUniformMatrix2x3fv");
-	glUniformMatrix3x2fv = (gl_uniform_matrix3x2fv_func *)fgl__GetOpenGLProcAddress(state, "glUniformMatrix3x2fv");
-	glUniformMatrix2x4fv = (gl_uniform_matrix2x4fv_func *)fgl__GetOpenGLProcAddress(state, "glUniformMatrix2x4fv");
-	glUniformMatrix4x2fv = (gl_uniform_matrix4x2fv_func *)fgl__GetOpenGLProcAddress(state, "glUniformMatrix4x2fv");
-	glUniformMatrix3x4fv = (gl_uniform_matrix3x4fv_func *)fgl__GetOpenGLProcAddress(state, "glUniformMatrix3x4fv");
-	glUniformMatrix4x3fv = (gl_uniform_matrix4x3fv_func *)fgl__GetOpenGLProcAddress(state, "glUniformMatrix4x3fv");
+	fgl__BeginOpenGLVersion(state, 21);
+	glUniformMatrix2x3fv = (gl_uniform_matrix2x3fv_func *)fgl__ResolveOpenGLProc(state, "glUniformMatrix2x3fv");
+	glUniformMatrix3x2fv = (gl_uniform_matrix3x2fv_func *)fgl__ResolveOpenGLProc(state, "glUniformMatrix3x2fv");
+	glUniformMatrix2x4fv = (gl_uniform_matrix2x4fv_func *)fgl__ResolveOpenGLProc(state, "glUniformMatrix2x4fv");
+	glUniformMatrix4x2fv = (gl_uniform_matrix4x2fv_func *)fgl__ResolveOpenGLProc(state, "glUniformMatrix4x2fv");
+	glUniformMatrix3x4fv = (gl_uniform_matrix3x4fv_func *)fgl__ResolveOpenGLProc(state, "glUniformMatrix3x4fv");
+	glUniformMatrix4x3fv = (gl_uniform_matrix4x3fv_func *)fgl__ResolveOpenGLProc(state, "glUniformMatrix4x3fv");
+	isGL_VERSION_2_1 = fgl__EndOpenGLVersion(state);
 #	endif //GL_VERSION_2_1
 
 #	if GL_VERSION_3_0
-	glColorMaski = (gl_color_maski_func *)fgl__GetOpenGLProcAddress(state, "glColorMaski");
-	glGetBooleani_v = (gl_get_booleani_v_func *)fgl__GetOpenGLProcAddress(state, "glGetBooleani_v");
-	glGetIntegeri_v = (gl_get_integeri_v_func *)fgl__GetOpenGLProcAddress(state, "glGetIntegeri_v");
-	glEnablei = (gl_enablei_func *)fgl__GetOpenGLProcAddress(state, "glEnablei");
-	glDisablei = (gl_disablei_func *)fgl__GetOpenGLProcAddress(state, "glDisablei");
-	glIsEnabledi = (gl_is_enabledi_func *)fgl__GetOpenGLProcAddress(state, "glIsEnabledi");
-	glBeginTransformFeedback = (gl_begin_transform_feedback_func *)fgl__GetOpenGLProcAddress(state, "glBeginTransformFeedback");
-	glEndTransformFeedback = (gl_end_transform_feedback_func *)fgl__GetOpenGLProcAddress(state, "glEndTransformFeedback");
-	glBindBufferRange = (gl_bind_buffer_range_func *)fgl__GetOpenGLProcAddress(state, "glBindBufferRange");
-	glBindBufferBase = (gl_bind_buffer_base_func *)fgl__GetOpenGLProcAddress(state, "glBindBufferBase");
-	glTransformFeedbackVaryings = (gl_transform_feedback_varyings_func *)fgl__GetOpenGLProcAddress(state, "glTransformFeedbackVaryings");
-	glGetTransformFeedbackVarying = (gl_get_transform_feedback_varying_func *)fgl__GetOpenGLProcAddress(state, "glGetTransformFeedbackVarying");
-	glClampColor = (gl_clamp_color_func *)fgl__GetOpenGLProcAddress(state, "glClampColor");
-	glBeginConditionalRender = (gl_begin_conditional_render_func *)fgl__GetOpenGLProcAddress(state, "glBeginConditionalRender");
-	glEndConditionalRender = (gl_end_conditional_render_func *)fgl__GetOpenGLProcAddress(state, "glEndConditionalRender");
-	glVertexAttribIPointer = (gl_vertex_attrib_i_pointer_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribIPointer");
-	glGetVertexAttribIiv = (gl_get_vertex_attrib_iiv_func *)fgl__GetOpenGLProcAddress(state, "glGetVertexAttribIiv");
-	glGetVertexAttribIuiv = (gl_get_vertex_attrib_iuiv_func *)fgl__GetOpenGLProcAddress(state, "glGetVertexAttribIuiv");
-	glVertexAttribI1i = (gl_vertex_attrib_i1i_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI1i");
-	glVertexAttribI2i = (gl_vertex_attrib_i2i_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI2i");
-	glVertexAttribI3i = (gl_vertex_attrib_i3i_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI3i");
-	glVertexAttribI4i = (gl_vertex_attrib_i4i_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI4i");
-	glVertexAttribI1ui = (gl_vertex_attrib_i1ui_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI1ui");
-	glVertexAttribI2ui = (gl_vertex_attrib_i2ui_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI2ui");
-	glVertexAttribI3ui = (gl_vertex_attrib_i3ui_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI3ui");
-	glVertexAttribI4ui = (gl_vertex_attrib_i4ui_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI4ui");
-	glVertexAttribI1iv = (gl_vertex_attrib_i1iv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI1iv");
-	glVertexAttribI2iv = (gl_vertex_attrib_i2iv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI2iv");
-	glVertexAttribI3iv = (gl_vertex_attrib_i3iv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI3iv");
-	glVertexAttribI4iv = (gl_vertex_attrib_i4iv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI4iv");
-	glVertexAttribI1uiv = (gl_vertex_attrib_i1uiv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI1uiv");
-	glVertexAttribI2uiv = (gl_vertex_attrib_i2uiv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI2uiv");
-	glVertexAttribI3uiv = (gl_vertex_attrib_i3uiv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI3uiv");
-	glVertexAttribI4uiv = (gl_vertex_attrib_i4uiv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI4uiv");
-	glVertexAttribI4bv = (gl_vertex_attrib_i4bv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI4bv");
-	glVertexAttribI4sv = (gl_vertex_attrib_i4sv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI4sv");
-	glVertexAttribI4ubv = (gl_vertex_attrib_i4ubv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI4ubv");
-	glVertexAttribI4usv = (gl_vertex_attrib_i4usv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribI4usv");
-	glGetUniformuiv = (gl_get_uniformuiv_func *)fgl__GetOpenGLProcAddress(state, "glGetUniformuiv");
-	glBindFragDataLocation = (gl_bind_frag_data_location_func *)fgl__GetOpenGLProcAddress(state, "glBindFragDataLocation");
-	glGetFragDataLocation = (gl_get_frag_data_location_func *)fgl__GetOpenGLProcAddress(state, "glGetFragDataLocation");
-	glUniform1ui = (gl_uniform1ui_func *)fgl__GetOpenGLProcAddress(state, "glUniform1ui");
-	glUniform2ui = (gl_uniform2ui_func *)fgl__GetOpenGLProcAddress(state, "glUniform2ui");
-	glUniform3ui = (gl_uniform3ui_func *)fgl__GetOpenGLProcAddress(state, "glUniform3ui");
-	glUniform4ui = (gl_uniform4ui_func *)fgl__GetOpenGLProcAddress(state, "glUniform4ui");
-	glUniform1uiv = (gl_uniform1uiv_func *)fgl__GetOpenGLProcAddress(state, "glUniform1uiv");
-	glUniform2uiv = (gl_uniform2uiv_func *)fgl__GetOpenGLProcAddress(state, "glUniform2uiv");
-	glUniform3uiv = (gl_uniform3uiv_func *)fgl__GetOpenGLProcAddress(state, "glUniform3uiv");
-	glUniform4uiv = (gl_uniform4uiv_func *)fgl__GetOpenGLProcAddress(state, "glUniform4uiv");
-	glTexParameterIiv = (gl_tex_parameter_iiv_func *)fgl__GetOpenGLProcAddress(state, "glTexParameterIiv");
-	glTexParameterIuiv = (gl_tex_parameter_iuiv_func *)fgl__GetOpenGLProcAddress(state, "glTexParameterIuiv");
-	glGetTexParameterIiv = (gl_get_tex_parameter_iiv_func *)fgl__GetOpenGLProcAddress(state, "glGetTexParameterIiv");
-	glGetTexParameterIuiv = (gl_get_tex_parameter_iuiv_func *)fgl__GetOpenGLProcAddress(state, "glGetTexParameterIuiv");
-	glClearBufferiv = (gl_clear_bufferiv_func *)fgl__GetOpenGLProcAddress(state, "glClearBufferiv");
-	glClearBufferuiv = (gl_clear_bufferuiv_func *)fgl__GetOpenGLProcAddress(state, "glClearBufferuiv");
-	glClearBufferfv = (gl_clear_bufferfv_func *)fgl__GetOpenGLProcAddress(state, "glClearBufferfv");
-	glClearBufferfi = (gl_clear_bufferfi_func *)fgl__GetOpenGLProcAddress(state, "glClearBufferfi");
-	glGetStringi = (gl_get_stringi_func *)fgl__GetOpenGLProcAddress(state, "glGetStringi");
-	glIsRenderbuffer = (gl_is_renderbuffer_func *)fgl__GetOpenGLProcAddress(state, "glIsRenderbuffer");
-	glBindRenderbuffer = (gl_bind_renderbuffer_func *)fgl__GetOpenGLProcAddress(state, "glBindRenderbuffer");
-	glDeleteRenderbuffers = (gl_delete_renderbuffers_func *)fgl__GetOpenGLProcAddress(state, "glDeleteRenderbuffers");
-	glGenRenderbuffers = (gl_gen_renderbuffers_func *)fgl__GetOpenGLProcAddress(state, "glGenRenderbuffers");
-	glRenderbufferStorage = (gl_renderbuffer_storage_func *)fgl__GetOpenGLProcAddress(state, "glRenderbufferStorage");
-	glGetRenderbufferParameteriv = (gl_get_renderbuffer_parameteriv_func *)fgl__GetOpenGLProcAddress(state, "glGetRenderbufferParameteriv");
-	glIsFramebuffer = (gl_is_framebuffer_func *)fgl__GetOpenGLProcAddress(state, "glIsFramebuffer");
-	glBindFramebuffer = (gl_bind_framebuffer_func *)fgl__GetOpenGLProcAddress(state, "glBindFramebuffer");
-	glDeleteFramebuffers = (gl_delete_framebuffers_func *)fgl__GetOpenGLProcAddress(state, "glDeleteFramebuffers");
-	glGenFramebuffers = (gl_gen_framebuffers_func *)fgl__GetOpenGLProcAddress(state, "glGenFramebuffers");
-	glCheckFramebufferStatus = (gl_check_framebuffer_status_func *)fgl__GetOpenGLProcAddress(state, "glCheckFramebufferStatus");
-	glFramebufferTexture1D = (gl_framebuffer_texture1d_func *)fgl__GetOpenGLProcAddress(state, "glFramebufferTexture1D");
-	glFramebufferTexture2D = (gl_framebuffer_texture2d_func *)fgl__GetOpenGLProcAddress(state, "glFramebufferTexture2D");
-	glFramebufferTexture3D = (gl_framebuffer_texture3d_func *)fgl__GetOpenGLProcAddress(state, "glFramebufferTexture3D");
-	glFramebufferRenderbuffer = (gl_framebuffer_renderbuffer_func *)fgl__GetOpenGLProcAddress(state, "glFramebufferRenderbuffer");
-	glGetFramebufferAttachmentParameteriv = (gl_get_framebuffer_attachment_parameteriv_func *)fgl__GetOpenGLProcAddress(state, "glGetFramebufferAttachmentParameteriv");
-	glGenerateMipmap = (gl_generate_mipmap_func *)fgl__GetOpenGLProcAddress(state, "glGenerateMipmap");
-	glBlitFramebuffer = (gl_blit_framebuffer_func *)fgl__GetOpenGLProcAddress(state, "glBlitFramebuffer");
-	glRenderbufferStorageMultisample = (gl_renderbuffer_storage_multisample_func *)fgl__GetOpenGLProcAddress(state, "glRenderbufferStorageMultisample");
-	glFramebufferTextureLayer = (gl_framebuffer_texture_layer_func *)fgl__GetOpenGLProcAddress(state, "glFramebufferTextureLayer");
-	glMapBufferRange = (gl_map_buffer_range_func *)fgl__GetOpenGLProcAddress(state, "glMapBufferRange");
-	glFlushMappedBufferRange = (gl_flush_mapped_buffer_range_func *)fgl__GetOpenGLProcAddress(state, "glFlushMappedBufferRange");
-	glBindVertexArray = (gl_bind_vertex_array_func *)fgl__GetOpenGLProcAddress(state, "glBindVertexArray");
-	glDeleteVertexArrays = (gl_delete_vertex_arrays_func *)fgl__GetOpenGLProcAddress(state, "glDeleteVertexArrays");
-	glGenVertexArrays = (gl_gen_vertex_arrays_func *)fgl__GetOpenGLProcAddress(state, "glGenVertexArrays");
-	glIsVertexArray = (gl_is_vertex_array_func *)fgl__GetOpenGLProcAddress(state, "glIsVertexArray");
+	fgl__BeginOpenGLVersion(state, 30);
+	glColorMaski = (gl_color_maski_func *)fgl__ResolveOpenGLProc(state, "glColorMaski");
+	glGetBooleani_v = (gl_get_booleani_v_func *)fgl__ResolveOpenGLProc(state, "glGetBooleani_v");
+	glGetIntegeri_v = (gl_get_integeri_v_func *)fgl__ResolveOpenGLProc(state, "glGetIntegeri_v");
+	glEnablei = (gl_enablei_func *)fgl__ResolveOpenGLProc(state, "glEnablei");
+	glDisablei = (gl_disablei_func *)fgl__ResolveOpenGLProc(state, "glDisablei");
+	glIsEnabledi = (gl_is_enabledi_func *)fgl__ResolveOpenGLProc(state, "glIsEnabledi");
+	glBeginTransformFeedback = (gl_begin_transform_feedback_func *)fgl__ResolveOpenGLProc(state, "glBeginTransformFeedback");
+	glEndTransformFeedback = (gl_end_transform_feedback_func *)fgl__ResolveOpenGLProc(state, "glEndTransformFeedback");
+	glBindBufferRange = (gl_bind_buffer_range_func *)fgl__ResolveOpenGLProc(state, "glBindBufferRange");
+	glBindBufferBase = (gl_bind_buffer_base_func *)fgl__ResolveOpenGLProc(state, "glBindBufferBase");
+	glTransformFeedbackVaryings = (gl_transform_feedback_varyings_func *)fgl__ResolveOpenGLProc(state, "glTransformFeedbackVaryings");
+	glGetTransformFeedbackVarying = (gl_get_transform_feedback_varying_func *)fgl__ResolveOpenGLProc(state, "glGetTransformFeedbackVarying");
+	glClampColor = (gl_clamp_color_func *)fgl__ResolveOpenGLProc(state, "glClampColor");
+	glBeginConditionalRender = (gl_begin_conditional_render_func *)fgl__ResolveOpenGLProc(state, "glBeginConditionalRender");
+	glEndConditionalRender = (gl_end_conditional_render_func *)fgl__ResolveOpenGLProc(state, "glEndConditionalRender");
+	glVertexAttribIPointer = (gl_vertex_attrib_i_pointer_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribIPointer");
+	glGetVertexAttribIiv = (gl_get_vertex_attrib_iiv_func *)fgl__ResolveOpenGLProc(state, "glGetVertexAttribIiv");
+	glGetVertexAttribIuiv = (gl_get_vertex_attrib_iuiv_func *)fgl__ResolveOpenGLProc(state, "glGetVertexAttribIuiv");
+	glVertexAttribI1i = (gl_vertex_attrib_i1i_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI1i");
+	glVertexAttribI2i = (gl_vertex_attrib_i2i_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI2i");
+	glVertexAttribI3i = (gl_vertex_attrib_i3i_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI3i");
+	glVertexAttribI4i = (gl_vertex_attrib_i4i_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI4i");
+	glVertexAttribI1ui = (gl_vertex_attrib_i1ui_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI1ui");
+	glVertexAttribI2ui = (gl_vertex_attrib_i2ui_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI2ui");
+	glVertexAttribI3ui = (gl_vertex_attrib_i3ui_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI3ui");
+	glVertexAttribI4ui = (gl_vertex_attrib_i4ui_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI4ui");
+	glVertexAttribI1iv = (gl_vertex_attrib_i1iv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI1iv");
+	glVertexAttribI2iv = (gl_vertex_attrib_i2iv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI2iv");
+	glVertexAttribI3iv = (gl_vertex_attrib_i3iv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI3iv");
+	glVertexAttribI4iv = (gl_vertex_attrib_i4iv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI4iv");
+	glVertexAttribI1uiv = (gl_vertex_attrib_i1uiv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI1uiv");
+	glVertexAttribI2uiv = (gl_vertex_attrib_i2uiv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI2uiv");
+	glVertexAttribI3uiv = (gl_vertex_attrib_i3uiv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI3uiv");
+	glVertexAttribI4uiv = (gl_vertex_attrib_i4uiv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI4uiv");
+	glVertexAttribI4bv = (gl_vertex_attrib_i4bv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI4bv");
+	glVertexAttribI4sv = (gl_vertex_attrib_i4sv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI4sv");
+	glVertexAttribI4ubv = (gl_vertex_attrib_i4ubv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI4ubv");
+	glVertexAttribI4usv = (gl_vertex_attrib_i4usv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribI4usv");
+	glGetUniformuiv = (gl_get_uniformuiv_func *)fgl__ResolveOpenGLProc(state, "glGetUniformuiv");
+	glBindFragDataLocation = (gl_bind_frag_data_location_func *)fgl__ResolveOpenGLProc(state, "glBindFragDataLocation");
+	glGetFragDataLocation = (gl_get_frag_data_location_func *)fgl__ResolveOpenGLProc(state, "glGetFragDataLocation");
+	glUniform1ui = (gl_uniform1ui_func *)fgl__ResolveOpenGLProc(state, "glUniform1ui");
+	glUniform2ui = (gl_uniform2ui_func *)fgl__ResolveOpenGLProc(state, "glUniform2ui");
+	glUniform3ui = (gl_uniform3ui_func *)fgl__ResolveOpenGLProc(state, "glUniform3ui");
+	glUniform4ui = (gl_uniform4ui_func *)fgl__ResolveOpenGLProc(state, "glUniform4ui");
+	glUniform1uiv = (gl_uniform1uiv_func *)fgl__ResolveOpenGLProc(state, "glUniform1uiv");
+	glUniform2uiv = (gl_uniform2uiv_func *)fgl__ResolveOpenGLProc(state, "glUniform2uiv");
+	glUniform3uiv = (gl_uniform3uiv_func *)fgl__ResolveOpenGLProc(state, "glUniform3uiv");
+	glUniform4uiv = (gl_uniform4uiv_func *)fgl__ResolveOpenGLProc(state, "glUniform4uiv");
+	glTexParameterIiv = (gl_tex_parameter_iiv_func *)fgl__ResolveOpenGLProc(state, "glTexParameterIiv");
+	glTexParameterIuiv = (gl_tex_parameter_iuiv_func *)fgl__ResolveOpenGLProc(state, "glTexParameterIuiv");
+	glGetTexParameterIiv = (gl_get_tex_parameter_iiv_func *)fgl__ResolveOpenGLProc(state, "glGetTexParameterIiv");
+	glGetTexParameterIuiv = (gl_get_tex_parameter_iuiv_func *)fgl__ResolveOpenGLProc(state, "glGetTexParameterIuiv");
+	glClearBufferiv = (gl_clear_bufferiv_func *)fgl__ResolveOpenGLProc(state, "glClearBufferiv");
+	glClearBufferuiv = (gl_clear_bufferuiv_func *)fgl__ResolveOpenGLProc(state, "glClearBufferuiv");
+	glClearBufferfv = (gl_clear_bufferfv_func *)fgl__ResolveOpenGLProc(state, "glClearBufferfv");
+	glClearBufferfi = (gl_clear_bufferfi_func *)fgl__ResolveOpenGLProc(state, "glClearBufferfi");
+	glGetStringi = (gl_get_stringi_func *)fgl__ResolveOpenGLProc(state, "glGetStringi");
+	glIsRenderbuffer = (gl_is_renderbuffer_func *)fgl__ResolveOpenGLProc(state, "glIsRenderbuffer");
+	glBindRenderbuffer = (gl_bind_renderbuffer_func *)fgl__ResolveOpenGLProc(state, "glBindRenderbuffer");
+	glDeleteRenderbuffers = (gl_delete_renderbuffers_func *)fgl__ResolveOpenGLProc(state, "glDeleteRenderbuffers");
+	glGenRenderbuffers = (gl_gen_renderbuffers_func *)fgl__ResolveOpenGLProc(state, "glGenRenderbuffers");
+	glRenderbufferStorage = (gl_renderbuffer_storage_func *)fgl__ResolveOpenGLProc(state, "glRenderbufferStorage");
+	glGetRenderbufferParameteriv = (gl_get_renderbuffer_parameteriv_func *)fgl__ResolveOpenGLProc(state, "glGetRenderbufferParameteriv");
+	glIsFramebuffer = (gl_is_framebuffer_func *)fgl__ResolveOpenGLProc(state, "glIsFramebuffer");
+	glBindFramebuffer = (gl_bind_framebuffer_func *)fgl__ResolveOpenGLProc(state, "glBindFramebuffer");
+	glDeleteFramebuffers = (gl_delete_framebuffers_func *)fgl__ResolveOpenGLProc(state, "glDeleteFramebuffers");
+	glGenFramebuffers = (gl_gen_framebuffers_func *)fgl__ResolveOpenGLProc(state, "glGenFramebuffers");
+	glCheckFramebufferStatus = (gl_check_framebuffer_status_func *)fgl__ResolveOpenGLProc(state, "glCheckFramebufferStatus");
+	glFramebufferTexture1D = (gl_framebuffer_texture1d_func *)fgl__ResolveOpenGLProc(state, "glFramebufferTexture1D");
+	glFramebufferTexture2D = (gl_framebuffer_texture2d_func *)fgl__ResolveOpenGLProc(state, "glFramebufferTexture2D");
+	glFramebufferTexture3D = (gl_framebuffer_texture3d_func *)fgl__ResolveOpenGLProc(state, "glFramebufferTexture3D");
+	glFramebufferRenderbuffer = (gl_framebuffer_renderbuffer_func *)fgl__ResolveOpenGLProc(state, "glFramebufferRenderbuffer");
+	glGetFramebufferAttachmentParameteriv = (gl_get_framebuffer_attachment_parameteriv_func *)fgl__ResolveOpenGLProc(state, "glGetFramebufferAttachmentParameteriv");
+	glGenerateMipmap = (gl_generate_mipmap_func *)fgl__ResolveOpenGLProc(state, "glGenerateMipmap");
+	glBlitFramebuffer = (gl_blit_framebuffer_func *)fgl__ResolveOpenGLProc(state, "glBlitFramebuffer");
+	glRenderbufferStorageMultisample = (gl_renderbuffer_storage_multisample_func *)fgl__ResolveOpenGLProc(state, "glRenderbufferStorageMultisample");
+	glFramebufferTextureLayer = (gl_framebuffer_texture_layer_func *)fgl__ResolveOpenGLProc(state, "glFramebufferTextureLayer");
+	glMapBufferRange = (gl_map_buffer_range_func *)fgl__ResolveOpenGLProc(state, "glMapBufferRange");
+	glFlushMappedBufferRange = (gl_flush_mapped_buffer_range_func *)fgl__ResolveOpenGLProc(state, "glFlushMappedBufferRange");
+	glBindVertexArray = (gl_bind_vertex_array_func *)fgl__ResolveOpenGLProc(state, "glBindVertexArray");
+	glDeleteVertexArrays = (gl_delete_vertex_arrays_func *)fgl__ResolveOpenGLProc(state, "glDeleteVertexArrays");
+	glGenVertexArrays = (gl_gen_vertex_arrays_func *)fgl__ResolveOpenGLProc(state, "glGenVertexArrays");
+	glIsVertexArray = (gl_is_vertex_array_func *)fgl__ResolveOpenGLProc(state, "glIsVertexArray");
+	isGL_VERSION_3_0 = fgl__EndOpenGLVersion(state);
 #	endif //GL_VERSION_3_0
 
 #	if GL_VERSION_3_1
-	glDrawArraysInstanced = (gl_draw_arrays_instanced_func *)fgl__GetOpenGLProcAddress(state, "glDrawArraysInstanced");
-	glDrawElementsInstanced = (gl_draw_elements_instanced_func *)fgl__GetOpenGLProcAddress(state, "glDrawElementsInstanced");
-	glTexBuffer = (gl_tex_buffer_func *)fgl__GetOpenGLProcAddress(state, "glTexBuffer");
-	glPrimitiveRestartIndex = (gl_primitive_restart_index_func *)fgl__GetOpenGLProcAddress(state, "glPrimitiveRestartIndex");
-	glCopyBufferSubData = (gl_copy_buffer_sub_data_func *)fgl__GetOpenGLProcAddress(state, "glCopyBufferSubData");
-	glGetUniformIndices = (gl_get_uniform_indices_func *)fgl__GetOpenGLProcAddress(state, "glGetUniformIndices");
-	glGetActiveUniformsiv = (gl_get_active_uniformsiv_func *)fgl__GetOpenGLProcAddress(state, "glGetActiveUniformsiv");
-	glGetActiveUniformName = (gl_get_active_uniform_name_func *)fgl__GetOpenGLProcAddress(state, "glGetActiveUniformName");
-	glGetUniformBlockIndex = (gl_get_uniform_block_index_func *)fgl__GetOpenGLProcAddress(state, "glGetUniformBlockIndex");
-	glGetActiveUniformBlockiv = (gl_get_active_uniform_blockiv_func *)fgl__GetOpenGLProcAddress(state, "glGetActiveUniformBlockiv");
-	glGetActiveUniformBlockName = (gl_get_active_uniform_block_name_func *)fgl__GetOpenGLProcAddress(state, "glGetActiveUniformBlockName");
-	glUniformBlockBinding = (gl_uniform_block_binding_func *)fgl__GetOpenGLProcAddress(state, "glUniformBlockBinding");
+	fgl__BeginOpenGLVersion(state, 31);
+	glDrawArraysInstanced = (gl_draw_arrays_instanced_func *)fgl__ResolveOpenGLProc(state, "glDrawArraysInstanced");
+	glDrawElementsInstanced = (gl_draw_elements_instanced_func *)fgl__ResolveOpenGLProc(state, "glDrawElementsInstanced");
+	glTexBuffer = (gl_tex_buffer_func *)fgl__ResolveOpenGLProc(state, "glTexBuffer");
+	glPrimitiveRestartIndex = (gl_primitive_restart_index_func *)fgl__ResolveOpenGLProc(state, "glPrimitiveRestartIndex");
+	glCopyBufferSubData = (gl_copy_buffer_sub_data_func *)fgl__ResolveOpenGLProc(state, "glCopyBufferSubData");
+	glGetUniformIndices = (gl_get_uniform_indices_func *)fgl__ResolveOpenGLProc(state, "glGetUniformIndices");
+	glGetActiveUniformsiv = (gl_get_active_uniformsiv_func *)fgl__ResolveOpenGLProc(state, "glGetActiveUniformsiv");
+	glGetActiveUniformName = (gl_get_active_uniform_name_func *)fgl__ResolveOpenGLProc(state, "glGetActiveUniformName");
+	glGetUniformBlockIndex = (gl_get_uniform_block_index_func *)fgl__ResolveOpenGLProc(state, "glGetUniformBlockIndex");
+	glGetActiveUniformBlockiv = (gl_get_active_uniform_blockiv_func *)fgl__ResolveOpenGLProc(state, "glGetActiveUniformBlockiv");
+	glGetActiveUniformBlockName = (gl_get_active_uniform_block_name_func *)fgl__ResolveOpenGLProc(state, "glGetActiveUniformBlockName");
+	glUniformBlockBinding = (gl_uniform_block_binding_func *)fgl__ResolveOpenGLProc(state, "glUniformBlockBinding");
+	isGL_VERSION_3_1 = fgl__EndOpenGLVersion(state);
 #	endif //GL_VERSION_3_1
 
 #	if GL_VERSION_3_2
-	glDrawElementsBaseVertex = (gl_draw_elements_base_vertex_func *)fgl__GetOpenGLProcAddress(state, "glDrawElementsBaseVertex");
-	glDrawRangeElementsBaseVertex = (gl_draw_range_elements_base_vertex_func *)fgl__GetOpenGLProcAddress(state, "glDrawRangeElementsBaseVertex");
-	glDrawElementsInstancedBaseVertex = (gl_draw_elements_instanced_base_vertex_func *)fgl__GetOpenGLProcAddress(state, "glDrawElementsInstancedBaseVertex");
-	glMultiDrawElementsBaseVertex = (gl_multi_draw_elements_base_vertex_func *)fgl__GetOpenGLProcAddress(state, "glMultiDrawElementsBaseVertex");
-	glProvokingVertex = (gl_provoking_vertex_func *)fgl__GetOpenGLProcAddress(state, "glProvokingVertex");
-	glFenceSync = (gl_fence_sync_func *)fgl__GetOpenGLProcAddress(state, "glFenceSync");
-	glIsSync = (gl_is_sync_func *)fgl__GetOpenGLProcAddress(state, "glIsSync");
-	glDeleteSync = (gl_delete_sync_func *)fgl__GetOpenGLProcAddress(state, "glDeleteSync");
-	glClientWaitSync = (gl_client_wait_sync_func *)fgl__GetOpenGLProcAddress(state, "glClientWaitSync");
-	glWaitSync = (gl_wait_sync_func *)fgl__GetOpenGLProcAddress(state, "glWaitSync");
-	glGetInteger64v = (gl_get_integer64v_func *)fgl__GetOpenGLProcAddress(state, "glGetInteger64v");
-	glGetSynciv = (gl_get_synciv_func *)fgl__GetOpenGLProcAddress(state, "glGetSynciv");
-	glGetInteger64i_v = (gl_get_integer64i_v_func *)fgl__GetOpenGLProcAddress(state, "glGetInteger64i_v");
-	glGetBufferParameteri64v = (gl_get_buffer_parameteri64v_func *)fgl__GetOpenGLProcAddress(state, "glGetBufferParameteri64v");
-	glFramebufferTexture = (gl_framebuffer_texture_func *)fgl__GetOpenGLProcAddress(state, "glFramebufferTexture");
-	glTexImage2DMultisample = (gl_tex_image2_d_multisample_func *)fgl__GetOpenGLProcAddress(state, "glTexImage2DMultisample");
-	glTexImage3DMultisample = (gl_tex_image3_d_multisample_func *)fgl__GetOpenGLProcAddress(state, "glTexImage3DMultisample");
-	glGetMultisamplefv = (gl_get_multisamplefv_func *)fgl__GetOpenGLProcAddress(state, "glGetMultisamplefv");
-	glSampleMaski = (gl_sample_maski_func *)fgl__GetOpenGLProcAddress(state, "glSampleMaski");
+	fgl__BeginOpenGLVersion(state, 32);
+	glDrawElementsBaseVertex = (gl_draw_elements_base_vertex_func *)fgl__ResolveOpenGLProc(state, "glDrawElementsBaseVertex");
+	glDrawRangeElementsBaseVertex = (gl_draw_range_elements_base_vertex_func *)fgl__ResolveOpenGLProc(state, "glDrawRangeElementsBaseVertex");
+	glDrawElementsInstancedBaseVertex = (gl_draw_elements_instanced_base_vertex_func *)fgl__ResolveOpenGLProc(state, "glDrawElementsInstancedBaseVertex");
+	glMultiDrawElementsBaseVertex = (gl_multi_draw_elements_base_vertex_func *)fgl__ResolveOpenGLProc(state, "glMultiDrawElementsBaseVertex");
+	glProvokingVertex = (gl_provoking_vertex_func *)fgl__ResolveOpenGLProc(state, "glProvokingVertex");
+	glFenceSync = (gl_fence_sync_func *)fgl__ResolveOpenGLProc(state, "glFenceSync");
+	glIsSync = (gl_is_sync_func *)fgl__ResolveOpenGLProc(state, "glIsSync");
+	glDeleteSync = (gl_delete_sync_func *)fgl__ResolveOpenGLProc(state, "glDeleteSync");
+	glClientWaitSync = (gl_client_wait_sync_func *)fgl__ResolveOpenGLProc(state, "glClientWaitSync");
+	glWaitSync = (gl_wait_sync_func *)fgl__ResolveOpenGLProc(state, "glWaitSync");
+	glGetInteger64v = (gl_get_integer64v_func *)fgl__ResolveOpenGLProc(state, "glGetInteger64v");
+	glGetSynciv = (gl_get_synciv_func *)fgl__ResolveOpenGLProc(state, "glGetSynciv");
+	glGetInteger64i_v = (gl_get_integer64i_v_func *)fgl__ResolveOpenGLProc(state, "glGetInteger64i_v");
+	glGetBufferParameteri64v = (gl_get_buffer_parameteri64v_func *)fgl__ResolveOpenGLProc(state, "glGetBufferParameteri64v");
+	glFramebufferTexture = (gl_framebuffer_texture_func *)fgl__ResolveOpenGLProc(state, "glFramebufferTexture");
+	glTexImage2DMultisample = (gl_tex_image2_d_multisample_func *)fgl__ResolveOpenGLProc(state, "glTexImage2DMultisample");
+	glTexImage3DMultisample = (gl_tex_image3_d_multisample_func *)fgl__ResolveOpenGLProc(state, "glTexImage3DMultisample");
+	glGetMultisamplefv = (gl_get_multisamplefv_func *)fgl__ResolveOpenGLProc(state, "glGetMultisamplefv");
+	glSampleMaski = (gl_sample_maski_func *)fgl__ResolveOpenGLProc(state, "glSampleMaski");
+	isGL_VERSION_3_2 = fgl__EndOpenGLVersion(state);
 #	endif //GL_VERSION_3_2
 
 #	if GL_VERSION_3_3
-	glBindFragDataLocationIndexed = (gl_bind_frag_data_location_indexed_func *)fgl__GetOpenGLProcAddress(state, "glBindFragDataLocationIndexed");
-	glGetFragDataIndex = (gl_get_frag_data_index_func *)fgl__GetOpenGLProcAddress(state, "glGetFragDataIndex");
-	glGenSamplers = (gl_gen_samplers_func *)fgl__GetOpenGLProcAddress(state, "glGenSamplers");
-	glDeleteSamplers = (gl_delete_samplers_func *)fgl__GetOpenGLProcAddress(state, "glDeleteSamplers");
-	glIsSampler = (gl_is_sampler_func *)fgl__GetOpenGLProcAddress(state, "glIsSampler");
-	glBindSampler = (gl_bind_sampler_func *)fgl__GetOpenGLProcAddress(state, "glBindSampler");
-	glSamplerParameteri = (gl_sampler_parameteri_func *)fgl__GetOpenGLProcAddress(state, "glSamplerParameteri");
-	glSamplerParameteriv = (gl_sampler_parameteriv_func *)fgl__GetOpenGLProcAddress(state, "glSamplerParameteriv");
-	glSamplerParameterf = (gl_sampler_parameterf_func *)fgl__GetOpenGLProcAddress(state, "glSamplerParameterf");
-	glSamplerParameterfv = (gl_sampler_parameterfv_func *)fgl__GetOpenGLProcAddress(state, "glSamplerParameterfv");
-	glSamplerParameterIiv = (gl_sampler_parameter_iiv_func *)fgl__GetOpenGLProcAddress(state, "glSamplerParameterIiv");
-	glSamplerParameterIuiv = (gl_sampler_parameter_iuiv_func *)fgl__GetOpenGLProcAddress(state, "glSamplerParameterIuiv");
-	glGetSamplerParameteriv = (gl_get_sampler_parameteriv_func *)fgl__GetOpenGLProcAddress(state, "glGetSamplerParameteriv");
-	glGetSamplerParameterIiv = (gl_get_sampler_parameter_iiv_func *)fgl__GetOpenGLProcAddress(state, "glGetSamplerParameterIiv");
-	glGetSamplerParameterfv = (gl_get_sampler_parameterfv_func *)fgl__GetOpenGLProcAddress(state, "glGetSamplerParameterfv");
-	glGetSamplerParameterIuiv = (gl_get_sampler_parameter_iuiv_func *)fgl__GetOpenGLProcAddress(state, "glGetSamplerParameterIuiv");
-	glQueryCounter = (gl_query_counter_func *)fgl__GetOpenGLProcAddress(state, "glQueryCounter");
-	glGetQueryObjecti64v = (gl_get_query_objecti64v_func *)fgl__GetOpenGLProcAddress(state, "glGetQueryObjecti64v");
-	glGetQueryObjectui64v = (gl_get_query_objectui64v_func *)fgl__GetOpenGLProcAddress(state, "glGetQueryObjectui64v");
-	glVertexAttribDivisor = (gl_vertex_attrib_divisor_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribDivisor");
-	glVertexAttribP1ui = (gl_vertex_attrib_p1ui_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribP1ui");
-	glVertexAttribP1uiv = (gl_vertex_attrib_p1uiv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribP1uiv");
-	glVertexAttribP2ui = (gl_vertex_attrib_p2ui_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribP2ui");
-	glVertexAttribP2uiv = (gl_vertex_attrib_p2uiv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribP2uiv");
-	glVertexAttribP3ui = (gl_vertex_attrib_p3ui_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribP3ui");
-	glVertexAttribP3uiv = (gl_vertex_attrib_p3uiv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribP3uiv");
-	glVertexAttribP4ui = (gl_vertex_attrib_p4ui_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribP4ui");
-	glVertexAttribP4uiv = (gl_vertex_attrib_p4uiv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribP4uiv");
-	glVertexP2ui = (gl_vertex_p2ui_func *)fgl__GetOpenGLProcAddress(state, "glVertexP2ui");
-	glVertexP2uiv = (gl_vertex_p2uiv_func *)fgl__GetOpenGLProcAddress(state, "glVertexP2uiv");
-	glVertexP3ui = (gl_vertex_p3ui_func *)fgl__GetOpenGLProcAddress(state, "glVertexP3ui");
-	glVertexP3uiv = (gl_vertex_p3uiv_func *)fgl__GetOpenGLProcAddress(state, "glVertexP3uiv");
-	glVertexP4ui = (gl_vertex_p4ui_func *)fgl__GetOpenGLProcAddress(state, "glVertexP4ui");
-	glVertexP4uiv = (gl_vertex_p4uiv_func *)fgl__GetOpenGLProcAddress(state, "glVertexP4uiv");
-	glTexCoordP1ui = (gl_tex_coord_p1ui_func *)fgl__GetOpenGLProcAddress(state, "glTexCoordP1ui");
-	glTexCoordP1uiv = (gl_tex_coord_p1uiv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoordP1uiv");
-	glTexCoordP2ui = (gl_tex_coord_p2ui_func *)fgl__GetOpenGLProcAddress(state, "glTexCoordP2ui");
-	glTexCoordP2uiv = (gl_tex_coord_p2uiv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoordP2uiv");
-	glTexCoordP3ui = (gl_tex_coord_p3ui_func *)fgl__GetOpenGLProcAddress(state, "glTexCoordP3ui");
-	glTexCoordP3uiv = (gl_tex_coord_p3uiv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoordP3uiv");
-	glTexCoordP4ui = (gl_tex_coord_p4ui_func *)fgl__GetOpenGLProcAddress(state, "glTexCoordP4ui");
-	glTexCoordP4uiv = (gl_tex_coord_p4uiv_func *)fgl__GetOpenGLProcAddress(state, "glTexCoordP4uiv");
-	glMultiTexCoordP1ui = (gl_multi_tex_coord_p1ui_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoordP1ui");
-	glMultiTexCoordP1uiv = (gl_multi_tex_coord_p1uiv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoordP1uiv");
-	glMultiTexCoordP2ui = (gl_multi_tex_coord_p2ui_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoordP2ui");
-	glMultiTexCoordP2uiv = (gl_multi_tex_coord_p2uiv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoordP2uiv");
-	glMultiTexCoordP3ui = (gl_multi_tex_coord_p3ui_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoordP3ui");
-	glMultiTexCoordP3uiv = (gl_multi_tex_coord_p3uiv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoordP3uiv");
-	glMultiTexCoordP4ui = (gl_multi_tex_coord_p4ui_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoordP4ui");
-	glMultiTexCoordP4uiv = (gl_multi_tex_coord_p4uiv_func *)fgl__GetOpenGLProcAddress(state, "glMultiTexCoordP4uiv");
-	glNormalP3ui = (gl_normal_p3ui_func *)fgl__GetOpenGLProcAddress(state, "glNormalP3ui");
-	glNormalP3uiv = (gl_normal_p3uiv_func *)fgl__GetOpenGLProcAddress(state, "glNormalP3uiv");
-	glColorP3ui = (gl_color_p3ui_func *)fgl__GetOpenGLProcAddress(state, "glColorP3ui");
-	glColorP3uiv = (gl_color_p3uiv_func *)fgl__GetOpenGLProcAddress(state, "glColorP3uiv");
-	glColorP4ui = (gl_color_p4ui_func *)fgl__GetOpenGLProcAddress(state, "glColorP4ui");
-	glColorP4uiv = (gl_color_p4uiv_func *)fgl__GetOpenGLProcAddress(state, "glColorP4uiv");
-	glSecondaryColorP3ui = (gl_secondary_color_p3ui_func *)fgl__GetOpenGLProcAddress(state, "glSecondaryColorP3ui");
-	glSecondaryColorP3uiv = (gl_secondary_color_p3uiv_func *)fgl__GetOpenGLProcAddress(state, "glSecondaryColorP3uiv");
+	fgl__BeginOpenGLVersion(state, 33);
+	glBindFragDataLocationIndexed = (gl_bind_frag_data_location_indexed_func *)fgl__ResolveOpenGLProc(state, "glBindFragDataLocationIndexed");
+	glGetFragDataIndex = (gl_get_frag_data_index_func *)fgl__ResolveOpenGLProc(state, "glGetFragDataIndex");
+	glGenSamplers = (gl_gen_samplers_func *)fgl__ResolveOpenGLProc(state, "glGenSamplers");
+	glDeleteSamplers = (gl_delete_samplers_func *)fgl__ResolveOpenGLProc(state, "glDeleteSamplers");
+	glIsSampler = (gl_is_sampler_func *)fgl__ResolveOpenGLProc(state, "glIsSampler");
+	glBindSampler = (gl_bind_sampler_func *)fgl__ResolveOpenGLProc(state, "glBindSampler");
+	glSamplerParameteri = (gl_sampler_parameteri_func *)fgl__ResolveOpenGLProc(state, "glSamplerParameteri");
+	glSamplerParameteriv = (gl_sampler_parameteriv_func *)fgl__ResolveOpenGLProc(state, "glSamplerParameteriv");
+	glSamplerParameterf = (gl_sampler_parameterf_func *)fgl__ResolveOpenGLProc(state, "glSamplerParameterf");
+	glSamplerParameterfv = (gl_sampler_parameterfv_func *)fgl__ResolveOpenGLProc(state, "glSamplerParameterfv");
+	glSamplerParameterIiv = (gl_sampler_parameter_iiv_func *)fgl__ResolveOpenGLProc(state, "glSamplerParameterIiv");
+	glSamplerParameterIuiv = (gl_sampler_parameter_iuiv_func *)fgl__ResolveOpenGLProc(state, "glSamplerParameterIuiv");
+	glGetSamplerParameteriv = (gl_get_sampler_parameteriv_func *)fgl__ResolveOpenGLProc(state, "glGetSamplerParameteriv");
+	glGetSamplerParameterIiv = (gl_get_sampler_parameter_iiv_func *)fgl__ResolveOpenGLProc(state, "glGetSamplerParameterIiv");
+	glGetSamplerParameterfv = (gl_get_sampler_parameterfv_func *)fgl__ResolveOpenGLProc(state, "glGetSamplerParameterfv");
+	glGetSamplerParameterIuiv = (gl_get_sampler_parameter_iuiv_func *)fgl__ResolveOpenGLProc(state, "glGetSamplerParameterIuiv");
+	glQueryCounter = (gl_query_counter_func *)fgl__ResolveOpenGLProc(state, "glQueryCounter");
+	glGetQueryObjecti64v = (gl_get_query_objecti64v_func *)fgl__ResolveOpenGLProc(state, "glGetQueryObjecti64v");
+	glGetQueryObjectui64v = (gl_get_query_objectui64v_func *)fgl__ResolveOpenGLProc(state, "glGetQueryObjectui64v");
+	glVertexAttribDivisor = (gl_vertex_attrib_divisor_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribDivisor");
+	glVertexAttribP1ui = (gl_vertex_attrib_p1ui_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribP1ui");
+	glVertexAttribP1uiv = (gl_vertex_attrib_p1uiv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribP1uiv");
+	glVertexAttribP2ui = (gl_vertex_attrib_p2ui_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribP2ui");
+	glVertexAttribP2uiv = (gl_vertex_attrib_p2uiv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribP2uiv");
+	glVertexAttribP3ui = (gl_vertex_attrib_p3ui_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribP3ui");
+	glVertexAttribP3uiv = (gl_vertex_attrib_p3uiv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribP3uiv");
+	glVertexAttribP4ui = (gl_vertex_attrib_p4ui_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribP4ui");
+	glVertexAttribP4uiv = (gl_vertex_attrib_p4uiv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribP4uiv");
+	glVertexP2ui = (gl_vertex_p2ui_func *)fgl__ResolveOpenGLProc(state, "glVertexP2ui");
+	glVertexP2uiv = (gl_vertex_p2uiv_func *)fgl__ResolveOpenGLProc(state, "glVertexP2uiv");
+	glVertexP3ui = (gl_vertex_p3ui_func *)fgl__ResolveOpenGLProc(state, "glVertexP3ui");
+	glVertexP3uiv = (gl_vertex_p3uiv_func *)fgl__ResolveOpenGLProc(state, "glVertexP3uiv");
+	glVertexP4ui = (gl_vertex_p4ui_func *)fgl__ResolveOpenGLProc(state, "glVertexP4ui");
+	glVertexP4uiv = (gl_vertex_p4uiv_func *)fgl__ResolveOpenGLProc(state, "glVertexP4uiv");
+	glTexCoordP1ui = (gl_tex_coord_p1ui_func *)fgl__ResolveOpenGLProc(state, "glTexCoordP1ui");
+	glTexCoordP1uiv = (gl_tex_coord_p1uiv_func *)fgl__ResolveOpenGLProc(state, "glTexCoordP1uiv");
+	glTexCoordP2ui = (gl_tex_coord_p2ui_func *)fgl__ResolveOpenGLProc(state, "glTexCoordP2ui");
+	glTexCoordP2uiv = (gl_tex_coord_p2uiv_func *)fgl__ResolveOpenGLProc(state, "glTexCoordP2uiv");
+	glTexCoordP3ui = (gl_tex_coord_p3ui_func *)fgl__ResolveOpenGLProc(state, "glTexCoordP3ui");
+	glTexCoordP3uiv = (gl_tex_coord_p3uiv_func *)fgl__ResolveOpenGLProc(state, "glTexCoordP3uiv");
+	glTexCoordP4ui = (gl_tex_coord_p4ui_func *)fgl__ResolveOpenGLProc(state, "glTexCoordP4ui");
+	glTexCoordP4uiv = (gl_tex_coord_p4uiv_func *)fgl__ResolveOpenGLProc(state, "glTexCoordP4uiv");
+	glMultiTexCoordP1ui = (gl_multi_tex_coord_p1ui_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoordP1ui");
+	glMultiTexCoordP1uiv = (gl_multi_tex_coord_p1uiv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoordP1uiv");
+	glMultiTexCoordP2ui = (gl_multi_tex_coord_p2ui_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoordP2ui");
+	glMultiTexCoordP2uiv = (gl_multi_tex_coord_p2uiv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoordP2uiv");
+	glMultiTexCoordP3ui = (gl_multi_tex_coord_p3ui_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoordP3ui");
+	glMultiTexCoordP3uiv = (gl_multi_tex_coord_p3uiv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoordP3uiv");
+	glMultiTexCoordP4ui = (gl_multi_tex_coord_p4ui_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoordP4ui");
+	glMultiTexCoordP4uiv = (gl_multi_tex_coord_p4uiv_func *)fgl__ResolveOpenGLProc(state, "glMultiTexCoordP4uiv");
+	glNormalP3ui = (gl_normal_p3ui_func *)fgl__ResolveOpenGLProc(state, "glNormalP3ui");
+	glNormalP3uiv = (gl_normal_p3uiv_func *)fgl__ResolveOpenGLProc(state, "glNormalP3uiv");
+	glColorP3ui = (gl_color_p3ui_func *)fgl__ResolveOpenGLProc(state, "glColorP3ui");
+	glColorP3uiv = (gl_color_p3uiv_func *)fgl__ResolveOpenGLProc(state, "glColorP3uiv");
+	glColorP4ui = (gl_color_p4ui_func *)fgl__ResolveOpenGLProc(state, "glColorP4ui");
+	glColorP4uiv = (gl_color_p4uiv_func *)fgl__ResolveOpenGLProc(state, "glColorP4uiv");
+	glSecondaryColorP3ui = (gl_secondary_color_p3ui_func *)fgl__ResolveOpenGLProc(state, "glSecondaryColorP3ui");
+	glSecondaryColorP3uiv = (gl_secondary_color_p3uiv_func *)fgl__ResolveOpenGLProc(state, "glSecondaryColorP3uiv");
+	isGL_VERSION_3_3 = fgl__EndOpenGLVersion(state);
 #	endif //GL_VERSION_3_3
 
 #	if GL_VERSION_4_0
-	glMinSampleShading = (gl_min_sample_shading_func *)fgl__GetOpenGLProcAddress(state, "glMinSampleShading");
-	glBlendEquationi = (gl_blend_equationi_func *)fgl__GetOpenGLProcAddress(state, "glBlendEquationi");
-	glBlendEquationSeparatei = (gl_blend_equation_separatei_func *)fgl__GetOpenGLProcAddress(state, "glBlendEquationSeparatei");
-	glBlendFunci = (gl_blend_funci_func *)fgl__GetOpenGLProcAddress(state, "glBlendFunci");
-	glBlendFuncSeparatei = (gl_blend_func_separatei_func *)fgl__GetOpenGLProcAddress(state, "glBlendFuncSeparatei");
-	glDrawArraysIndirect = (gl_draw_arrays_indirect_func *)fgl__GetOpenGLProcAddress(state, "glDrawArraysIndirect");
-	glDrawElementsIndirect = (gl_draw_elements_indirect_func *)fgl__GetOpenGLProcAddress(state, "glDrawElementsIndirect");
-	glUniform1d = (gl_uniform1d_func *)fgl__GetOpenGLProcAddress(state, "glUniform1d");
-	glUniform2d = (gl_uniform2d_func *)fgl__GetOpenGLProcAddress(state, "glUniform2d");
-	glUniform3d = (gl_uniform3d_func *)fgl__GetOpenGLProcAddress(state, "glUniform3d");
-	glUniform4d = (gl_uniform4d_func *)fgl__GetOpenGLProcAddress(state, "glUniform4d");
-	glUniform1dv = (gl_uniform1dv_func *)fgl__GetOpenGLProcAddress(state, "glUniform1dv");
-	glUniform2dv = (gl_uniform2dv_func *)fgl__GetOpenGLProcAddress(state, "glUniform2dv");
-	glUniform3dv = (gl_uniform3dv_func *)fgl__GetOpenGLProcAddress(state, "glUniform3dv");
-	glUniform4dv = (gl_uniform4dv_func *)fgl__GetOpenGLProcAddress(state, "glUniform4dv");
-	glUniformMatrix2dv = (gl_uniform_matrix2dv_func *)fgl__GetOpenGLProcAddress(state, "glUniformMatrix2dv");
-	glUniformMatrix3dv = (gl_uniform_matrix3dv_func *)fgl__GetOpenGLProcAddress(state, "glUniformMatrix3dv");
-	glUniformMatrix4dv = (gl_uniform_matrix4dv_func *)fgl__GetOpenGLProcAddress(state, "glUniformMatrix4dv");
-	glUniformMatrix2x3dv = (gl_uniform_matrix2x3dv_func *)fgl__GetOpenGLProcAddress(state, "glUniformMatrix2x3dv");
-	glUniformMatrix2x4dv = (gl_uniform_matrix2x4dv_func *)fgl__GetOpenGLProcAddress(state, "glUniformMatrix2x4dv");
-	glUniformMatrix3x2dv = (gl_uniform_matrix3x2dv_func *)fgl__GetOpenGLProcAddress(state, "glUniformMatrix3x2dv");
-	glUniformMatrix3x4dv = (gl_uniform_matrix3x4dv_func *)fgl__GetOpenGLProcAddress(state, "glUniformMatrix3x4dv");
-	glUniformMatrix4x2dv = (gl_uniform_matrix4x2dv_func *)fgl__GetOpenGLProcAddress(state, "glUniformMatrix4x2dv");
-	glUniformMatrix4x3dv = (gl_uniform_matrix4x3dv_func *)fgl__GetOpenGLProcAddress(state, "glUniformMatrix4x3dv");
-	glGetUniformdv = (gl_get_uniformdv_func *)fgl__GetOpenGLProcAddress(state, "glGetUniformdv");
-	glGetSubroutineUniformLocation = (gl_get_subroutine_uniform_location_func *)fgl__GetOpenGLProcAddress(state, "glGetSubroutineUniformLocation");
-	glGetSubroutineIndex = (gl_get_subroutine_index_func *)fgl__GetOpenGLProcAddress(state, "glGetSubroutineIndex");
-	glGetActiveSubroutineUniformiv = (gl_get_active_subroutine_uniformiv_func *)fgl__GetOpenGLProcAddress(state, "glGetActiveSubroutineUniformiv");
-	glGetActiveSubroutineUniformName = (gl_get_active_subroutine_uniform_name_func *)fgl__GetOpenGLProcAddress(state, "glGetActiveSubroutineUniformName");
-	glGetActiveSubroutineName = (gl_get_active_subroutine_name_func *)fgl__GetOpenGLProcAddress(state, "glGetActiveSubroutineName");
-	glUniformSubroutinesuiv = (gl_uniform_subroutinesuiv_func *)fgl__GetOpenGLProcAddress(state, "glUniformSubroutinesuiv");
-	glGetUniformSubroutineuiv = (gl_get_uniform_subroutineuiv_func *)fgl__GetOpenGLProcAddress(state, "glGetUniformSubroutineuiv");
-	glGetProgramStageiv = (gl_get_program_stageiv_func *)fgl__GetOpenGLProcAddress(state, "glGetProgramStageiv");
-	glPatchParameteri = (gl_patch_parameteri_func *)fgl__GetOpenGLProcAddress(state, "glPatchParameteri");
-	glPatchParameterfv = (gl_patch_parameterfv_func *)fgl__GetOpenGLProcAddress(state, "glPatchParameterfv");
-	glBindTransformFeedback = (gl_bind_transform_feedback_func *)fgl__GetOpenGLProcAddress(state, "glBindTransformFeedback");
-	glDeleteTransformFeedbacks = (gl_delete_transform_feedbacks_func *)fgl__GetOpenGLProcAddress(state, "glDeleteTransformFeedbacks");
-	glGenTransformFeedbacks = (gl_gen_transform_feedbacks_func *)fgl__GetOpenGLProcAddress(state, "glGenTransformFeedbacks");
-	glIsTransformFeedback = (gl_is_transform_feedback_func *)fgl__GetOpenGLProcAddress(state, "glIsTransformFeedback");
-	glPauseTransformFeedback = (gl_pause_transform_feedback_func *)fgl__GetOpenGLProcAddress(state, "glPauseTransformFeedback");
-	glResumeTransformFeedback = (gl_resume_transform_feedback_func *)fgl__GetOpenGLProcAddress(state, "glResumeTransformFeedback");
-	glDrawTransformFeedback = (gl_draw_transform_feedback_func *)fgl__GetOpenGLProcAddress(state, "glDrawTransformFeedback");
-	glDrawTransformFeedbackStream = (gl_draw_transform_feedback_stream_func *)fgl__GetOpenGLProcAddress(state, "glDrawTransformFeedbackStream");
-	glBeginQueryIndexed = (gl_begin_query_indexed_func *)fgl__GetOpenGLProcAddress(state, "glBeginQueryIndexed");
-	glEndQueryIndexed = (gl_end_query_indexed_func *)fgl__GetOpenGLProcAddress(state, "glEndQueryIndexed");
-	glGetQueryIndexediv = (gl_get_query_indexediv_func *)fgl__GetOpenGLProcAddress(state, "glGetQueryIndexediv");
+	fgl__BeginOpenGLVersion(state, 40);
+	glMinSampleShading = (gl_min_sample_shading_func *)fgl__ResolveOpenGLProc(state, "glMinSampleShading");
+	glBlendEquationi = (gl_blend_equationi_func *)fgl__ResolveOpenGLProc(state, "glBlendEquationi");
+	glBlendEquationSeparatei = (gl_blend_equation_separatei_func *)fgl__ResolveOpenGLProc(state, "glBlendEquationSeparatei");
+	glBlendFunci = (gl_blend_funci_func *)fgl__ResolveOpenGLProc(state, "glBlendFunci");
+	glBlendFuncSeparatei = (gl_blend_func_separatei_func *)fgl__ResolveOpenGLProc(state, "glBlendFuncSeparatei");
+	glDrawArraysIndirect = (gl_draw_arrays_indirect_func *)fgl__ResolveOpenGLProc(state, "glDrawArraysIndirect");
+	glDrawElementsIndirect = (gl_draw_elements_indirect_func *)fgl__ResolveOpenGLProc(state, "glDrawElementsIndirect");
+	glUniform1d = (gl_uniform1d_func *)fgl__ResolveOpenGLProc(state, "glUniform1d");
+	glUniform2d = (gl_uniform2d_func *)fgl__ResolveOpenGLProc(state, "glUniform2d");
+	glUniform3d = (gl_uniform3d_func *)fgl__ResolveOpenGLProc(state, "glUniform3d");
+	glUniform4d = (gl_uniform4d_func *)fgl__ResolveOpenGLProc(state, "glUniform4d");
+	glUniform1dv = (gl_uniform1dv_func *)fgl__ResolveOpenGLProc(state, "glUniform1dv");
+	glUniform2dv = (gl_uniform2dv_func *)fgl__ResolveOpenGLProc(state, "glUniform2dv");
+	glUniform3dv = (gl_uniform3dv_func *)fgl__ResolveOpenGLProc(state, "glUniform3dv");
+	glUniform4dv = (gl_uniform4dv_func *)fgl__ResolveOpenGLProc(state, "glUniform4dv");
+	glUniformMatrix2dv = (gl_uniform_matrix2dv_func *)fgl__ResolveOpenGLProc(state, "glUniformMatrix2dv");
+	glUniformMatrix3dv = (gl_uniform_matrix3dv_func *)fgl__ResolveOpenGLProc(state, "glUniformMatrix3dv");
+	glUniformMatrix4dv = (gl_uniform_matrix4dv_func *)fgl__ResolveOpenGLProc(state, "glUniformMatrix4dv");
+	glUniformMatrix2x3dv = (gl_uniform_matrix2x3dv_func *)fgl__ResolveOpenGLProc(state, "glUniformMatrix2x3dv");
+	glUniformMatrix2x4dv = (gl_uniform_matrix2x4dv_func *)fgl__ResolveOpenGLProc(state, "glUniformMatrix2x4dv");
+	glUniformMatrix3x2dv = (gl_uniform_matrix3x2dv_func *)fgl__ResolveOpenGLProc(state, "glUniformMatrix3x2dv");
+	glUniformMatrix3x4dv = (gl_uniform_matrix3x4dv_func *)fgl__ResolveOpenGLProc(state, "glUniformMatrix3x4dv");
+	glUniformMatrix4x2dv = (gl_uniform_matrix4x2dv_func *)fgl__ResolveOpenGLProc(state, "glUniformMatrix4x2dv");
+	glUniformMatrix4x3dv = (gl_uniform_matrix4x3dv_func *)fgl__ResolveOpenGLProc(state, "glUniformMatrix4x3dv");
+	glGetUniformdv = (gl_get_uniformdv_func *)fgl__ResolveOpenGLProc(state, "glGetUniformdv");
+	glGetSubroutineUniformLocation = (gl_get_subroutine_uniform_location_func *)fgl__ResolveOpenGLProc(state, "glGetSubroutineUniformLocation");
+	glGetSubroutineIndex = (gl_get_subroutine_index_func *)fgl__ResolveOpenGLProc(state, "glGetSubroutineIndex");
+	glGetActiveSubroutineUniformiv = (gl_get_active_subroutine_uniformiv_func *)fgl__ResolveOpenGLProc(state, "glGetActiveSubroutineUniformiv");
+	glGetActiveSubroutineUniformName = (gl_get_active_subroutine_uniform_name_func *)fgl__ResolveOpenGLProc(state, "glGetActiveSubroutineUniformName");
+	glGetActiveSubroutineName = (gl_get_active_subroutine_name_func *)fgl__ResolveOpenGLProc(state, "glGetActiveSubroutineName");
+	glUniformSubroutinesuiv = (gl_uniform_subroutinesuiv_func *)fgl__ResolveOpenGLProc(state, "glUniformSubroutinesuiv");
+	glGetUniformSubroutineuiv = (gl_get_uniform_subroutineuiv_func *)fgl__ResolveOpenGLProc(state, "glGetUniformSubroutineuiv");
+	glGetProgramStageiv = (gl_get_program_stageiv_func *)fgl__ResolveOpenGLProc(state, "glGetProgramStageiv");
+	glPatchParameteri = (gl_patch_parameteri_func *)fgl__ResolveOpenGLProc(state, "glPatchParameteri");
+	glPatchParameterfv = (gl_patch_parameterfv_func *)fgl__ResolveOpenGLProc(state, "glPatchParameterfv");
+	glBindTransformFeedback = (gl_bind_transform_feedback_func *)fgl__ResolveOpenGLProc(state, "glBindTransformFeedback");
+	glDeleteTransformFeedbacks = (gl_delete_transform_feedbacks_func *)fgl__ResolveOpenGLProc(state, "glDeleteTransformFeedbacks");
+	glGenTransformFeedbacks = (gl_gen_transform_feedbacks_func *)fgl__ResolveOpenGLProc(state, "glGenTransformFeedbacks");
+	glIsTransformFeedback = (gl_is_transform_feedback_func *)fgl__ResolveOpenGLProc(state, "glIsTransformFeedback");
+	glPauseTransformFeedback = (gl_pause_transform_feedback_func *)fgl__ResolveOpenGLProc(state, "glPauseTransformFeedback");
+	glResumeTransformFeedback = (gl_resume_transform_feedback_func *)fgl__ResolveOpenGLProc(state, "glResumeTransformFeedback");
+	glDrawTransformFeedback = (gl_draw_transform_feedback_func *)fgl__ResolveOpenGLProc(state, "glDrawTransformFeedback");
+	glDrawTransformFeedbackStream = (gl_draw_transform_feedback_stream_func *)fgl__ResolveOpenGLProc(state, "glDrawTransformFeedbackStream");
+	glBeginQueryIndexed = (gl_begin_query_indexed_func *)fgl__ResolveOpenGLProc(state, "glBeginQueryIndexed");
+	glEndQueryIndexed = (gl_end_query_indexed_func *)fgl__ResolveOpenGLProc(state, "glEndQueryIndexed");
+	glGetQueryIndexediv = (gl_get_query_indexediv_func *)fgl__ResolveOpenGLProc(state, "glGetQueryIndexediv");
+	isGL_VERSION_4_0 = fgl__EndOpenGLVersion(state);
 #	endif //GL_VERSION_4_0
 
 #	if GL_VERSION_4_1
-	glReleaseShaderCompiler = (gl_release_shader_compiler_func *)fgl__GetOpenGLProcAddress(state, "glReleaseShaderCompiler");
-	glShaderBinary = (gl_shader_binary_func *)fgl__GetOpenGLProcAddress(state, "glShaderBinary");
-	glGetShaderPrecisionFormat = (gl_get_shader_precision_format_func *)fgl__GetOpenGLProcAddress(state, "glGetShaderPrecisionFormat");
-	glDepthRangef = (gl_depth_rangef_func *)fgl__GetOpenGLProcAddress(state, "glDepthRangef");
-	glClearDepthf = (gl_clear_depthf_func *)fgl__GetOpenGLProcAddress(state, "glClearDepthf");
-	glGetProgramBinary = (gl_get_program_binary_func *)fgl__GetOpenGLProcAddress(state, "glGetProgramBinary");
-	glProgramBinary = (gl_program_binary_func *)fgl__GetOpenGLProcAddress(state, "glProgramBinary");
-	glProgramParameteri = (gl_program_parameteri_func *)fgl__GetOpenGLProcAddress(state, "glProgramParameteri");
-	glUseProgramStages = (gl_use_program_stages_func *)fgl__GetOpenGLProcAddress(state, "glUseProgramStages");
-	glActiveShaderProgram = (gl_active_shader_program_func *)fgl__GetOpenGLProcAddress(state, "glActiveShaderProgram");
-	glCreateShaderProgramv = (gl_create_shader_programv_func *)fgl__GetOpenGLProcAddress(state, "glCreateShaderProgramv");
-	glBindProgramPipeline = (gl_bind_program_pipeline_func *)fgl__GetOpenGLProcAddress(state, "glBindProgramPipeline");
-	glDeleteProgramPipelines = (gl_delete_program_pipelines_func *)fgl__GetOpenGLProcAddress(state, "glDeleteProgramPipelines");
-	glGenProgramPipelines = (gl_gen_program_pipelines_func *)fgl__GetOpenGLProcAddress(state, "glGenProgramPipelines");
-	glIsProgramPipeline = (gl_is_program_pipeline_func *)fgl__GetOpenGLProcAddress(state, "glIsProgramPipeline");
-	glGetProgramPipelineiv = (gl_get_program_pipelineiv_func *)fgl__GetOpenGLProcAddress(state, "glGetProgramPipelineiv");
-	glProgramUniform1i = (gl_program_uniform1i_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform1i");
-	glProgramUniform1iv = (gl_program_uniform1iv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform1iv");
-	glProgramUniform1f = (gl_program_uniform1f_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform1f");
-	glProgramUniform1fv = (gl_program_uniform1fv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform1fv");
-	glProgramUniform1d = (gl_program_uniform1d_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform1d");
-	glProgramUniform1dv = (gl_program_uniform1dv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform1dv");
-	glProgramUniform1ui = (gl_program_uniform1ui_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform1ui");
-	glProgramUniform1uiv = (gl_program_uniform1uiv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform1uiv");
-	glProgramUniform2i = (gl_program_uniform2i_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform2i");
-	glProgramUniform2iv = (gl_program_uniform2iv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform2iv");
-	glProgramUniform2f = (gl_program_uniform2f_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform2f");
-	glProgramUniform2fv = (gl_program_uniform2fv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform2fv");
-	glProgramUniform2d = (gl_program_uniform2d_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform2d");
-	glProgramUniform2dv = (gl_program_uniform2dv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform2dv");
-	glProgramUniform2ui = (gl_program_uniform2ui_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform2ui");
-	glProgramUniform2uiv = (gl_program_uniform2uiv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform2uiv");
-	glProgramUniform3i = (gl_program_uniform3i_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform3i");
-	glProgramUniform3iv = (gl_program_uniform3iv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform3iv");
-	glProgramUniform3f = (gl_program_uniform3f_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform3f");
-	glProgramUniform3fv = (gl_program_uniform3fv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform3fv");
-	glProgramUniform3d = (gl_program_uniform3d_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform3d");
-	glProgramUniform3dv = (gl_program_uniform3dv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform3dv");
-	glProgramUniform3ui = (gl_program_uniform3ui_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform3ui");
-	glProgramUniform3uiv = (gl_program_uniform3uiv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform3uiv");
-	glProgramUniform4i = (gl_program_uniform4i_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform4i");
-	glProgramUniform4iv = (gl_program_uniform4iv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform4iv");
-	glProgramUniform4f = (gl_program_uniform4f_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform4f");
-	glProgramUniform4fv = (gl_program_uniform4fv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform4fv");
-	glProgramUniform4d = (gl_program_uniform4d_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform4d");
-	glProgramUniform4dv = (gl_program_uniform4dv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform4dv");
-	glProgramUniform4ui = (gl_program_uniform4ui_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform4ui");
-	glProgramUniform4uiv = (gl_program_uniform4uiv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniform4uiv");
-	glProgramUniformMatrix2fv = (gl_program_uniform_matrix2fv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniformMatrix2fv");
-	glProgramUniformMatrix3fv = (gl_program_uniform_matrix3fv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniformMatrix3fv");
-	glProgramUniformMatrix4fv = (gl_program_uniform_matrix4fv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniformMatrix4fv");
-	glProgramUniformMatrix2dv = (gl_program_uniform_matrix2dv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniformMatrix2dv");
-	glProgramUniformMatrix3dv = (gl_program_uniform_matrix3dv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniformMatrix3dv");
-	glProgramUniformMatrix4dv = (gl_program_uniform_matrix4dv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniformMatrix4dv");
-	glProgramUniformMatrix2x3fv = (gl_program_uniform_matrix2x3fv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniformMatrix2x3fv");
-	glProgramUniformMatrix3x2fv = (gl_program_uniform_matrix3x2fv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniformMatrix3x2fv");
-	glProgramUniformMatrix2x4fv = (gl_program_uniform_matrix2x4fv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniformMatrix2x4fv");
-	glProgramUniformMatrix4x2fv = (gl_program_uniform_matrix4x2fv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniformMatrix4x2fv");
-	glProgramUniformMatrix3x4fv = (gl_program_uniform_matrix3x4fv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniformMatrix3x4fv");
-	glProgramUniformMatrix4x3fv = (gl_program_uniform_matrix4x3fv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniformMatrix4x3fv");
-	glProgramUniformMatrix2x3dv = (gl_program_uniform_matrix2x3dv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniformMatrix2x3dv");
-	glProgramUniformMatrix3x2dv = (gl_program_uniform_matrix3x2dv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniformMatrix3x2dv");
-	glProgramUniformMatrix2x4dv = (gl_program_uniform_matrix2x4dv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniformMatrix2x4dv");
-	glProgramUniformMatrix4x2dv = (gl_program_uniform_matrix4x2dv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniformMatrix4x2dv");
-	glProgramUniformMatrix3x4dv = (gl_program_uniform_matrix3x4dv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniformMatrix3x4dv");
-	glProgramUniformMatrix4x3dv = (gl_program_uniform_matrix4x3dv_func *)fgl__GetOpenGLProcAddress(state, "glProgramUniformMatrix4x3dv");
-	glValidateProgramPipeline = (gl_validate_program_pipeline_func *)fgl__GetOpenGLProcAddress(state, "glValidateProgramPipeline");
-	glGetProgramPipelineInfoLog = (gl_get_program_pipeline_info_log_func *)fgl__GetOpenGLProcAddress(state, "glGetProgramPipelineInfoLog");
-	glVertexAttribL1d = (gl_vertex_attrib_l1d_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribL1d");
-	glVertexAttribL2d = (gl_vertex_attrib_l2d_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribL2d");
-	glVertexAttribL3d = (gl_vertex_attrib_l3d_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribL3d");
-	glVertexAttribL4d = (gl_vertex_attrib_l4d_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribL4d");
-	glVertexAttribL1dv = (gl_vertex_attrib_l1dv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribL1dv");
-	glVertexAttribL2dv = (gl_vertex_attrib_l2dv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribL2dv");
-	glVertexAttribL3dv = (gl_vertex_attrib_l3dv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribL3dv");
-	glVertexAttribL4dv = (gl_vertex_attrib_l4dv_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribL4dv");
-	glVertexAttribLPointer = (gl_vertex_attrib_l_pointer_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribLPointer");
-	glGetVertexAttribLdv = (gl_get_vertex_attrib_ldv_func *)fgl__GetOpenGLProcAddress(state, "glGetVertexAttribLdv");
-	glViewportArrayv = (gl_viewport_arrayv_func *)fgl__GetOpenGLProcAddress(state, "glViewportArrayv");
-	glViewportIndexedf = (gl_viewport_indexedf_func *)fgl__GetOpenGLProcAddress(state, "glViewportIndexedf");
-	glViewportIndexedfv = (gl_viewport_indexedfv_func *)fgl__GetOpenGLProcAddress(state, "glViewportIndexedfv");
-	glScissorArrayv = (gl_scissor_arrayv_func *)fgl__GetOpenGLProcAddress(state, "glScissorArrayv");
-	glScissorIndexed = (gl_scissor_indexed_func *)fgl__GetOpenGLProcAddress(state, "glScissorIndexed");
-	glScissorIndexedv = (gl_scissor_indexedv_func *)fgl__GetOpenGLProcAddress(state, "glScissorIndexedv");
-	glDepthRangeArrayv = (gl_depth_range_arrayv_func *)fgl__GetOpenGLProcAddress(state, "glDepthRangeArrayv");
-	glDepthRangeIndexed = (gl_depth_range_indexed_func *)fgl__GetOpenGLProcAddress(state, "glDepthRangeIndexed");
-	glGetFloati_v = (gl_get_floati_v_func *)fgl__GetOpenGLProcAddress(state, "glGetFloati_v");
-	glGetDoublei_v = (gl_get_doublei_v_func *)fgl__GetOpenGLProcAddress(state, "glGetDoublei_v");
+	fgl__BeginOpenGLVersion(state, 41);
+	glReleaseShaderCompiler = (gl_release_shader_compiler_func *)fgl__ResolveOpenGLProc(state, "glReleaseShaderCompiler");
+	glShaderBinary = (gl_shader_binary_func *)fgl__ResolveOpenGLProc(state, "glShaderBinary");
+	glGetShaderPrecisionFormat = (gl_get_shader_precision_format_func *)fgl__ResolveOpenGLProc(state, "glGetShaderPrecisionFormat");
+	glDepthRangef = (gl_depth_rangef_func *)fgl__ResolveOpenGLProc(state, "glDepthRangef");
+	glClearDepthf = (gl_clear_depthf_func *)fgl__ResolveOpenGLProc(state, "glClearDepthf");
+	glGetProgramBinary = (gl_get_program_binary_func *)fgl__ResolveOpenGLProc(state, "glGetProgramBinary");
+	glProgramBinary = (gl_program_binary_func *)fgl__ResolveOpenGLProc(state, "glProgramBinary");
+	glProgramParameteri = (gl_program_parameteri_func *)fgl__ResolveOpenGLProc(state, "glProgramParameteri");
+	glUseProgramStages = (gl_use_program_stages_func *)fgl__ResolveOpenGLProc(state, "glUseProgramStages");
+	glActiveShaderProgram = (gl_active_shader_program_func *)fgl__ResolveOpenGLProc(state, "glActiveShaderProgram");
+	glCreateShaderProgramv = (gl_create_shader_programv_func *)fgl__ResolveOpenGLProc(state, "glCreateShaderProgramv");
+	glBindProgramPipeline = (gl_bind_program_pipeline_func *)fgl__ResolveOpenGLProc(state, "glBindProgramPipeline");
+	glDeleteProgramPipelines = (gl_delete_program_pipelines_func *)fgl__ResolveOpenGLProc(state, "glDeleteProgramPipelines");
+	glGenProgramPipelines = (gl_gen_program_pipelines_func *)fgl__ResolveOpenGLProc(state, "glGenProgramPipelines");
+	glIsProgramPipeline = (gl_is_program_pipeline_func *)fgl__ResolveOpenGLProc(state, "glIsProgramPipeline");
+	glGetProgramPipelineiv = (gl_get_program_pipelineiv_func *)fgl__ResolveOpenGLProc(state, "glGetProgramPipelineiv");
+	glProgramUniform1i = (gl_program_uniform1i_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform1i");
+	glProgramUniform1iv = (gl_program_uniform1iv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform1iv");
+	glProgramUniform1f = (gl_program_uniform1f_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform1f");
+	glProgramUniform1fv = (gl_program_uniform1fv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform1fv");
+	glProgramUniform1d = (gl_program_uniform1d_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform1d");
+	glProgramUniform1dv = (gl_program_uniform1dv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform1dv");
+	glProgramUniform1ui = (gl_program_uniform1ui_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform1ui");
+	glProgramUniform1uiv = (gl_program_uniform1uiv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform1uiv");
+	glProgramUniform2i = (gl_program_uniform2i_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform2i");
+	glProgramUniform2iv = (gl_program_uniform2iv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform2iv");
+	glProgramUniform2f = (gl_program_uniform2f_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform2f");
+	glProgramUniform2fv = (gl_program_uniform2fv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform2fv");
+	glProgramUniform2d = (gl_program_uniform2d_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform2d");
+	glProgramUniform2dv = (gl_program_uniform2dv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform2dv");
+	glProgramUniform2ui = (gl_program_uniform2ui_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform2ui");
+	glProgramUniform2uiv = (gl_program_uniform2uiv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform2uiv");
+	glProgramUniform3i = (gl_program_uniform3i_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform3i");
+	glProgramUniform3iv = (gl_program_uniform3iv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform3iv");
+	glProgramUniform3f = (gl_program_uniform3f_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform3f");
+	glProgramUniform3fv = (gl_program_uniform3fv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform3fv");
+	glProgramUniform3d = (gl_program_uniform3d_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform3d");
+	glProgramUniform3dv = (gl_program_uniform3dv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform3dv");
+	glProgramUniform3ui = (gl_program_uniform3ui_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform3ui");
+	glProgramUniform3uiv = (gl_program_uniform3uiv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform3uiv");
+	glProgramUniform4i = (gl_program_uniform4i_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform4i");
+	glProgramUniform4iv = (gl_program_uniform4iv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform4iv");
+	glProgramUniform4f = (gl_program_uniform4f_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform4f");
+	glProgramUniform4fv = (gl_program_uniform4fv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform4fv");
+	glProgramUniform4d = (gl_program_uniform4d_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform4d");
+	glProgramUniform4dv = (gl_program_uniform4dv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform4dv");
+	glProgramUniform4ui = (gl_program_uniform4ui_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform4ui");
+	glProgramUniform4uiv = (gl_program_uniform4uiv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniform4uiv");
+	glProgramUniformMatrix2fv = (gl_program_uniform_matrix2fv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniformMatrix2fv");
+	glProgramUniformMatrix3fv = (gl_program_uniform_matrix3fv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniformMatrix3fv");
+	glProgramUniformMatrix4fv = (gl_program_uniform_matrix4fv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniformMatrix4fv");
+	glProgramUniformMatrix2dv = (gl_program_uniform_matrix2dv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniformMatrix2dv");
+	glProgramUniformMatrix3dv = (gl_program_uniform_matrix3dv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniformMatrix3dv");
+	glProgramUniformMatrix4dv = (gl_program_uniform_matrix4dv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniformMatrix4dv");
+	glProgramUniformMatrix2x3fv = (gl_program_uniform_matrix2x3fv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniformMatrix2x3fv");
+	glProgramUniformMatrix3x2fv = (gl_program_uniform_matrix3x2fv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniformMatrix3x2fv");
+	glProgramUniformMatrix2x4fv = (gl_program_uniform_matrix2x4fv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniformMatrix2x4fv");
+	glProgramUniformMatrix4x2fv = (gl_program_uniform_matrix4x2fv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniformMatrix4x2fv");
+	glProgramUniformMatrix3x4fv = (gl_program_uniform_matrix3x4fv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniformMatrix3x4fv");
+	glProgramUniformMatrix4x3fv = (gl_program_uniform_matrix4x3fv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniformMatrix4x3fv");
+	glProgramUniformMatrix2x3dv = (gl_program_uniform_matrix2x3dv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniformMatrix2x3dv");
+	glProgramUniformMatrix3x2dv = (gl_program_uniform_matrix3x2dv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniformMatrix3x2dv");
+	glProgramUniformMatrix2x4dv = (gl_program_uniform_matrix2x4dv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniformMatrix2x4dv");
+	glProgramUniformMatrix4x2dv = (gl_program_uniform_matrix4x2dv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniformMatrix4x2dv");
+	glProgramUniformMatrix3x4dv = (gl_program_uniform_matrix3x4dv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniformMatrix3x4dv");
+	glProgramUniformMatrix4x3dv = (gl_program_uniform_matrix4x3dv_func *)fgl__ResolveOpenGLProc(state, "glProgramUniformMatrix4x3dv");
+	glValidateProgramPipeline = (gl_validate_program_pipeline_func *)fgl__ResolveOpenGLProc(state, "glValidateProgramPipeline");
+	glGetProgramPipelineInfoLog = (gl_get_program_pipeline_info_log_func *)fgl__ResolveOpenGLProc(state, "glGetProgramPipelineInfoLog");
+	glVertexAttribL1d = (gl_vertex_attrib_l1d_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribL1d");
+	glVertexAttribL2d = (gl_vertex_attrib_l2d_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribL2d");
+	glVertexAttribL3d = (gl_vertex_attrib_l3d_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribL3d");
+	glVertexAttribL4d = (gl_vertex_attrib_l4d_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribL4d");
+	glVertexAttribL1dv = (gl_vertex_attrib_l1dv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribL1dv");
+	glVertexAttribL2dv = (gl_vertex_attrib_l2dv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribL2dv");
+	glVertexAttribL3dv = (gl_vertex_attrib_l3dv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribL3dv");
+	glVertexAttribL4dv = (gl_vertex_attrib_l4dv_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribL4dv");
+	glVertexAttribLPointer = (gl_vertex_attrib_l_pointer_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribLPointer");
+	glGetVertexAttribLdv = (gl_get_vertex_attrib_ldv_func *)fgl__ResolveOpenGLProc(state, "glGetVertexAttribLdv");
+	glViewportArrayv = (gl_viewport_arrayv_func *)fgl__ResolveOpenGLProc(state, "glViewportArrayv");
+	glViewportIndexedf = (gl_viewport_indexedf_func *)fgl__ResolveOpenGLProc(state, "glViewportIndexedf");
+	glViewportIndexedfv = (gl_viewport_indexedfv_func *)fgl__ResolveOpenGLProc(state, "glViewportIndexedfv");
+	glScissorArrayv = (gl_scissor_arrayv_func *)fgl__ResolveOpenGLProc(state, "glScissorArrayv");
+	glScissorIndexed = (gl_scissor_indexed_func *)fgl__ResolveOpenGLProc(state, "glScissorIndexed");
+	glScissorIndexedv = (gl_scissor_indexedv_func *)fgl__ResolveOpenGLProc(state, "glScissorIndexedv");
+	glDepthRangeArrayv = (gl_depth_range_arrayv_func *)fgl__ResolveOpenGLProc(state, "glDepthRangeArrayv");
+	glDepthRangeIndexed = (gl_depth_range_indexed_func *)fgl__ResolveOpenGLProc(state, "glDepthRangeIndexed");
+	glGetFloati_v = (gl_get_floati_v_func *)fgl__ResolveOpenGLProc(state, "glGetFloati_v");
+	glGetDoublei_v = (gl_get_doublei_v_func *)fgl__ResolveOpenGLProc(state, "glGetDoublei_v");
+	isGL_VERSION_4_1 = fgl__EndOpenGLVersion(state);
 #	endif //GL_VERSION_4_1
 
 #	if GL_VERSION_4_2
-	glDrawArraysInstancedBaseInstance = (gl_draw_arrays_instanced_base_instance_func *)fgl__GetOpenGLProcAddress(state, "glDrawArraysInstancedBaseInstance");
-	glDrawElementsInstancedBaseInstance = (gl_draw_elements_instanced_base_instance_func *)fgl__GetOpenGLProcAddress(state, "glDrawElementsInstancedBaseInstance");
-	glDrawElementsInstancedBaseVertexBaseInstance = (gl_draw_elements_instanced_base_vertex_base_instance_func *)fgl__GetOpenGLProcAddress(state, "glDrawElementsInstancedBaseVertexBaseInstance");
-	glGetInternalformativ = (gl_get_internalformativ_func *)fgl__GetOpenGLProcAddress(state, "glGetInternalformativ");
-	glGetActiveAtomicCounterBufferiv = (gl_get_active_atomic_counter_bufferiv_func *)fgl__GetOpenGLProcAddress(state, "glGetActiveAtomicCounterBufferiv");
-	glBindImageTexture = (gl_bind_image_texture_func *)fgl__GetOpenGLProcAddress(state, "glBindImageTexture");
-	glMemoryBarrier = (gl_memory_barrier_func *)fgl__GetOpenGLProcAddress(state, "glMemoryBarrier");
-	glTexStorage1D = (gl_tex_storage1d_func *)fgl__GetOpenGLProcAddress(state, "glTexStorage1D");
-	glTexStorage2D = (gl_tex_storage2d_func *)fgl__GetOpenGLProcAddress(state, "glTexStorage2D");
-	glTexStorage3D = (gl_tex_storage3d_func *)fgl__GetOpenGLProcAddress(state, "glTexStorage3D");
-	glDrawTransformFeedbackInstanced = (gl_draw_transform_feedback_instanced_func *)fgl__GetOpenGLProcAddress(state, "glDrawTransformFeedbackInstanced");
-	glDrawTransformFeedbackStreamInstanced = (gl_draw_transform_feedback_stream_instanced_func *)fgl__GetOpenGLProcAddress(state, "glDrawTransformFeedbackStreamInstanced");
+	fgl__BeginOpenGLVersion(state, 42);
+	glDrawArraysInstancedBaseInstance = (gl_draw_arrays_instanced_base_instance_func *)fgl__ResolveOpenGLProc(state, "glDrawArraysInstancedBaseInstance");
+	glDrawElementsInstancedBaseInstance = (gl_draw_elements_instanced_base_instance_func *)fgl__ResolveOpenGLProc(state, "glDrawElementsInstancedBaseInstance");
+	glDrawElementsInstancedBaseVertexBaseInstance = (gl_draw_elements_instanced_base_vertex_base_instance_func *)fgl__ResolveOpenGLProc(state, "glDrawElementsInstancedBaseVertexBaseInstance");
+	glGetInternalformativ = (gl_get_internalformativ_func *)fgl__ResolveOpenGLProc(state, "glGetInternalformativ");
+	glGetActiveAtomicCounterBufferiv = (gl_get_active_atomic_counter_bufferiv_func *)fgl__ResolveOpenGLProc(state, "glGetActiveAtomicCounterBufferiv");
+	glBindImageTexture = (gl_bind_image_texture_func *)fgl__ResolveOpenGLProc(state, "glBindImageTexture");
+	glMemoryBarrier = (gl_memory_barrier_func *)fgl__ResolveOpenGLProc(state, "glMemoryBarrier");
+	glTexStorage1D = (gl_tex_storage1d_func *)fgl__ResolveOpenGLProc(state, "glTexStorage1D");
+	glTexStorage2D = (gl_tex_storage2d_func *)fgl__ResolveOpenGLProc(state, "glTexStorage2D");
+	glTexStorage3D = (gl_tex_storage3d_func *)fgl__ResolveOpenGLProc(state, "glTexStorage3D");
+	glDrawTransformFeedbackInstanced = (gl_draw_transform_feedback_instanced_func *)fgl__ResolveOpenGLProc(state, "glDrawTransformFeedbackInstanced");
+	glDrawTransformFeedbackStreamInstanced = (gl_draw_transform_feedback_stream_instanced_func *)fgl__ResolveOpenGLProc(state, "glDrawTransformFeedbackStreamInstanced");
+	isGL_VERSION_4_2 = fgl__EndOpenGLVersion(state);
 #	endif //GL_VERSION_4_2
 
 #	if GL_VERSION_4_3
-	glClearBufferData = (gl_clear_buffer_data_func *)fgl__GetOpenGLProcAddress(state, "glClearBufferData");
-	glClearBufferSubData = (gl_clear_buffer_sub_data_func *)fgl__GetOpenGLProcAddress(state, "glClearBufferSubData");
-	glDispatchCompute = (gl_dispatch_compute_func *)fgl__GetOpenGLProcAddress(state, "glDispatchCompute");
-	glDispatchComputeIndirect = (gl_dispatch_compute_indirect_func *)fgl__GetOpenGLProcAddress(state, "glDispatchComputeIndirect");
-	glCopyImageSubData = (gl_copy_image_sub_data_func *)fgl__GetOpenGLProcAddress(state, "glCopyImageSubData");
-	glFramebufferParameteri = (gl_framebuffer_parameteri_func *)fgl__GetOpenGLProcAddress(state, "glFramebufferParameteri");
-	glGetFramebufferParameteriv = (gl_get_framebuffer_parameteriv_func *)fgl__GetOpenGLProcAddress(state, "glGetFramebufferParameteriv");
-	glGetInternalformati64v = (gl_get_internalformati64v_func *)fgl__GetOpenGLProcAddress(state, "glGetInternalformati64v");
-	glInvalidateTexSubImage = (gl_invalidate_tex_sub_image_func *)fgl__GetOpenGLProcAddress(state, "glInvalidateTexSubImage");
-	glInvalidateTexImage = (gl_invalidate_tex_image_func *)fgl__GetOpenGLProcAddress(state, "glInvalidateTexImage");
-	glInvalidateBufferSubData = (gl_invalidate_buffer_sub_data_func *)fgl__GetOpenGLProcAddress(state, "glInvalidateBufferSubData");
-	glInvalidateBufferData = (gl_invalidate_buffer_data_func *)fgl__GetOpenGLProcAddress(state, "glInvalidateBufferData");
-	glInvalidateFramebuffer = (gl_invalidate_framebuffer_func *)fgl__GetOpenGLProcAddress(state, "glInvalidateFramebuffer");
-	glInvalidateSubFramebuffer = (gl_invalidate_sub_framebuffer_func *)fgl__GetOpenGLProcAddress(state, "glInvalidateSubFramebuffer");
-	glMultiDrawArraysIndirect = (gl_multi_draw_arrays_indirect_func *)fgl__GetOpenGLProcAddress(state, "glMultiDrawArraysIndirect");
-	glMultiDrawElementsIndirect = (gl_multi_draw_elements_indirect_func *)fgl__GetOpenGLProcAddress(state, "glMultiDrawElementsIndirect");
-	glGetProgramInterfaceiv = (gl_get_program_interfaceiv_func *)fgl__GetOpenGLProcAddress(state, "glGetProgramInterfaceiv");
-	glGetProgramResourceIndex = (gl_get_program_resource_index_func *)fgl__GetOpenGLProcAddress(state, "glGetProgramResourceIndex");
-	glGetProgramResourceName = (gl_get_program_resource_name_func *)fgl__GetOpenGLProcAddress(state, "glGetProgramResourceName");
-	glGetProgramResourceiv = (gl_get_program_resourceiv_func *)fgl__GetOpenGLProcAddress(state, "glGetProgramResourceiv");
-	glGetProgramResourceLocation = (gl_get_program_resource_location_func *)fgl__GetOpenGLProcAddress(state, "glGetProgramResourceLocation");
-	glGetProgramResourceLocationIndex = (gl_get_program_resource_location_index_func *)fgl__GetOpenGLProcAddress(state, "glGetProgramResourceLocationIndex");
-	glShaderStorageBlockBinding = (gl_shader_storage_block_binding_func *)fgl__GetOpenGLProcAddress(state, "glShaderStorageBlockBinding");
-	glTexBufferRange = (gl_tex_buffer_range_func *)fgl__GetOpenGLProcAddress(state, "glTexBufferRange");
-	glTexStorage2DMultisample = (gl_tex_storage2_d_multisample_func *)fgl__GetOpenGLProcAddress(state, "glTexStorage2DMultisample");
-	glTexStorage3DMultisample = (gl_tex_storage3_d_multisample_func *)fgl__GetOpenGLProcAddress(state, "glTexStorage3DMultisample");
-	glTextureView = (gl_texture_view_func *)fgl__GetOpenGLProcAddress(state, "glTextureView");
-	glBindVertexBuffer = (gl_bind_vertex_buffer_func *)fgl__GetOpenGLProcAddress(state, "glBindVertexBuffer");
-	glVertexAttribFormat = (gl_vertex_attrib_format_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribFormat");
-	glVertexAttribIFormat = (gl_vertex_attrib_i_format_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribIFormat");
-	glVertexAttribLFormat = (gl_vertex_attrib_l_format_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribLFormat");
-	glVertexAttribBinding = (gl_vertex_attrib_binding_func *)fgl__GetOpenGLProcAddress(state, "glVertexAttribBinding");
-	glVertexBindingDivisor = (gl_vertex_binding_divisor_func *)fgl__GetOpenGLProcAddress(state, "glVertexBindingDivisor");
-	glDebugMessageControl = (gl_debug_message_control_func *)fgl__GetOpenGLProcAddress(state, "glDebugMessageControl");
-	glDebugMessageInsert = (gl_debug_message_insert_func *)fgl__GetOpenGLProcAddress(state, "glDebugMessageInsert");
-	glDebugMessageCallback = (gl_debug_message_callback_func *)fgl__GetOpenGLProcAddress(state, "glDebugMessageCallback");
-	glGetDebugMessageLog = (gl_get_debug_message_log_func *)fgl__GetOpenGLProcAddress(state, "glGetDebugMessageLog");
-	glPushDebugGroup = (gl_push_debug_group_func *)fgl__GetOpenGLProcAddress(state, "glPushDebugGroup");
-	glPopDebugGroup = (gl_pop_debug_group_func *)fgl__GetOpenGLProcAddress(state, "glPopDebugGroup");
-	glObjectLabel = (gl_object_label_func *)fgl__GetOpenGLProcAddress(state, "glObjectLabel");
-	glGetObjectLabel = (gl_get_object_label_func *)fgl__GetOpenGLProcAddress(state, "glGetObjectLabel");
-	glObjectPtrLabel = (gl_object_ptr_label_func *)fgl__GetOpenGLProcAddress(state, "glObjectPtrLabel");
-	glGetObjectPtrLabel = (gl_get_object_ptr_label_func *)fgl__GetOpenGLProcAddress(state, "glGetObjectPtrLabel");
+	fgl__BeginOpenGLVersion(state, 43);
+	glClearBufferData = (gl_clear_buffer_data_func *)fgl__ResolveOpenGLProc(state, "glClearBufferData");
+	glClearBufferSubData = (gl_clear_buffer_sub_data_func *)fgl__ResolveOpenGLProc(state, "glClearBufferSubData");
+	glDispatchCompute = (gl_dispatch_compute_func *)fgl__ResolveOpenGLProc(state, "glDispatchCompute");
+	glDispatchComputeIndirect = (gl_dispatch_compute_indirect_func *)fgl__ResolveOpenGLProc(state, "glDispatchComputeIndirect");
+	glCopyImageSubData = (gl_copy_image_sub_data_func *)fgl__ResolveOpenGLProc(state, "glCopyImageSubData");
+	glFramebufferParameteri = (gl_framebuffer_parameteri_func *)fgl__ResolveOpenGLProc(state, "glFramebufferParameteri");
+	glGetFramebufferParameteriv = (gl_get_framebuffer_parameteriv_func *)fgl__ResolveOpenGLProc(state, "glGetFramebufferParameteriv");
+	glGetInternalformati64v = (gl_get_internalformati64v_func *)fgl__ResolveOpenGLProc(state, "glGetInternalformati64v");
+	glInvalidateTexSubImage = (gl_invalidate_tex_sub_image_func *)fgl__ResolveOpenGLProc(state, "glInvalidateTexSubImage");
+	glInvalidateTexImage = (gl_invalidate_tex_image_func *)fgl__ResolveOpenGLProc(state, "glInvalidateTexImage");
+	glInvalidateBufferSubData = (gl_invalidate_buffer_sub_data_func *)fgl__ResolveOpenGLProc(state, "glInvalidateBufferSubData");
+	glInvalidateBufferData = (gl_invalidate_buffer_data_func *)fgl__ResolveOpenGLProc(state, "glInvalidateBufferData");
+	glInvalidateFramebuffer = (gl_invalidate_framebuffer_func *)fgl__ResolveOpenGLProc(state, "glInvalidateFramebuffer");
+	glInvalidateSubFramebuffer = (gl_invalidate_sub_framebuffer_func *)fgl__ResolveOpenGLProc(state, "glInvalidateSubFramebuffer");
+	glMultiDrawArraysIndirect = (gl_multi_draw_arrays_indirect_func *)fgl__ResolveOpenGLProc(state, "glMultiDrawArraysIndirect");
+	glMultiDrawElementsIndirect = (gl_multi_draw_elements_indirect_func *)fgl__ResolveOpenGLProc(state, "glMultiDrawElementsIndirect");
+	glGetProgramInterfaceiv = (gl_get_program_interfaceiv_func *)fgl__ResolveOpenGLProc(state, "glGetProgramInterfaceiv");
+	glGetProgramResourceIndex = (gl_get_program_resource_index_func *)fgl__ResolveOpenGLProc(state, "glGetProgramResourceIndex");
+	glGetProgramResourceName = (gl_get_program_resource_name_func *)fgl__ResolveOpenGLProc(state, "glGetProgramResourceName");
+	glGetProgramResourceiv = (gl_get_program_resourceiv_func *)fgl__ResolveOpenGLProc(state, "glGetProgramResourceiv");
+	glGetProgramResourceLocation = (gl_get_program_resource_location_func *)fgl__ResolveOpenGLProc(state, "glGetProgramResourceLocation");
+	glGetProgramResourceLocationIndex = (gl_get_program_resource_location_index_func *)fgl__ResolveOpenGLProc(state, "glGetProgramResourceLocationIndex");
+	glShaderStorageBlockBinding = (gl_shader_storage_block_binding_func *)fgl__ResolveOpenGLProc(state, "glShaderStorageBlockBinding");
+	glTexBufferRange = (gl_tex_buffer_range_func *)fgl__ResolveOpenGLProc(state, "glTexBufferRange");
+	glTexStorage2DMultisample = (gl_tex_storage2_d_multisample_func *)fgl__ResolveOpenGLProc(state, "glTexStorage2DMultisample");
+	glTexStorage3DMultisample = (gl_tex_storage3_d_multisample_func *)fgl__ResolveOpenGLProc(state, "glTexStorage3DMultisample");
+	glTextureView = (gl_texture_view_func *)fgl__ResolveOpenGLProc(state, "glTextureView");
+	glBindVertexBuffer = (gl_bind_vertex_buffer_func *)fgl__ResolveOpenGLProc(state, "glBindVertexBuffer");
+	glVertexAttribFormat = (gl_vertex_attrib_format_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribFormat");
+	glVertexAttribIFormat = (gl_vertex_attrib_i_format_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribIFormat");
+	glVertexAttribLFormat = (gl_vertex_attrib_l_format_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribLFormat");
+	glVertexAttribBinding = (gl_vertex_attrib_binding_func *)fgl__ResolveOpenGLProc(state, "glVertexAttribBinding");
+	glVertexBindingDivisor = (gl_vertex_binding_divisor_func *)fgl__ResolveOpenGLProc(state, "glVertexBindingDivisor");
+	glDebugMessageControl = (gl_debug_message_control_func *)fgl__ResolveOpenGLProc(state, "glDebugMessageControl");
+	glDebugMessageInsert = (gl_debug_message_insert_func *)fgl__ResolveOpenGLProc(state, "glDebugMessageInsert");
+	glDebugMessageCallback = (gl_debug_message_callback_func *)fgl__ResolveOpenGLProc(state, "glDebugMessageCallback");
+	glGetDebugMessageLog = (gl_get_debug_message_log_func *)fgl__ResolveOpenGLProc(state, "glGetDebugMessageLog");
+	glPushDebugGroup = (gl_push_debug_group_func *)fgl__ResolveOpenGLProc(state, "glPushDebugGroup");
+	glPopDebugGroup = (gl_pop_debug_group_func *)fgl__ResolveOpenGLProc(state, "glPopDebugGroup");
+	glObjectLabel = (gl_object_label_func *)fgl__ResolveOpenGLProc(state, "glObjectLabel");
+	glGetObjectLabel = (gl_get_object_label_func *)fgl__ResolveOpenGLProc(state, "glGetObjectLabel");
+	glObjectPtrLabel = (gl_object_ptr_label_func *)fgl__ResolveOpenGLProc(state, "glObjectPtrLabel");
+	glGetObjectPtrLabel = (gl_get_object_ptr_label_func *)fgl__ResolveOpenGLProc(state, "glGetObjectPtrLabel");
+	isGL_VERSION_4_3 = fgl__EndOpenGLVersion(state);
 #	endif //GL_VERSION_4_3
 
 #	if GL_VERSION_4_4
-	glBufferStorage = (gl_buffer_storage_func *)fgl__GetOpenGLProcAddress(state, "glBufferStorage");
-	glClearTexImage = (gl_clear_tex_image_func *)fgl__GetOpenGLProcAddress(state, "glClearTexImage");
-	glClearTexSubImage = (gl_clear_tex_sub_image_func *)fgl__GetOpenGLProcAddress(state, "glClearTexSubImage");
-	glBindBuffersBase = (gl_bind_buffers_base_func *)fgl__GetOpenGLProcAddress(state, "glBindBuffersBase");
-	glBindBuffersRange = (gl_bind_buffers_range_func *)fgl__GetOpenGLProcAddress(state, "glBindBuffersRange");
-	glBindTextures = (gl_bind_textures_func *)fgl__GetOpenGLProcAddress(state, "glBindTextures");
-	glBindSamplers = (gl_bind_samplers_func *)fgl__GetOpenGLProcAddress(state, "glBindSamplers");
-	glBindImageTextures = (gl_bind_image_textures_func *)fgl__GetOpenGLProcAddress(state, "glBindImageTextures");
-	glBindVertexBuffers = (gl_bind_vertex_buffers_func *)fgl__GetOpenGLProcAddress(state, "glBindVertexBuffers");
+	fgl__BeginOpenGLVersion(state, 44);
+	glBufferStorage = (gl_buffer_storage_func *)fgl__ResolveOpenGLProc(state, "glBufferStorage");
+	glClearTexImage = (gl_clear_tex_image_func *)fgl__ResolveOpenGLProc(state, "glClearTexImage");
+	glClearTexSubImage = (gl_clear_tex_sub_image_func *)fgl__ResolveOpenGLProc(state, "glClearTexSubImage");
+	glBindBuffersBase = (gl_bind_buffers_base_func *)fgl__ResolveOpenGLProc(state, "glBindBuffersBase");
+	glBindBuffersRange = (gl_bind_buffers_range_func *)fgl__ResolveOpenGLProc(state, "glBindBuffersRange");
+	glBindTextures = (gl_bind_textures_func *)fgl__ResolveOpenGLProc(state, "glBindTextures");
+	glBindSamplers = (gl_bind_samplers_func *)fgl__ResolveOpenGLProc(state, "glBindSamplers");
+	glBindImageTextures = (gl_bind_image_textures_func *)fgl__ResolveOpenGLProc(state, "glBindImageTextures");
+	glBindVertexBuffers = (gl_bind_vertex_buffers_func *)fgl__ResolveOpenGLProc(state, "glBindVertexBuffers");
+	isGL_VERSION_4_4 = fgl__EndOpenGLVersion(state);
 #	endif //GL_VERSION_4_4
 
 #	if GL_VERSION_4_5
-	glClipControl = (gl_clip_control_func *)fgl__GetOpenGLProcAddress(state, "glClipControl");
-	glCreateTransformFeedbacks = (gl_create_transform_feedbacks_func *)fgl__GetOpenGLProcAddress(state, "glCreateTransformFeedbacks");
-	glTransformFeedbackBufferBase = (gl_transform_feedback_buffer_base_func *)fgl__GetOpenGLProcAddress(state, "glTransformFeedbackBufferBase");
-	glTransformFeedbackBufferRange = (gl_transform_feedback_buffer_range_func *)fgl__GetOpenGLProcAddress(state, "glTransformFeedbackBufferRange");
-	glGetTransformFeedbackiv = (gl_get_transform_feedbackiv_func *)fgl__GetOpenGLProcAddress(state, "glGetTransformFeedbackiv");
-	glGetTransformFeedbacki_v = (gl_get_transform_feedbacki_v_func *)fgl__GetOpenGLProcAddress(state, "glGetTransformFeedbacki_v");
-	glGetTransformFeedbacki64_v = (gl_get_transform_feedbacki64_v_func *)fgl__GetOpenGLProcAddress(state, "glGetTransformFeedbacki64_v");
-	glCreateBuffers = (gl_create_buffers_func *)fgl__GetOpenGLProcAddress(state, "glCreateBuffers");
-	glNamedBufferStorage = (gl_named_buffer_storage_func *)fgl__GetOpenGLProcAddress(state, "glNamedBufferStorage");
-	glNamedBufferData = (gl_named_buffer_data_func *)fgl__GetOpenGLProcAddress(state, "glNamedBufferData");
-	glNamedBufferSubData = (gl_named_buffer_sub_data_func *)fgl__GetOpenGLProcAddress(state, "glNamedBufferSubData");
-	glCopyNamedBufferSubData = (gl_copy_named_buffer_sub_data_func *)fgl__GetOpenGLProcAddress(state, "glCopyNamedBufferSubData");
-	glClearNamedBufferData = (gl_clear_named_buffer_data_func *)fgl__GetOpenGLProcAddress(state, "glClearNamedBufferData");
-	glClearNamedBufferSubData = (gl_clear_named_buffer_sub_data_func *)fgl__GetOpenGLProcAddress(state, "glClearNamedBufferSubData");
-	glMapNamedBuffer = (gl_map_named_buffer_func *)fgl__GetOpenGLProcAddress(state, "glMapNamedBuffer");
-	glMapNamedBufferRange = (gl_map_named_buffer_range_func *)fgl__GetOpenGLProcAddress(state, "glMapNamedBufferRange");
-	glUnmapNamedBuffer = (gl_unmap_named_buffer_func *)fgl__GetOpenGLProcAddress(state, "glUnmapNamedBuffer");
-	glFlushMappedNamedBufferRange = (gl_flush_mapped_named_buffer_range_func *)fgl__GetOpenGLProcAddress(state, "glFlushMappedNamedBufferRange");
-	glGetNamedBufferParameteriv = (gl_get_named_buffer_parameteriv_func *)fgl__GetOpenGLProcAddress(state, "glGetNamedBufferParameteriv");
-	glGetNamedBufferParameteri64v = (gl_get_named_buffer_parameteri64v_func *)fgl__GetOpenGLProcAddress(state, "glGetNamedBufferParameteri64v");
-	glGetNamedBufferPointerv = (gl_get_named_buffer_pointerv_func *)fgl__GetOpenGLProcAddress(state, "glGetNamedBufferPointerv");
-	glGetNamedBufferSubData = (gl_get_named_buffer_sub_data_func *)fgl__GetOpenGLProcAddress(state, "glGetNamedBufferSubData");
-	glCreateFramebuffers = (gl_create_framebuffers_func *)fgl__GetOpenGLProcAddress(state, "glCreateFramebuffers");
-	glNamedFramebufferRenderbuffer = (gl_named_framebuffer_renderbuffer_func *)fgl__GetOpenGLProcAddress(state, "glNamedFramebufferRenderbuffer");
-	glNamedFramebufferParameteri = (gl_named_framebuffer_parameteri_func *)fgl__GetOpenGLProcAddress(state, "glNamedFramebufferParameteri");
-	glNamedFramebufferTexture = (gl_named_framebuffer_texture_func *)fgl__GetOpenGLProcAddress(state, "glNamedFramebufferTexture");
-	glNamedFramebufferTextureLayer = (gl_named_framebuffer_texture_layer_func *)fgl__GetOpenGLProcAddress(state, "glNamedFramebufferTextureLayer");
-	glNamedFramebufferDrawBuffer = (gl_named_framebuffer_draw_buffer_func *)fgl__GetOpenGLProcAddress(state, "glNamedFramebufferDrawBuffer");
-	glNamedFramebufferDrawBuffers = (gl_named_framebuffer_draw_buffers_func *)fgl__GetOpenGLProcAddress(state, "glNamedFramebufferDrawBuffers");
-	glNamedFramebufferReadBuffer = (gl_named_framebuffer_read_buffer_func *)fgl__GetOpenGLProcAddress(state, "glNamedFramebufferReadBuffer");
-	glInvalidateNamedFramebufferData = (gl_invalidate_named_framebuffer_data_func *)fgl__GetOpenGLProcAddress(state, "glInvalidateNamedFramebufferData");
-	glInvalidateNamedFramebufferSubData = (gl_invalidate_named_framebuffer_sub_data_func *)fgl__GetOpenGLProcAddress(state, "glInvalidateNamedFramebufferSubData");
-	glClearNamedFramebufferiv = (gl_clear_named_framebufferiv_func *)fgl__GetOpenGLProcAddress(state, "glClearNamedFramebufferiv");
-	glClearNamedFramebufferuiv = (gl_clear_named_framebufferuiv_func *)fgl__GetOpenGLProcAddress(state, "glClearNamedFramebufferuiv");
-	glClearNamedFramebufferfv = (gl_clear_named_framebufferfv_func *)fgl__GetOpenGLProcAddress(state, "glClearNamedFramebufferfv");
-	glClearNamedFramebufferfi = (gl_clear_named_framebufferfi_func *)fgl__GetOpenGLProcAddress(state, "glClearNamedFramebufferfi");
-	glBlitNamedFramebuffer = (gl_blit_named_framebuffer_func *)fgl__GetOpenGLProcAddress(state, "glBlitNamedFramebuffer");
-	glCheckNamedFramebufferStatus = (gl_check_named_framebuffer_status_func *)fgl__GetOpenGLProcAddress(state, "glCheckNamedFramebufferStatus");
-	glGetNamedFramebufferParameteriv = (gl_get_named_framebuffer_parameteriv_func *)fgl__GetOpenGLProcAddress(state, "glGetNamedFramebufferParameteriv");
-	glGetNamedFramebufferAttachmentParameteriv = (gl_get_named_framebuffer_attachment_parameteriv_func *)fgl__GetOpenGLProcAddress(state, "glGetNamedFramebufferAttachmentParameteriv");
-	glCreateRenderbuffers = (gl_create_renderbuffers_func *)fgl__GetOpenGLProcAddress(state, "glCreateRenderbuffers");
-	glNamedRenderbufferStorage = (gl_named_renderbuffer_storage_func *)fgl__GetOpenGLProcAddress(state, "glNamedRenderbufferStorage");
-	glNamedRenderbufferStorageMultisample = (gl_named_renderbuffer_storage_multisample_func *)fgl__GetOpenGLProcAddress(state, "glNamedRenderbufferStorageMultisample");
-	glGetNamedRenderbufferParameteriv = (gl_get_named_renderbuffer_parameteriv_func *)fgl__GetOpenGLProcAddress(state, "glGetNamedRenderbufferParameteriv");
-	glCreateTextures = (gl_create_textures_func *)fgl__GetOpenGLProcAddress(state, "glCreateTextures");
-	glTextureBuffer = (gl_texture_buffer_func *)fgl__GetOpenGLProcAddress(state, "glTextureBuffer");
-	glTextureBufferRange = (gl_texture_buffer_range_func *)fgl__GetOpenGLProcAddress(state, "glTextureBufferRange");
-	glTextureStorage1D = (gl_texture_storage1d_func *)fgl__GetOpenGLProcAddress(state, "glTextureStorage1D");
-	glTextureStorage2D = (gl_texture_storage2d_func *)fgl__GetOpenGLProcAddress(state, "glTextureStorage2D");
-	glTextureStorage3D = (gl_texture_storage3d_func *)fgl__GetOpenGLProcAddress(state, "glTextureStorage3D");
-	glTextureStorage2DMultisample = (gl_texture_storage2_d_multisample_func *)fgl__GetOpenGLProcAddress(state, "glTextureStorage2DMultisample");
-	glTextureStorage3DMultisample = (gl_texture_storage3_d_multisample_func *)fgl__GetOpenGLProcAddress(state, "glTextureStorage3DMultisample");
-	glTextureSubImage1D = (gl_texture_sub_image1d_func *)fgl__GetOpenGLProcAddress(state, "glTextureSubImage1D");
-	glTextureSubImage2D = (gl_texture_sub_image2d_func *)fgl__GetOpenGLProcAddress(state, "glTextureSubImage2D");
-	glTextureSubImage3D = (gl_texture_sub_image3d_func *)fgl__GetOpenGLProcAddress(state, "glTextureSubImage3D");
-	glCompressedTextureSubImage1D = (gl_compressed_texture_sub_image1d_func *)fgl__GetOpenGLProcAddress(state, "glCompressedTextureSubImage1D");
-	glCompressedTextureSubImage2D = (gl_compressed_texture_sub_image2d_func *)fgl__GetOpenGLProcAddress(state, "glCompressedTextureSubImage2D");
-	glCompressedTextureSubImage3D = (gl_compressed_texture_sub_image3d_func *)fgl__GetOpenGLProcAddress(state, "glCompressedTextureSubImage3D");
-	glCopyTextureSubImage1D = (gl_copy_texture_sub_image1d_func *)fgl__GetOpenGLProcAddress(state, "glCopyTextureSubImage1D");
-	glCopyTextureSubImage2D = (gl_copy_texture_sub_image2d_func *)fgl__GetOpenGLProcAddress(state, "glCopyTextureSubImage2D");
-	glCopyTextureSubImage3D = (gl_copy_texture_sub_image3d_func *)fgl__GetOpenGLProcAddress(state, "glCopyTextureSubImage3D");
-	glTextureParameterf = (gl_texture_parameterf_func *)fgl__GetOpenGLProcAddress(state, "glTextureParameterf");
-	glTextureParameterfv = (gl_texture_parameterfv_func *)fgl__GetOpenGLProcAddress(state, "glTextureParameterfv");
-	glTextureParameteri = (gl_texture_parameteri_func *)fgl__GetOpenGLProcAddress(state, "glTextureParameteri");
-	glTextureParameterIiv = (gl_texture_parameter_iiv_func *)fgl__GetOpenGLProcAddress(state, "glTextureParameterIiv");
-	glTextureParameterIuiv = (gl_texture_parameter_iuiv_func *)fgl__GetOpenGLProcAddress(state, "glTextureParameterIuiv");
-	glTextureParameteriv = (gl_texture_parameteriv_func *)fgl__GetOpenGLProcAddress(state, "glTextureParameteriv");
-	glGenerateTextureMipmap = (gl_generate_texture_mipmap_func *)fgl__GetOpenGLProcAddress(state, "glGenerateTextureMipmap");
-	glBindTextureUnit = (gl_bind_texture_unit_func *)fgl__GetOpenGLProcAddress(state, "glBindTextureUnit");
-	glGetTextureImage = (gl_get_texture_image_func *)fgl__GetOpenGLProcAddress(state, "glGetTextureImage");
-	glGetCompressedTextureImage = (gl_get_compressed_texture_image_func *)fgl__GetOpenGLProcAddress(state, "glGetCompressedTextureImage");
-	glGetTextureLevelParameterfv = (gl_get_texture_level_parameterfv_func *)fgl__GetOpenGLProcAddress(state, "glGetTextureLevelParameterfv");
-	glGetTextureLevelParameteriv = (gl_get_texture_level_parameteriv_func *)fgl__GetOpenGLProcAddress(state, "glGetTextureLevelParameteriv");
-	glGetTextureParameterfv = (gl_get_texture_parameterfv_func *)fgl__GetOpenGLProcAddress(state, "glGetTextureParameterfv");
-	glGetTextureParameterIiv = (gl_get_texture_parameter_iiv_func *)fgl__GetOpenGLProcAddress(state, "glGetTextureParameterIiv");
-	glGetTextureParameterIuiv = (gl_get_texture_parameter_iuiv_func *)fgl__GetOpenGLProcAddress(state, "glGetTextureParameterIuiv");
-	glGetTextureParameteriv = (gl_get_texture_parameteriv_func *)fgl__GetOpenGLProcAddress(state, "glGetTextureParameteriv");
-	glCreateVertexArrays = (gl_create_vertex_arrays_func *)fgl__GetOpenGLProcAddress(state, "glCreateVertexArrays");
-	glDisableVertexArrayAttrib = (gl_disable_vertex_array_attrib_func *)fgl__GetOpenGLProcAddress(state, "glDisableVertexArrayAttrib");
-	glEnableVertexArrayAttrib = (gl_enable_vertex_array_attrib_func *)fgl__GetOpenGLProcAddress(state, "glEnableVertexArrayAttrib");
-	glVertexArrayElementBuffer = (gl_vertex_array_element_buffer_func *)fgl__GetOpenGLProcAddress(state, "glVertexArrayElementBuffer");
-	glVertexArrayVertexBuffer = (gl_vertex_array_vertex_buffer_func *)fgl__GetOpenGLProcAddress(state, "glVertexArrayVertexBuffer");
-	glVertexArrayVertexBuffers = (gl_vertex_array_vertex_buffers_func *)fgl__GetOpenGLProcAddress(state, "glVertexArrayVertexBuffers");
-	glVertexArrayAttribBinding = (gl_vertex_array_attrib_binding_func *)fgl__GetOpenGLProcAddress(state, "glVertexArrayAttribBinding");
-	glVertexArrayAttribFormat = (gl_vertex_array_attrib_format_func *)fgl__GetOpenGLProcAddress(state, "glVertexArrayAttribFormat");
-	glVertexArrayAttribIFormat = (gl_vertex_array_attrib_i_format_func *)fgl__GetOpenGLProcAddress(state, "glVertexArrayAttribIFormat");
-	glVertexArrayAttribLFormat = (gl_vertex_array_attrib_l_format_func *)fgl__GetOpenGLProcAddress(state, "glVertexArrayAttribLFormat");
-	glVertexArrayBindingDivisor = (gl_vertex_array_binding_divisor_func *)fgl__GetOpenGLProcAddress(state, "glVertexArrayBindingDivisor");
-	glGetVertexArrayiv = (gl_get_vertex_arrayiv_func *)fgl__GetOpenGLProcAddress(state, "glGetVertexArrayiv");
-	glGetVertexArrayIndexediv = (gl_get_vertex_array_indexediv_func *)fgl__GetOpenGLProcAddress(state, "glGetVertexArrayIndexediv");
-	glGetVertexArrayIndexed64iv = (gl_get_vertex_array_indexed64iv_func *)fgl__GetOpenGLProcAddress(state, "glGetVertexArrayIndexed64iv");
-	glCreateSamplers = (gl_create_samplers_func *)fgl__GetOpenGLProcAddress(state, "glCreateSamplers");
-	glCreateProgramPipelines = (gl_create_program_pipelines_func *)fgl__GetOpenGLProcAddress(state, "glCreateProgramPipelines");
-	glCreateQueries = (gl_create_queries_func *)fgl__GetOpenGLProcAddress(state, "glCreateQueries");
-	glGetQueryBufferObjecti64v = (gl_get_query_buffer_objecti64v_func *)fgl__GetOpenGLProcAddress(state, "glGetQueryBufferObjecti64v");
-	glGetQueryBufferObjectiv = (gl_get_query_buffer_objectiv_func *)fgl__GetOpenGLProcAddress(state, "glGetQueryBufferObjectiv");
-	glGetQueryBufferObjectui64v = (gl_get_query_buffer_objectui64v_func *)fgl__GetOpenGLProcAddress(state, "glGetQueryBufferObjectui64v");
-	glGetQueryBufferObjectuiv = (gl_get_query_buffer_objectuiv_func *)fgl__GetOpenGLProcAddress(state, "glGetQueryBufferObjectuiv");
-	glMemoryBarrierByRegion = (gl_memory_barrier_by_region_func *)fgl__GetOpenGLProcAddress(state, "glMemoryBarrierByRegion");
-	glGetTextureSubImage = (gl_get_texture_sub_image_func *)fgl__GetOpenGLProcAddress(state, "glGetTextureSubImage");
-	glGetCompressedTextureSubImage = (gl_get_compressed_texture_sub_image_func *)fgl__GetOpenGLProcAddress(state, "glGetCompressedTextureSubImage");
-	glGetGraphicsResetStatus = (gl_get_graphics_reset_status_func *)fgl__GetOpenGLProcAddress(state, "glGetGraphicsResetStatus");
-	glGetnCompressedTexImage = (gl_getn_compressed_tex_image_func *)fgl__GetOpenGLProcAddress(state, "glGetnCompressedTexImage");
-	glGetnTexImage = (gl_getn_tex_image_func *)fgl__GetOpenGLProcAddress(state, "glGetnTexImage");
-	glGetnUniformdv = (gl_getn_uniformdv_func *)fgl__GetOpenGLProcAddress(state, "glGetnUniformdv");
-	glGetnUniformfv = (gl_getn_uniformfv_func *)fgl__GetOpenGLProcAddress(state, "glGetnUniformfv");
-	glGetnUniformiv = (gl_getn_uniformiv_func *)fgl__GetOpenGLProcAddress(state, "glGetnUniformiv");
-	glGetnUniformuiv = (gl_getn_uniformuiv_func *)fgl__GetOpenGLProcAddress(state, "glGetnUniformuiv");
-	glReadnPixels = (gl_readn_pixels_func *)fgl__GetOpenGLProcAddress(state, "glReadnPixels");
-	glGetnMapdv = (gl_getn_mapdv_func *)fgl__GetOpenGLProcAddress(state, "glGetnMapdv");
-	glGetnMapfv = (gl_getn_mapfv_func *)fgl__GetOpenGLProcAddress(state, "glGetnMapfv");
-	glGetnMapiv = (gl_getn_mapiv_func *)fgl__GetOpenGLProcAddress(state, "glGetnMapiv");
-	glGetnPixelMapfv = (gl_getn_pixel_mapfv_func *)fgl__GetOpenGLProcAddress(state, "glGetnPixelMapfv");
-	glGetnPixelMapuiv = (gl_getn_pixel_mapuiv_func *)fgl__GetOpenGLProcAddress(state, "glGetnPixelMapuiv");
-	glGetnPixelMapusv = (gl_getn_pixel_mapusv_func *)fgl__GetOpenGLProcAddress(state, "glGetnPixelMapusv");
-	glGetnPolygonStipple = (gl_getn_polygon_stipple_func *)fgl__GetOpenGLProcAddress(state, "glGetnPolygonStipple");
-	glGetnColorTable = (gl_getn_color_table_func *)fgl__GetOpenGLProcAddress(state, "glGetnColorTable");
-	glGetnConvolutionFilter = (gl_getn_convolution_filter_func *)fgl__GetOpenGLProcAddress(state, "glGetnConvolutionFilter");
-	glGetnSeparableFilter = (gl_getn_separable_filter_func *)fgl__GetOpenGLProcAddress(state, "glGetnSeparableFilter");
-	glGetnHistogram = (gl_getn_histogram_func *)fgl__GetOpenGLProcAddress(state, "glGetnHistogram");
-	glGetnMinmax = (gl_getn_minmax_func *)fgl__GetOpenGLProcAddress(state, "glGetnMinmax");
-	glTextureBarrier = (gl_texture_barrier_func *)fgl__GetOpenGLProcAddress(state, "glTextureBarrier");
+	fgl__BeginOpenGLVersion(state, 45);
+	glClipControl = (gl_clip_control_func *)fgl__ResolveOpenGLProc(state, "glClipControl");
+	glCreateTransformFeedbacks = (gl_create_transform_feedbacks_func *)fgl__ResolveOpenGLProc(state, "glCreateTransformFeedbacks");
+	glTransformFeedbackBufferBase = (gl_transform_feedback_buffer_base_func *)fgl__ResolveOpenGLProc(state, "glTransformFeedbackBufferBase");
+	glTransformFeedbackBufferRange = (gl_transform_feedback_buffer_range_func *)fgl__ResolveOpenGLProc(state, "glTransformFeedbackBufferRange");
+	glGetTransformFeedbackiv = (gl_get_transform_feedbackiv_func *)fgl__ResolveOpenGLProc(state, "glGetTransformFeedbackiv");
+	glGetTransformFeedbacki_v = (gl_get_transform_feedbacki_v_func *)fgl__ResolveOpenGLProc(state, "glGetTransformFeedbacki_v");
+	glGetTransformFeedbacki64_v = (gl_get_transform_feedbacki64_v_func *)fgl__ResolveOpenGLProc(state, "glGetTransformFeedbacki64_v");
+	glCreateBuffers = (gl_create_buffers_func *)fgl__ResolveOpenGLProc(state, "glCreateBuffers");
+	glNamedBufferStorage = (gl_named_buffer_storage_func *)fgl__ResolveOpenGLProc(state, "glNamedBufferStorage");
+	glNamedBufferData = (gl_named_buffer_data_func *)fgl__ResolveOpenGLProc(state, "glNamedBufferData");
+	glNamedBufferSubData = (gl_named_buffer_sub_data_func *)fgl__ResolveOpenGLProc(state, "glNamedBufferSubData");
+	glCopyNamedBufferSubData = (gl_copy_named_buffer_sub_data_func *)fgl__ResolveOpenGLProc(state, "glCopyNamedBufferSubData");
+	glClearNamedBufferData = (gl_clear_named_buffer_data_func *)fgl__ResolveOpenGLProc(state, "glClearNamedBufferData");
+	glClearNamedBufferSubData = (gl_clear_named_buffer_sub_data_func *)fgl__ResolveOpenGLProc(state, "glClearNamedBufferSubData");
+	glMapNamedBuffer = (gl_map_named_buffer_func *)fgl__ResolveOpenGLProc(state, "glMapNamedBuffer");
+	glMapNamedBufferRange = (gl_map_named_buffer_range_func *)fgl__ResolveOpenGLProc(state, "glMapNamedBufferRange");
+	glUnmapNamedBuffer = (gl_unmap_named_buffer_func *)fgl__ResolveOpenGLProc(state, "glUnmapNamedBuffer");
+	glFlushMappedNamedBufferRange = (gl_flush_mapped_named_buffer_range_func *)fgl__ResolveOpenGLProc(state, "glFlushMappedNamedBufferRange");
+	glGetNamedBufferParameteriv = (gl_get_named_buffer_parameteriv_func *)fgl__ResolveOpenGLProc(state, "glGetNamedBufferParameteriv");
+	glGetNamedBufferParameteri64v = (gl_get_named_buffer_parameteri64v_func *)fgl__ResolveOpenGLProc(state, "glGetNamedBufferParameteri64v");
+	glGetNamedBufferPointerv = (gl_get_named_buffer_pointerv_func *)fgl__ResolveOpenGLProc(state, "glGetNamedBufferPointerv");
+	glGetNamedBufferSubData = (gl_get_named_buffer_sub_data_func *)fgl__ResolveOpenGLProc(state, "glGetNamedBufferSubData");
+	glCreateFramebuffers = (gl_create_framebuffers_func *)fgl__ResolveOpenGLProc(state, "glCreateFramebuffers");
+	glNamedFramebufferRenderbuffer = (gl_named_framebuffer_renderbuffer_func *)fgl__ResolveOpenGLProc(state, "glNamedFramebufferRenderbuffer");
+	glNamedFramebufferParameteri = (gl_named_framebuffer_parameteri_func *)fgl__ResolveOpenGLProc(state, "glNamedFramebufferParameteri");
+	glNamedFramebufferTexture = (gl_named_framebuffer_texture_func *)fgl__ResolveOpenGLProc(state, "glNamedFramebufferTexture");
+	glNamedFramebufferTextureLayer = (gl_named_framebuffer_texture_layer_func *)fgl__ResolveOpenGLProc(state, "glNamedFramebufferTextureLayer");
+	glNamedFramebufferDrawBuffer = (gl_named_framebuffer_draw_buffer_func *)fgl__ResolveOpenGLProc(state, "glNamedFramebufferDrawBuffer");
+	glNamedFramebufferDrawBuffers = (gl_named_framebuffer_draw_buffers_func *)fgl__ResolveOpenGLProc(state, "glNamedFramebufferDrawBuffers");
+	glNamedFramebufferReadBuffer = (gl_named_framebuffer_read_buffer_func *)fgl__ResolveOpenGLProc(state, "glNamedFramebufferReadBuffer");
+	glInvalidateNamedFramebufferData = (gl_invalidate_named_framebuffer_data_func *)fgl__ResolveOpenGLProc(state, "glInvalidateNamedFramebufferData");
+	glInvalidateNamedFramebufferSubData = (gl_invalidate_named_framebuffer_sub_data_func *)fgl__ResolveOpenGLProc(state, "glInvalidateNamedFramebufferSubData");
+	glClearNamedFramebufferiv = (gl_clear_named_framebufferiv_func *)fgl__ResolveOpenGLProc(state, "glClearNamedFramebufferiv");
+	glClearNamedFramebufferuiv = (gl_clear_named_framebufferuiv_func *)fgl__ResolveOpenGLProc(state, "glClearNamedFramebufferuiv");
+	glClearNamedFramebufferfv = (gl_clear_named_framebufferfv_func *)fgl__ResolveOpenGLProc(state, "glClearNamedFramebufferfv");
+	glClearNamedFramebufferfi = (gl_clear_named_framebufferfi_func *)fgl__ResolveOpenGLProc(state, "glClearNamedFramebufferfi");
+	glBlitNamedFramebuffer = (gl_blit_named_framebuffer_func *)fgl__ResolveOpenGLProc(state, "glBlitNamedFramebuffer");
+	glCheckNamedFramebufferStatus = (gl_check_named_framebuffer_status_func *)fgl__ResolveOpenGLProc(state, "glCheckNamedFramebufferStatus");
+	glGetNamedFramebufferParameteriv = (gl_get_named_framebuffer_parameteriv_func *)fgl__ResolveOpenGLProc(state, "glGetNamedFramebufferParameteriv");
+	glGetNamedFramebufferAttachmentParameteriv = (gl_get_named_framebuffer_attachment_parameteriv_func *)fgl__ResolveOpenGLProc(state, "glGetNamedFramebufferAttachmentParameteriv");
+	glCreateRenderbuffers = (gl_create_renderbuffers_func *)fgl__ResolveOpenGLProc(state, "glCreateRenderbuffers");
+	glNamedRenderbufferStorage = (gl_named_renderbuffer_storage_func *)fgl__ResolveOpenGLProc(state, "glNamedRenderbufferStorage");
+	glNamedRenderbufferStorageMultisample = (gl_named_renderbuffer_storage_multisample_func *)fgl__ResolveOpenGLProc(state, "glNamedRenderbufferStorageMultisample");
+	glGetNamedRenderbufferParameteriv = (gl_get_named_renderbuffer_parameteriv_func *)fgl__ResolveOpenGLProc(state, "glGetNamedRenderbufferParameteriv");
+	glCreateTextures = (gl_create_textures_func *)fgl__ResolveOpenGLProc(state, "glCreateTextures");
+	glTextureBuffer = (gl_texture_buffer_func *)fgl__ResolveOpenGLProc(state, "glTextureBuffer");
+	glTextureBufferRange = (gl_texture_buffer_range_func *)fgl__ResolveOpenGLProc(state, "glTextureBufferRange");
+	glTextureStorage1D = (gl_texture_storage1d_func *)fgl__ResolveOpenGLProc(state, "glTextureStorage1D");
+	glTextureStorage2D = (gl_texture_storage2d_func *)fgl__ResolveOpenGLProc(state, "glTextureStorage2D");
+	glTextureStorage3D = (gl_texture_storage3d_func *)fgl__ResolveOpenGLProc(state, "glTextureStorage3D");
+	glTextureStorage2DMultisample = (gl_texture_storage2_d_multisample_func *)fgl__ResolveOpenGLProc(state, "glTextureStorage2DMultisample");
+	glTextureStorage3DMultisample = (gl_texture_storage3_d_multisample_func *)fgl__ResolveOpenGLProc(state, "glTextureStorage3DMultisample");
+	glTextureSubImage1D = (gl_texture_sub_image1d_func *)fgl__ResolveOpenGLProc(state, "glTextureSubImage1D");
+	glTextureSubImage2D = (gl_texture_sub_image2d_func *)fgl__ResolveOpenGLProc(state, "glTextureSubImage2D");
+	glTextureSubImage3D = (gl_texture_sub_image3d_func *)fgl__ResolveOpenGLProc(state, "glTextureSubImage3D");
+	glCompressedTextureSubImage1D = (gl_compressed_texture_sub_image1d_func *)fgl__ResolveOpenGLProc(state, "glCompressedTextureSubImage1D");
+	glCompressedTextureSubImage2D = (gl_compressed_texture_sub_image2d_func *)fgl__ResolveOpenGLProc(state, "glCompressedTextureSubImage2D");
+	glCompressedTextureSubImage3D = (gl_compressed_texture_sub_image3d_func *)fgl__ResolveOpenGLProc(state, "glCompressedTextureSubImage3D");
+	glCopyTextureSubImage1D = (gl_copy_texture_sub_image1d_func *)fgl__ResolveOpenGLProc(state, "glCopyTextureSubImage1D");
+	glCopyTextureSubImage2D = (gl_copy_texture_sub_image2d_func *)fgl__ResolveOpenGLProc(state, "glCopyTextureSubImage2D");
+	glCopyTextureSubImage3D = (gl_copy_texture_sub_image3d_func *)fgl__ResolveOpenGLProc(state, "glCopyTextureSubImage3D");
+	glTextureParameterf = (gl_texture_parameterf_func *)fgl__ResolveOpenGLProc(state, "glTextureParameterf");
+	glTextureParameterfv = (gl_texture_parameterfv_func *)fgl__ResolveOpenGLProc(state, "glTextureParameterfv");
+	glTextureParameteri = (gl_texture_parameteri_func *)fgl__ResolveOpenGLProc(state, "glTextureParameteri");
+	glTextureParameterIiv = (gl_texture_parameter_iiv_func *)fgl__ResolveOpenGLProc(state, "glTextureParameterIiv");
+	glTextureParameterIuiv = (gl_texture_parameter_iuiv_func *)fgl__ResolveOpenGLProc(state, "glTextureParameterIuiv");
+	glTextureParameteriv = (gl_texture_parameteriv_func *)fgl__ResolveOpenGLProc(state, "glTextureParameteriv");
+	glGenerateTextureMipmap = (gl_generate_texture_mipmap_func *)fgl__ResolveOpenGLProc(state, "glGenerateTextureMipmap");
+	glBindTextureUnit = (gl_bind_texture_unit_func *)fgl__ResolveOpenGLProc(state, "glBindTextureUnit");
+	glGetTextureImage = (gl_get_texture_image_func *)fgl__ResolveOpenGLProc(state, "glGetTextureImage");
+	glGetCompressedTextureImage = (gl_get_compressed_texture_image_func *)fgl__ResolveOpenGLProc(state, "glGetCompressedTextureImage");
+	glGetTextureLevelParameterfv = (gl_get_texture_level_parameterfv_func *)fgl__ResolveOpenGLProc(state, "glGetTextureLevelParameterfv");
+	glGetTextureLevelParameteriv = (gl_get_texture_level_parameteriv_func *)fgl__ResolveOpenGLProc(state, "glGetTextureLevelParameteriv");
+	glGetTextureParameterfv = (gl_get_texture_parameterfv_func *)fgl__ResolveOpenGLProc(state, "glGetTextureParameterfv");
+	glGetTextureParameterIiv = (gl_get_texture_parameter_iiv_func *)fgl__ResolveOpenGLProc(state, "glGetTextureParameterIiv");
+	glGetTextureParameterIuiv = (gl_get_texture_parameter_iuiv_func *)fgl__ResolveOpenGLProc(state, "glGetTextureParameterIuiv");
+	glGetTextureParameteriv = (gl_get_texture_parameteriv_func *)fgl__ResolveOpenGLProc(state, "glGetTextureParameteriv");
+	glCreateVertexArrays = (gl_create_vertex_arrays_func *)fgl__ResolveOpenGLProc(state, "glCreateVertexArrays");
+	glDisableVertexArrayAttrib = (gl_disable_vertex_array_attrib_func *)fgl__ResolveOpenGLProc(state, "glDisableVertexArrayAttrib");
+	glEnableVertexArrayAttrib = (gl_enable_vertex_array_attrib_func *)fgl__ResolveOpenGLProc(state, "glEnableVertexArrayAttrib");
+	glVertexArrayElementBuffer = (gl_vertex_array_element_buffer_func *)fgl__ResolveOpenGLProc(state, "glVertexArrayElementBuffer");
+	glVertexArrayVertexBuffer = (gl_vertex_array_vertex_buffer_func *)fgl__ResolveOpenGLProc(state, "glVertexArrayVertexBuffer");
+	glVertexArrayVertexBuffers = (gl_vertex_array_vertex_buffers_func *)fgl__ResolveOpenGLProc(state, "glVertexArrayVertexBuffers");
+	glVertexArrayAttribBinding = (gl_vertex_array_attrib_binding_func *)fgl__ResolveOpenGLProc(state, "glVertexArrayAttribBinding");
+	glVertexArrayAttribFormat = (gl_vertex_array_attrib_format_func *)fgl__ResolveOpenGLProc(state, "glVertexArrayAttribFormat");
+	glVertexArrayAttribIFormat = (gl_vertex_array_attrib_i_format_func *)fgl__ResolveOpenGLProc(state, "glVertexArrayAttribIFormat");
+	glVertexArrayAttribLFormat = (gl_vertex_array_attrib_l_format_func *)fgl__ResolveOpenGLProc(state, "glVertexArrayAttribLFormat");
+	glVertexArrayBindingDivisor = (gl_vertex_array_binding_divisor_func *)fgl__ResolveOpenGLProc(state, "glVertexArrayBindingDivisor");
+	glGetVertexArrayiv = (gl_get_vertex_arrayiv_func *)fgl__ResolveOpenGLProc(state, "glGetVertexArrayiv");
+	glGetVertexArrayIndexediv = (gl_get_vertex_array_indexediv_func *)fgl__ResolveOpenGLProc(state, "glGetVertexArrayIndexediv");
+	glGetVertexArrayIndexed64iv = (gl_get_vertex_array_indexed64iv_func *)fgl__ResolveOpenGLProc(state, "glGetVertexArrayIndexed64iv");
+	glCreateSamplers = (gl_create_samplers_func *)fgl__ResolveOpenGLProc(state, "glCreateSamplers");
+	glCreateProgramPipelines = (gl_create_program_pipelines_func *)fgl__ResolveOpenGLProc(state, "glCreateProgramPipelines");
+	glCreateQueries = (gl_create_queries_func *)fgl__ResolveOpenGLProc(state, "glCreateQueries");
+	glGetQueryBufferObjecti64v = (gl_get_query_buffer_objecti64v_func *)fgl__ResolveOpenGLProc(state, "glGetQueryBufferObjecti64v");
+	glGetQueryBufferObjectiv = (gl_get_query_buffer_objectiv_func *)fgl__ResolveOpenGLProc(state, "glGetQueryBufferObjectiv");
+	glGetQueryBufferObjectui64v = (gl_get_query_buffer_objectui64v_func *)fgl__ResolveOpenGLProc(state, "glGetQueryBufferObjectui64v");
+	glGetQueryBufferObjectuiv = (gl_get_query_buffer_objectuiv_func *)fgl__ResolveOpenGLProc(state, "glGetQueryBufferObjectuiv");
+	glMemoryBarrierByRegion = (gl_memory_barrier_by_region_func *)fgl__ResolveOpenGLProc(state, "glMemoryBarrierByRegion");
+	glGetTextureSubImage = (gl_get_texture_sub_image_func *)fgl__ResolveOpenGLProc(state, "glGetTextureSubImage");
+	glGetCompressedTextureSubImage = (gl_get_compressed_texture_sub_image_func *)fgl__ResolveOpenGLProc(state, "glGetCompressedTextureSubImage");
+	glGetGraphicsResetStatus = (gl_get_graphics_reset_status_func *)fgl__ResolveOpenGLProc(state, "glGetGraphicsResetStatus");
+	glGetnCompressedTexImage = (gl_getn_compressed_tex_image_func *)fgl__ResolveOpenGLProc(state, "glGetnCompressedTexImage");
+	glGetnTexImage = (gl_getn_tex_image_func *)fgl__ResolveOpenGLProc(state, "glGetnTexImage");
+	glGetnUniformdv = (gl_getn_uniformdv_func *)fgl__ResolveOpenGLProc(state, "glGetnUniformdv");
+	glGetnUniformfv = (gl_getn_uniformfv_func *)fgl__ResolveOpenGLProc(state, "glGetnUniformfv");
+	glGetnUniformiv = (gl_getn_uniformiv_func *)fgl__ResolveOpenGLProc(state, "glGetnUniformiv");
+	glGetnUniformuiv = (gl_getn_uniformuiv_func *)fgl__ResolveOpenGLProc(state, "glGetnUniformuiv");
+	glReadnPixels = (gl_readn_pixels_func *)fgl__ResolveOpenGLProc(state, "glReadnPixels");
+	glGetnMapdv = (gl_getn_mapdv_func *)fgl__ResolveOpenGLProc(state, "glGetnMapdv");
+	glGetnMapfv = (gl_getn_mapfv_func *)fgl__ResolveOpenGLProc(state, "glGetnMapfv");
+	glGetnMapiv = (gl_getn_mapiv_func *)fgl__ResolveOpenGLProc(state, "glGetnMapiv");
+	glGetnPixelMapfv = (gl_getn_pixel_mapfv_func *)fgl__ResolveOpenGLProc(state, "glGetnPixelMapfv");
+	glGetnPixelMapuiv = (gl_getn_pixel_mapuiv_func *)fgl__ResolveOpenGLProc(state, "glGetnPixelMapuiv");
+	glGetnPixelMapusv = (gl_getn_pixel_mapusv_func *)fgl__ResolveOpenGLProc(state, "glGetnPixelMapusv");
+	glGetnPolygonStipple = (gl_getn_polygon_stipple_func *)fgl__ResolveOpenGLProc(state, "glGetnPolygonStipple");
+	glGetnColorTable = (gl_getn_color_table_func *)fgl__ResolveOpenGLProc(state, "glGetnColorTable");
+	glGetnConvolutionFilter = (gl_getn_convolution_filter_func *)fgl__ResolveOpenGLProc(state, "glGetnConvolutionFilter");
+	glGetnSeparableFilter = (gl_getn_separable_filter_func *)fgl__ResolveOpenGLProc(state, "glGetnSeparableFilter");
+	glGetnHistogram = (gl_getn_histogram_func *)fgl__ResolveOpenGLProc(state, "glGetnHistogram");
+	glGetnMinmax = (gl_getn_minmax_func *)fgl__ResolveOpenGLProc(state, "glGetnMinmax");
+	glTextureBarrier = (gl_texture_barrier_func *)fgl__ResolveOpenGLProc(state, "glTextureBarrier");
+	isGL_VERSION_4_5 = fgl__EndOpenGLVersion(state);
 #	endif //GL_VERSION_4_5
+
+#	if GL_VERSION_4_6
+	fgl__BeginOpenGLVersion(state, 46);
+	glSpecializeShader = (gl_specialize_shader_func *)fgl__ResolveOpenGLProc(state, "glSpecializeShader");
+	glMultiDrawArraysIndirectCount = (gl_multi_draw_arrays_indirect_count_func *)fgl__ResolveOpenGLProc(state, "glMultiDrawArraysIndirectCount");
+	glMultiDrawElementsIndirectCount = (gl_multi_draw_elements_indirect_count_func *)fgl__ResolveOpenGLProc(state, "glMultiDrawElementsIndirectCount");
+	glPolygonOffsetClamp = (gl_polygon_offset_clamp_func *)fgl__ResolveOpenGLProc(state, "glPolygonOffsetClamp");
+	isGL_VERSION_4_6 = fgl__EndOpenGLVersion(state);
+#	endif //GL_VERSION_4_6
 }
 
 static bool fgl__LoadOpenGL(fglOpenGLState *state) {
@@ -6085,13 +6259,44 @@ fdyngl_api void fglDestroyOpenGLContext(fglOpenGLContext *context) {
 	fgl__DestroyOpenGLContext(state, context);
 }
 
+static void fgl__LoadOpenGLFunctions(fglOpenGLState *state, uint32_t maxVersion) {
+	assert(state != fgl_null);
+	if(maxVersion == 0 || maxVersion > FGL_MAX_OPENGL_VERSION) {
+		maxVersion = FGL_MAX_OPENGL_VERSION;
+	}
+	fglOpenGLLoadStats *stats = &state->loadStats;
+	fgl__ClearMemory(stats, sizeof(*stats));
+	double startTime = fgl__GetTimeInMilliseconds();
+	stats->contextVersion = fgl__GetCurrentOpenGLVersion(state);
+	// Every version is visited, so flags and functions of a previous load with a higher version are cleared
+	state->loadMaxVersion = maxVersion;
+	fgl__LoadOpenGLExtensions(state);
+	stats->loadTimeMs = fgl__GetTimeInMilliseconds() - startTime;
+}
+
 fdyngl_api void fglLoadOpenGLFunctions() {
 	fglOpenGLState *state = &fgl__globalOpenGLState;
 	if(state->isLoaded) {
-		fgl__LoadOpenGLExtensions(state);
+		fgl__LoadOpenGLFunctions(state, FGL_MAX_OPENGL_VERSION);
+	}
+}
+
+fdyngl_api void fglLoadOpenGLFunctionsForVersion(const uint32_t majorVersion, const uint32_t minorVersion) {
+	fglOpenGLState *state = &fgl__globalOpenGLState;
+	if(state->isLoaded) {
+		uint32_t maxVersion = majorVersion * 10 + minorVersion;
+		if(maxVersion == 0) {
+			maxVersion = fgl__GetCurrentOpenGLVersion(state);
+		}
+		fgl__LoadOpenGLFunctions(state, maxVersion);
 	}
 }
 
+fdyngl_api const fglOpenGLLoadStats *fglGetOpenGLLoadStats() {
+	const fglOpenGLState *state = &fgl__globalOpenGLState;
+	return &state->loadStats;
+}
+
 fdyngl_api bool fglLoadOpenGL(const bool loadFunctions) {
 	fglOpenGLState *state = &fgl__globalOpenGLState;
 	if(!state->isLoaded) {
@@ -6101,7 +6306,7 @@ fdyngl_api bool fglLoadOpenGL(const bool loadFunctions) {
 		}
 	}
 	if(loadFunctions) {
-		fgl__LoadOpenGLExtensions(state);
+		fgl__LoadOpenGLFunctions(state, FGL_MAX_OPENGL_VERSION);
 	}
 	return true;
 }
@@ -223,6 +223,8 @@ SOFTWARE.
 	- Fixed: [POSIX/Win32] fplAtomicAddAndFetch* uses now addend parameter
 	- Fixed: [Linux] Previous gamepad state was not cleared before filling in the new state
 	- Fixed: [X11] Gamepad controller handling was broken
+	- Fixed: [GCC/Clang] fplCPUID, fplGetXCR0 and fplRDTSC always used the fallback, because the fpl__m_CPUID/fpl__m_GetXCR0/fpl__m_RDTSC macros were never defined
+	- Fixed: [Win32] fplFileMove converted the source path twice, so the file was never moved to the target path
 
 	- Changed: [POSIX] Use __sync_add_and_fetch instead of __sync_fetch_and_or in fplAtomicLoad*
 	- Changed: [POSIX/Win32] When a dynamic library failed to load, it will push on a warning instead of a error
@@ -8866,6 +8868,7 @@ fpl_internal void fpl__m_CPUID(fplCPUIDLeaf *outLeaf, const uint32_t functionId)
 	outLeaf->ecx = ecx;
 	outLeaf->edx = edx;
 }
+#		define fpl__m_CPUID fpl__m_CPUID
 
 		// XCR0 for GCC/CLANG
 fpl_internal uint64_t fpl__m_GetXCR0(void) {
@@ -8873,6 +8876,7 @@ fpl_internal uint64_t fpl__m_GetXCR0(void) {
 	__asm(".byte 0x0F, 0x01, 0xd0" : "=a"(eax), "=d"(edx) : "c"(0));
 	return eax;
 }
+#		define fpl__m_GetXCR0 fpl__m_GetXCR0
 
 		// RDTSC for non-MSVC
 #		if defined(FPL_ARCH_X86)
@@ -8889,6 +8893,9 @@ fpl_force_inline uint64_t fpl__m_RDTSC(void) {
 	return (result);
 }
 #		endif
+#		if defined(FPL_ARCH_X86) || defined(FPL_ARCH_X64)
+#			define fpl__m_RDTSC fpl__m_RDTSC
+#		endif
 #	endif
 
 fpl_common_api void fplCPUID(fplCPUIDLeaf *outLeaf, const uint32_t functionId) {
@@ -12180,7 +12187,7 @@ fpl_platform_api bool fplFileMove(const char *sourceFilePath, const char *target
 	wchar_t sourceFilePathWide[FPL_MAX_PATH_LENGTH];
 	wchar_t targetFilePathWide[FPL_MAX_PATH_LENGTH];
 	fplUTF8StringToWideString(sourceFilePath, fplGetStringLength(sourceFilePath), sourceFilePathWide, fplArrayCount(sourceFilePathWide));
-	fplUTF8StringToWideString(sourceFilePath, fplGetStringLength(sourceFilePath), targetFilePathWide, fplArrayCount(targetFilePathWide));
+	fplUTF8StringToWideString(targetFilePath, fplGetStringLength(targetFilePath), targetFilePathWide, fplArrayCount(targetFilePathWide));
 	bool result = (MoveFileW(sourceFilePathWide, targetFilePathWide) == TRUE);
 	return(result);
 }